@@ -0,0 +1,187 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file example_optiga_crypt_ecdsa_sign_batch.c
+ *
+ * \brief   This file provides the example and throughput benchmark for batch ECDSA Sign operation using
+ *          #optiga_crypt_ecdsa_sign_batch.
+ *
+ * \ingroup grOptigaExamples
+ *
+ * @{
+ */
+
+#include <stdio.h>
+
+#include "optiga_crypt.h"
+#include "optiga_example.h"
+#include "pal_os_memory.h"
+
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+extern void example_optiga_init(void);
+extern void example_optiga_deinit(void);
+#endif
+
+// Largest batch size of the benchmark
+#define EXAMPLE_SIGN_BATCH_MAX_SIZE (64U)
+// Size of the buffer to store a DER encoded NIST P-256 signature
+#define EXAMPLE_SIGN_BATCH_SIGNATURE_SIZE (80U)
+
+/**
+ * Callback when optiga_crypt_xxxx operation is completed asynchronously
+ */
+static volatile optiga_lib_status_t optiga_lib_status;
+// lint --e{818} suppress "argument "context" is not used in the sample provided"
+static void optiga_crypt_callback(void *context, optiga_lib_status_t return_status) {
+    optiga_lib_status = return_status;
+    if (NULL != context) {
+        // callback to upper layer here
+    }
+}
+
+/**
+ * Callback when an item of the batch is signed
+ */
+static volatile uint16_t signed_item_count;
+// lint --e{715} suppress "argument "item_index" is not used in the sample provided"
+static void
+optiga_crypt_batch_item_callback(void *context, uint16_t item_index, optiga_lib_status_t event) {
+    if (OPTIGA_LIB_SUCCESS == event) {
+        signed_item_count++;
+    }
+    if (NULL != context) {
+        // callback to upper layer here
+    }
+}
+
+// SHA-256 Digest to be signed, the first byte is replaced with the item index
+static uint8_t digests[EXAMPLE_SIGN_BATCH_MAX_SIZE][32];
+static const uint8_t *digest_pointers[EXAMPLE_SIGN_BATCH_MAX_SIZE];
+
+// To store the signatures generated
+static uint8_t signatures[EXAMPLE_SIGN_BATCH_MAX_SIZE][EXAMPLE_SIGN_BATCH_SIGNATURE_SIZE];
+static uint8_t *signature_pointers[EXAMPLE_SIGN_BATCH_MAX_SIZE];
+static uint16_t signature_lengths[EXAMPLE_SIGN_BATCH_MAX_SIZE];
+
+static const uint8_t digest[] = {
+    // Size of digest to be chosen based on Curve
+    0x61, 0xC7, 0xDE, 0xF9, 0x0F, 0xD5, 0xCD, 0x7A, 0x8B, 0x7A, 0x36, 0x41, 0x04, 0xE0, 0x0D, 0x82,
+    0x38, 0x46, 0xBF, 0xB7, 0x70, 0xEE, 0xBF, 0x8F, 0x40, 0x25, 0x2E, 0x0A, 0x21, 0x42, 0xAF, 0x9C,
+};
+
+/**
+ * The below example demonstrates the signing of a batch of digests using
+ * the Private key in OPTIGA Key store and measures the throughput for batch sizes 1 to 64.
+ *
+ * Example for #optiga_crypt_ecdsa_sign_batch
+ *
+ */
+void example_optiga_crypt_ecdsa_sign_batch(void) {
+    char_t benchmark_string[80];
+    uint32_t time_taken = 0;
+    uint16_t batch_size;
+    uint16_t item_index;
+    optiga_crypt_t *me = NULL;
+    optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+
+    do {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+        /**
+         * Open the application on OPTIGA which is a precondition to perform any other operations
+         * using optiga_util_open_application
+         */
+        example_optiga_init();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+        OPTIGA_EXAMPLE_LOG_MESSAGE(__FUNCTION__);
+
+        /**
+         * 1. Create OPTIGA Crypt Instance
+         */
+        me = optiga_crypt_create(0, optiga_crypt_callback, NULL);
+        if (NULL == me) {
+            break;
+        }
+
+        for (item_index = 0; item_index < EXAMPLE_SIGN_BATCH_MAX_SIZE; item_index++) {
+            pal_os_memcpy(digests[item_index], digest, sizeof(digest));
+            digests[item_index][0] = (uint8_t)item_index;
+            digest_pointers[item_index] = digests[item_index];
+            signature_pointers[item_index] = signatures[item_index];
+        }
+
+        /**
+         * 2. Sign batches of 1 to 64 digests using Private key from Key Store ID E0F0
+         */
+        for (batch_size = 1; batch_size <= EXAMPLE_SIGN_BATCH_MAX_SIZE; batch_size *= 2) {
+            for (item_index = 0; item_index < batch_size; item_index++) {
+                signature_lengths[item_index] = EXAMPLE_SIGN_BATCH_SIGNATURE_SIZE;
+            }
+            signed_item_count = 0;
+
+            START_PERFORMANCE_MEASUREMENT(time_taken);
+
+            optiga_lib_status = OPTIGA_LIB_BUSY;
+            return_status = optiga_crypt_ecdsa_sign_batch(
+                me,
+                digest_pointers,
+                sizeof(digest),
+                batch_size,
+                OPTIGA_KEY_ID_E0F0,
+                signature_pointers,
+                signature_lengths,
+                optiga_crypt_batch_item_callback
+            );
+
+            WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+
+            READ_PERFORMANCE_MEASUREMENT(time_taken);
+
+            if (batch_size != signed_item_count) {
+                return_status = OPTIGA_CRYPT_ERROR;
+                break;
+            }
+            sprintf(
+                benchmark_string,
+                "Batch of %d signatures takes %d msec, %d signatures/sec",
+                (int)batch_size,
+                (int)time_taken,
+                (int)((0U != time_taken) ? ((batch_size * 1000U) / time_taken) : 0U)
+            );
+            OPTIGA_EXAMPLE_LOG_MESSAGE(benchmark_string);
+        }
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+
+        return_status = OPTIGA_LIB_SUCCESS;
+
+    } while (FALSE);
+    OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    /**
+     * Close the application on OPTIGA after all the operations are executed
+     * using optiga_util_close_application
+     */
+    example_optiga_deinit();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+    if (me) {
+        // Destroy the instance after the completion of usecase if not required.
+        return_status = optiga_crypt_destroy(me);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            // lint --e{774} suppress This is a generic macro
+            OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+        }
+    }
+}
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_ENABLED && OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+/**
+ * @}
+ */
@@ -0,0 +1,188 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file example_optiga_crypt_hash_stream.c
+ *
+ * \brief   This file provides the example and throughput benchmark for hashing a large data stream using
+ *          #optiga_crypt_hash_stream.
+ *
+ * \ingroup grOptigaExamples
+ *
+ * @{
+ */
+
+#include <stdio.h>
+
+#include "optiga_crypt.h"
+#include "optiga_example.h"
+#include "pal_os_memory.h"
+
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+extern void example_optiga_init(void);
+extern void example_optiga_deinit(void);
+#endif
+
+// Length of the data image to be hashed
+#define EXAMPLE_HASH_STREAM_IMAGE_SIZE (16384U)
+
+/**
+ * Callback when optiga_crypt_xxxx operation is completed asynchronously
+ */
+static volatile optiga_lib_status_t optiga_lib_status;
+// lint --e{818} suppress "argument "context" is not used in the sample provided"
+static void optiga_crypt_callback(void *context, optiga_lib_status_t return_status) {
+    optiga_lib_status = return_status;
+    if (NULL != context) {
+        // callback to upper layer here
+    }
+}
+
+/**
+ * Reader context over a data image in memory, for example a firmware image or a memory mapped file
+ */
+typedef struct example_hash_stream_reader {
+    const uint8_t *p_image;
+    uint32_t image_length;
+    uint32_t offset;
+} example_hash_stream_reader_t;
+
+// Data image to be hashed
+static uint8_t image[EXAMPLE_HASH_STREAM_IMAGE_SIZE];
+// Buffer to read the next fragment into, while OPTIGA hashes the current fragment
+static uint8_t stream_buffer[OPTIGA_MAX_COMMS_BUFFER_SIZE];
+// Number of fragments hashed by OPTIGA
+static volatile uint16_t hashed_fragment_count;
+
+/**
+ * Reads the next part of the data image
+ */
+static optiga_lib_status_t example_hash_stream_read(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    example_hash_stream_reader_t *p_reader = (example_hash_stream_reader_t *)callback_ctx;
+    uint32_t remaining_length = p_reader->image_length - p_reader->offset;
+
+    *p_read_length = (remaining_length > buffer_length) ? buffer_length : (uint16_t)remaining_length;
+    pal_os_memcpy(p_buffer, &p_reader->p_image[p_reader->offset], *p_read_length);
+    p_reader->offset += *p_read_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * Progress of the hash calculation
+ */
+// lint --e{715} suppress "arguments are not used in the sample provided"
+static void
+example_hash_stream_progress(void *callback_ctx, uint32_t hashed_length, uint32_t total_length) {
+    hashed_fragment_count++;
+    if (NULL != callback_ctx) {
+        // report hashed_length of total_length to upper layer here
+    }
+}
+
+/**
+ * The below example demonstrates the generation of digest of a large data image which is read
+ * fragment by fragment, while OPTIGA hashes the previous fragment.
+ *
+ * Example for #optiga_crypt_hash_stream
+ *
+ */
+void example_optiga_crypt_hash_stream(void) {
+    char_t benchmark_string[80];
+    uint32_t time_taken = 0;
+    uint32_t index;
+    optiga_crypt_t *me = NULL;
+    optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+    uint8_t digest[32];
+    example_hash_stream_reader_t reader;
+    hash_data_stream_t hash_stream;
+
+    do {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+        /**
+         * Open the application on OPTIGA which is a precondition to perform any other operations
+         * using optiga_util_open_application
+         */
+        example_optiga_init();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+        OPTIGA_EXAMPLE_LOG_MESSAGE(__FUNCTION__);
+
+        /**
+         * 1. Create OPTIGA Crypt Instance
+         */
+        me = optiga_crypt_create(0, optiga_crypt_callback, NULL);
+        if (NULL == me) {
+            break;
+        }
+
+        for (index = 0; index < sizeof(image); index++) {
+            image[index] = (uint8_t)index;
+        }
+        reader.p_image = image;
+        reader.image_length = sizeof(image);
+        reader.offset = 0;
+
+        hash_stream.reader = example_hash_stream_read;
+        hash_stream.progress_handler = example_hash_stream_progress;
+        hash_stream.p_stream_ctx = &reader;
+        hash_stream.length = sizeof(image);
+        hash_stream.p_buffer = stream_buffer;
+        hash_stream.buffer_length = sizeof(stream_buffer);
+        hashed_fragment_count = 0;
+
+        /**
+         * 2. Hash the data image using SHA256
+         */
+        START_PERFORMANCE_MEASUREMENT(time_taken);
+
+        optiga_lib_status = OPTIGA_LIB_BUSY;
+        return_status = optiga_crypt_hash_stream(me, OPTIGA_HASH_TYPE_SHA_256, &hash_stream, digest);
+
+        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+
+        READ_PERFORMANCE_MEASUREMENT(time_taken);
+
+        sprintf(
+            benchmark_string,
+            "Hashing %d bytes in %d fragments takes %d msec",
+            (int)sizeof(image),
+            (int)hashed_fragment_count,
+            (int)time_taken
+        );
+        OPTIGA_EXAMPLE_LOG_MESSAGE(benchmark_string);
+
+        return_status = OPTIGA_LIB_SUCCESS;
+
+    } while (FALSE);
+    OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    /**
+     * Close the application on OPTIGA after all the operations are executed
+     * using optiga_util_close_application
+     */
+    example_optiga_deinit();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+    if (me) {
+        // Destroy the instance after the completion of usecase if not required.
+        return_status = optiga_crypt_destroy(me);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            // lint --e{774} suppress This is a generic macro
+            OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+        }
+    }
+}
+#endif  // OPTIGA_CRYPT_HASH_ENABLED && OPTIGA_CRYPT_HASH_STREAM_ENABLED
+/**
+ * @}
+ */
@@ -7,16 +7,20 @@
  * \file example_optiga_crypt_hmac.c
  *
  * \brief   This file provides the example for HMAC generation  using
- *          optiga_crypt_hmac_start, optiga_crypt_hmac_update and optiga_crypt_hmac_finalize APIs.
+ *          optiga_crypt_hmac_start, optiga_crypt_hmac_update and optiga_crypt_hmac_finalize APIs,
+ *          and for HMAC generation over a large data stream using optiga_crypt_hmac_stream.
  *
  * \ingroup grOptigaExamples
  *
  * @{
  */
 
+#include <stdio.h>
+
 #include "optiga_crypt.h"
 #include "optiga_example.h"
 #include "optiga_util.h"
+#include "pal_os_memory.h"
 
 #if defined OPTIGA_CRYPT_HMAC_ENABLED
 
@@ -286,6 +290,190 @@ void example_optiga_crypt_hmac(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+// Length of the data image to be authenticated
+#define EXAMPLE_HMAC_STREAM_IMAGE_SIZE (16384U)
+
+/**
+ * Reader context over a data image in memory, for example a firmware image or a memory mapped file
+ */
+typedef struct example_hmac_stream_ctx {
+    const uint8_t *p_image;
+    uint32_t image_length;
+    uint32_t offset;
+    uint8_t *p_mac;
+    uint16_t mac_length;
+    uint32_t bytes_per_second;
+} example_hmac_stream_ctx_t;
+
+// Data image to be authenticated
+static uint8_t hmac_image[EXAMPLE_HMAC_STREAM_IMAGE_SIZE];
+// Buffer to read the next fragment into, while OPTIGA processes the current fragment
+static uint8_t hmac_stream_buffer[OPTIGA_MAX_COMMS_BUFFER_SIZE];
+
+/**
+ * Reads the next part of the data image
+ */
+static optiga_lib_status_t example_hmac_stream_read(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    example_hmac_stream_ctx_t *p_ctx = (example_hmac_stream_ctx_t *)callback_ctx;
+    uint32_t remaining_length = p_ctx->image_length - p_ctx->offset;
+
+    *p_read_length = (remaining_length > buffer_length) ? buffer_length : (uint16_t)remaining_length;
+    pal_os_memcpy(p_buffer, &p_ctx->p_image[p_ctx->offset], *p_read_length);
+    p_ctx->offset += *p_read_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * Stores the generated MAC
+ */
+static optiga_lib_status_t
+example_hmac_stream_write(void *callback_ctx, const uint8_t *p_data, uint16_t data_length) {
+    example_hmac_stream_ctx_t *p_ctx = (example_hmac_stream_ctx_t *)callback_ctx;
+
+    if (data_length > p_ctx->mac_length) {
+        return OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+    }
+    pal_os_memcpy(p_ctx->p_mac, p_data, data_length);
+    p_ctx->mac_length = data_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * Throughput of the HMAC generation
+ */
+// lint --e{715} suppress "arguments are not used in the sample provided"
+static void example_hmac_stream_progress(
+    void *callback_ctx,
+    uint32_t processed_length,
+    uint32_t total_length,
+    uint32_t bytes_per_second
+) {
+    ((example_hmac_stream_ctx_t *)callback_ctx)->bytes_per_second = bytes_per_second;
+}
+
+/**
+ * The below example demonstrates HMAC-SHA256 generation over a large data image using OPTIGA.
+ * The image is read fragment by fragment while OPTIGA processes the previous fragment.
+ *
+ * Example for #optiga_crypt_hmac_stream
+ */
+void example_optiga_crypt_hmac_stream(void) {
+    uint8_t mac_buffer[32] = {0};
+    char_t benchmark_string[80];
+    uint32_t time_taken = 0;
+    uint32_t index;
+    optiga_crypt_t *me_crypt = NULL;
+    optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+    example_hmac_stream_ctx_t stream_ctx;
+    symmetric_data_stream_t sym_stream;
+
+    do {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+        /**
+         * Open the application on OPTIGA which is a precondition to perform any other operations
+         * using optiga_util_open_application
+         */
+        example_optiga_init();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+        OPTIGA_EXAMPLE_LOG_MESSAGE(__FUNCTION__);
+
+        /**
+         * 1. Create OPTIGA Crypt Instance
+         *
+         */
+        me_crypt = optiga_crypt_create(0, optiga_util_crypt_callback, NULL);
+        if (NULL == me_crypt) {
+            break;
+        }
+
+        /**
+         * 2. Update input secret in 0xF1D0
+         *
+         */
+        return_status = write_input_secret_to_oid();
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            // Update of secret failed
+            break;
+        }
+
+        for (index = 0; index < sizeof(hmac_image); index++) {
+            hmac_image[index] = (uint8_t)index;
+        }
+        stream_ctx.p_image = hmac_image;
+        stream_ctx.image_length = sizeof(hmac_image);
+        stream_ctx.offset = 0;
+        stream_ctx.p_mac = mac_buffer;
+        stream_ctx.mac_length = sizeof(mac_buffer);
+        stream_ctx.bytes_per_second = 0;
+
+        sym_stream.reader = example_hmac_stream_read;
+        sym_stream.writer = example_hmac_stream_write;
+        sym_stream.progress_handler = example_hmac_stream_progress;
+        sym_stream.p_stream_ctx = &stream_ctx;
+        sym_stream.length = sizeof(hmac_image);
+        sym_stream.p_buffer = hmac_stream_buffer;
+        sym_stream.buffer_length = sizeof(hmac_stream_buffer);
+        sym_stream.padding = FALSE;
+
+        /**
+         * 3. Generate HMAC over the data image
+         */
+        optiga_lib_status = OPTIGA_LIB_BUSY;
+
+        START_PERFORMANCE_MEASUREMENT(time_taken);
+
+        return_status =
+            optiga_crypt_hmac_stream(me_crypt, OPTIGA_HMAC_SHA_256, 0xF1D0, &sym_stream);
+
+        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+
+        READ_PERFORMANCE_MEASUREMENT(time_taken);
+
+        sprintf(
+            benchmark_string,
+            "HMAC of %d bytes takes %d msec (%d bytes/s)",
+            (int)sizeof(hmac_image),
+            (int)time_taken,
+            (int)stream_ctx.bytes_per_second
+        );
+        OPTIGA_EXAMPLE_LOG_MESSAGE(benchmark_string);
+
+        if (sizeof(mac_buffer) != stream_ctx.mac_length) {
+            // MAC length is incorrect
+            return_status = !OPTIGA_LIB_SUCCESS;
+            break;
+        }
+        return_status = OPTIGA_LIB_SUCCESS;
+
+    } while (FALSE);
+    OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    /**
+     * Close the application on OPTIGA after all the operations are executed
+     * using optiga_util_close_application
+     */
+    example_optiga_deinit();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+    if (me_crypt) {
+        // Destroy the instance after the completion of usecase if not required.
+        return_status = optiga_crypt_destroy(me_crypt);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            // lint --e{774} suppress This is a generic macro
+            OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+        }
+    }
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
+
 #endif  // OPTIGA_CRYPT_HMAC_ENABLED
 /**
  * @}
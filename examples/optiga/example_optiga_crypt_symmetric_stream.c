@@ -0,0 +1,307 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file example_optiga_crypt_symmetric_stream.c
+ *
+ * \brief   This file provides the example and throughput benchmark for encrypting and decrypting a large data
+ *          stream using #optiga_crypt_symmetric_encrypt_stream and #optiga_crypt_symmetric_decrypt_stream.
+ *
+ * \ingroup grOptigaExamples
+ *
+ * @{
+ */
+
+#include <stdio.h>
+
+#include "optiga_crypt.h"
+#include "optiga_example.h"
+#include "pal_os_memory.h"
+
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+extern void example_optiga_init(void);
+extern void example_optiga_deinit(void);
+#endif
+
+extern optiga_lib_status_t generate_symmetric_key(void);
+
+// Length of the data image to be encrypted
+#define EXAMPLE_SYM_STREAM_IMAGE_SIZE (16000U)
+// Length of the encrypted image, including the PKCS#7 padding
+#define EXAMPLE_SYM_STREAM_ENCRYPTED_IMAGE_SIZE (EXAMPLE_SYM_STREAM_IMAGE_SIZE + 16U)
+
+/**
+ * Callback when optiga_crypt_xxxx operation is completed asynchronously
+ */
+static volatile optiga_lib_status_t optiga_lib_status;
+// lint --e{818} suppress "argument "context" is not used in the sample provided"
+static void optiga_crypt_callback(void *context, optiga_lib_status_t return_status) {
+    optiga_lib_status = return_status;
+    if (NULL != context) {
+        // callback to upper layer here
+    }
+}
+
+/**
+ * Reader and writer context over data images in memory, for example memory mapped files
+ */
+typedef struct example_sym_stream_ctx {
+    const uint8_t *p_input;
+    uint32_t input_length;
+    uint32_t input_offset;
+    uint8_t *p_output;
+    uint32_t output_size;
+    uint32_t output_length;
+    uint32_t bytes_per_second;
+} example_sym_stream_ctx_t;
+
+// Data image to be encrypted
+static uint8_t image[EXAMPLE_SYM_STREAM_IMAGE_SIZE];
+// Encrypted data image
+static uint8_t encrypted_image[EXAMPLE_SYM_STREAM_ENCRYPTED_IMAGE_SIZE];
+// Decrypted data image
+static uint8_t decrypted_image[EXAMPLE_SYM_STREAM_IMAGE_SIZE];
+// Buffer to read the next fragment into, while OPTIGA processes the current fragment
+static uint8_t stream_buffer[OPTIGA_MAX_COMMS_BUFFER_SIZE];
+
+/**
+ * Reads the next part of the input image
+ */
+static optiga_lib_status_t example_sym_stream_read(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    example_sym_stream_ctx_t *p_ctx = (example_sym_stream_ctx_t *)callback_ctx;
+    uint32_t remaining_length = p_ctx->input_length - p_ctx->input_offset;
+
+    *p_read_length = (remaining_length > buffer_length) ? buffer_length : (uint16_t)remaining_length;
+    pal_os_memcpy(p_buffer, &p_ctx->p_input[p_ctx->input_offset], *p_read_length);
+    p_ctx->input_offset += *p_read_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * Appends the output of OPTIGA to the output image
+ */
+static optiga_lib_status_t
+example_sym_stream_write(void *callback_ctx, const uint8_t *p_data, uint16_t data_length) {
+    example_sym_stream_ctx_t *p_ctx = (example_sym_stream_ctx_t *)callback_ctx;
+
+    if ((p_ctx->output_length + data_length) > p_ctx->output_size) {
+        return OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+    }
+    pal_os_memcpy(&p_ctx->p_output[p_ctx->output_length], p_data, data_length);
+    p_ctx->output_length += data_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+/**
+ * Progress and throughput of the symmetric operation
+ */
+// lint --e{715} suppress "arguments are not used in the sample provided"
+static void example_sym_stream_progress(
+    void *callback_ctx,
+    uint32_t processed_length,
+    uint32_t total_length,
+    uint32_t bytes_per_second
+) {
+    ((example_sym_stream_ctx_t *)callback_ctx)->bytes_per_second = bytes_per_second;
+}
+
+static void example_sym_stream_init(
+    example_sym_stream_ctx_t *p_ctx,
+    symmetric_data_stream_t *p_sym_stream,
+    const uint8_t *p_input,
+    uint32_t input_length,
+    uint8_t *p_output,
+    uint32_t output_size
+) {
+    p_ctx->p_input = p_input;
+    p_ctx->input_length = input_length;
+    p_ctx->input_offset = 0;
+    p_ctx->p_output = p_output;
+    p_ctx->output_size = output_size;
+    p_ctx->output_length = 0;
+    p_ctx->bytes_per_second = 0;
+
+    p_sym_stream->reader = example_sym_stream_read;
+    p_sym_stream->writer = example_sym_stream_write;
+    p_sym_stream->progress_handler = example_sym_stream_progress;
+    p_sym_stream->p_stream_ctx = p_ctx;
+    p_sym_stream->length = input_length;
+    p_sym_stream->p_buffer = stream_buffer;
+    p_sym_stream->buffer_length = sizeof(stream_buffer);
+    p_sym_stream->padding = TRUE;
+}
+
+/**
+ * The below example demonstrates the symmetric encryption and decryption of a large data image in CBC mode
+ * with PKCS#7 padding, which is read fragment by fragment while OPTIGA processes the previous fragment.
+ *
+ * Example for #optiga_crypt_symmetric_encrypt_stream and #optiga_crypt_symmetric_decrypt_stream
+ *
+ */
+void example_optiga_crypt_symmetric_stream(void) {
+    const uint8_t iv[16] = {
+        0x00,
+        0x01,
+        0x02,
+        0x03,
+        0x04,
+        0x05,
+        0x06,
+        0x07,
+        0x08,
+        0x09,
+        0x0A,
+        0x0B,
+        0x0C,
+        0x0D,
+        0x0E,
+        0x0F};
+    char_t benchmark_string[80];
+    uint32_t time_taken = 0;
+    uint32_t index;
+    optiga_crypt_t *me = NULL;
+    optiga_lib_status_t return_status = !OPTIGA_LIB_SUCCESS;
+    example_sym_stream_ctx_t stream_ctx;
+    symmetric_data_stream_t sym_stream;
+
+    do {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+        /**
+         * Open the application on OPTIGA which is a precondition to perform any other operations
+         * using optiga_util_open_application
+         */
+        example_optiga_init();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+        OPTIGA_EXAMPLE_LOG_MESSAGE(__FUNCTION__);
+
+        /**
+         * 1. Create OPTIGA Crypt Instance
+         */
+        me = optiga_crypt_create(0, optiga_crypt_callback, NULL);
+        if (NULL == me) {
+            break;
+        }
+
+        /**
+         * 2. Update AES 128 symmetric key using secure key update
+         */
+        OPTIGA_EXAMPLE_LOG_MESSAGE("Symmetric key generation");
+        return_status = generate_symmetric_key();
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            break;
+        }
+
+        for (index = 0; index < sizeof(image); index++) {
+            image[index] = (uint8_t)index;
+        }
+
+        /**
+         * 3. Encrypt the data image with CBC mode and PKCS#7 padding
+         */
+        example_sym_stream_init(
+            &stream_ctx,
+            &sym_stream,
+            image,
+            sizeof(image),
+            encrypted_image,
+            sizeof(encrypted_image)
+        );
+
+        START_PERFORMANCE_MEASUREMENT(time_taken);
+
+        optiga_lib_status = OPTIGA_LIB_BUSY;
+        return_status = optiga_crypt_symmetric_encrypt_stream(
+            me,
+            OPTIGA_SYMMETRIC_CBC,
+            OPTIGA_KEY_ID_SECRET_BASED,
+            iv,
+            sizeof(iv),
+            &sym_stream
+        );
+
+        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+
+        READ_PERFORMANCE_MEASUREMENT(time_taken);
+
+        sprintf(
+            benchmark_string,
+            "Encrypting %d bytes takes %d msec (%d bytes/s)",
+            (int)sizeof(image),
+            (int)time_taken,
+            (int)stream_ctx.bytes_per_second
+        );
+        OPTIGA_EXAMPLE_LOG_MESSAGE(benchmark_string);
+
+        if (sizeof(encrypted_image) != stream_ctx.output_length) {
+            // Encrypted data length is incorrect
+            return_status = !OPTIGA_LIB_SUCCESS;
+            break;
+        }
+
+        /**
+         * 4. Decrypt the encrypted image from step 3 and remove the padding
+         */
+        example_sym_stream_init(
+            &stream_ctx,
+            &sym_stream,
+            encrypted_image,
+            sizeof(encrypted_image),
+            decrypted_image,
+            sizeof(decrypted_image)
+        );
+
+        optiga_lib_status = OPTIGA_LIB_BUSY;
+        return_status = optiga_crypt_symmetric_decrypt_stream(
+            me,
+            OPTIGA_SYMMETRIC_CBC,
+            OPTIGA_KEY_ID_SECRET_BASED,
+            iv,
+            sizeof(iv),
+            &sym_stream
+        );
+
+        WAIT_AND_CHECK_STATUS(return_status, optiga_lib_status);
+
+        // Compare the decrypted image with the data image
+        if ((sizeof(image) != stream_ctx.output_length)
+            || (0 != memcmp(decrypted_image, image, sizeof(image)))) {
+            return_status = !OPTIGA_LIB_SUCCESS;
+            break;
+        }
+        return_status = OPTIGA_LIB_SUCCESS;
+
+    } while (FALSE);
+    OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    /**
+     * Close the application on OPTIGA after all the operations are executed
+     * using optiga_util_close_application
+     */
+    example_optiga_deinit();
+#endif  // OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+
+    if (me) {
+        // Destroy the instance after the completion of usecase if not required.
+        return_status = optiga_crypt_destroy(me);
+        if (OPTIGA_LIB_SUCCESS != return_status) {
+            // lint --e{774} suppress This is a generic macro
+            OPTIGA_EXAMPLE_LOG_STATUS(return_status);
+        }
+    }
+}
+#endif  // OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED && OPTIGA_CRYPT_SYM_DECRYPT_ENABLED && OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/**
+ * @}
+ */
@@ -38,6 +38,7 @@ extern optiga_lib_status_t pair_host_and_optiga_using_pre_shared_secret(void);
 extern void example_optiga_crypt_hash(void);
 extern void example_optiga_crypt_ecc_generate_keypair(void);
 extern void example_optiga_crypt_ecdsa_sign(void);
+extern void example_optiga_crypt_ecdsa_sign_batch(void);
 extern void example_optiga_crypt_ecdsa_verify(void);
 extern void example_optiga_crypt_ecdh(void);
 extern void example_optiga_crypt_random(void);
@@ -55,6 +56,7 @@ extern void example_optiga_util_update_count(void);
 extern void example_optiga_util_protected_update(void);
 extern void example_read_coprocessor_id(void);
 extern void example_optiga_crypt_hash_data(void);
+extern void example_optiga_crypt_hash_stream(void);
 #ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
 extern void example_pair_host_and_optiga_using_pre_shared_secret(void);
 #endif
@@ -62,7 +64,9 @@ extern void example_optiga_util_hibernate_restore(void);
 extern void example_optiga_crypt_symmetric_encrypt_decrypt_ecb(void);
 extern void example_optiga_crypt_symmetric_encrypt_decrypt_cbc(void);
 extern void example_optiga_crypt_symmetric_encrypt_cbcmac(void);
+extern void example_optiga_crypt_symmetric_stream(void);
 extern void example_optiga_crypt_hmac(void);
+extern void example_optiga_crypt_hmac_stream(void);
 extern void example_optiga_crypt_hkdf(void);
 extern void example_optiga_crypt_symmetric_generate_key(void);
 extern void example_optiga_hmac_verify_with_authorization_reference(void);
@@ -345,6 +349,20 @@ static void optiga_shell_crypt_hash_data(void) {
 }
 #endif
 
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+static void optiga_shell_crypt_hash_stream(void) {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("Initializing OPTIGA for example demonstration...");
+#endif
+    OPTIGA_SHELL_LOG_MESSAGE("Starting streamed hash throughput example");
+    OPTIGA_SHELL_LOG_MESSAGE("1 Step: Generate hash of a data image read fragment by fragment");
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("2 Step: Close the application on OPTIGA");
+#endif
+    example_optiga_crypt_hash_stream();
+}
+#endif
+
 #ifdef OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
 static void optiga_shell_crypt_tls_prf_sha256(void) {
 #ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
@@ -429,6 +447,20 @@ static void optiga_shell_crypt_ecdsa_sign(void) {
 }
 #endif
 
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+static void optiga_shell_crypt_ecdsa_sign_batch(void) {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("Initializing OPTIGA for example demonstration...");
+#endif
+    OPTIGA_SHELL_LOG_MESSAGE("Starting batch signing throughput example for ECDSA");
+    OPTIGA_SHELL_LOG_MESSAGE("1 Step: Sign batches of 1 to 64 digests and export the signatures");
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("2 Step: Close the application on OPTIGA");
+#endif
+    example_optiga_crypt_ecdsa_sign_batch();
+}
+#endif
+
 #ifdef OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
 static void optiga_shell_crypt_ecdsa_verify(void) {
 #ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
@@ -615,6 +647,25 @@ static void optiga_shell_crypt_symmetric_encrypt_cbcmac(void) {
 }
 #endif
 
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+static void optiga_shell_crypt_symmetric_stream(void) {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("Initializing OPTIGA for example demonstration...");
+#endif
+    OPTIGA_SHELL_LOG_MESSAGE("Starting streamed symmetric Encrypt and Decrypt throughput example");
+    OPTIGA_SHELL_LOG_MESSAGE(
+        "1 Step: Generate and store the AES 128 Symmetric key in OPTIGA Key store OID(E200)"
+    );
+    OPTIGA_SHELL_LOG_MESSAGE("2 Step: Encrypt a data image read fragment by fragment with CBC mode");
+    OPTIGA_SHELL_LOG_MESSAGE("3 Step: Decrypt the encrypted image from step 2");
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("4 Step: Close the application on OPTIGA");
+#endif
+    example_optiga_crypt_symmetric_stream();
+}
+#endif
+
 #ifdef OPTIGA_CRYPT_HMAC_ENABLED
 static void optiga_shell_crypt_hmac(void) {
 #ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
@@ -632,6 +683,23 @@ static void optiga_shell_crypt_hmac(void) {
 }
 #endif
 
+#if defined(OPTIGA_CRYPT_HMAC_ENABLED) && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+static void optiga_shell_crypt_hmac_stream(void) {
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("Initializing OPTIGA for example demonstration...");
+#endif
+    OPTIGA_SHELL_LOG_MESSAGE("Starting streamed HMAC-SHA256 throughput example");
+    OPTIGA_SHELL_LOG_MESSAGE(
+        "1 Step: Change metadata for OID(0xF1D0) as Execute access condition = Always and Data object type  =  Pre-shared secret"
+    );
+    OPTIGA_SHELL_LOG_MESSAGE("2 Step: Generate HMAC of a data image read fragment by fragment");
+#ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
+    OPTIGA_SHELL_LOG_MESSAGE("3 Step: Close the application on OPTIGA");
+#endif
+    example_optiga_crypt_hmac_stream();
+}
+#endif
+
 #ifdef OPTIGA_CRYPT_HKDF_ENABLED
 static void optiga_shell_crypt_hkdf(void) {
 #ifndef OPTIGA_INIT_DEINIT_DONE_EXCLUSIVELY
@@ -727,6 +795,9 @@ static void optiga_shell_selftest(void) {
     run_example(optiga_shell_crypt_hash);
     run_example(optiga_shell_crypt_hash_data);
 #endif
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+    run_example(optiga_shell_crypt_hash_stream);
+#endif
 #ifdef OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
     run_example(optiga_shell_crypt_tls_prf_sha256);
 #endif
@@ -739,6 +810,9 @@ static void optiga_shell_selftest(void) {
 #ifdef OPTIGA_CRYPT_ECDSA_SIGN_ENABLED
     run_example(optiga_shell_crypt_ecdsa_sign);
 #endif
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+    run_example(optiga_shell_crypt_ecdsa_sign_batch);
+#endif
 #ifdef OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
     run_example(optiga_shell_crypt_ecdsa_verify);
 #endif
@@ -767,9 +841,16 @@ static void optiga_shell_selftest(void) {
     run_example(optiga_shell_crypt_symmetric_encrypt_decrypt_cbc);
     run_example(optiga_shell_crypt_symmetric_encrypt_cbcmac);
 #endif
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+    run_example(optiga_shell_crypt_symmetric_stream);
+#endif
 #ifdef OPTIGA_CRYPT_HMAC_ENABLED
     run_example(optiga_shell_crypt_hmac);
 #endif
+#if defined(OPTIGA_CRYPT_HMAC_ENABLED) && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+    run_example(optiga_shell_crypt_hmac_stream);
+#endif
 #ifdef OPTIGA_CRYPT_HKDF_ENABLED
     run_example(optiga_shell_crypt_hkdf);
 #endif
@@ -827,6 +908,11 @@ optiga_example_cmd_t optiga_cmds[] = {
      "hashsha256",
      optiga_shell_crypt_hash_data},
 #endif
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+    {"    hash of data stream                      : optiga --",
+     "hashstream",
+     optiga_shell_crypt_hash_stream},
+#endif
 #ifdef OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
     {"    tls prf sha256                           : optiga --",
      "prf",
@@ -847,6 +933,11 @@ optiga_example_cmd_t optiga_cmds[] = {
      "ecdsasign",
      optiga_shell_crypt_ecdsa_sign},
 #endif
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+    {"    ecdsa batch sign throughput              : optiga --",
+     "ecdsasignbatch",
+     optiga_shell_crypt_ecdsa_sign_batch},
+#endif
 #ifdef OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
     {"    ecdsa verify sign                        : optiga --",
      "ecdsaverify",
@@ -897,9 +988,20 @@ optiga_example_cmd_t optiga_cmds[] = {
      "cbcmacenc",
      optiga_shell_crypt_symmetric_encrypt_cbcmac},
 #endif
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+    {"    symmetric cbc encrypt decrypt of stream  : optiga --",
+     "symstream",
+     optiga_shell_crypt_symmetric_stream},
+#endif
 #ifdef OPTIGA_CRYPT_HMAC_ENABLED
     {"    hmac-sha256 generation                   : optiga --", "hmac", optiga_shell_crypt_hmac},
 #endif
+#if defined(OPTIGA_CRYPT_HMAC_ENABLED) && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+    {"    hmac-sha256 generation of data stream    : optiga --",
+     "hmacstream",
+     optiga_shell_crypt_hmac_stream},
+#endif
 #ifdef OPTIGA_CRYPT_HKDF_ENABLED
     {"    hkdf-sha256 key derivation               : optiga --", "hkdf", optiga_shell_crypt_hkdf},
 #endif
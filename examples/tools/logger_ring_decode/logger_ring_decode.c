@@ -0,0 +1,85 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file logger_ring_decode.c
+ *
+ * \brief   This file implements a tool to decode the logger ring dumps created by pal_logger_ring_dump.
+ *
+ * @{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "optiga_lib_logger.h"
+#include "pal_logger.h"
+
+int main(int argc, char **argv) {
+    pal_logger_ring_dump_header_t header;
+    pal_logger_ring_record_t record;
+    uint32_t record_index;
+    int exit_code = EXIT_FAILURE;
+    FILE *p_file;
+
+    if (2 != argc) {
+        fprintf(stderr, "Usage : %s <logger ring dump file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    p_file = fopen(argv[1], "rb");
+    if (NULL == p_file) {
+        fprintf(stderr, "Error : Unable to open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    do {
+        if (1U != fread(&header, sizeof(header), 1U, p_file)) {
+            fprintf(stderr, "Error : Truncated dump header\n");
+            break;
+        }
+        if ((PAL_LOGGER_RING_DUMP_MAGIC != header.magic)
+            || (PAL_LOGGER_RING_DUMP_VERSION != header.version)) {
+            fprintf(stderr, "Error : Not a logger ring dump or unsupported version\n");
+            break;
+        }
+        // The record layout depends on PAL_LOGGER_RING_MAX_PAYLOAD of the producer
+        if (sizeof(pal_logger_ring_record_t) != header.record_size) {
+            fprintf(
+                stderr,
+                "Error : Record size %u does not match the tool record size %u\n",
+                (unsigned int)header.record_size,
+                (unsigned int)sizeof(pal_logger_ring_record_t)
+            );
+            break;
+        }
+
+        printf(
+            "Records : %u, Dropped records : %u\n",
+            (unsigned int)header.record_count,
+            (unsigned int)header.overflow_count
+        );
+        for (record_index = 0; record_index < header.record_count; record_index++) {
+            if (1U != fread(&record, sizeof(record), 1U, p_file)) {
+                fprintf(stderr, "Error : Truncated record %u\n", (unsigned int)record_index);
+                break;
+            }
+            if (record.payload_length > PAL_LOGGER_RING_MAX_PAYLOAD) {
+                fprintf(stderr, "Error : Corrupted record %u\n", (unsigned int)record_index);
+                break;
+            }
+            optiga_lib_print_record(&record);
+        }
+        if (record_index == header.record_count) {
+            exit_code = EXIT_SUCCESS;
+        }
+    } while (0);
+
+    fclose(p_file);
+    return exit_code;
+}
+
+/**
+ * @}
+ */
@@ -44,6 +44,21 @@ void pal_gpio_set_low(const pal_gpio_t *p_gpio_context) {
     }
 }
 
+// lint --e{714,715} suppress "No precise pulse on this platform, the caller times the levels"
+pal_status_t pal_gpio_pulse_low(const pal_gpio_t *p_gpio_context, uint32_t low_time_us) {
+    return PAL_STATUS_FAILURE;
+}
+
+// lint --e{714,715} suppress "No ready line on this platform, the caller waits for the start up time"
+pal_status_t pal_gpio_watch_ready(const pal_gpio_t *p_ready_gpio) {
+    return PAL_STATUS_FAILURE;
+}
+
+// lint --e{714,715} suppress "No ready line on this platform, the caller waits for the start up time"
+pal_status_t pal_gpio_is_ready(const pal_gpio_t *p_ready_gpio) {
+    return PAL_STATUS_FAILURE;
+}
+
 /**
  * @}
  */
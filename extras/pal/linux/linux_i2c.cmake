@@ -7,10 +7,13 @@ set(PAL_FILES
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_gpio.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_i2c.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_logger.c
+    ${PROJECT_SOURCE_DIR}/../extras/pal/pal_logger_ring.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_datastore.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_event.c
+    ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_executor.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_lock.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_memory.c
+    ${PROJECT_SOURCE_DIR}/../extras/pal/pal_os_memory_pool.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_timer.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_shared_mutex.c
     ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal.c
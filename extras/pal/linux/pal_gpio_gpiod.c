@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <time.h>
 #include <unistd.h>
 
 #include "errno.h"
@@ -26,35 +27,28 @@
 #define LOW 0
 #define HIGH 1
 
-static int GPIOWrite(pal_linux_gpio_gpiod_t *pin, int value) {
-#if defined(LIBGPIOD_V1)
-    int ret = 0;
-    ret = gpiod_ctxless_set_value(
-        pin->gpio_device,
-        pin->gpio_device_offset,
-        value,
-        false,
-        "trustm",
-        NULL,
-        NULL
-    );
+#if !defined(LIBGPIOD_V1)
+/// Reset and power timing metrics
+static pal_linux_gpio_metrics_t g_pal_gpio_metrics;
+/// Chip-ready line watched by pal_gpio_watch_ready
+static pal_linux_gpio_gpiod_t *gp_ready_pin = NULL;
+/// Ready edge of the watched line not received yet
+static uint8_t g_ready_pending = FALSE;
 
-    if (ret != 0) {
-        char err_msg[100];
-        sprintf(err_msg, "Failed to write value! Return code = %d\n", ret);
-        write(STDERR_FILENO, err_msg, strlen(err_msg));
-        return -1;
-    }
+static uint64_t GPIOTimestampNs(void) {
+    struct timespec now;
 
-    return 0;
-#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+static struct gpiod_line_request *
+GPIORequest(const pal_linux_gpio_gpiod_t *pin, struct gpiod_line_settings *settings) {
     struct gpiod_chip *chip = NULL;
-    struct gpiod_line_settings *settings = NULL;
     struct gpiod_line_config *line_cfg = NULL;
     struct gpiod_request_config *req_cfg = NULL;
     struct gpiod_line_request *request = NULL;
     unsigned int offset;
-    int ret = -1;
 
     offset = (unsigned int)pin->gpio_device_offset;
 
@@ -64,17 +58,6 @@ static int GPIOWrite(pal_linux_gpio_gpiod_t *pin, int value) {
         goto cleanup;
     }
 
-    settings = gpiod_line_settings_new();
-    if (!settings) {
-        goto cleanup;
-    }
-
-    gpiod_line_settings_set_direction(settings, GPIOD_LINE_DIRECTION_OUTPUT);
-    gpiod_line_settings_set_output_value(
-        settings,
-        value ? GPIOD_LINE_VALUE_ACTIVE : GPIOD_LINE_VALUE_INACTIVE
-    );
-
     line_cfg = gpiod_line_config_new();
     if (!line_cfg) {
         goto cleanup;
@@ -91,6 +74,7 @@ static int GPIOWrite(pal_linux_gpio_gpiod_t *pin, int value) {
 
     gpiod_request_config_set_consumer(req_cfg, "trustm");
 
+    // The request stays valid after the chip is closed
     request = gpiod_chip_request_lines(chip, req_cfg, line_cfg);
     if (!request) {
         fprintf(
@@ -100,22 +84,91 @@ static int GPIOWrite(pal_linux_gpio_gpiod_t *pin, int value) {
             offset,
             strerror(errno)
         );
-        goto cleanup;
     }
-    ret = 0;
 cleanup:
-    if (request)
-        gpiod_line_request_release(request);
-    if (settings)
-        gpiod_line_settings_free(settings);
     if (line_cfg)
         gpiod_line_config_free(line_cfg);
     if (req_cfg)
         gpiod_request_config_free(req_cfg);
     if (chip)
         gpiod_chip_close(chip);
-    return ret;
+    return request;
+}
+
+static void GPIORecordTransition(const pal_gpio_t *p_gpio_context, int value) {
+    pal_linux_gpio_gpiod_t *pin = (pal_linux_gpio_gpiod_t *)(p_gpio_context->p_gpio_hw);
+    uint32_t low_time_us;
+
+    if (value == LOW) {
+        pin->low_timestamp_ns = GPIOTimestampNs();
+        return;
+    }
+    pin->high_timestamp_ns = GPIOTimestampNs();
+    if ((0U == pin->low_timestamp_ns) || (pin->high_timestamp_ns < pin->low_timestamp_ns)) {
+        return;
+    }
+    low_time_us = (uint32_t)((pin->high_timestamp_ns - pin->low_timestamp_ns) / 1000U);
+    if (p_gpio_context == &optiga_reset_0) {
+        g_pal_gpio_metrics.reset_pulse_us = low_time_us;
+    } else if (p_gpio_context == &optiga_vdd_0) {
+        g_pal_gpio_metrics.power_cycle_us = low_time_us;
+    }
+}
+#endif
+
+static int GPIOWrite(pal_linux_gpio_gpiod_t *pin, int value) {
+#if defined(LIBGPIOD_V1)
+    int ret = 0;
+    ret = gpiod_ctxless_set_value(
+        pin->gpio_device,
+        pin->gpio_device_offset,
+        value,
+        false,
+        "trustm",
+        NULL,
+        NULL
+    );
+
+    if (ret != 0) {
+        char err_msg[100];
+        sprintf(err_msg, "Failed to write value! Return code = %d\n", ret);
+        write(STDERR_FILENO, err_msg, strlen(err_msg));
+        return -1;
+    }
+
+    return 0;
+#else
+    struct gpiod_line_settings *settings = NULL;
+    enum gpiod_line_value line_value = value ? GPIOD_LINE_VALUE_ACTIVE : GPIOD_LINE_VALUE_INACTIVE;
+    int ret = -1;
 
+    // Line is requested once and then kept open, later writes only set the value
+    if (pin->p_line_request) {
+        if (gpiod_line_request_set_value(
+                pin->p_line_request,
+                (unsigned int)pin->gpio_device_offset,
+                line_value
+            )
+            != 0) {
+            fprintf(stderr, "Failed to write value: %s\n", strerror(errno));
+            return -1;
+        }
+        return 0;
+    }
+
+    settings = gpiod_line_settings_new();
+    if (!settings) {
+        return -1;
+    }
+    gpiod_line_settings_set_direction(settings, GPIOD_LINE_DIRECTION_OUTPUT);
+    gpiod_line_settings_set_output_value(settings, line_value);
+
+    pin->p_line_request = GPIORequest(pin, settings);
+    if (pin->p_line_request) {
+        ret = 0;
+    }
+    gpiod_line_settings_free(settings);
+    return ret;
 #endif
 }
 
@@ -126,6 +179,21 @@ pal_status_t pal_gpio_init(const pal_gpio_t *p_gpio_context) {
 
 // lint --e{714,715} suppress "This function is used for to support multiple platforms "
 pal_status_t pal_gpio_deinit(const pal_gpio_t *p_gpio_context) {
+#if !defined(LIBGPIOD_V1)
+    pal_linux_gpio_gpiod_t *pin;
+
+    if ((p_gpio_context != NULL) && (p_gpio_context->p_gpio_hw != NULL)) {
+        pin = (pal_linux_gpio_gpiod_t *)(p_gpio_context->p_gpio_hw);
+        if (pin == gp_ready_pin) {
+            gp_ready_pin = NULL;
+            g_ready_pending = FALSE;
+        }
+        if (pin->p_line_request) {
+            gpiod_line_request_release(pin->p_line_request);
+            pin->p_line_request = NULL;
+        }
+    }
+#endif
     return PAL_STATUS_SUCCESS;
 }
 
@@ -137,6 +205,11 @@ void pal_gpio_set_high(const pal_gpio_t *p_gpio_context) {
         if (GPIOWrite((pal_linux_gpio_gpiod_t *)(p_gpio_context->p_gpio_hw), HIGH) != 0) {
             fprintf(stderr, "Unable to set gpio pin high!");
         }
+#if !defined(LIBGPIOD_V1)
+        else {
+            GPIORecordTransition(p_gpio_context, HIGH);
+        }
+#endif
     }
 }
 
@@ -148,8 +221,135 @@ void pal_gpio_set_low(const pal_gpio_t *p_gpio_context) {
         if (GPIOWrite((pal_linux_gpio_gpiod_t *)(p_gpio_context->p_gpio_hw), LOW) != 0) {
             fprintf(stderr, "Unable to set gpio pin low!");
         }
+#if !defined(LIBGPIOD_V1)
+        else {
+            GPIORecordTransition(p_gpio_context, LOW);
+        }
+#endif
+    }
+}
+
+#if !defined(LIBGPIOD_V1)
+pal_status_t pal_gpio_pulse_low(const pal_gpio_t *p_gpio_context, uint32_t low_time_us) {
+    struct timespec deadline;
+    uint64_t deadline_ns;
+
+    if ((p_gpio_context == NULL) || (p_gpio_context->p_gpio_hw == NULL)) {
+        return PAL_STATUS_FAILURE;
+    }
+    pal_gpio_set_low(p_gpio_context);
+
+    // Absolute deadline from the recorded low transition, so that the write latency is not added twice
+    deadline_ns = ((pal_linux_gpio_gpiod_t *)(p_gpio_context->p_gpio_hw))->low_timestamp_ns
+        + ((uint64_t)low_time_us * 1000U);
+    deadline.tv_sec = (time_t)(deadline_ns / 1000000000U);
+    deadline.tv_nsec = (long)(deadline_ns % 1000000000U);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
     }
+
+    pal_gpio_set_high(p_gpio_context);
+    return PAL_STATUS_SUCCESS;
+}
+
+pal_status_t pal_gpio_watch_ready(const pal_gpio_t *p_ready_gpio) {
+    struct gpiod_line_settings *settings = NULL;
+    pal_linux_gpio_gpiod_t *pin;
+
+    if ((p_ready_gpio == NULL) || (p_ready_gpio->p_gpio_hw == NULL)) {
+        return PAL_STATUS_FAILURE;
+    }
+    pin = (pal_linux_gpio_gpiod_t *)(p_ready_gpio->p_gpio_hw);
+    if (!pin->p_line_request) {
+        settings = gpiod_line_settings_new();
+        if (!settings) {
+            return PAL_STATUS_FAILURE;
+        }
+        gpiod_line_settings_set_direction(settings, GPIOD_LINE_DIRECTION_INPUT);
+        gpiod_line_settings_set_edge_detection(settings, GPIOD_LINE_EDGE_RISING);
+        gpiod_line_settings_set_event_clock(settings, GPIOD_LINE_CLOCK_MONOTONIC);
+        pin->p_line_request = GPIORequest(pin, settings);
+        gpiod_line_settings_free(settings);
+        if (!pin->p_line_request) {
+            return PAL_STATUS_FAILURE;
+        }
+    }
+    // The previous wait ended without its ready edge
+    if (TRUE == g_ready_pending) {
+        g_pal_gpio_metrics.ready_timeout_count++;
+    }
+    gp_ready_pin = pin;
+    g_ready_pending = TRUE;
+    return PAL_STATUS_SUCCESS;
+}
+
+pal_status_t pal_gpio_is_ready(const pal_gpio_t *p_ready_gpio) {
+    struct gpiod_edge_event_buffer *buffer = NULL;
+    struct gpiod_edge_event *event;
+    uint64_t edge_timestamp_ns;
+    uint64_t reset_release_ns;
+    pal_status_t status = PAL_STATUS_FAILURE;
+
+    if ((p_ready_gpio == NULL) || (!gp_ready_pin) || (p_ready_gpio->p_gpio_hw != gp_ready_pin)) {
+        return PAL_STATUS_FAILURE;
+    }
+    if (FALSE == g_ready_pending) {
+        return PAL_STATUS_SUCCESS;
+    }
+
+    // Zero timeout, only checks for a pending edge event
+    if (gpiod_line_request_wait_edge_events(gp_ready_pin->p_line_request, 0) <= 0) {
+        return PAL_STATUS_FAILURE;
+    }
+
+    buffer = gpiod_edge_event_buffer_new(1);
+    if (!buffer) {
+        return PAL_STATUS_FAILURE;
+    }
+    if (gpiod_line_request_read_edge_events(gp_ready_pin->p_line_request, buffer, 1) > 0) {
+        event = gpiod_edge_event_buffer_get_event(buffer, 0);
+        edge_timestamp_ns = gpiod_edge_event_get_timestamp_ns(event);
+        reset_release_ns = 0U;
+        if (optiga_reset_0.p_gpio_hw != NULL) {
+            reset_release_ns =
+                ((pal_linux_gpio_gpiod_t *)(optiga_reset_0.p_gpio_hw))->high_timestamp_ns;
+        }
+        if ((0U != reset_release_ns) && (edge_timestamp_ns >= reset_release_ns)) {
+            g_pal_gpio_metrics.reset_to_ready_us =
+                (uint32_t)((edge_timestamp_ns - reset_release_ns) / 1000U);
+            if (g_pal_gpio_metrics.reset_to_ready_us > g_pal_gpio_metrics.max_reset_to_ready_us) {
+                g_pal_gpio_metrics.max_reset_to_ready_us = g_pal_gpio_metrics.reset_to_ready_us;
+            }
+        }
+        g_ready_pending = FALSE;
+        status = PAL_STATUS_SUCCESS;
+    }
+    gpiod_edge_event_buffer_free(buffer);
+    return status;
+}
+
+pal_status_t pal_gpio_gpiod_get_metrics(pal_linux_gpio_metrics_t *p_metrics) {
+    if (p_metrics == NULL) {
+        return PAL_STATUS_INVALID_INPUT;
+    }
+    *p_metrics = g_pal_gpio_metrics;
+    return PAL_STATUS_SUCCESS;
+}
+#else
+// lint --e{714,715} suppress "libgpiod v1 has no line requests, the caller times the levels"
+pal_status_t pal_gpio_pulse_low(const pal_gpio_t *p_gpio_context, uint32_t low_time_us) {
+    return PAL_STATUS_FAILURE;
+}
+
+// lint --e{714,715} suppress "libgpiod v1 has no line requests, the caller waits for the start up time"
+pal_status_t pal_gpio_watch_ready(const pal_gpio_t *p_ready_gpio) {
+    return PAL_STATUS_FAILURE;
+}
+
+// lint --e{714,715} suppress "libgpiod v1 has no line requests, the caller waits for the start up time"
+pal_status_t pal_gpio_is_ready(const pal_gpio_t *p_ready_gpio) {
+    return PAL_STATUS_FAILURE;
 }
+#endif  // !LIBGPIOD_V1
 
 /**
  * @}
@@ -0,0 +1,281 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_executor.c
+ *
+ * \brief   This file implements the completion executor with worker threads or an eventfd for Linux platforms.
+ *
+ * \ingroup  grPAL
+ *
+ * @{
+ */
+
+#include "pal_os_executor.h"
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+
+#include <pthread.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/** \brief Queued completion */
+typedef struct pal_os_executor_entry {
+    /// Callback handler
+    callback_handler_t handler;
+    /// Context passed to the handler
+    void *p_ctx;
+    /// Status passed to the handler
+    optiga_lib_status_t status;
+} pal_os_executor_entry_t;
+
+/** \brief Completion executor */
+typedef struct pal_os_executor {
+    /// Ring of queued completions
+    pal_os_executor_entry_t queue[PAL_OS_EXECUTOR_QUEUE_LENGTH];
+    /// Index of the oldest queued completion
+    uint32_t head;
+    /// Number of queued completions
+    uint32_t depth;
+    /// Executor is accepting completions
+    bool_t is_running;
+    /// Number of worker threads
+    uint8_t worker_count;
+    /// Worker threads
+    pthread_t workers[PAL_OS_EXECUTOR_MAX_WORKERS];
+    /// eventfd signalling queued completions, -1 if not used
+    int32_t event_fd;
+    /// Statistics
+    pal_os_executor_stats_t stats;
+    /// Protects the executor
+    pthread_mutex_t mutex;
+    /// Signals queued completions and the stop to the workers
+    pthread_cond_t condition;
+} pal_os_executor_t;
+
+static pal_os_executor_t g_pal_os_executor = {
+    .event_fd = -1,
+    .mutex = PTHREAD_MUTEX_INITIALIZER,
+    .condition = PTHREAD_COND_INITIALIZER,
+};
+
+// Removes the oldest completion, the mutex is held by the caller
+static pal_os_executor_entry_t pal_os_executor_pop(pal_os_executor_t *p_executor) {
+    pal_os_executor_entry_t entry = p_executor->queue[p_executor->head];
+
+    p_executor->head = (p_executor->head + 1U) % PAL_OS_EXECUTOR_QUEUE_LENGTH;
+    p_executor->depth--;
+    p_executor->stats.executed_count++;
+    return (entry);
+}
+
+static void *pal_os_executor_worker(void *p_arg) {
+    pal_os_executor_t *p_executor = (pal_os_executor_t *)p_arg;
+    pal_os_executor_entry_t entry;
+
+    pthread_mutex_lock(&p_executor->mutex);
+    while (TRUE) {
+        while ((0U == p_executor->depth) && (TRUE == p_executor->is_running)) {
+            pthread_cond_wait(&p_executor->condition, &p_executor->mutex);
+        }
+        // Completions left at stop are invoked by pal_os_executor_stop
+        if (FALSE == p_executor->is_running) {
+            break;
+        }
+        entry = pal_os_executor_pop(p_executor);
+        pthread_mutex_unlock(&p_executor->mutex);
+        entry.handler(entry.p_ctx, entry.status);
+        pthread_mutex_lock(&p_executor->mutex);
+    }
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    return (NULL);
+}
+
+pal_status_t pal_os_executor_start(uint8_t worker_count) {
+    pal_os_executor_t *p_executor = &g_pal_os_executor;
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    uint8_t index;
+
+    if (PAL_OS_EXECUTOR_MAX_WORKERS < worker_count) {
+        return (PAL_STATUS_INVALID_INPUT);
+    }
+
+    pthread_mutex_lock(&p_executor->mutex);
+    do {
+        if ((TRUE == p_executor->is_running) || (0U != p_executor->worker_count)) {
+            break;
+        }
+        if (0U == worker_count) {
+            p_executor->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (0 > p_executor->event_fd) {
+                p_executor->event_fd = -1;
+                break;
+            }
+        }
+        p_executor->head = 0;
+        p_executor->depth = 0;
+        p_executor->is_running = TRUE;
+        for (index = 0; index < worker_count; index++) {
+            if (0
+                != pthread_create(
+                    &p_executor->workers[index],
+                    NULL,
+                    pal_os_executor_worker,
+                    p_executor
+                )) {
+                break;
+            }
+            p_executor->worker_count++;
+        }
+        return_status = PAL_STATUS_SUCCESS;
+    } while (FALSE);
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    if ((PAL_STATUS_SUCCESS == return_status) && (worker_count != p_executor->worker_count)) {
+        // lint --e{534} suppress "The executor is running, stopping it always succeeds"
+        pal_os_executor_stop();
+        return_status = PAL_STATUS_FAILURE;
+    }
+
+    return (return_status);
+}
+
+pal_status_t pal_os_executor_stop(void) {
+    pal_os_executor_t *p_executor = &g_pal_os_executor;
+    pal_os_executor_entry_t entry;
+    uint8_t index;
+
+    pthread_mutex_lock(&p_executor->mutex);
+    if (FALSE == p_executor->is_running) {
+        pthread_mutex_unlock(&p_executor->mutex);
+        return (PAL_STATUS_FAILURE);
+    }
+    p_executor->is_running = FALSE;
+    pthread_cond_broadcast(&p_executor->condition);
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    for (index = 0; index < p_executor->worker_count; index++) {
+        pthread_join(p_executor->workers[index], NULL);
+    }
+
+    pthread_mutex_lock(&p_executor->mutex);
+    p_executor->worker_count = 0;
+    while (0U != p_executor->depth) {
+        entry = pal_os_executor_pop(p_executor);
+        pthread_mutex_unlock(&p_executor->mutex);
+        entry.handler(entry.p_ctx, entry.status);
+        pthread_mutex_lock(&p_executor->mutex);
+    }
+    if (-1 != p_executor->event_fd) {
+        close(p_executor->event_fd);
+        p_executor->event_fd = -1;
+    }
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    return (PAL_STATUS_SUCCESS);
+}
+
+pal_status_t
+pal_os_executor_post(callback_handler_t handler, void *p_ctx, optiga_lib_status_t status) {
+    pal_os_executor_t *p_executor = &g_pal_os_executor;
+    pal_os_executor_entry_t entry;
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    uint64_t signal = 1;
+    uint32_t pending_count;
+    uint32_t tail;
+
+    pthread_mutex_lock(&p_executor->mutex);
+    do {
+        if (FALSE == p_executor->is_running) {
+            break;
+        }
+        if (PAL_OS_EXECUTOR_QUEUE_LENGTH == p_executor->depth) {
+            p_executor->stats.overflow_count++;
+            // The completions queued before are invoked first, the caller invokes its handler after them
+            pending_count = p_executor->depth;
+            while ((0U != pending_count) && (0U != p_executor->depth)) {
+                entry = pal_os_executor_pop(p_executor);
+                pthread_mutex_unlock(&p_executor->mutex);
+                entry.handler(entry.p_ctx, entry.status);
+                pending_count--;
+                pthread_mutex_lock(&p_executor->mutex);
+            }
+            break;
+        }
+        tail = (p_executor->head + p_executor->depth) % PAL_OS_EXECUTOR_QUEUE_LENGTH;
+        p_executor->queue[tail].handler = handler;
+        p_executor->queue[tail].p_ctx = p_ctx;
+        p_executor->queue[tail].status = status;
+        p_executor->depth++;
+        p_executor->stats.posted_count++;
+        if (p_executor->depth > p_executor->stats.max_queue_depth) {
+            p_executor->stats.max_queue_depth = p_executor->depth;
+        }
+        if (-1 != p_executor->event_fd) {
+            // lint --e{534} suppress "The counter of the eventfd cannot overflow with the bounded queue"
+            write(p_executor->event_fd, &signal, sizeof(signal));
+        } else {
+            pthread_cond_signal(&p_executor->condition);
+        }
+        return_status = PAL_STATUS_SUCCESS;
+    } while (FALSE);
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    return (return_status);
+}
+
+int32_t pal_os_executor_get_fd(void) {
+    int32_t event_fd;
+
+    pthread_mutex_lock(&g_pal_os_executor.mutex);
+    event_fd = g_pal_os_executor.event_fd;
+    pthread_mutex_unlock(&g_pal_os_executor.mutex);
+
+    return (event_fd);
+}
+
+uint32_t pal_os_executor_run(void) {
+    pal_os_executor_t *p_executor = &g_pal_os_executor;
+    pal_os_executor_entry_t entry;
+    uint64_t signal;
+    uint32_t pending_count;
+    uint32_t executed_count = 0;
+
+    pthread_mutex_lock(&p_executor->mutex);
+    if (-1 != p_executor->event_fd) {
+        // Cleared before the queue is read, later completions signal the descriptor again
+        // lint --e{534} suppress "Reading an empty non blocking eventfd fails with EAGAIN"
+        read(p_executor->event_fd, &signal, sizeof(signal));
+        pending_count = p_executor->depth;
+        while ((executed_count < pending_count) && (0U != p_executor->depth)) {
+            entry = pal_os_executor_pop(p_executor);
+            pthread_mutex_unlock(&p_executor->mutex);
+            entry.handler(entry.p_ctx, entry.status);
+            executed_count++;
+            pthread_mutex_lock(&p_executor->mutex);
+        }
+    }
+    pthread_mutex_unlock(&p_executor->mutex);
+
+    return (executed_count);
+}
+
+pal_status_t pal_os_executor_get_stats(pal_os_executor_stats_t *p_stats) {
+    if (NULL == p_stats) {
+        return (PAL_STATUS_INVALID_INPUT);
+    }
+    pthread_mutex_lock(&g_pal_os_executor.mutex);
+    *p_stats = g_pal_os_executor.stats;
+    pthread_mutex_unlock(&g_pal_os_executor.mutex);
+
+    return (PAL_STATUS_SUCCESS);
+}
+
+#endif  // PAL_OS_EXECUTOR_ENABLED
+
+/**
+ * @}
+ */
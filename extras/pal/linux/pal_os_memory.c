@@ -16,14 +16,38 @@
 #include "pal_os_memory.h"
 
 void *pal_os_malloc(uint32_t block_size) {
-    return (malloc(block_size));
+    void *p_block = NULL;
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+    p_block = pal_os_memory_pool_alloc(block_size);
+#endif
+    if (NULL == p_block) {
+        p_block = malloc(block_size);
+    }
+    return (p_block);
 }
 
 void *pal_os_calloc(uint32_t number_of_blocks, uint32_t block_size) {
-    return (calloc(number_of_blocks, block_size));
+    void *p_block = NULL;
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+    if ((0U != block_size) && (number_of_blocks <= (UINT32_MAX / block_size))) {
+        p_block = pal_os_memory_pool_alloc(number_of_blocks * block_size);
+        if (NULL != p_block) {
+            memset(p_block, 0, number_of_blocks * block_size);
+        }
+    }
+#endif
+    if (NULL == p_block) {
+        p_block = calloc(number_of_blocks, block_size);
+    }
+    return (p_block);
 }
 
 void pal_os_free(void *p_block) {
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+    if (TRUE == pal_os_memory_pool_free(p_block)) {
+        p_block = NULL;
+    }
+#endif
     free(p_block);
 }
 
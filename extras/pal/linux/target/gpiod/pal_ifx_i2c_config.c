@@ -21,6 +21,7 @@ pal_linux_t linux_events = {"/dev/i2c-1", 0, NULL};
 
 #define GPIO_PIN_RESET 16
 #define GPIO_PIN_VDD 27
+#define GPIO_PIN_READY 22
 #define GPIO_CHIP "/dev/gpiochip0"
 
 /**
@@ -38,6 +39,9 @@ pal_i2c_t optiga_pal_i2c_context_0 = {
 
 static struct pal_linux_gpio_gpiod pin_reset = {GPIO_CHIP, GPIO_PIN_RESET};
 static struct pal_linux_gpio_gpiod pin_vdd = {GPIO_CHIP, GPIO_PIN_VDD};
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+static struct pal_linux_gpio_gpiod pin_ready = {GPIO_CHIP, GPIO_PIN_READY};
+#endif
 
 /**
  * \brief PAL vdd pin configuration for OPTIGA.
@@ -53,6 +57,15 @@ pal_gpio_t optiga_reset_0 = {
     // Platform specific GPIO context for the pin used to toggle Reset.
     (void *)&pin_reset};
 
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/**
+ * \brief PAL ready line configuration for OPTIGA.
+ */
+pal_gpio_t optiga_ready_0 = {
+    // Platform specific GPIO context for the line signalling the readiness after a reset.
+    (void *)&pin_ready};
+#endif
+
 /**
  * @}
  */
@@ -15,6 +15,9 @@
 
 #include "mbedtls/ccm.h"
 #include "mbedtls/md.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/sha256.h"
+#include "mbedtls/sha512.h"
 #include "mbedtls/ssl.h"
 #include "mbedtls/version.h"
 #include "optiga_lib_common.h"
@@ -22,6 +25,16 @@
 #include "pal_os_memory.h"
 
 #define PAL_CRYPT_MAX_LABEL_SEED_LENGTH (96U)
+
+#if MBEDTLS_VERSION_NUMBER < 0x03000000
+// Hash functions returning a status in mbedTLS 2.x
+#define mbedtls_sha256_starts mbedtls_sha256_starts_ret
+#define mbedtls_sha256_update mbedtls_sha256_update_ret
+#define mbedtls_sha256_finish mbedtls_sha256_finish_ret
+#define mbedtls_sha512_starts mbedtls_sha512_starts_ret
+#define mbedtls_sha512_update mbedtls_sha512_update_ret
+#define mbedtls_sha512_finish mbedtls_sha512_finish_ret
+#endif
 // lint --e{818, 715, 830} suppress "argument "p_pal_crypt" is not used in the implementation but kept for future use"
 pal_status_t pal_crypt_tls_prf_sha256(
     pal_crypt_t *p_pal_crypt,
@@ -290,6 +303,181 @@ pal_status_t pal_crypt_version(uint8_t *p_crypt_lib_version_info, uint16_t *leng
     return return_value;
 }
 
+pal_status_t pal_crypt_hmac_sha256(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_key,
+    uint16_t key_length,
+    const uint8_t *p_data,
+    uint16_t data_length,
+    uint8_t *p_mac
+) {
+    (void)p_pal_crypt;
+    if (0
+        != mbedtls_md_hmac(
+            mbedtls_md_info_from_type(MBEDTLS_MD_SHA256),
+            p_key,
+            key_length,
+            p_data,
+            data_length,
+            p_mac
+        )) {
+        return PAL_STATUS_FAILURE;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+pal_status_t pal_crypt_verify_signature(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_public_key_info,
+    uint16_t public_key_info_length,
+    const uint8_t *p_digest,
+    uint16_t digest_length,
+    const uint8_t *p_signature,
+    uint16_t signature_length
+) {
+    pal_status_t return_status = PAL_STATUS_INVALID_INPUT;
+    mbedtls_md_type_t md_type;
+    mbedtls_pk_context public_key;
+
+    (void)p_pal_crypt;
+    mbedtls_pk_init(&public_key);
+    do {
+        // Hash algorithm is used for the DigestInfo of RSA signatures only
+        md_type = (32U == digest_length) ? MBEDTLS_MD_SHA256
+            : (48U == digest_length)     ? MBEDTLS_MD_SHA384
+            : (64U == digest_length)     ? MBEDTLS_MD_SHA512
+                                         : MBEDTLS_MD_NONE;
+        if (0 != mbedtls_pk_parse_public_key(&public_key, p_public_key_info, public_key_info_length)) {
+            break;
+        }
+        if ((MBEDTLS_MD_NONE == md_type) && (MBEDTLS_PK_RSA == mbedtls_pk_get_type(&public_key))) {
+            break;
+        }
+
+        return_status = (0
+                         == mbedtls_pk_verify(
+                             &public_key,
+                             md_type,
+                             p_digest,
+                             digest_length,
+                             p_signature,
+                             signature_length
+                         ))
+            ? PAL_STATUS_SUCCESS
+            : PAL_STATUS_FAILURE;
+    } while (FALSE);
+    mbedtls_pk_free(&public_key);
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_start(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    uint16_t context_length
+) {
+    pal_status_t return_status = PAL_STATUS_INVALID_INPUT;
+    mbedtls_sha256_context sha256_context;
+#if defined(MBEDTLS_SHA512_C)
+    mbedtls_sha512_context sha512_context;
+#endif
+
+    (void)p_pal_crypt;
+    do {
+        if (32U == digest_length) {
+            if (context_length < sizeof(sha256_context)) {
+                break;
+            }
+            mbedtls_sha256_init(&sha256_context);
+            return_status = (0 == mbedtls_sha256_starts(&sha256_context, 0)) ? PAL_STATUS_SUCCESS
+                                                                             : PAL_STATUS_FAILURE;
+            pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+            break;
+        }
+#if defined(MBEDTLS_SHA512_C)
+        if ((48U == digest_length) || (64U == digest_length)) {
+            if (context_length < sizeof(sha512_context)) {
+                break;
+            }
+            mbedtls_sha512_init(&sha512_context);
+            return_status = (0 == mbedtls_sha512_starts(&sha512_context, (48U == digest_length) ? 1 : 0))
+                ? PAL_STATUS_SUCCESS
+                : PAL_STATUS_FAILURE;
+            pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+        }
+#endif
+    } while (FALSE);
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_update(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    const uint8_t *p_data,
+    uint32_t data_length
+) {
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    mbedtls_sha256_context sha256_context;
+#if defined(MBEDTLS_SHA512_C)
+    mbedtls_sha512_context sha512_context;
+#endif
+
+    (void)p_pal_crypt;
+    // The context buffer is not required to be aligned, the context is updated in a local copy
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        if (0 == mbedtls_sha256_update(&sha256_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    }
+#if defined(MBEDTLS_SHA512_C)
+    else if ((48U == digest_length) || (64U == digest_length)) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        if (0 == mbedtls_sha512_update(&sha512_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    }
+#endif
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_finalize(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    const uint8_t *p_context,
+    uint8_t *p_digest
+) {
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    mbedtls_sha256_context sha256_context;
+#if defined(MBEDTLS_SHA512_C)
+    mbedtls_sha512_context sha512_context;
+    uint8_t sha512_digest[64];
+#endif
+
+    (void)p_pal_crypt;
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        if (0 == mbedtls_sha256_finish(&sha256_context, p_digest)) {
+            return_status = PAL_STATUS_SUCCESS;
+        }
+        mbedtls_sha256_free(&sha256_context);
+    }
+#if defined(MBEDTLS_SHA512_C)
+    else if ((48U == digest_length) || (64U == digest_length)) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        if (0 == mbedtls_sha512_finish(&sha512_context, sha512_digest)) {
+            pal_os_memcpy(p_digest, sha512_digest, digest_length);
+            return_status = PAL_STATUS_SUCCESS;
+        }
+        mbedtls_sha512_free(&sha512_context);
+    }
+#endif
+    return return_status;
+}
+
 /**
  * @}
  */
@@ -13,11 +13,16 @@
  * @{
  */
 
+// The SHA contexts of the low level API can be stored in the hash context buffer of the caller
+#define OPENSSL_SUPPRESS_DEPRECATED
+
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 #include <openssl/kdf.h>
 #include <openssl/opensslv.h>
+#include <openssl/rsa.h>
 #include <openssl/sha.h>
+#include <openssl/x509.h>
 
 #include "pal_crypt.h"
 #include "pal_os_memory.h"
@@ -256,6 +261,159 @@ pal_status_t pal_crypt_version(uint8_t *p_crypt_lib_version_info, uint16_t *leng
     return return_value;
 }
 
+pal_status_t pal_crypt_hmac_sha256(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_key,
+    uint16_t key_length,
+    const uint8_t *p_data,
+    uint16_t data_length,
+    uint8_t *p_mac
+) {
+    unsigned int mac_length = 0;
+
+    (void)p_pal_crypt;
+    if (NULL == HMAC(EVP_sha256(), p_key, key_length, p_data, data_length, p_mac, &mac_length)) {
+        return PAL_STATUS_FAILURE;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+pal_status_t pal_crypt_verify_signature(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_public_key_info,
+    uint16_t public_key_info_length,
+    const uint8_t *p_digest,
+    uint16_t digest_length,
+    const uint8_t *p_signature,
+    uint16_t signature_length
+) {
+    pal_status_t return_status = PAL_STATUS_INVALID_INPUT;
+    const unsigned char *p_key = p_public_key_info;
+    const EVP_MD *p_md = NULL;
+    EVP_PKEY *p_pkey = NULL;
+    EVP_PKEY_CTX *p_ctx = NULL;
+
+    (void)p_pal_crypt;
+    do {
+        p_pkey = d2i_PUBKEY(NULL, &p_key, public_key_info_length);
+        if (NULL == p_pkey) {
+            break;
+        }
+        p_ctx = EVP_PKEY_CTX_new(p_pkey, NULL);
+        if ((NULL == p_ctx) || (1 != EVP_PKEY_verify_init(p_ctx))) {
+            break;
+        }
+        if (EVP_PKEY_RSA == EVP_PKEY_base_id(p_pkey)) {
+            p_md = (32 == digest_length) ? EVP_sha256()
+                : (48 == digest_length)  ? EVP_sha384()
+                : (64 == digest_length)  ? EVP_sha512()
+                                         : NULL;
+            if ((NULL == p_md) || (1 != EVP_PKEY_CTX_set_rsa_padding(p_ctx, RSA_PKCS1_PADDING))
+                || (1 != EVP_PKEY_CTX_set_signature_md(p_ctx, p_md))) {
+                break;
+            }
+        }
+
+        return_status = (1 == EVP_PKEY_verify(p_ctx, p_signature, signature_length, p_digest, digest_length))
+            ? PAL_STATUS_SUCCESS
+            : PAL_STATUS_FAILURE;
+    } while (FALSE);
+    EVP_PKEY_CTX_free(p_ctx);
+    EVP_PKEY_free(p_pkey);
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_start(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    uint16_t context_length
+) {
+    pal_status_t return_status = PAL_STATUS_INVALID_INPUT;
+    SHA256_CTX sha256_context;
+    SHA512_CTX sha512_context;
+
+    (void)p_pal_crypt;
+    if (32U == digest_length) {
+        if (context_length >= sizeof(sha256_context)) {
+            return_status = (1 == SHA256_Init(&sha256_context)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+            pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+        }
+    } else if ((48U == digest_length) || (64U == digest_length)) {
+        if (context_length >= sizeof(sha512_context)) {
+            return_status = (1
+                             == ((48U == digest_length) ? SHA384_Init(&sha512_context)
+                                                        : SHA512_Init(&sha512_context)))
+                ? PAL_STATUS_SUCCESS
+                : PAL_STATUS_FAILURE;
+            pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+        }
+    } else {
+        // Hash algorithm is not supported
+    }
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_update(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    const uint8_t *p_data,
+    uint32_t data_length
+) {
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    SHA256_CTX sha256_context;
+    SHA512_CTX sha512_context;
+
+    (void)p_pal_crypt;
+    // The context buffer is not required to be aligned, the context is updated in a local copy
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        if (1 == SHA256_Update(&sha256_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    } else if ((48U == digest_length) || (64U == digest_length)) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        // SHA384 shares the update of SHA512
+        if (1 == SHA512_Update(&sha512_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    } else {
+        // Hash algorithm is not supported
+    }
+    return return_status;
+}
+
+pal_status_t pal_crypt_hash_finalize(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    const uint8_t *p_context,
+    uint8_t *p_digest
+) {
+    pal_status_t return_status = PAL_STATUS_FAILURE;
+    SHA256_CTX sha256_context;
+    SHA512_CTX sha512_context;
+
+    (void)p_pal_crypt;
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        if (1 == SHA256_Final(p_digest, &sha256_context)) {
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    } else if ((48U == digest_length) || (64U == digest_length)) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        // The digest length is taken from the context, SHA384 stores 48 bytes
+        if (1 == SHA512_Final(p_digest, &sha512_context)) {
+            return_status = PAL_STATUS_SUCCESS;
+        }
+    } else {
+        // Hash algorithm is not supported
+    }
+    return return_status;
+}
+
 /**
  * @}
  */
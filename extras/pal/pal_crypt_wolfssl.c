@@ -20,6 +20,12 @@
 // lint --e{123,617,537} suppress "Suppress ctype.h in Keil + Warning mpi_class.h is both a module and an include file + Repeated include"
 #include <wolfssl\optiga_wolfssl_tls.h>
 #include <wolfssl\wolfcrypt\aes.h>
+#include <wolfssl\wolfcrypt\asn.h>
+#include <wolfssl\wolfcrypt\ecc.h>
+#include <wolfssl\wolfcrypt\hmac.h>
+#include <wolfssl\wolfcrypt\rsa.h>
+#include <wolfssl\wolfcrypt\sha256.h>
+#include <wolfssl\wolfcrypt\sha512.h>
 /// @endcond
 
 pal_status_t pal_crypt_tls_prf_sha256(
@@ -194,6 +200,116 @@ pal_status_t pal_crypt_version(uint8_t *p_crypt_lib_version_info, uint16_t *leng
     return return_value;
 }
 
+pal_status_t pal_crypt_hmac_sha256(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_key,
+    uint16_t key_length,
+    const uint8_t *p_data,
+    uint16_t data_length,
+    uint8_t *p_mac
+) {
+    pal_status_t return_value = PAL_STATUS_FAILURE;
+    Hmac hmac;
+
+    (void)p_pal_crypt;
+    do {
+        if (0 != wc_HmacInit(&hmac, NULL, INVALID_DEVID)) {
+            break;
+        }
+        if ((0 == wc_HmacSetKey(&hmac, WC_SHA256, p_key, key_length))
+            && (0 == wc_HmacUpdate(&hmac, p_data, data_length)) && (0 == wc_HmacFinal(&hmac, p_mac))) {
+            return_value = PAL_STATUS_SUCCESS;
+        }
+        wc_HmacFree(&hmac);
+    } while (FALSE);
+    return return_value;
+}
+
+pal_status_t pal_crypt_verify_signature(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_public_key_info,
+    uint16_t public_key_info_length,
+    const uint8_t *p_digest,
+    uint16_t digest_length,
+    const uint8_t *p_signature,
+    uint16_t signature_length
+) {
+#define RSA_DECODED_SIGNATURE_MAX_SIZE (0x200)
+    pal_status_t return_value = PAL_STATUS_INVALID_INPUT;
+    ecc_key ecc_public_key;
+    RsaKey rsa_public_key;
+    word32 index = 0;
+    int verify_result = 0;
+    int32_t hash_oid;
+    int32_t decoded_length;
+    word32 encoded_length;
+    uint8_t decoded_signature[RSA_DECODED_SIGNATURE_MAX_SIZE];
+    uint8_t encoded_digest[RSA_DECODED_SIGNATURE_MAX_SIZE];
+
+    (void)p_pal_crypt;
+    do {
+        if (0 != wc_ecc_init(&ecc_public_key)) {
+            break;
+        }
+        if (0
+            == wc_EccPublicKeyDecode(
+                p_public_key_info,
+                &index,
+                &ecc_public_key,
+                public_key_info_length
+            )) {
+            return_value = ((0
+                             == wc_ecc_verify_hash(
+                                 p_signature,
+                                 signature_length,
+                                 p_digest,
+                                 digest_length,
+                                 &verify_result,
+                                 &ecc_public_key
+                             ))
+                            && (1 == verify_result))
+                ? PAL_STATUS_SUCCESS
+                : PAL_STATUS_FAILURE;
+            wc_ecc_free(&ecc_public_key);
+            break;
+        }
+        wc_ecc_free(&ecc_public_key);
+
+        hash_oid = (32U == digest_length) ? SHA256h
+            : (48U == digest_length)      ? SHA384h
+            : (64U == digest_length)      ? SHA512h
+                                          : 0;
+        if ((0 == hash_oid) || (0 != wc_InitRsaKey(&rsa_public_key, NULL))) {
+            break;
+        }
+        index = 0;
+        if (0
+            == wc_RsaPublicKeyDecode(
+                p_public_key_info,
+                &index,
+                &rsa_public_key,
+                public_key_info_length
+            )) {
+            // PKCS#1 v1.5: compare the recovered DigestInfo with the expected one
+            decoded_length = wc_RsaSSL_Verify(
+                p_signature,
+                signature_length,
+                decoded_signature,
+                sizeof(decoded_signature),
+                &rsa_public_key
+            );
+            encoded_length = wc_EncodeSignature(encoded_digest, p_digest, digest_length, hash_oid);
+            return_value = ((decoded_length > 0) && ((word32)decoded_length == encoded_length)
+                            && (0 == memcmp(decoded_signature, encoded_digest, encoded_length)))
+                ? PAL_STATUS_SUCCESS
+                : PAL_STATUS_FAILURE;
+        }
+        wc_FreeRsaKey(&rsa_public_key);
+    } while (FALSE);
+#undef RSA_DECODED_SIGNATURE_MAX_SIZE
+    return return_value;
+}
+
 /// @cond hidden
 // lint --e{715,830,818} suppress "As this is reference api to be implemented by the user to generate random number from wolfssl"
 int32_t CryptoLib_GenerateSeed(uint8_t *PpbSeed, uint32_t PdwSeedLength) {
@@ -201,6 +317,99 @@ int32_t CryptoLib_GenerateSeed(uint8_t *PpbSeed, uint32_t PdwSeedLength) {
     //"User need to write an Platform specific wc_GenerateSeed() here"
     return i4Status;
 }
+
+pal_status_t pal_crypt_hash_start(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    uint16_t context_length
+) {
+    pal_status_t return_value = PAL_STATUS_INVALID_INPUT;
+    wc_Sha256 sha256_context;
+    wc_Sha384 sha384_context;
+    wc_Sha512 sha512_context;
+
+    (void)p_pal_crypt;
+    if ((32U == digest_length) && (context_length >= sizeof(sha256_context))) {
+        return_value = (0 == wc_InitSha256(&sha256_context)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+        pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+    } else if ((48U == digest_length) && (context_length >= sizeof(sha384_context))) {
+        return_value = (0 == wc_InitSha384(&sha384_context)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+        pal_os_memcpy(p_context, &sha384_context, sizeof(sha384_context));
+    } else if ((64U == digest_length) && (context_length >= sizeof(sha512_context))) {
+        return_value = (0 == wc_InitSha512(&sha512_context)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+        pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+    } else {
+        // Hash algorithm or context length is not supported
+    }
+    return return_value;
+}
+
+pal_status_t pal_crypt_hash_update(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    const uint8_t *p_data,
+    uint32_t data_length
+) {
+    pal_status_t return_value = PAL_STATUS_FAILURE;
+    wc_Sha256 sha256_context;
+    wc_Sha384 sha384_context;
+    wc_Sha512 sha512_context;
+
+    (void)p_pal_crypt;
+    // The context buffer is not required to be aligned, the context is updated in a local copy
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        if (0 == wc_Sha256Update(&sha256_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha256_context, sizeof(sha256_context));
+            return_value = PAL_STATUS_SUCCESS;
+        }
+    } else if (48U == digest_length) {
+        pal_os_memcpy(&sha384_context, p_context, sizeof(sha384_context));
+        if (0 == wc_Sha384Update(&sha384_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha384_context, sizeof(sha384_context));
+            return_value = PAL_STATUS_SUCCESS;
+        }
+    } else if (64U == digest_length) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        if (0 == wc_Sha512Update(&sha512_context, p_data, data_length)) {
+            pal_os_memcpy(p_context, &sha512_context, sizeof(sha512_context));
+            return_value = PAL_STATUS_SUCCESS;
+        }
+    } else {
+        // Hash algorithm is not supported
+    }
+    return return_value;
+}
+
+pal_status_t pal_crypt_hash_finalize(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    const uint8_t *p_context,
+    uint8_t *p_digest
+) {
+    pal_status_t return_value = PAL_STATUS_FAILURE;
+    wc_Sha256 sha256_context;
+    wc_Sha384 sha384_context;
+    wc_Sha512 sha512_context;
+
+    (void)p_pal_crypt;
+    // Finalized in a local copy, the hash context of the caller remains valid
+    if (32U == digest_length) {
+        pal_os_memcpy(&sha256_context, p_context, sizeof(sha256_context));
+        return_value = (0 == wc_Sha256Final(&sha256_context, p_digest)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+    } else if (48U == digest_length) {
+        pal_os_memcpy(&sha384_context, p_context, sizeof(sha384_context));
+        return_value = (0 == wc_Sha384Final(&sha384_context, p_digest)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+    } else if (64U == digest_length) {
+        pal_os_memcpy(&sha512_context, p_context, sizeof(sha512_context));
+        return_value = (0 == wc_Sha512Final(&sha512_context, p_digest)) ? PAL_STATUS_SUCCESS : PAL_STATUS_FAILURE;
+    } else {
+        // Hash algorithm is not supported
+    }
+    return return_value;
+}
 /// @endcond
 /**
  * @}
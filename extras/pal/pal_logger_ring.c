@@ -0,0 +1,231 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_logger_ring.c
+ *
+ * \brief   This file implements a lock free multi producer binary logger ring with a drain thread
+ *          for POSIX platforms.
+ *
+ * \ingroup  grPAL
+ *
+ * @{
+ */
+
+#include "pal_logger.h"
+
+#ifdef PAL_LOGGER_RING_ENABLED
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "pal_os_timer.h"
+
+#if (PAL_LOGGER_RING_RECORD_COUNT & (PAL_LOGGER_RING_RECORD_COUNT - 1U)) != 0U
+#error "PAL_LOGGER_RING_RECORD_COUNT must be a power of 2"
+#endif
+
+// Ring index of a free running counter
+#define PAL_LOGGER_RING_INDEX(counter) ((counter) & (PAL_LOGGER_RING_RECORD_COUNT - 1U))
+
+/// Records of the ring
+static pal_logger_ring_record_t g_pal_logger_ring[PAL_LOGGER_RING_RECORD_COUNT];
+/// Write counter + 1 of the record committed to each slot, the record is readable once it matches
+static _Atomic uint32_t g_pal_logger_ring_sequence[PAL_LOGGER_RING_RECORD_COUNT];
+/// Free running write counter, slots are claimed by the producers with compare and swap
+static _Atomic uint32_t g_pal_logger_ring_head;
+/// Free running read counter, only modified by the consumer
+static _Atomic uint32_t g_pal_logger_ring_tail;
+/// Number of dropped records
+static _Atomic uint32_t g_pal_logger_ring_overflow_count;
+/// Drain thread is running
+static _Atomic uint8_t g_pal_logger_ring_drain_running;
+/// Drain thread
+static pthread_t g_pal_logger_ring_drain_thread;
+/// Record handler of the drain thread
+static pal_logger_ring_handler_t g_pal_logger_ring_handler;
+
+pal_status_t pal_logger_ring_write(
+    uint8_t layer_id,
+    uint8_t event_id,
+    const uint8_t *p_data,
+    uint16_t data_length
+) {
+    pal_logger_ring_record_t *p_record;
+    uint32_t head = atomic_load_explicit(&g_pal_logger_ring_head, memory_order_relaxed);
+    uint32_t tail;
+
+    // Claim a slot, a concurrent producer which claimed it first reloads head
+    do {
+        tail = atomic_load_explicit(&g_pal_logger_ring_tail, memory_order_acquire);
+        if ((head - tail) >= PAL_LOGGER_RING_RECORD_COUNT) {
+            atomic_fetch_add_explicit(&g_pal_logger_ring_overflow_count, 1U, memory_order_relaxed);
+            return PAL_STATUS_FAILURE;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(
+        &g_pal_logger_ring_head,
+        &head,
+        head + 1U,
+        memory_order_relaxed,
+        memory_order_relaxed
+    ));
+
+    p_record = &g_pal_logger_ring[PAL_LOGGER_RING_INDEX(head)];
+    p_record->timestamp_us = pal_os_timer_get_time_in_microseconds();
+    p_record->layer_id = layer_id;
+    p_record->event_id = event_id;
+    p_record->data_length = data_length;
+    p_record->payload_length =
+        (data_length > PAL_LOGGER_RING_MAX_PAYLOAD) ? PAL_LOGGER_RING_MAX_PAYLOAD : data_length;
+    if ((NULL != p_data) && (0U != p_record->payload_length)) {
+        memcpy(p_record->payload, p_data, p_record->payload_length);
+    } else {
+        p_record->payload_length = 0U;
+    }
+
+    // Commit the record to the consumer
+    atomic_store_explicit(
+        &g_pal_logger_ring_sequence[PAL_LOGGER_RING_INDEX(head)],
+        head + 1U,
+        memory_order_release
+    );
+    return PAL_STATUS_SUCCESS;
+}
+
+// Returns TRUE, if the record of the write counter is committed
+static bool_t pal_logger_ring_is_committed(uint32_t counter) {
+    return (
+        (counter + 1U)
+        == atomic_load_explicit(
+            &g_pal_logger_ring_sequence[PAL_LOGGER_RING_INDEX(counter)],
+            memory_order_acquire
+        )
+    );
+}
+
+pal_status_t pal_logger_ring_read(pal_logger_ring_record_t *p_record) {
+    uint32_t tail = atomic_load_explicit(&g_pal_logger_ring_tail, memory_order_relaxed);
+
+    // Oldest record is not read before its producer committed it, even if later ones are committed
+    if ((NULL == p_record) || (FALSE == pal_logger_ring_is_committed(tail))) {
+        return PAL_STATUS_FAILURE;
+    }
+
+    *p_record = g_pal_logger_ring[PAL_LOGGER_RING_INDEX(tail)];
+    // Release the slot to the producer
+    atomic_store_explicit(&g_pal_logger_ring_tail, tail + 1U, memory_order_release);
+    return PAL_STATUS_SUCCESS;
+}
+
+static void pal_logger_ring_drain(void) {
+    pal_logger_ring_record_t record;
+
+    while (PAL_STATUS_SUCCESS == pal_logger_ring_read(&record)) {
+        g_pal_logger_ring_handler(&record);
+    }
+}
+
+static void *pal_logger_ring_drain_thread(void *p_arg) {
+    const struct timespec interval = {
+        .tv_sec = 0,
+        .tv_nsec = (long)PAL_LOGGER_RING_DRAIN_INTERVAL_US * 1000L};
+
+    (void)p_arg;
+    while (0U != atomic_load_explicit(&g_pal_logger_ring_drain_running, memory_order_acquire)) {
+        pal_logger_ring_drain();
+        nanosleep(&interval, NULL);
+    }
+    return NULL;
+}
+
+pal_status_t pal_logger_ring_start(pal_logger_ring_handler_t handler) {
+    if ((NULL == handler)
+        || (0U != atomic_load_explicit(&g_pal_logger_ring_drain_running, memory_order_acquire))) {
+        return PAL_STATUS_FAILURE;
+    }
+
+    g_pal_logger_ring_handler = handler;
+    atomic_store_explicit(&g_pal_logger_ring_drain_running, 1U, memory_order_release);
+    if (0 != pthread_create(&g_pal_logger_ring_drain_thread, NULL, pal_logger_ring_drain_thread, NULL)) {
+        atomic_store_explicit(&g_pal_logger_ring_drain_running, 0U, memory_order_release);
+        return PAL_STATUS_FAILURE;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+pal_status_t pal_logger_ring_stop(void) {
+    if (0U == atomic_exchange_explicit(&g_pal_logger_ring_drain_running, 0U, memory_order_acq_rel)) {
+        return PAL_STATUS_FAILURE;
+    }
+
+    pthread_join(g_pal_logger_ring_drain_thread, NULL);
+    // Records written after the last iteration of the drain thread
+    pal_logger_ring_drain();
+    return PAL_STATUS_SUCCESS;
+}
+
+uint32_t pal_logger_ring_get_overflow_count(void) {
+    return atomic_load_explicit(&g_pal_logger_ring_overflow_count, memory_order_relaxed);
+}
+
+pal_status_t pal_logger_ring_dump(const char_t *p_file_path) {
+    pal_logger_ring_dump_header_t header;
+    pal_status_t status = PAL_STATUS_FAILURE;
+    uint32_t tail = atomic_load_explicit(&g_pal_logger_ring_tail, memory_order_acquire);
+    uint32_t head = tail;
+    uint32_t counter;
+    FILE *p_file;
+
+    if (NULL == p_file_path) {
+        return PAL_STATUS_FAILURE;
+    }
+    // Committed records up to the first one still written by a producer
+    while (((head - tail) < PAL_LOGGER_RING_RECORD_COUNT)
+           && (TRUE == pal_logger_ring_is_committed(head))) {
+        head++;
+    }
+    p_file = fopen(p_file_path, "wb");
+    if (NULL == p_file) {
+        return PAL_STATUS_FAILURE;
+    }
+
+    header.magic = PAL_LOGGER_RING_DUMP_MAGIC;
+    header.version = PAL_LOGGER_RING_DUMP_VERSION;
+    header.record_size = (uint16_t)sizeof(pal_logger_ring_record_t);
+    header.record_count = head - tail;
+    header.overflow_count = pal_logger_ring_get_overflow_count();
+
+    do {
+        if (1U != fwrite(&header, sizeof(header), 1U, p_file)) {
+            break;
+        }
+        for (counter = tail; counter != head; counter++) {
+            if (1U
+                != fwrite(
+                    &g_pal_logger_ring[PAL_LOGGER_RING_INDEX(counter)],
+                    sizeof(pal_logger_ring_record_t),
+                    1U,
+                    p_file
+                )) {
+                break;
+            }
+        }
+        if (counter == head) {
+            status = PAL_STATUS_SUCCESS;
+        }
+    } while (FALSE);
+
+    fclose(p_file);
+    return status;
+}
+
+#endif  // PAL_LOGGER_RING_ENABLED
+
+/**
+ * @}
+ */
@@ -0,0 +1,263 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_memory_pool.c
+ *
+ * \brief   This file implements a fixed block pool allocator which can be used by the PAL OS memory APIs.
+ *
+ * \ingroup  grPAL
+ *
+ * @{
+ */
+
+#include "pal_os_memory.h"
+
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+
+#ifndef __STDC_NO_ATOMICS__
+#include <stdatomic.h>
+#define PAL_OS_MEMORY_POOL_ATOMIC(type) _Atomic type
+#else
+#include "pal_os_lock.h"
+#define PAL_OS_MEMORY_POOL_ATOMIC(type) volatile type
+#endif
+
+// Rounds the block size to keep every block 8 byte aligned
+#define PAL_OS_MEMORY_POOL_ALIGN(size) (((size) + 7U) & ~((uint32_t)7U))
+// Number of 64 bit words required for the arena of a size class
+#define PAL_OS_MEMORY_POOL_ARENA_WORDS(size) \
+    ((PAL_OS_MEMORY_POOL_ALIGN(size) * PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS) / sizeof(uint64_t))
+// Empty free list / end of free list marker
+#define PAL_OS_MEMORY_POOL_END_OF_LIST (0U)
+// Free list head is the block index (+1) in the lower half and an ABA tag in the upper half
+#define PAL_OS_MEMORY_POOL_HEAD_INDEX(head) ((uint32_t)((head)&0xFFFFFFFFU))
+#define PAL_OS_MEMORY_POOL_HEAD_TAG(head) ((uint32_t)((head) >> 32))
+#define PAL_OS_MEMORY_POOL_MAKE_HEAD(tag, index) ((((uint64_t)(tag)) << 32) | (uint64_t)(index))
+
+/**
+ * \brief Structure to hold the state of one size class of the pool
+ */
+typedef struct pal_os_memory_pool_class {
+    /// Start of the memory arena of the size class
+    uint8_t *p_arena;
+    /// Aligned size of each block
+    uint32_t block_size;
+    /// Head of the free list
+    PAL_OS_MEMORY_POOL_ATOMIC(uint64_t) free_list_head;
+    /// Number of blocks that were never handed out
+    PAL_OS_MEMORY_POOL_ATOMIC(uint32_t) untouched_index;
+    /// Next pointers (block index + 1) of the free list
+    PAL_OS_MEMORY_POOL_ATOMIC(uint32_t) next[PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS];
+    /// Number of blocks currently in use
+    PAL_OS_MEMORY_POOL_ATOMIC(uint32_t) blocks_in_use;
+    /// Highest number of blocks in use
+    PAL_OS_MEMORY_POOL_ATOMIC(uint32_t) high_water_mark;
+    /// Number of requests served from heap
+    PAL_OS_MEMORY_POOL_ATOMIC(uint32_t) heap_fallback_count;
+} pal_os_memory_pool_class_t;
+
+_STATIC_H uint64_t
+    g_pool_small_arena[PAL_OS_MEMORY_POOL_ARENA_WORDS(PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE)];
+_STATIC_H uint64_t
+    g_pool_medium_arena[PAL_OS_MEMORY_POOL_ARENA_WORDS(PAL_OS_MEMORY_POOL_MEDIUM_BLOCK_SIZE)];
+_STATIC_H uint64_t
+    g_pool_large_arena[PAL_OS_MEMORY_POOL_ARENA_WORDS(PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE)];
+
+// Size classes, must be ordered by ascending block size
+_STATIC_H pal_os_memory_pool_class_t g_pal_os_memory_pool[PAL_OS_MEMORY_POOL_CLASS_COUNT] = {
+    {.p_arena = (uint8_t *)g_pool_small_arena,
+     .block_size = PAL_OS_MEMORY_POOL_ALIGN(PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE)},
+    {.p_arena = (uint8_t *)g_pool_medium_arena,
+     .block_size = PAL_OS_MEMORY_POOL_ALIGN(PAL_OS_MEMORY_POOL_MEDIUM_BLOCK_SIZE)},
+    {.p_arena = (uint8_t *)g_pool_large_arena,
+     .block_size = PAL_OS_MEMORY_POOL_ALIGN(PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE)},
+};
+
+#ifndef __STDC_NO_ATOMICS__
+#define PAL_OS_MEMORY_POOL_LOAD(p_object) atomic_load(p_object)
+#define PAL_OS_MEMORY_POOL_STORE(p_object, value) atomic_store(p_object, value)
+#define PAL_OS_MEMORY_POOL_CAS(p_object, p_expected, desired) \
+    atomic_compare_exchange_weak(p_object, p_expected, desired)
+#define PAL_OS_MEMORY_POOL_FETCH_ADD(p_object, value) atomic_fetch_add(p_object, value)
+#define PAL_OS_MEMORY_POOL_FETCH_SUB(p_object, value) atomic_fetch_sub(p_object, value)
+#else
+#define PAL_OS_MEMORY_POOL_LOAD(p_object) (*(p_object))
+#define PAL_OS_MEMORY_POOL_STORE(p_object, value) (*(p_object) = (value))
+#define PAL_OS_MEMORY_POOL_CAS(p_object, p_expected, desired) \
+    pal_os_memory_pool_cas64(p_object, p_expected, desired)
+#define PAL_OS_MEMORY_POOL_FETCH_ADD(p_object, value) \
+    pal_os_memory_pool_fetch_add32(p_object, (uint32_t)(value))
+#define PAL_OS_MEMORY_POOL_FETCH_SUB(p_object, value) \
+    pal_os_memory_pool_fetch_add32(p_object, (uint32_t)(0U - (uint32_t)(value)))
+
+// Compare and swap emulated using the critical section of the platform
+_STATIC_H bool_t
+pal_os_memory_pool_cas64(volatile uint64_t *p_object, uint64_t *p_expected, uint64_t desired) {
+    bool_t swapped = FALSE;
+    pal_os_lock_enter_critical_section();
+    if (*p_object == *p_expected) {
+        *p_object = desired;
+        swapped = TRUE;
+    } else {
+        *p_expected = *p_object;
+    }
+    pal_os_lock_exit_critical_section();
+    return (swapped);
+}
+
+// Fetch and add emulated using the critical section of the platform
+_STATIC_H uint32_t pal_os_memory_pool_fetch_add32(volatile uint32_t *p_object, uint32_t value) {
+    uint32_t previous;
+    pal_os_lock_enter_critical_section();
+    previous = *p_object;
+    *p_object = previous + value;
+    pal_os_lock_exit_critical_section();
+    return (previous);
+}
+#endif
+
+// Counts the allocated block and raises the high-water mark if required
+_STATIC_H void pal_os_memory_pool_account_alloc(pal_os_memory_pool_class_t *p_class) {
+    uint32_t in_use = PAL_OS_MEMORY_POOL_FETCH_ADD(&p_class->blocks_in_use, 1U) + 1U;
+#ifndef __STDC_NO_ATOMICS__
+    uint32_t high_water_mark = atomic_load(&p_class->high_water_mark);
+
+    while ((in_use > high_water_mark)
+           && !atomic_compare_exchange_weak(&p_class->high_water_mark, &high_water_mark, in_use)) {
+        // high_water_mark is reloaded by the failed exchange
+    }
+#else
+    pal_os_lock_enter_critical_section();
+    if (in_use > p_class->high_water_mark) {
+        p_class->high_water_mark = in_use;
+    }
+    pal_os_lock_exit_critical_section();
+#endif
+}
+
+// Pops a block from the free list or hands out a block which was never used
+_STATIC_H void *pal_os_memory_pool_class_alloc(pal_os_memory_pool_class_t *p_class) {
+    void *p_block = NULL;
+    uint64_t head = PAL_OS_MEMORY_POOL_LOAD(&p_class->free_list_head);
+    uint32_t index;
+    uint32_t next;
+
+    do {
+        while (PAL_OS_MEMORY_POOL_END_OF_LIST != PAL_OS_MEMORY_POOL_HEAD_INDEX(head)) {
+            index = PAL_OS_MEMORY_POOL_HEAD_INDEX(head) - 1U;
+            next = PAL_OS_MEMORY_POOL_LOAD(&p_class->next[index]);
+            if (PAL_OS_MEMORY_POOL_CAS(
+                    &p_class->free_list_head,
+                    &head,
+                    PAL_OS_MEMORY_POOL_MAKE_HEAD(PAL_OS_MEMORY_POOL_HEAD_TAG(head) + 1U, next)
+                )) {
+                p_block = p_class->p_arena + (index * p_class->block_size);
+                break;
+            }
+        }
+        if (NULL != p_block) {
+            break;
+        }
+
+        // Free list is empty, use a block which was never handed out
+        index = PAL_OS_MEMORY_POOL_FETCH_ADD(&p_class->untouched_index, 1U);
+        if (index < PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS) {
+            p_block = p_class->p_arena + (index * p_class->block_size);
+        } else {
+            (void)PAL_OS_MEMORY_POOL_FETCH_SUB(&p_class->untouched_index, 1U);
+        }
+    } while (FALSE);
+
+    if (NULL != p_block) {
+        pal_os_memory_pool_account_alloc(p_class);
+    }
+    return (p_block);
+}
+
+void *pal_os_memory_pool_alloc(uint32_t block_size) {
+    void *p_block = NULL;
+    pal_os_memory_pool_class_t *p_first_fit = NULL;
+    uint8_t class_index;
+
+    for (class_index = 0; class_index < PAL_OS_MEMORY_POOL_CLASS_COUNT; class_index++) {
+        if ((0U == block_size) || (block_size > g_pal_os_memory_pool[class_index].block_size)) {
+            continue;
+        }
+        if (NULL == p_first_fit) {
+            p_first_fit = &g_pal_os_memory_pool[class_index];
+        }
+        // Spill over into the next larger class if the fitting class is exhausted
+        p_block = pal_os_memory_pool_class_alloc(&g_pal_os_memory_pool[class_index]);
+        if (NULL != p_block) {
+            break;
+        }
+    }
+
+    if ((NULL == p_block) && (NULL != p_first_fit)) {
+        (void)PAL_OS_MEMORY_POOL_FETCH_ADD(&p_first_fit->heap_fallback_count, 1U);
+    }
+    return (p_block);
+}
+
+bool_t pal_os_memory_pool_free(void *p_block) {
+    bool_t is_pool_block = FALSE;
+    pal_os_memory_pool_class_t *p_class;
+    uint8_t *p_byte = (uint8_t *)p_block;
+    uint8_t class_index;
+    uint32_t index;
+    uint64_t head;
+
+    for (class_index = 0; class_index < PAL_OS_MEMORY_POOL_CLASS_COUNT; class_index++) {
+        p_class = &g_pal_os_memory_pool[class_index];
+        if ((p_byte < p_class->p_arena)
+            || (p_byte
+                >= (p_class->p_arena + (p_class->block_size * PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS))
+            )) {
+            continue;
+        }
+
+        index = (uint32_t)((uint32_t)(p_byte - p_class->p_arena) / p_class->block_size);
+        head = PAL_OS_MEMORY_POOL_LOAD(&p_class->free_list_head);
+        do {
+            PAL_OS_MEMORY_POOL_STORE(&p_class->next[index], PAL_OS_MEMORY_POOL_HEAD_INDEX(head));
+        } while (!PAL_OS_MEMORY_POOL_CAS(
+            &p_class->free_list_head,
+            &head,
+            PAL_OS_MEMORY_POOL_MAKE_HEAD(PAL_OS_MEMORY_POOL_HEAD_TAG(head) + 1U, index + 1U)
+        ));
+        (void)PAL_OS_MEMORY_POOL_FETCH_SUB(&p_class->blocks_in_use, 1U);
+        is_pool_block = TRUE;
+        break;
+    }
+    return (is_pool_block);
+}
+
+pal_status_t
+pal_os_memory_pool_get_stats(uint8_t class_index, pal_os_memory_pool_stats_t *p_stats) {
+    pal_status_t return_status = PAL_STATUS_INVALID_INPUT;
+    pal_os_memory_pool_class_t *p_class;
+
+    do {
+        if ((NULL == p_stats) || (PAL_OS_MEMORY_POOL_CLASS_COUNT <= class_index)) {
+            break;
+        }
+        p_class = &g_pal_os_memory_pool[class_index];
+        p_stats->block_size = p_class->block_size;
+        p_stats->block_count = (uint16_t)PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS;
+        p_stats->blocks_in_use = (uint16_t)PAL_OS_MEMORY_POOL_LOAD(&p_class->blocks_in_use);
+        p_stats->high_water_mark = (uint16_t)PAL_OS_MEMORY_POOL_LOAD(&p_class->high_water_mark);
+        p_stats->heap_fallback_count = PAL_OS_MEMORY_POOL_LOAD(&p_class->heap_fallback_count);
+        return_status = PAL_STATUS_SUCCESS;
+    } while (FALSE);
+
+    return (return_status);
+}
+
+#endif  // PAL_OS_MEMORY_POOL_ENABLED
+
+/**
+ * @}
+ */
@@ -3,15 +3,17 @@
 # SPDX-License-Identifier: MIT
 
 # Add include directories
+include_directories(${PROJECT_SOURCE_DIR}/../extras/pal/test_pal)
 
 aux_source_directory(${PROJECT_SOURCE_DIR}/../extras/pal/test_pal PAL_FILES)
+list(APPEND PAL_FILES ${PROJECT_SOURCE_DIR}/../extras/pal/pal_os_memory_pool.c ${PROJECT_SOURCE_DIR}/../extras/pal/pal_logger_ring.c ${PROJECT_SOURCE_DIR}/../extras/pal/linux/pal_os_executor.c)
 
 if(BUILD_MBEDTLS_3)
-add_compile_options(-Wall -fprofile-arcs -ftest-coverage --coverage -DMBEDTLS_USER_CONFIG_FILE="../config/mbedtls_3.x_default_config.h" -DOPTIGA_USE_SOFT_RESET -DPAL_OS_HAS_EVENT_INIT)
+add_compile_options(-Wall -fprofile-arcs -ftest-coverage --coverage -DMBEDTLS_USER_CONFIG_FILE="../config/mbedtls_3.x_default_config.h" -DOPTIGA_USE_SOFT_RESET -DPAL_OS_HAS_EVENT_INIT -DPAL_OS_MEMORY_POOL_ENABLED -DOPTIGA_UTIL_POWER_MANAGER_ENABLED -DOPTIGA_UTIL_SLOT_MANAGER_ENABLED -DOPTIGA_UTIL_READ_CACHE_ENABLED -DOPTIGA_UTIL_METADATA_STORE_ENABLED -DOPTIGA_UTIL_WRITE_BEHIND_ENABLED -DOPTIGA_UTIL_SEC_GOVERNOR_ENABLED -DOPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED -DOPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED -DOPTIGA_COMMS_FAST_RECOVERY_ENABLED -DOPTIGA_COMMS_GPIOD_RESET_ENABLED -DPAL_LOGGER_RING_ENABLED -DPAL_OS_EXECUTOR_ENABLED -DOPTIGA_CRYPT_HOST_VERIFY_ENABLED -DOPTIGA_CRYPT_RANDOM_POOL_ENABLED -DOPTIGA_CRYPT_HOST_HASH_ENABLED -DOPTIGA_CRYPT_ECDHE_POOL_ENABLED -DOPTIGA_CRYPT_RESULT_CACHE_ENABLED -DOPTIGA_CRYPT_KEY_SCHEDULE_ENABLED)
 else()
-add_compile_options(-Wall -fprofile-arcs -ftest-coverage --coverage -DMBEDTLS_USER_CONFIG_FILE="../config/mbedtls_default_config.h" -DOPTIGA_USE_SOFT_RESET -DPAL_OS_HAS_EVENT_INIT)
+add_compile_options(-Wall -fprofile-arcs -ftest-coverage --coverage -DMBEDTLS_USER_CONFIG_FILE="../config/mbedtls_default_config.h" -DOPTIGA_USE_SOFT_RESET -DPAL_OS_HAS_EVENT_INIT -DPAL_OS_MEMORY_POOL_ENABLED -DOPTIGA_UTIL_POWER_MANAGER_ENABLED -DOPTIGA_UTIL_SLOT_MANAGER_ENABLED -DOPTIGA_UTIL_READ_CACHE_ENABLED -DOPTIGA_UTIL_METADATA_STORE_ENABLED -DOPTIGA_UTIL_WRITE_BEHIND_ENABLED -DOPTIGA_UTIL_SEC_GOVERNOR_ENABLED -DOPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED -DOPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED -DOPTIGA_COMMS_FAST_RECOVERY_ENABLED -DOPTIGA_COMMS_GPIOD_RESET_ENABLED -DPAL_LOGGER_RING_ENABLED -DPAL_OS_EXECUTOR_ENABLED -DOPTIGA_CRYPT_HOST_VERIFY_ENABLED -DOPTIGA_CRYPT_RANDOM_POOL_ENABLED -DOPTIGA_CRYPT_HOST_HASH_ENABLED -DOPTIGA_CRYPT_ECDHE_POOL_ENABLED -DOPTIGA_CRYPT_RESULT_CACHE_ENABLED -DOPTIGA_CRYPT_KEY_SCHEDULE_ENABLED)
 endif()
-add_link_options(-lrt -fprofile-arcs -ftest-coverage --coverage)
+add_link_options(-lrt -lpthread -fprofile-arcs -ftest-coverage --coverage)
 
 add_library(optiga_trust_M_lib STATIC 
     ${SRC_CMD_FILES}
@@ -22,6 +22,7 @@
 #include <unistd.h>
 
 #include "errno.h"
+#include "pal_i2c_test.h"
 #include "pal_ifx_i2c_config.h"
 #include "pal_linux.h"
 
@@ -80,8 +81,12 @@ pal_status_t pal_gpio_deinit(const pal_gpio_t *p_gpio_context) {
  * \retval  None
  */
 void pal_gpio_set_high(const pal_gpio_t *p_gpio_context) {
-    /* Dummy component*/
-    return;
+    const pal_i2c_test_slave_t *p_slave = pal_i2c_test_get_slave();
+
+    /* Dummy component, the level is only passed to the attached slave */
+    if ((NULL != p_slave) && (NULL != p_slave->gpio)) {
+        p_slave->gpio(p_slave->p_ctx, p_gpio_context, HIGH);
+    }
 }
 
 /**
@@ -99,8 +104,64 @@ void pal_gpio_set_high(const pal_gpio_t *p_gpio_context) {
  * \retval  None
  */
 void pal_gpio_set_low(const pal_gpio_t *p_gpio_context) {
-    /* Dummy component*/
-    return;
+    const pal_i2c_test_slave_t *p_slave = pal_i2c_test_get_slave();
+
+    /* Dummy component, the level is only passed to the attached slave */
+    if ((NULL != p_slave) && (NULL != p_slave->gpio)) {
+        p_slave->gpio(p_slave->p_ctx, p_gpio_context, LOW);
+    }
+}
+
+static const pal_gpio_t *gp_pal_gpio_ready = NULL;
+
+/**
+ * @brief Drives the GPIO pin low for the given time and then high again
+ *
+ *<b>API Details:</b>
+ * - Both levels are passed to the attached slave<br>
+ *
+ * \retval  #PAL_STATUS_SUCCESS  Always
+ */
+pal_status_t pal_gpio_pulse_low(const pal_gpio_t *p_gpio_context, uint32_t low_time_us) {
+    pal_gpio_set_low(p_gpio_context);
+    usleep(low_time_us);
+    pal_gpio_set_high(p_gpio_context);
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Watches the ready line
+ *
+ *<b>API Details:</b>
+ * - Dummy component, the ready line is provided by the attached slave<br>
+ *
+ * \retval  #PAL_STATUS_SUCCESS  Attached slave provides the ready line
+ * \retval  #PAL_STATUS_FAILURE  No ready line
+ */
+pal_status_t pal_gpio_watch_ready(const pal_gpio_t *p_ready_gpio) {
+    const pal_i2c_test_slave_t *p_slave = pal_i2c_test_get_slave();
+
+    if ((NULL == p_ready_gpio) || (NULL == p_slave) || (NULL == p_slave->is_ready)) {
+        return PAL_STATUS_FAILURE;
+    }
+    gp_pal_gpio_ready = p_ready_gpio;
+    return PAL_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Checks the watched ready line
+ *
+ * \retval  #PAL_STATUS_SUCCESS  Attached slave signalled ready
+ * \retval  #PAL_STATUS_FAILURE  Not ready yet or no ready line watched
+ */
+pal_status_t pal_gpio_is_ready(const pal_gpio_t *p_ready_gpio) {
+    const pal_i2c_test_slave_t *p_slave = pal_i2c_test_get_slave();
+
+    if ((NULL == gp_pal_gpio_ready) || (p_ready_gpio != gp_pal_gpio_ready) || (NULL == p_slave)
+        || (NULL == p_slave->is_ready)) {
+        return PAL_STATUS_FAILURE;
+    }
+    return (p_slave->is_ready(p_slave->p_ctx));
 }
 
 /**
@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <unistd.h>
 
+#include "pal_i2c_test.h"
 #include "pal_linux.h"
 
 /* Define LOG_HAL as normal stdio printf */
@@ -36,6 +37,19 @@ static volatile uint32_t g_entry_count = 0;
 /* Pointer to the current pal i2c context*/
 static pal_i2c_t *gp_pal_i2c_current_ctx;
 
+/* Slave attached by the test, transfers complete without data if none is attached */
+static const pal_i2c_test_slave_t *gp_pal_i2c_test_slave = NULL;
+
+/* Attach the slave */
+void pal_i2c_test_attach_slave(const pal_i2c_test_slave_t *p_slave) {
+    gp_pal_i2c_test_slave = p_slave;
+}
+
+/* Get the attached slave */
+const pal_i2c_test_slave_t *pal_i2c_test_get_slave(void) {
+    return gp_pal_i2c_test_slave;
+}
+
 /* Slave address Event handler */
 _STATIC_H void ut_pal_slave_addr_event_handler(void *p_ctx, optiga_lib_status_t event) {
     (void)(p_ctx);
@@ -86,7 +100,10 @@ pal_status_t pal_i2c_init(const pal_i2c_t *p_i2c_context) {
 
     pal_i2c_t *ut_p_i2c_ctx = (pal_i2c_t *)p_i2c_context;
 
-    ut_p_i2c_ctx->upper_layer_event_handler = (void *)ut_pal_slave_addr_event_handler;
+    /* The events are passed to the stack, if a slave is attached */
+    if (NULL == gp_pal_i2c_test_slave) {
+        ut_p_i2c_ctx->upper_layer_event_handler = (void *)ut_pal_slave_addr_event_handler;
+    }
 
     return PAL_STATUS_SUCCESS;
 }
@@ -108,8 +125,15 @@ pal_status_t pal_i2c_write(const pal_i2c_t *p_i2c_context, uint8_t *p_data, uint
     if (PAL_STATUS_SUCCESS == pal_i2c_acquire()) {
         /* Pointing to the current I2C Context */
         gp_pal_i2c_current_ctx = (pal_i2c_t *)p_i2c_context;
-        /* Dummy component - Not write action is hapenning */
-        i2c_master_end_of_transmit_callback();
+        if ((NULL != gp_pal_i2c_test_slave)
+            && (PAL_STATUS_SUCCESS
+                != gp_pal_i2c_test_slave->write(gp_pal_i2c_test_slave->p_ctx, p_data, length))) {
+            /* Slave did not acknowledge */
+            invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_ERROR);
+        } else {
+            /* Dummy component - Not write action is hapenning, if no slave is attached */
+            i2c_master_end_of_transmit_callback();
+        }
         status = PAL_STATUS_SUCCESS;
     } else {
         /* I2C is busy, couldn'e acquire the lock */
@@ -130,8 +154,15 @@ pal_status_t pal_i2c_read(const pal_i2c_t *p_i2c_context, uint8_t *p_data, uint1
     if (PAL_STATUS_SUCCESS == pal_i2c_acquire()) {
         /* Pointing to the current I2C Context */
         gp_pal_i2c_current_ctx = (pal_i2c_t *)p_i2c_context;
-        /* Dummy component - Not read action is hapenning */
-        i2c_master_end_of_receive_callback();
+        if ((NULL != gp_pal_i2c_test_slave)
+            && (PAL_STATUS_SUCCESS
+                != gp_pal_i2c_test_slave->read(gp_pal_i2c_test_slave->p_ctx, p_data, length))) {
+            /* Slave did not acknowledge */
+            invoke_upper_layer_callback(gp_pal_i2c_current_ctx, PAL_I2C_EVENT_ERROR);
+        } else {
+            /* Dummy component - Not read action is hapenning, if no slave is attached */
+            i2c_master_end_of_receive_callback();
+        }
         i2c_read_status = PAL_STATUS_SUCCESS;
     } else {
         /* I2C is busy, couldn'e acquire the lock */
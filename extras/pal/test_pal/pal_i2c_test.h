@@ -0,0 +1,59 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_i2c_test.h
+ *
+ * \brief   This file provides the hooks of the test platform abstraction layer to attach an emulated I2C slave.
+ *
+ * \ingroup  grPAL
+ * @{
+ */
+
+#ifndef _PAL_I2C_TEST_H_
+#define _PAL_I2C_TEST_H_
+
+#include "pal_gpio.h"
+#include "pal_i2c.h"
+
+/** @brief I2C slave attached to the test platform abstraction layer */
+typedef struct pal_i2c_test_slave {
+    /// Receives the data written by the master, a failure is reported as missing acknowledge
+    pal_status_t (*write)(void *p_ctx, const uint8_t *p_data, uint16_t length);
+    /// Provides the data read by the master, a failure is reported as missing acknowledge
+    pal_status_t (*read)(void *p_ctx, uint8_t *p_data, uint16_t length);
+    /// Notifies the level driven on a GPIO, optional
+    void (*gpio)(void *p_ctx, const pal_gpio_t *p_gpio_context, uint8_t level);
+    /// Checks without blocking whether the slave signalled ready after a reset, optional
+    pal_status_t (*is_ready)(void *p_ctx);
+    /// Context passed to the callbacks
+    void *p_ctx;
+} pal_i2c_test_slave_t;
+
+/**
+ * \brief Attaches an I2C slave to the test platform abstraction layer.
+ *
+ * \details
+ * - The transfers of #pal_i2c_write and #pal_i2c_read are passed to the slave.
+ * - The levels set with #pal_gpio_set_high and #pal_gpio_set_low are passed to the slave.
+ * - The ready line can be watched with #pal_gpio_watch_ready, if the slave provides is_ready.
+ * - Passing NULL detaches the slave, the transfers complete without any data as before.
+ *
+ * \param[in] p_slave          Slave to attach, NULL to detach
+ */
+void pal_i2c_test_attach_slave(const pal_i2c_test_slave_t *p_slave);
+
+/**
+ * \brief Provides the I2C slave attached to the test platform abstraction layer.
+ *
+ * \retval    Attached slave, NULL if none is attached
+ */
+const pal_i2c_test_slave_t *pal_i2c_test_get_slave(void);
+
+#endif /* _PAL_I2C_TEST_H_ */
+
+/**
+ * @}
+ */
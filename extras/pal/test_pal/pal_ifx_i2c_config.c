@@ -87,6 +87,15 @@ pal_gpio_t optiga_reset_0 = {
     // Platform specific GPIO context for the pin used to toggle Reset, dummy component = no hardware
     NULL};
 
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/**
+ * \brief PAL ready line configuration for OPTIGA.
+ */
+pal_gpio_t optiga_ready_0 = {
+    // Platform specific GPIO context for the ready line, dummy component = no hardware
+    NULL};
+#endif
+
 /**
  * @}
  */
@@ -52,6 +52,11 @@
 /* Signal Definition */
 #define SIG SIGRTMIN
 
+struct dbg_ev { char op; void *cb; uint32_t t; uint32_t us; };
+struct dbg_ev dbg_evs[64]; unsigned dbg_evn;
+#define DBGEV(o, c, u) do { struct dbg_ev *x = &dbg_evs[dbg_evn++ % 64]; x->op = (o); x->cb = (void *)(c); x->t = 0; x->us = (u); } while (0)
+static timer_t timerid;
+void dbg_ev_dump(void) { unsigned i; struct itimerspec cur; timer_gettime(timerid, &cur); fprintf(stderr, " timer %ld.%09ld n%u\n", (long)cur.it_value.tv_sec, cur.it_value.tv_nsec, dbg_evn); for (i = (dbg_evn > 24 ? dbg_evn - 24 : 0); i < dbg_evn; i++) { struct dbg_ev *x = &dbg_evs[i % 64]; fprintf(stderr, " ev %c %p t%u us%u\n", x->op, x->cb, x->t, x->us); } }
 /* pal os event handler */
 static void pal_os_event_handler(int sig, siginfo_t *si, void *uc) {
     TRUSTM_PAL_EVENT_DBGFN(">");
@@ -62,7 +67,6 @@ static void pal_os_event_handler(int sig, siginfo_t *si, void *uc) {
 /* local pal os event 0 definition */
 static pal_os_event_t pal_os_event_0 = {0};
 /* Local timer definition */
-static timer_t timerid;
 
 /* Start pal os event */
 void pal_os_event_start(
@@ -85,6 +89,7 @@ void pal_os_event_start(
 void pal_os_event_stop(pal_os_event_t *p_pal_os_event) {
     TRUSTM_PAL_EVENT_DBGFN(">");
     /* Set event as not triggered */
+    DBGEV('S', 0, 0);
     p_pal_os_event->is_event_triggered = FALSE;
     TRUSTM_PAL_EVENT_DBGFN("<");
 }
@@ -115,6 +120,7 @@ pal_os_event_t *pal_os_event_create(register_callback callback, void *callback_a
             exit(1);
         }
 
+        DBGEV('C', 0, 0);
         /* Start pal os event */
         pal_os_event_start(&pal_os_event_0, callback, callback_args);
     }
@@ -141,6 +147,7 @@ void pal_os_event_trigger_registered_callback(void) {
         exit(1);
     }
 
+    DBGEV('T', pal_os_event_0.callback_registered, 0);
     /* If a callaback is registered */
     if (pal_os_event_0.callback_registered) {
         callback = pal_os_event_0.callback_registered;
@@ -166,6 +173,7 @@ void pal_os_event_register_callback_oneshot(
 
     TRUSTM_PAL_EVENT_DBGFN(">");
 
+    DBGEV('R', callback, time_us);
     /* Set callback and arguments in the event */
     p_pal_os_event->callback_registered = callback;
     p_pal_os_event->callback_ctx = callback_args;
@@ -193,6 +201,7 @@ void pal_os_event_register_callback_oneshot(
 void pal_os_event_destroy(pal_os_event_t *pal_os_event) {
     TRUSTM_PAL_EVENT_DBGFN(">");
     /* delete local timer */
+    DBGEV('D', 0, 0);
     timer_delete(timerid);
     TRUSTM_PAL_EVENT_DBGFN("<");
 }
@@ -0,0 +1,486 @@
+# SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+#
+# SPDX-License-Identifier: MIT
+
+# Generates a specialised library configuration (OPTIGA_LIB_EXTERNAL) from the operations an application calls
+# and reports the flash and RAM footprint of the library per module.
+#
+# Usage from a CMake project:
+#   include(<optiga-trust-m>/extras/profile/optiga_profile.cmake)
+#   optiga_profile_generate(${CMAKE_BINARY_DIR}/optiga_lib_config_profile.h
+#       OPERATIONS optiga_util_open_application optiga_util_read_data optiga_crypt_ecdsa_sign
+#       [BASE m_v3|m_v1] [DATA_LENGTH <bytes>] [FEATURES <additional macros>])
+#   target_compile_definitions(optiga_trust_M_lib PUBLIC
+#       OPTIGA_LIB_EXTERNAL="${CMAKE_BINARY_DIR}/optiga_lib_config_profile.h")
+#   optiga_profile_size_report(optiga_trust_M_lib)
+#
+# Usage in script mode:
+#   cmake -DOPTIGA_PROFILE_OUTPUT=<header> -DOPTIGA_PROFILE_OPERATIONS="<op>;<op>"
+#         [-DOPTIGA_PROFILE_BASE=m_v1] [-DOPTIGA_PROFILE_DATA_LENGTH=<bytes>] [-DOPTIGA_PROFILE_FEATURES="<macro>"]
+#         -P optiga_profile.cmake
+#   cmake -DOPTIGA_PROFILE_SIZE_LIBRARY=<static library> [-DOPTIGA_PROFILE_SIZE_TOOL=<size utility>]
+#         -P optiga_profile.cmake
+#   cmake -DOPTIGA_PROFILE_CHECK_DIR=<directory> [-DOPTIGA_PROFILE_BASE=m_v1] [-DOPTIGA_PROFILE_CHECK_COMPILER=<cc>]
+#         -P optiga_profile.cmake
+
+set(OPTIGA_PROFILE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# Maximum buffer size required to communicate with OPTIGA
+set(OPTIGA_PROFILE_MAX_COMMS_BUFFER_SIZE 1557)
+# Default length of the data sent or received in one command by the operations which chain long data
+set(OPTIGA_PROFILE_DEFAULT_DATA_LENGTH 256)
+
+# Operation table: <operation> <largest APDU without chained data> <chained data (0/1)> <feature macros...>
+# The APDU size covers the command and the response including the TLV headers, for the largest key and data
+# sizes the operation accepts.
+set(OPTIGA_PROFILE_OPERATIONS_TABLE
+    "optiga_util_open_application 64 0"
+    "optiga_util_close_application 64 0"
+    "optiga_util_update_count 32 0"
+    "optiga_util_read_data 16 1"
+    "optiga_util_read_metadata 80 0"
+    "optiga_util_write_data 16 1"
+    "optiga_util_write_metadata 80 0"
+    "optiga_util_protected_update_start 656 0"
+    "optiga_util_protected_update_continue 656 0"
+    "optiga_util_protected_update_final 656 0"
+    "optiga_util_protected_update_stream 656 0 OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED"
+    "optiga_util_protected_update_stream_resume 656 0 OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED"
+    "optiga_util_power_manager_start 64 0 OPTIGA_UTIL_POWER_MANAGER_ENABLED"
+    "optiga_util_power_manager_stop 64 0 OPTIGA_UTIL_POWER_MANAGER_ENABLED"
+    "optiga_util_power_manager_get_stats 0 0 OPTIGA_UTIL_POWER_MANAGER_ENABLED"
+    "optiga_util_slot_manager_start 80 1 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_manager_stop 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_manager_sync 16 1 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_allocate 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_free 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_record_write 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_lookup 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_slot_get_info 0 0 OPTIGA_UTIL_SLOT_MANAGER_ENABLED"
+    "optiga_util_read_cache_enable 0 0 OPTIGA_UTIL_READ_CACHE_ENABLED"
+    "optiga_util_read_cache_set_ttl 0 0 OPTIGA_UTIL_READ_CACHE_ENABLED"
+    "optiga_util_read_cache_set_read_ahead 0 0 OPTIGA_UTIL_READ_CACHE_ENABLED"
+    "optiga_util_read_cache_flush 0 0 OPTIGA_UTIL_READ_CACHE_ENABLED"
+    "optiga_util_read_cache_get_stats 0 0 OPTIGA_UTIL_READ_CACHE_ENABLED"
+    "optiga_util_metadata_store_start 80 1 OPTIGA_UTIL_METADATA_STORE_ENABLED"
+    "optiga_util_metadata_store_refresh 80 1 OPTIGA_UTIL_METADATA_STORE_ENABLED"
+    "optiga_util_metadata_store_stop 0 0 OPTIGA_UTIL_METADATA_STORE_ENABLED"
+    "optiga_util_metadata_get 0 0 OPTIGA_UTIL_METADATA_STORE_ENABLED"
+    "optiga_util_metadata_find 0 0 OPTIGA_UTIL_METADATA_STORE_ENABLED"
+    "optiga_util_write_behind_start 0 0 OPTIGA_UTIL_WRITE_BEHIND_ENABLED"
+    "optiga_util_write_behind_stop 0 0 OPTIGA_UTIL_WRITE_BEHIND_ENABLED"
+    "optiga_util_write_behind_flush 16 1 OPTIGA_UTIL_WRITE_BEHIND_ENABLED"
+    "optiga_util_write_behind_barrier 16 1 OPTIGA_UTIL_WRITE_BEHIND_ENABLED"
+    "optiga_util_write_behind_get_stats 0 0 OPTIGA_UTIL_WRITE_BEHIND_ENABLED"
+    "optiga_util_sec_governor_start 16 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_sec_governor_stop 0 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_sec_governor_refresh 16 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_sec_governor_admit 16 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_sec_governor_release 0 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_sec_governor_get_stats 0 0 OPTIGA_UTIL_SEC_GOVERNOR_ENABLED"
+    "optiga_util_performance_profile_start 16 0 OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED"
+    "optiga_util_performance_profile_stop 0 0 OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED"
+    "optiga_util_performance_profile_set 16 0 OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED"
+    "optiga_util_performance_profile_get_state 0 0 OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED"
+    "optiga_util_performance_profile_get_benchmark 0 0 OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED"
+    "optiga_crypt_random 272 0 OPTIGA_CRYPT_RANDOM_ENABLED"
+    "optiga_crypt_random_pool_enable 272 0 OPTIGA_CRYPT_RANDOM_ENABLED OPTIGA_CRYPT_RANDOM_POOL_ENABLED"
+    "optiga_crypt_random_pool_disable 0 0 OPTIGA_CRYPT_RANDOM_ENABLED OPTIGA_CRYPT_RANDOM_POOL_ENABLED"
+    "optiga_crypt_hash 256 1 OPTIGA_CRYPT_HASH_ENABLED"
+    "optiga_crypt_hash_start 256 1 OPTIGA_CRYPT_HASH_ENABLED"
+    "optiga_crypt_hash_update 256 1 OPTIGA_CRYPT_HASH_ENABLED"
+    "optiga_crypt_hash_finalize 256 1 OPTIGA_CRYPT_HASH_ENABLED"
+    "optiga_crypt_hash_stream 256 1 OPTIGA_CRYPT_HASH_ENABLED OPTIGA_CRYPT_HASH_STREAM_ENABLED"
+    "optiga_crypt_set_hash_engine 0 0 OPTIGA_CRYPT_HASH_ENABLED OPTIGA_CRYPT_HOST_HASH_ENABLED"
+    "optiga_crypt_ecc_generate_keypair 176 0 OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED"
+    "optiga_crypt_ecdhe_pool_start 176 0 OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED OPTIGA_CRYPT_ECDHE_POOL_ENABLED"
+    "optiga_crypt_ecdhe_pool_stop 0 0 OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED OPTIGA_CRYPT_ECDHE_POOL_ENABLED"
+    "optiga_crypt_ecdhe_pool_get_stats 0 0 OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED OPTIGA_CRYPT_ECDHE_POOL_ENABLED"
+    "optiga_crypt_ecdsa_sign 160 0 OPTIGA_CRYPT_ECDSA_SIGN_ENABLED"
+    "optiga_crypt_ecdsa_sign_batch 160 0 OPTIGA_CRYPT_ECDSA_SIGN_ENABLED OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED"
+    "optiga_crypt_ecdsa_verify 352 0 OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED"
+    "optiga_crypt_set_verify_policy 0 0 OPTIGA_CRYPT_HOST_VERIFY_ENABLED"
+    "optiga_crypt_ecdh 192 0 OPTIGA_CRYPT_ECDH_ENABLED"
+    "optiga_crypt_key_schedule 512 0 OPTIGA_CRYPT_ECDH_ENABLED OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED"
+    "optiga_crypt_tls_prf 512 0 OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED"
+    "optiga_crypt_tls_prf_sha256 512 0 OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED"
+    "optiga_crypt_tls_prf_sha384 512 0 OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED"
+    "optiga_crypt_tls_prf_sha512 512 0 OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED"
+    "optiga_crypt_hkdf 512 0 OPTIGA_CRYPT_HKDF_ENABLED"
+    "optiga_crypt_hkdf_sha256 512 0 OPTIGA_CRYPT_HKDF_ENABLED"
+    "optiga_crypt_hkdf_sha384 512 0 OPTIGA_CRYPT_HKDF_ENABLED"
+    "optiga_crypt_hkdf_sha512 512 0 OPTIGA_CRYPT_HKDF_ENABLED"
+    "optiga_crypt_rsa_generate_keypair 288 0 OPTIGA_CRYPT_RSA_GENERATE_KEYPAIR_ENABLED"
+    "optiga_crypt_rsa_sign 288 0 OPTIGA_CRYPT_RSA_SIGN_ENABLED"
+    "optiga_crypt_rsa_verify 608 0 OPTIGA_CRYPT_RSA_VERIFY_ENABLED"
+    "optiga_crypt_rsa_generate_pre_master_secret 96 0 OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED"
+    "optiga_crypt_rsa_encrypt_message 528 0 OPTIGA_CRYPT_RSA_ENCRYPT_ENABLED"
+    "optiga_crypt_rsa_encrypt_session 528 0 OPTIGA_CRYPT_RSA_ENCRYPT_ENABLED"
+    "optiga_crypt_rsa_decrypt_and_export 288 0 OPTIGA_CRYPT_RSA_DECRYPT_ENABLED"
+    "optiga_crypt_rsa_decrypt_and_store 288 0 OPTIGA_CRYPT_RSA_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt_ecb 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt_start 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt_continue 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt_final 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED"
+    "optiga_crypt_symmetric_encrypt_stream 720 0 OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED OPTIGA_CRYPT_SYM_STREAM_ENABLED"
+    "optiga_crypt_symmetric_decrypt 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_decrypt_ecb 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_decrypt_start 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_decrypt_continue 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_decrypt_final 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED"
+    "optiga_crypt_symmetric_decrypt_stream 720 0 OPTIGA_CRYPT_SYM_DECRYPT_ENABLED OPTIGA_CRYPT_SYM_STREAM_ENABLED"
+    "optiga_crypt_hmac 720 0 OPTIGA_CRYPT_HMAC_ENABLED"
+    "optiga_crypt_hmac_start 720 0 OPTIGA_CRYPT_HMAC_ENABLED"
+    "optiga_crypt_hmac_update 720 0 OPTIGA_CRYPT_HMAC_ENABLED"
+    "optiga_crypt_hmac_finalize 720 0 OPTIGA_CRYPT_HMAC_ENABLED"
+    "optiga_crypt_hmac_stream 720 0 OPTIGA_CRYPT_HMAC_ENABLED OPTIGA_CRYPT_SYM_STREAM_ENABLED"
+    "optiga_crypt_hmac_verify 768 0 OPTIGA_CRYPT_HMAC_VERIFY_ENABLED"
+    "optiga_crypt_symmetric_generate_key 64 0 OPTIGA_CRYPT_SYM_GENERATE_KEY_ENABLED"
+    "optiga_crypt_generate_auth_code 96 0 OPTIGA_CRYPT_GENERATE_AUTH_CODE_ENABLED"
+    "optiga_crypt_clear_auto_state 32 0 OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED"
+)
+
+# Operations which are not supported by OPTIGA Trust M V1
+set(OPTIGA_PROFILE_M_V1_UNSUPPORTED_FEATURES
+    OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED
+    OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED
+    OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
+    OPTIGA_CRYPT_ECC_BRAINPOOL_P_R1_ENABLED
+    OPTIGA_CRYPT_RSA_SSA_SHA512_ENABLED
+    OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
+    OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
+    OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    OPTIGA_CRYPT_HMAC_ENABLED
+    OPTIGA_CRYPT_HKDF_ENABLED
+    OPTIGA_CRYPT_SYM_GENERATE_KEY_ENABLED
+    OPTIGA_CRYPT_GENERATE_AUTH_CODE_ENABLED
+    OPTIGA_CRYPT_HMAC_VERIFY_ENABLED
+    OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED
+)
+
+# Generates the configuration header <output> which enables only the features of the given operations and sizes
+# OPTIGA_MAX_COMMS_BUFFER_SIZE to the largest APDU of them.
+function(optiga_profile_generate output)
+    cmake_parse_arguments(PROFILE "" "BASE;DATA_LENGTH" "OPERATIONS;FEATURES" ${ARGN})
+
+    if(NOT PROFILE_BASE)
+        set(PROFILE_BASE m_v3)
+    endif()
+    if(NOT PROFILE_DATA_LENGTH)
+        set(PROFILE_DATA_LENGTH ${OPTIGA_PROFILE_DEFAULT_DATA_LENGTH})
+    endif()
+    set(base_header ${OPTIGA_PROFILE_DIR}/../../include/optiga_lib_config_${PROFILE_BASE}.h)
+    if(NOT EXISTS ${base_header})
+        message(FATAL_ERROR "optiga_profile: unknown BASE ${PROFILE_BASE}")
+    endif()
+    if(NOT PROFILE_OPERATIONS)
+        message(FATAL_ERROR "optiga_profile: no OPERATIONS given")
+    endif()
+
+    # Every application opens the application on OPTIGA, the buffer always fits OpenApplication
+    set(operations optiga_util_open_application ${PROFILE_OPERATIONS})
+    list(REMOVE_DUPLICATES operations)
+
+    set(features ${PROFILE_FEATURES})
+    set(buffer_size 0)
+    foreach(operation ${operations})
+        set(found FALSE)
+        foreach(entry ${OPTIGA_PROFILE_OPERATIONS_TABLE})
+            string(REPLACE " " ";" entry "${entry}")
+            list(GET entry 0 entry_operation)
+            if(entry_operation STREQUAL operation)
+                set(found TRUE)
+                list(GET entry 1 apdu_size)
+                list(GET entry 2 chained_data)
+                list(LENGTH entry entry_length)
+                if(entry_length GREATER 3)
+                    list(SUBLIST entry 3 -1 entry_features)
+                    list(APPEND features ${entry_features})
+                endif()
+                if(chained_data)
+                    math(EXPR apdu_size "${apdu_size} + ${PROFILE_DATA_LENGTH}")
+                endif()
+                if(apdu_size GREATER buffer_size)
+                    set(buffer_size ${apdu_size})
+                endif()
+                break()
+            endif()
+        endforeach()
+        if(NOT found)
+            message(FATAL_ERROR "optiga_profile: unknown operation ${operation}")
+        endif()
+    endforeach()
+    list(REMOVE_DUPLICATES features)
+    list(SORT features)
+
+    if(PROFILE_BASE STREQUAL "m_v1")
+        foreach(feature ${features})
+            list(FIND OPTIGA_PROFILE_M_V1_UNSUPPORTED_FEATURES ${feature} index)
+            if(NOT index EQUAL -1)
+                message(FATAL_ERROR "optiga_profile: ${feature} is not supported by OPTIGA Trust M V1")
+            endif()
+        endforeach()
+    endif()
+
+    if(buffer_size GREATER OPTIGA_PROFILE_MAX_COMMS_BUFFER_SIZE)
+        set(buffer_size ${OPTIGA_PROFILE_MAX_COMMS_BUFFER_SIZE})
+    endif()
+    math(EXPR buffer_size_hex "${buffer_size}" OUTPUT_FORMAT HEXADECIMAL)
+
+    # Take over all settings of the base configuration except for the feature and buffer size macros
+    file(READ ${base_header} base_content)
+    string(REGEX REPLACE "\n$" "" base_content "${base_content}")
+    string(REPLACE "\n" ";" base_lines "${base_content}")
+    set(content "")
+    set(skip_endif FALSE)
+    set(pending_brief "")
+    foreach(line IN LISTS base_lines)
+        if(line MATCHES "^/\\*\\* @brief OPTIGA CRYPT .* feature enable/disable macro \\*/$")
+            set(pending_brief "${line}")
+            continue()
+        endif()
+        if(line MATCHES "^#define OPTIGA_CRYPT_[A-Z0-9_]+_ENABLED$")
+            set(pending_brief "")
+            continue()
+        endif()
+        if(NOT pending_brief STREQUAL "")
+            string(APPEND content "${pending_brief}\n")
+            set(pending_brief "")
+        endif()
+        if(line MATCHES "^#define OPTIGA_MAX_COMMS_BUFFER_SIZE ")
+            set(line "#define OPTIGA_MAX_COMMS_BUFFER_SIZE (${buffer_size_hex})  // ${buffer_size} in decimal")
+        elseif(line MATCHES "^#(ifndef|define) _OPTIGA_LIB_CONFIG_|^#endif /\\* _OPTIGA_LIB_CONFIG_")
+            string(REGEX REPLACE "_OPTIGA_LIB_CONFIG_[A-Z0-9_]+_H_" "_OPTIGA_LIB_CONFIG_PROFILE_H_" line "${line}")
+        elseif(line MATCHES "^ \\* \\\\file ")
+            get_filename_component(output_name ${output} NAME)
+            set(line " * \\file ${output_name}")
+        elseif(line MATCHES "^ \\* \\\\brief ")
+            set(line " * \\brief   This file is generated by optiga_profile.cmake and enables only the features of the operations")
+            string(APPEND line "\n *          used by the application.")
+        elseif(line STREQUAL "extern \"C\" {")
+            string(APPEND line "\n#endif\n\n/** @brief Operations of the profile */")
+            foreach(operation ${PROFILE_OPERATIONS})
+                string(APPEND line "\n// ${operation}")
+            endforeach()
+            foreach(feature ${features})
+                string(APPEND line "\n#define ${feature}")
+            endforeach()
+            string(APPEND content "${line}\n")
+            # skip the #endif of the extern "C" block which was written above
+            set(skip_endif TRUE)
+            continue()
+        elseif(skip_endif AND line STREQUAL "#endif")
+            set(skip_endif FALSE)
+            continue()
+        endif()
+        string(APPEND content "${line}\n")
+    endforeach()
+
+    file(WRITE ${output}.tmp "${content}")
+    # Rewrite the header only if the profile changed to avoid rebuilding the library
+    execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different ${output}.tmp ${output})
+    file(REMOVE ${output}.tmp)
+    message(STATUS "optiga_profile: ${output} with OPTIGA_MAX_COMMS_BUFFER_SIZE ${buffer_size}")
+endfunction()
+
+# Compiles the library sources with the profile of each operation of the table alone into <build_dir>, which
+# catches feature guards missing a dependency of an operation. Operations not supported by the base are skipped.
+function(optiga_profile_check_operations build_dir)
+    cmake_parse_arguments(CHECK "" "BASE;COMPILER" "" ${ARGN})
+
+    if(NOT CHECK_BASE)
+        set(CHECK_BASE m_v3)
+    endif()
+    if(NOT CHECK_COMPILER)
+        set(CHECK_COMPILER cc)
+    endif()
+    set(root_dir ${OPTIGA_PROFILE_DIR}/../..)
+    file(GLOB sources
+        ${root_dir}/src/cmd/*.c
+        ${root_dir}/src/common/*.c
+        ${root_dir}/src/comms/*.c
+        ${root_dir}/src/comms/ifx_i2c/*.c
+        ${root_dir}/src/crypt/*.c
+        ${root_dir}/src/util/*.c)
+    set(includes)
+    foreach(include_dir include include/pal include/common include/comms include/cmd include/ifx_i2c)
+        list(APPEND includes -I${root_dir}/${include_dir})
+    endforeach()
+    file(MAKE_DIRECTORY ${build_dir})
+
+    set(failed_operations "")
+    foreach(entry ${OPTIGA_PROFILE_OPERATIONS_TABLE})
+        string(REPLACE " " ";" entry "${entry}")
+        list(GET entry 0 operation)
+        set(supported TRUE)
+        if(CHECK_BASE STREQUAL "m_v1")
+            foreach(feature ${entry})
+                list(FIND OPTIGA_PROFILE_M_V1_UNSUPPORTED_FEATURES ${feature} index)
+                if(NOT index EQUAL -1)
+                    set(supported FALSE)
+                endif()
+            endforeach()
+        endif()
+        if(NOT supported)
+            continue()
+        endif()
+
+        set(header ${build_dir}/optiga_lib_config_${operation}.h)
+        optiga_profile_generate(${header} OPERATIONS ${operation} BASE ${CHECK_BASE})
+        # Unused functions are only reported when compiling, not with -fsyntax-only
+        execute_process(
+            COMMAND ${CHECK_COMPILER} -c -Wall -Werror -DOPTIGA_LIB_EXTERNAL=\"${header}\"
+                ${includes} ${sources}
+            WORKING_DIRECTORY ${build_dir}
+            RESULT_VARIABLE compile_result
+            ERROR_VARIABLE compile_errors
+            OUTPUT_QUIET)
+        if(NOT compile_result EQUAL 0)
+            message("optiga_profile: ${operation}\n${compile_errors}")
+            list(APPEND failed_operations ${operation})
+        endif()
+    endforeach()
+    if(failed_operations)
+        message(FATAL_ERROR "optiga_profile: the library does not compile for ${failed_operations}")
+    endif()
+endfunction()
+
+# Reports the flash (text + data) and RAM (data + bss) size of each module of the static library <library>
+function(optiga_profile_print_size_report library)
+    cmake_parse_arguments(SIZE "" "TOOL" "" ${ARGN})
+
+    if(NOT SIZE_TOOL)
+        set(SIZE_TOOL size)
+    endif()
+    execute_process(
+        COMMAND ${SIZE_TOOL} ${library}
+        OUTPUT_VARIABLE size_output
+        RESULT_VARIABLE size_result)
+    if(NOT size_result EQUAL 0)
+        message(FATAL_ERROR "optiga_profile: ${SIZE_TOOL} ${library} failed")
+    endif()
+
+    # Module of each source file of the library
+    set(source_dir ${OPTIGA_PROFILE_DIR}/../../src)
+    set(modules cmd comms ifx_i2c crypt util common pal other)
+    foreach(module cmd crypt util common)
+        file(GLOB module_sources RELATIVE ${source_dir}/${module} ${source_dir}/${module}/*.c)
+        set(sources_${module} ${module_sources})
+    endforeach()
+    file(GLOB sources_comms RELATIVE ${source_dir}/comms ${source_dir}/comms/*.c)
+    file(GLOB sources_ifx_i2c RELATIVE ${source_dir}/comms/ifx_i2c ${source_dir}/comms/ifx_i2c/*.c)
+    foreach(module ${modules})
+        set(flash_${module} 0)
+        set(ram_${module} 0)
+    endforeach()
+
+    string(REPLACE "\n" ";" size_lines "${size_output}")
+    foreach(line IN LISTS size_lines)
+        if(NOT line MATCHES "^ *([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+(.+)$")
+            continue()
+        endif()
+        set(text ${CMAKE_MATCH_1})
+        set(data ${CMAKE_MATCH_2})
+        set(bss ${CMAKE_MATCH_3})
+        # "optiga_cmd.c.o (ex lib.a)" or "optiga_cmd.o (ex lib.a)"
+        string(REGEX REPLACE " \\(ex .*\\)$" "" object "${CMAKE_MATCH_4}")
+        get_filename_component(object ${object} NAME)
+        string(REGEX REPLACE "(\\.c)?\\.(o|obj)$" ".c" source "${object}")
+
+        set(object_module other)
+        foreach(module cmd comms ifx_i2c crypt util common)
+            list(FIND sources_${module} ${source} index)
+            if(NOT index EQUAL -1)
+                set(object_module ${module})
+                break()
+            endif()
+        endforeach()
+        if(object_module STREQUAL "other" AND source MATCHES "^pal")
+            set(object_module pal)
+        endif()
+        math(EXPR flash_${object_module} "${flash_${object_module}} + ${text} + ${data}")
+        math(EXPR ram_${object_module} "${ram_${object_module}} + ${data} + ${bss}")
+    endforeach()
+
+    set(flash_total 0)
+    set(ram_total 0)
+    set(report "optiga_profile: size report of ${library}\n")
+    string(APPEND report "  module         flash      ram\n")
+    foreach(module ${modules})
+        math(EXPR flash_total "${flash_total} + ${flash_${module}}")
+        math(EXPR ram_total "${ram_total} + ${ram_${module}}")
+        string(LENGTH "${module}" module_length)
+        math(EXPR padding "10 - ${module_length}")
+        string(REPEAT " " ${padding} module_padding)
+        string(LENGTH "${flash_${module}}" flash_length)
+        math(EXPR padding "10 - ${flash_length}")
+        string(REPEAT " " ${padding} flash_padding)
+        string(LENGTH "${ram_${module}}" ram_length)
+        math(EXPR padding "9 - ${ram_length}")
+        string(REPEAT " " ${padding} ram_padding)
+        string(APPEND report "  ${module}${module_padding}${flash_padding}${flash_${module}}${ram_padding}${ram_${module}}\n")
+    endforeach()
+    string(LENGTH "${flash_total}" flash_length)
+    math(EXPR padding "10 - ${flash_length}")
+    string(REPEAT " " ${padding} flash_padding)
+    string(LENGTH "${ram_total}" ram_length)
+    math(EXPR padding "9 - ${ram_length}")
+    string(REPEAT " " ${padding} ram_padding)
+    string(APPEND report "  total     ${flash_padding}${flash_total}${ram_padding}${ram_total}\n")
+    message("${report}")
+endfunction()
+
+# Adds the target <target>_size_report which prints the size report of the static library <target>
+function(optiga_profile_size_report target)
+    cmake_parse_arguments(SIZE "" "TOOL" "" ${ARGN})
+
+    if(NOT SIZE_TOOL)
+        if(CMAKE_SIZE)
+            set(SIZE_TOOL ${CMAKE_SIZE})
+        else()
+            set(SIZE_TOOL size)
+        endif()
+    endif()
+    add_custom_target(${target}_size_report
+        COMMAND ${CMAKE_COMMAND}
+            -DOPTIGA_PROFILE_SIZE_LIBRARY=$<TARGET_FILE:${target}>
+            -DOPTIGA_PROFILE_SIZE_TOOL=${SIZE_TOOL}
+            -P ${OPTIGA_PROFILE_DIR}/optiga_profile.cmake
+        DEPENDS ${target}
+        VERBATIM)
+endfunction()
+
+if(CMAKE_SCRIPT_MODE_FILE STREQUAL CMAKE_CURRENT_LIST_FILE)
+    if(DEFINED OPTIGA_PROFILE_OUTPUT)
+        set(arguments OPERATIONS ${OPTIGA_PROFILE_OPERATIONS})
+        if(DEFINED OPTIGA_PROFILE_BASE)
+            list(APPEND arguments BASE ${OPTIGA_PROFILE_BASE})
+        endif()
+        if(DEFINED OPTIGA_PROFILE_DATA_LENGTH)
+            list(APPEND arguments DATA_LENGTH ${OPTIGA_PROFILE_DATA_LENGTH})
+        endif()
+        if(DEFINED OPTIGA_PROFILE_FEATURES)
+            list(APPEND arguments FEATURES ${OPTIGA_PROFILE_FEATURES})
+        endif()
+        optiga_profile_generate(${OPTIGA_PROFILE_OUTPUT} ${arguments})
+    elseif(DEFINED OPTIGA_PROFILE_CHECK_DIR)
+        set(arguments "")
+        if(DEFINED OPTIGA_PROFILE_BASE)
+            list(APPEND arguments BASE ${OPTIGA_PROFILE_BASE})
+        endif()
+        if(DEFINED OPTIGA_PROFILE_CHECK_COMPILER)
+            list(APPEND arguments COMPILER ${OPTIGA_PROFILE_CHECK_COMPILER})
+        endif()
+        optiga_profile_check_operations(${OPTIGA_PROFILE_CHECK_DIR} ${arguments})
+    elseif(DEFINED OPTIGA_PROFILE_SIZE_LIBRARY)
+        if(DEFINED OPTIGA_PROFILE_SIZE_TOOL)
+            optiga_profile_print_size_report(${OPTIGA_PROFILE_SIZE_LIBRARY} TOOL ${OPTIGA_PROFILE_SIZE_TOOL})
+        else()
+            optiga_profile_print_size_report(${OPTIGA_PROFILE_SIZE_LIBRARY})
+        endif()
+    else()
+        message(FATAL_ERROR
+            "optiga_profile: define OPTIGA_PROFILE_OUTPUT, OPTIGA_PROFILE_CHECK_DIR or OPTIGA_PROFILE_SIZE_LIBRARY")
+    endif()
+endif()
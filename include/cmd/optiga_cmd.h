@@ -155,6 +155,337 @@ optiga_lib_status_t optiga_cmd_open_application(optiga_cmd_t *me, uint8_t cmd_pa
  */
 optiga_lib_status_t optiga_cmd_close_application(optiga_cmd_t *me, uint8_t cmd_param, void *params);
 
+#if defined(OPTIGA_UTIL_POWER_MANAGER_ENABLED) || defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED)
+/// Application on OPTIGA is closed
+#define OPTIGA_CMD_POWER_STATE_CLOSED (0x00)
+/// Application on OPTIGA is open
+#define OPTIGA_CMD_POWER_STATE_ACTIVE (0x01)
+/// Application on OPTIGA is hibernated and OPTIGA is powered down
+#define OPTIGA_CMD_POWER_STATE_HIBERNATED (0x02)
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED || OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+/// OPTIGA is idle, value holds the idle time in milliseconds
+#define OPTIGA_CMD_POWER_EVENT_IDLE (0x01)
+/// Hibernated application context is restored, value holds the resume latency in microseconds
+#define OPTIGA_CMD_POWER_EVENT_RESTORED (0x02)
+/// Restoring the hibernated application context failed, value holds the error code
+#define OPTIGA_CMD_POWER_EVENT_RESTORE_FAILED (0x03)
+
+/**
+ * \brief Callback to notify the power manager about power events of an OPTIGA instance.
+ */
+typedef void (*optiga_cmd_power_event_handler_t)(void *p_ctx, uint8_t event, uint32_t value);
+
+/**
+ * \brief Attaches a power manager to the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \details
+ * Attaches a power manager to the OPTIGA instance.
+ * - The scheduler notifies #OPTIGA_CMD_POWER_EVENT_IDLE while the application is open, no request is queued and no session is acquired.
+ *   Sessions held by the idle handler of #optiga_cmd_idle_handler_attach are not counted, they are released before hibernating.<br>
+ * - While attached, a command issued in #OPTIGA_CMD_POWER_STATE_HIBERNATED state first opens the communication and restores
+ *   the application context from #OPTIGA_HIBERNATE_CONTEXT_ID, within the same lock.<br>
+ * - Passing NULL as handler detaches the power manager.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The idle events are raised with the granularity of the scheduler idling time.
+ * - Only one power manager can be attached to an OPTIGA instance.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Power event handler, NULL to detach.
+ * \param[in] p_ctx                                       Context passed to the power event handler.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Power manager is attached or detached.
+ * \retval    #OPTIGA_CMD_ERROR                           Another power manager is already attached.
+ */
+optiga_lib_status_t optiga_cmd_power_manager_attach(
+    optiga_cmd_t *me,
+    optiga_cmd_power_event_handler_t handler,
+    void *p_ctx
+);
+
+/**
+ * \brief Queues the CloseApplication command hibernating the application on OPTIGA.
+ *
+ * \details
+ * Queues the CloseApplication command with hibernate option for the OPTIGA instance.
+ * - The command is only queued and is executed by the scheduler like any other request,
+ *   hence this can be invoked from the power event handler.<br>
+ * - The completion is notified to the upper layer handler of the instance, as for #optiga_cmd_close_application.<br>
+ *
+ * \pre
+ * - No request of the instance is queued or in progress.
+ *
+ * \note
+ * - The shielded connection options of the instance must be set before invoking this.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         CloseApplication command is queued.
+ * \retval    #OPTIGA_CMD_ERROR                           A request of the instance is already queued or in progress.
+ */
+optiga_lib_status_t optiga_cmd_power_hibernate_request(optiga_cmd_t *me);
+
+/**
+ * \brief Provides the power state of the OPTIGA instance.
+ *
+ * \details
+ * Provides the power state of the OPTIGA instance, as tracked from the OpenApplication and CloseApplication commands.
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - None
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ *
+ * \retval    #OPTIGA_CMD_POWER_STATE_CLOSED              Application is closed.
+ * \retval    #OPTIGA_CMD_POWER_STATE_ACTIVE              Application is open.
+ * \retval    #OPTIGA_CMD_POWER_STATE_HIBERNATED          Application is hibernated.
+ */
+uint8_t optiga_cmd_get_power_state(const optiga_cmd_t *me);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+/// OPTIGA is idle and the application is open, background operations can be started
+#define OPTIGA_CMD_IDLE_EVENT_IDLE (0x01)
+/// Sessions held for background operations must be released, the keys in the sessions are lost or OPTIGA hibernates
+#define OPTIGA_CMD_IDLE_EVENT_RELEASE (0x02)
+/// The application is opened, background operations which failed before can be retried
+#define OPTIGA_CMD_IDLE_EVENT_OPEN (0x03)
+
+/**
+ * \brief Callback to notify the idle handler about idle events, with the number of sessions not acquired by any instance.
+ * Returns the number of sessions held by the background operations after the event.
+ */
+typedef uint8_t (*optiga_cmd_idle_handler_t)(void *p_ctx, uint8_t event, uint8_t free_session_count);
+
+/**
+ * \brief Attaches an idle handler to the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \details
+ * Attaches an idle handler to the OPTIGA instance, which is used to perform background operations.
+ * - The scheduler notifies #OPTIGA_CMD_IDLE_EVENT_IDLE while the application is open, no slot is processing a command
+ *   or holding a strict lock and no request is queued.<br>
+ * - Sessions held by instances do not prevent the notification.<br>
+ * - #OPTIGA_CMD_IDLE_EVENT_RELEASE is notified after a CloseApplication without hibernate, an OpenApplication without restore
+ *   (which follows every reset of OPTIGA), a failed transceive (which may have recovered OPTIGA by a reset) and before the power
+ *   manager hibernates OPTIGA.<br>
+ * - #OPTIGA_CMD_IDLE_EVENT_OPEN is notified after every successful OpenApplication, following the release event if any.<br>
+ * - Passing NULL as handler detaches the idle handler.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The idle handler is invoked with the granularity of the scheduler idling time.
+ * - Only one idle handler can be attached to an OPTIGA instance.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Idle handler, NULL to detach.
+ * \param[in] p_ctx                                       Context passed to the idle handler.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Idle handler is attached or detached.
+ * \retval    #OPTIGA_CMD_ERROR                           Another idle handler is already attached.
+ */
+optiga_lib_status_t
+optiga_cmd_idle_handler_attach(optiga_cmd_t *me, optiga_cmd_idle_handler_t handler, void *p_ctx);
+
+/**
+ * \brief Transfers the session of an instance of #optiga_cmd_t to another instance.
+ *
+ * \details
+ * Transfers the session acquired by the source instance, together with the key in the session, to the target instance.
+ * - The source instance no longer holds a session after the transfer.<br>
+ * - The target instance releases the session as if it was acquired by itself.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Neither instance must have a request in progress.
+ *
+ * \param[in] p_source                                    Valid instance of #optiga_cmd_t holding a session.
+ * \param[in] p_target                                    Valid instance of #optiga_cmd_t not holding a session.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Session is transferred.
+ * \retval    #OPTIGA_CMD_ERROR                           Source holds no session or target already holds a session.
+ */
+optiga_lib_status_t optiga_cmd_session_transfer(optiga_cmd_t *p_source, optiga_cmd_t *p_target);
+
+/**
+ * \brief Releases the session of an instance of #optiga_cmd_t.
+ *
+ * \details
+ * Releases the session acquired by the instance, the key in the session is not used anymore.
+ * - Nothing is done, if the instance holds no session.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The instance must not have a request in progress.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Session is released.
+ */
+optiga_lib_status_t optiga_cmd_release_session(optiga_cmd_t *me);
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#if defined(OPTIGA_CRYPT_RESULT_CACHE_ENABLED) || defined(OPTIGA_UTIL_READ_CACHE_ENABLED) \
+    || defined(OPTIGA_UTIL_METADATA_STORE_ENABLED)
+/// Write handlers are used by the host side caches of data object contents and metadata
+#define OPTIGA_CMD_WRITE_HANDLER_ENABLED
+#endif
+
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+#ifndef OPTIGA_CMD_MAX_WRITE_HANDLERS
+/// Maximum number of write handlers attached to an OPTIGA instance
+#define OPTIGA_CMD_MAX_WRITE_HANDLERS (0x04)
+#endif
+
+/// OID notified by the write handler, if the written data object is not known to the host (protected update)
+#define OPTIGA_CMD_WRITE_ALL_OIDS (0xFFFF)
+
+/// OID notified by the write handler, if the state evaluated by the access conditions changes
+/// (application opened or closed, auto state cleared). No data object is written.
+#define OPTIGA_CMD_WRITE_ACCESS_STATE (0xFFFE)
+
+/**
+ * \brief Callback to notify that a data object or its metadata is about to be written.
+ */
+typedef void (*optiga_cmd_write_handler_t)(void *p_ctx, uint16_t oid);
+
+/**
+ * \brief Attaches a write handler to the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \details
+ * Attaches a write handler to the OPTIGA instance, which is used to invalidate host copies of data object contents.
+ * - The handler is notified with the OID before the SetDataObject command (write data, write metadata, update count) is sent.<br>
+ * - The handler is notified with #OPTIGA_CMD_WRITE_ALL_OIDS before the SetObjectProtected command is sent.<br>
+ * - The handler is notified with #OPTIGA_CMD_WRITE_ACCESS_STATE before the OpenApplication and CloseApplication
+ *   commands and the clearing of the auto state are sent.<br>
+ * - Up to #OPTIGA_CMD_MAX_WRITE_HANDLERS handlers are notified in the order they are attached.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The write handler is invoked in the context of the scheduler and must not issue commands.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Write handler.
+ * \param[in] p_ctx                                       Context passed to the write handler.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Write handler is attached.
+ * \retval    #OPTIGA_CMD_ERROR                           The write handler is already attached.
+ * \retval    #OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT       #OPTIGA_CMD_MAX_WRITE_HANDLERS handlers are already attached.
+ */
+optiga_lib_status_t
+optiga_cmd_write_handler_attach(optiga_cmd_t *me, optiga_cmd_write_handler_t handler, void *p_ctx);
+
+/**
+ * \brief Detaches a write handler from the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Write handler attached using #optiga_cmd_write_handler_attach.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Write handler is detached.
+ * \retval    #OPTIGA_CMD_ERROR                           The write handler is not attached.
+ */
+optiga_lib_status_t
+optiga_cmd_write_handler_detach(optiga_cmd_t *me, optiga_cmd_write_handler_t handler);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+/// Timer callbacks are used by the write-behind to flush the buffered data after the coalescing window
+#define OPTIGA_CMD_TIMER_ENABLED
+#endif
+
+#ifdef OPTIGA_CMD_TIMER_ENABLED
+/**
+ * \brief Callback invoked by the scheduler once the registered time elapsed.
+ */
+typedef void (*optiga_cmd_timer_handler_t)(void *p_ctx);
+
+/**
+ * \brief Registers a callback, which is invoked once after the given time, with the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \details
+ * Registers a one-shot callback with the scheduler of the OPTIGA instance. The PAL OS event of the OPTIGA instance
+ * is shared with the scheduler, hence the callback is invoked by the scheduler instead of being registered with
+ * pal_os_event_register_callback_oneshot directly.
+ * - The callback is invoked by the first run of the scheduler after the time elapsed, while no command is processed.<br>
+ * - Registering a callback replaces the callback registered before, passing NULL as handler cancels it.<br>
+ * - The callback is invoked in the context of the scheduler and may issue commands.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The callback is invoked with the granularity of the scheduler idling time.
+ * - Only one callback can be registered with an OPTIGA instance.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Callback, NULL to cancel.
+ * \param[in] p_ctx                                       Context passed to the callback.
+ * \param[in] time_ms                                     Time in milliseconds, after which the callback is invoked.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Callback is registered or cancelled.
+ */
+optiga_lib_status_t optiga_cmd_register_callback_oneshot(
+    optiga_cmd_t *me,
+    optiga_cmd_timer_handler_t handler,
+    void *p_ctx,
+    uint32_t time_ms
+);
+#endif  // OPTIGA_CMD_TIMER_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+/// Scheduler is invoked, value holds the number of requests queued or processing
+#define OPTIGA_CMD_LOAD_EVENT_QUEUE_DEPTH (0x01)
+/// Response to a command is received, value holds the latency in microseconds from sending the command
+#define OPTIGA_CMD_LOAD_EVENT_COMMAND (0x02)
+
+/**
+ * \brief Callback to notify the load of an OPTIGA instance, command holds the OPTIGA command code of #OPTIGA_CMD_LOAD_EVENT_COMMAND.
+ */
+typedef void (*optiga_cmd_load_handler_t)(void *p_ctx, uint8_t event, uint8_t command, uint32_t value);
+
+/**
+ * \brief Attaches a load handler to the OPTIGA instance of #optiga_cmd_t.
+ *
+ * \details
+ * Attaches a load handler to the OPTIGA instance, which is used to adapt the performance of OPTIGA to the load.
+ * - The scheduler notifies #OPTIGA_CMD_LOAD_EVENT_QUEUE_DEPTH on every invocation, before the next request is selected.<br>
+ * - #OPTIGA_CMD_LOAD_EVENT_COMMAND is notified for every command APDU, including every APDU of a chained command,
+ *   with the command code without the clear last error bit.<br>
+ * - Passing NULL as handler detaches the load handler.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The queue depth is notified with the granularity of the scheduler idling time, while no request is queued.
+ * - Only one load handler can be attached to an OPTIGA instance.
+ *
+ * \param[in] me                                          Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ * \param[in] handler                                     Load handler, NULL to detach.
+ * \param[in] p_ctx                                       Context passed to the load handler.
+ *
+ * \retval    #OPTIGA_CMD_SUCCESS                         Load handler is attached or detached.
+ * \retval    #OPTIGA_CMD_ERROR                           Another load handler is already attached.
+ */
+optiga_lib_status_t
+optiga_cmd_load_handler_attach(optiga_cmd_t *me, optiga_cmd_load_handler_t handler, void *p_ctx);
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
 /**
  * \brief Reads data or metadata of the specified data object
  *
@@ -227,7 +558,8 @@ optiga_lib_status_t optiga_cmd_set_data_object(
     optiga_set_data_object_params_t *params
 );
 
-#if defined(OPTIGA_CRYPT_RANDOM_ENABLED) || defined(OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED)
+#if defined(OPTIGA_CRYPT_RANDOM_ENABLED) || defined(OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED) \
+    || defined(OPTIGA_CRYPT_GENERATE_AUTH_CODE_ENABLED)
 /**
  * \brief Generates random data or pre-master secret for RSA key exchange.
  *
@@ -257,7 +589,7 @@ optiga_lib_status_t optiga_cmd_set_data_object(
  */
 optiga_lib_status_t
 optiga_cmd_get_random(optiga_cmd_t *me, uint8_t cmd_param, optiga_get_random_params_t *params);
-#endif  // OPTIGA_CRYPT_RANDOM_ENABLED || OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED
+#endif  // OPTIGA_CRYPT_RANDOM_ENABLED || OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED || OPTIGA_CRYPT_GENERATE_AUTH_CODE_ENABLED
 
 #ifdef OPTIGA_CRYPT_HASH_ENABLED
 /**
@@ -301,6 +633,7 @@ optiga_cmd_calc_hash(optiga_cmd_t *me, uint8_t cmd_param, optiga_calc_hash_param
  * - Acquires the OPTIGA session/lock for #optiga_crypt_ecdsa_sign/#optiga_crypt_rsa_sign.<br>
  * - Forms the Generate KeyPair command based on inputs.<br>
  * - Issues the Generate KeyPair command through #optiga_comms_transceive.
+ * - For a batch (#optiga_crypt_ecdsa_sign_batch), issues the Calc Sign command for each item while holding the lock.
  * - Releases the OPTIGA lock on successful completion of asynchronous operation.<br>
  *
  * \pre
@@ -426,6 +759,43 @@ optiga_lib_status_t
 optiga_cmd_derive_key(optiga_cmd_t *me, uint8_t cmd_param, optiga_derive_key_params_t *params);
 #endif  // OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED || OPTIGA_CRYPT_HKDF_ENABLED
 
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+/**
+ * \brief Calculates a shared secret and derives keys from it, as a single command sequence.
+ *
+ * \details
+ * Issues CalcSSec command followed by a DeriveKey command for each key derivation step to OPTIGA.
+ * - Acquires the OPTIGA session and lock once for the whole sequence.<br>
+ * - Stores the shared secret in the session OID.<br>
+ * - Each key derivation step derives from the session OID and either exports the derived key
+ *   or stores it in the session OID, for the next step.<br>
+ * - Releases the OPTIGA lock on successful completion of the last step or on failure of any step.<br>
+ *
+ * \pre
+ * - Application on OPTIGA must be opened using #optiga_cmd_open_application.
+ * - A key pair must be generated/available in the given private key ID.
+ *
+ * \note
+ * - Error codes from lower layers will be returned as it is.<br>
+ * - The session is kept by the instance after completion and holds the shared secret or the last derived key, which is not exported.<br>
+ *
+ *\param[in] me                                           Valid instance of #optiga_cmd_t created using #optiga_cmd_create.
+ *\param[in] cmd_param                                    Param of Calc SSec Command APDU.
+ *                                                        - Must be valid argument, otherwise OPTIGA returns an error.<br>
+ *\param[in] params                                       Pointer to input parameters, must not be NULL.
+ *
+ * \retval   #OPTIGA_LIB_SUCCESS                          Successful invocation.
+ * \retval   #OPTIGA_CMD_ERROR_INVALID_INPUT              Instance invoked for session oid, without acquiring the session (from #optiga_cmd_gen_keypair).
+ */
+optiga_lib_status_t optiga_cmd_key_schedule(
+    optiga_cmd_t *me,
+    uint8_t cmd_param,
+    optiga_key_schedule_params_t *params
+);
+#endif  // OPTIGA_CRYPT_ECDH_ENABLED && OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+
 #if defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED) \
     || defined(OPTIGA_CRYPT_RSA_GENERATE_KEYPAIR_ENABLED)
 /**
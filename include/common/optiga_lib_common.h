@@ -162,7 +162,8 @@ typedef enum optiga_rsa_signature_scheme {
 } optiga_rsa_signature_scheme_t;
 
 #if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
-    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED)
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 /**
  * \brief Specifies the symmetric encryption schemes type in OPTIGA.
  */
@@ -183,7 +184,13 @@ typedef enum optiga_symmetric_encryption_mode {
  */
 typedef enum optiga_hash_type {
     /// Hash algorithm type SHA256
-    OPTIGA_HASH_TYPE_SHA_256 = 0xE2
+    OPTIGA_HASH_TYPE_SHA_256 = 0xE2,
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    /// Hash algorithm type SHA384, supported by the host hash engine only
+    OPTIGA_HASH_TYPE_SHA_384 = 0xE3,
+    /// Hash algorithm type SHA512, supported by the host hash engine only
+    OPTIGA_HASH_TYPE_SHA_512 = 0xE4
+#endif
 } optiga_hash_type_t;
 
 /**
@@ -191,7 +198,13 @@ typedef enum optiga_hash_type {
  */
 typedef enum optiga_hash_context_length {
     /// Hash context length (in bytes) in case of SHA256.
-    OPTIGA_HASH_CONTEXT_LENGTH_SHA_256 = 209
+    OPTIGA_HASH_CONTEXT_LENGTH_SHA_256 = 209,
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    /// Hash context length (in bytes) in case of SHA384.
+    OPTIGA_HASH_CONTEXT_LENGTH_SHA_384 = 240,
+    /// Hash context length (in bytes) in case of SHA512.
+    OPTIGA_HASH_CONTEXT_LENGTH_SHA_512 = 240
+#endif
 } optiga_hash_context_length_t;
 
 /**
@@ -204,7 +217,9 @@ typedef enum optiga_rng_type {
     OPTIGA_RNG_TYPE_DRNG = 0x01
 } optiga_rng_type_t;
 
-#ifdef OPTIGA_CRYPT_HMAC_ENABLED
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 /**
  * \brief Specifies the HMAC generation types in OPTIGA.
  */
@@ -295,6 +310,41 @@ typedef struct hash_data_in_optiga {
     uint16_t length;
 } hash_data_in_optiga_t;
 
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+/// typedef for the reader providing the next part of the data to be hashed
+typedef optiga_lib_status_t (*optiga_hash_stream_reader_t)(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+);
+
+/// typedef for the handler reporting the progress of a streamed hash
+typedef void (*optiga_hash_stream_progress_handler_t)(
+    void *callback_ctx,
+    uint32_t hashed_length,
+    uint32_t total_length
+);
+
+/**
+ * \brief Specifies the structure to provide the details of data to be hashed from a host stream.
+ */
+typedef struct hash_data_stream {
+    /// Reader providing the data to hash
+    optiga_hash_stream_reader_t reader;
+    /// Handler invoked after each fragment hashed by OPTIGA, can be NULL
+    optiga_hash_stream_progress_handler_t progress_handler;
+    /// Context of the reader and the progress handler
+    void *p_stream_ctx;
+    /// Total length of data
+    uint32_t length;
+    /// Buffer to read the next fragment into, while the current fragment is hashed by OPTIGA
+    uint8_t *p_buffer;
+    /// Length of the read buffer
+    uint16_t buffer_length;
+} hash_data_stream_t;
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
+
 /**
  * \brief Specifies the data structure of the Public Key details (key, size and type)
  */
@@ -373,6 +423,16 @@ typedef struct optiga_calc_hash {
     uint8_t current_hash_sequence;
     /// export hash ctx
     bool_t export_hash_ctx;
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+    /// Stream pointer, NULL if the data is not streamed
+    const hash_data_stream_t *p_hash_stream;
+    /// Length of data read from the stream
+    uint32_t stream_read_length;
+    /// Length of data read ahead into the stream buffer
+    uint16_t stream_buffered_length;
+    /// Status of the stream reader
+    optiga_lib_status_t stream_read_status;
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
 } optiga_calc_hash_params_t;
 
 /**
@@ -411,6 +471,35 @@ typedef struct optiga_gen_keypair {
     bool_t export_private_key;
 } optiga_gen_keypair_params_t;
 
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+/// typedef for the handler invoked on completion of each item of a signature batch
+typedef void (*optiga_sign_batch_item_handler_t)(
+    void *callback_ctx,
+    uint16_t item_index,
+    optiga_lib_status_t event
+);
+
+/**
+ * \brief Specifies the data structure for a batch of ECDSA signatures
+ */
+typedef struct optiga_calc_sign_batch {
+    /// Digest buffer pointers of all the items
+    const uint8_t *const *p_digests;
+    /// Signature buffer pointers of all the items
+    uint8_t *const *p_signatures;
+    /// Signature lengths of all the items
+    uint16_t *p_signature_lengths;
+    /// Handler invoked on completion of each item, can be NULL
+    optiga_sign_batch_item_handler_t item_handler;
+    /// Context of the item handler
+    void *p_item_handler_ctx;
+    /// Number of items in the batch
+    uint16_t item_count;
+    /// Index of the item being signed
+    uint16_t item_index;
+} optiga_calc_sign_batch_t;
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
 /**
  * \brief Specifies the data structure for ECDSA signature
  */
@@ -425,6 +514,10 @@ typedef struct optiga_calc_sign {
     optiga_key_id_t private_key_oid;
     /// Digest data length
     uint8_t digest_length;
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+    /// Batch details, item_count is zero for a single signature
+    optiga_calc_sign_batch_t batch;
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
 } optiga_calc_sign_params_t;
 
 /**
@@ -485,6 +578,48 @@ typedef struct optiga_derive_key {
     uint16_t derived_key_length;
 } optiga_derive_key_params_t;
 
+#ifdef OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+/**
+ * \brief Specifies a key derivation step of a key schedule
+ */
+typedef struct optiga_key_schedule_step {
+    /// Random Seed/Salt
+    const uint8_t *random_data;
+    /// Label input as a constant string, used with TLS PRF
+    const uint8_t *label;
+    /// Application specific info, used with HKDF
+    const uint8_t *info;
+    /// Pointer to a buffer where the derived key is exported, NULL to store the derived key in the session OID
+    uint8_t *derived_key;
+    /// Random Seed/Salt length
+    uint16_t random_data_length;
+    /// Label length
+    uint16_t label_length;
+    /// Info length
+    uint16_t info_length;
+    /// Derived Key length
+    uint16_t derived_key_length;
+    /// Key derivation type, #optiga_tls_prf_type_t or #optiga_hkdf_type_t
+    uint8_t derivation_type;
+} optiga_key_schedule_step_t;
+
+/**
+ * \brief Specifies the data structure for a shared secret calculation followed by key derivations in the session OID
+ */
+typedef struct optiga_key_schedule {
+    /// Shared secret calculation, the shared secret is stored in the session OID
+    optiga_calc_ssec_params_t calc_ssec;
+    /// Derive key parameters of the step being executed
+    optiga_derive_key_params_t derive_key;
+    /// Key derivation steps, executed in order on the session OID
+    const optiga_key_schedule_step_t *p_steps;
+    /// Number of key derivation steps
+    uint8_t step_count;
+    /// Number of the step being executed, zero for the shared secret calculation
+    uint8_t step_index;
+} optiga_key_schedule_params_t;
+#endif  // OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+
 #if defined(OPTIGA_CRYPT_RSA_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_RSA_DECRYPT_ENABLED)
 /**
  * \brief Specifies the structure for asymmetric encryption and decryption
@@ -507,6 +642,45 @@ typedef struct optiga_enc_dec_asym {
 } optiga_encrypt_asym_params_t, optiga_decrypt_asym_params_t;
 #endif
 
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+/// Length of the fragments of a protected update, the last fragment can be shorter
+#define OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE (640U)
+
+/// typedef for the reader providing the fragments of a streamed protected update from the given offset
+typedef optiga_lib_status_t (*optiga_protected_update_stream_reader_t)(
+    void *callback_ctx,
+    uint32_t offset,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+);
+
+/// typedef for the handler reporting the progress of a streamed protected update
+typedef void (*optiga_protected_update_stream_progress_handler_t)(
+    void *callback_ctx,
+    uint32_t written_length,
+    uint32_t total_length
+);
+
+/**
+ * \brief Specifies the structure to provide the fragments of a protected update from a host stream.
+ */
+typedef struct protected_update_data_stream {
+    /// Reader providing the concatenated fragments
+    optiga_protected_update_stream_reader_t reader;
+    /// Handler invoked after each fragment written to OPTIGA, can be NULL
+    optiga_protected_update_stream_progress_handler_t progress_handler;
+    /// Context of the reader and the progress handler
+    void *p_stream_ctx;
+    /// Total length of the fragments
+    uint32_t length;
+    /// Buffer to read the next fragment into, while the current fragment is processed by OPTIGA
+    uint8_t *p_buffer;
+    /// Length of the read buffer
+    uint16_t buffer_length;
+} protected_update_data_stream_t;
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 /**
  * \brief Specifies the data structure for protected update
  */
@@ -519,9 +693,68 @@ typedef struct optiga_set_object_protected_params {
     optiga_set_obj_protected_tag_t set_obj_protected_tag;
     /// manifest version
     uint8_t manifest_version;
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+    /// Stream pointer, NULL if the fragments are not streamed
+    const protected_update_data_stream_t *p_stream;
+    /// Length of the fragments sent to OPTIGA
+    uint32_t stream_sent_length;
+    /// Length of the next fragment read into the stream buffer
+    uint16_t stream_buffered_length;
+    /// Status of the stream reader
+    optiga_lib_status_t stream_read_status;
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
 } optiga_set_object_protected_params_t;
 
-#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED)
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/// typedef for the reader providing the next part of the input data of a streamed symmetric operation
+typedef optiga_lib_status_t (*optiga_symmetric_stream_reader_t)(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+);
+
+/// typedef for the writer consuming the output data of a streamed symmetric operation
+typedef optiga_lib_status_t (*optiga_symmetric_stream_writer_t)(
+    void *callback_ctx,
+    const uint8_t *p_data,
+    uint16_t data_length
+);
+
+/// typedef for the handler reporting the progress and the throughput of a streamed symmetric operation
+typedef void (*optiga_symmetric_stream_progress_handler_t)(
+    void *callback_ctx,
+    uint32_t processed_length,
+    uint32_t total_length,
+    uint32_t bytes_per_second
+);
+
+/**
+ * \brief Specifies the structure to provide the input and output of a streamed symmetric operation.
+ */
+typedef struct symmetric_data_stream {
+    /// Reader providing the input data
+    optiga_symmetric_stream_reader_t reader;
+    /// Writer consuming the output data
+    optiga_symmetric_stream_writer_t writer;
+    /// Handler invoked after each fragment processed by OPTIGA, can be NULL
+    optiga_symmetric_stream_progress_handler_t progress_handler;
+    /// Context of the reader, the writer and the progress handler
+    void *p_stream_ctx;
+    /// Total length of input data
+    uint32_t length;
+    /// Buffer to read the next fragment into, while the current fragment is processed by OPTIGA
+    uint8_t *p_buffer;
+    /// Length of the read buffer, at least one block
+    uint16_t buffer_length;
+    /// PKCS#7 padding is added on encryption and removed on decryption, only for ECB and CBC modes
+    bool_t padding;
+} symmetric_data_stream_t;
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
+
 /**
  * \brief Specifies the data structure for symmetric encrypt and decrypt
  */
@@ -562,6 +795,18 @@ typedef struct optiga_symmetric_enc_dec_params {
     uint8_t mode;
     /// Symmetric mode of operation
     uint8_t operation_mode;
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    /// Stream pointer, NULL if the data is not streamed
+    const symmetric_data_stream_t *p_sym_stream;
+    /// Length of data read from the stream, including the padding
+    uint32_t stream_read_length;
+    /// Start time of the stream in milliseconds
+    uint32_t stream_start_time;
+    /// Length of data read ahead into the stream buffer
+    uint16_t stream_buffered_length;
+    /// Status of the stream reader and writer
+    optiga_lib_status_t stream_status;
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 } optiga_encrypt_sym_params_t, optiga_decrypt_sym_params_t;
 #endif
 #ifdef OPTIGA_CRYPT_SYM_GENERATE_KEY_ENABLED
@@ -654,6 +899,29 @@ void optiga_common_set_uint32(uint8_t *p_output_buffer, uint32_t four_byte_value
  */
 void optiga_common_get_uint16(const uint8_t *p_input_buffer, uint16_t *p_two_byte_value);
 
+/**
+ * \brief Compares two buffers of the same length
+ *
+ * \details
+ * Compares two buffers of the same length
+ * - Compares all bytes, the execution time does not depend on the position of the first difference.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Used to compare digests and keys, for which an early exit would reveal the length of the matching prefix.
+ *
+ * \param[in]  p_buffer_1        Pointer to the first buffer
+ * \param[in]  p_buffer_2        Pointer to the second buffer
+ * \param[in]  length            Number of bytes to be compared
+ *
+ * \retval     TRUE              Buffers are equal
+ * \retval     FALSE             Buffers differ
+ *
+ */
+bool_t optiga_common_is_equal(const uint8_t *p_buffer_1, const uint8_t *p_buffer_2, uint16_t length);
+
 #ifdef __cplusplus
 }
 #endif
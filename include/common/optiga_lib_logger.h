@@ -56,6 +56,55 @@ extern "C" {
 #define OPTIGA_PROTECTED_DATA_COLOR OPTIGA_LIB_LOGGER_COLOR_YELLOW
 
 #define OPTIGA_HEX_BYTE_SEPERATOR ""
+
+#ifdef PAL_LOGGER_RING_ENABLED
+#include "pal_logger.h"
+
+// Layer ids of the binary log records, index into OPTIGA_LIB_LOGGER_LAYER_NAMES
+#define OPTIGA_LIB_LOGGER_LAYER_ID_NONE (0x00)
+#define OPTIGA_LIB_LOGGER_LAYER_ID_UTIL (0x01)
+#define OPTIGA_LIB_LOGGER_LAYER_ID_CRYPT (0x02)
+#define OPTIGA_LIB_LOGGER_LAYER_ID_CMD (0x03)
+#define OPTIGA_LIB_LOGGER_LAYER_ID_COMMS (0x04)
+#define OPTIGA_LIB_LOGGER_LAYER_ID_PAL (0x05)
+#define OPTIGA_LIB_LOGGER_LAYER_COUNT (0x06)
+
+// Layer names of the binary log records
+#define OPTIGA_LIB_LOGGER_LAYER_NAMES \
+    { \
+        OPTIGA_LAYER_EMPTY, OPTIGA_UTIL_SERVICE, OPTIGA_CRYPT_SERVICE, OPTIGA_COMMAND_LAYER, \
+            OPTIGA_COMMUNICATION_LAYER, OPTIGA_PAL_LAYER \
+    }
+
+// Event ids of the binary log records
+#define OPTIGA_LIB_LOGGER_EVENT_STRING (0x01)
+#define OPTIGA_LIB_LOGGER_EVENT_STRING_NEWLINE (0x02)
+#define OPTIGA_LIB_LOGGER_EVENT_MESSAGE (0x03)
+#define OPTIGA_LIB_LOGGER_EVENT_STATUS (0x04)
+#define OPTIGA_LIB_LOGGER_EVENT_HEX_DATA (0x05)
+#define OPTIGA_LIB_LOGGER_EVENT_HEX_DATA_PROTECTED (0x06)
+
+/**
+ * \brief To log a binary record recorded in the logger ring
+ *
+ * \details
+ * To log a binary record recorded in the logger ring
+ * - Formats the record the same way as the synchronous logger APIs and writes it to the logger port
+ * - Used as handler of the drain thread (#pal_logger_ring_start) and by the logger ring decode tool
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - With PAL_LOGGER_RING_ENABLED, the logger APIs only record binary records into the logger ring.
+ *   Nothing is printed until the application starts the drain thread with
+ *   pal_logger_ring_start(optiga_lib_print_record).
+ *
+ * \param[in] p_record           Pointer to the record
+ *
+ */
+void optiga_lib_print_record(const pal_logger_ring_record_t *p_record);
+#endif  // PAL_LOGGER_RING_ENABLED
 /**
  * \brief To log a string
  *
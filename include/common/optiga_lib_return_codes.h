@@ -59,6 +59,8 @@ extern "C" {
 #define OPTIGA_COMMS_ERROR_HANDSHAKE (0x0107)
 /// Presentation layer session error
 #define OPTIGA_COMMS_ERROR_SESSION (0x0108)
+/// Command failed and the OPTIGA was recovered by a reset, the application must be opened again
+#define OPTIGA_COMMS_ERROR_RECOVERED (0x0109)
 
 /**
  * OPTIGA command module return values
@@ -105,6 +107,8 @@ extern "C" {
 #define OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT (0x0404)
 /// OPTIGA crypt API called when, a request of same instance is already in service
 #define OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE (0x0405)
+/// OPTIGA crypt signature verification performed on the host failed
+#define OPTIGA_CRYPT_ERROR_VERIFY_FAILED (0x0406)
 
 #ifdef __cplusplus
 }
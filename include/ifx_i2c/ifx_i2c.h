@@ -30,7 +30,11 @@ typedef enum ifx_i2c_reset_type {
     /// Soft reset. 0x0000 is written to IFX-I2C Soft reset register
     IFX_I2C_SOFT_RESET = 1U,
     /// Warm reset. Only reset pin is toggled low and then high
-    IFX_I2C_WARM_RESET = 2U
+    IFX_I2C_WARM_RESET = 2U,
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /// Recovery reset. Starts with soft reset and escalates to warm and then cold reset on failure
+    IFX_I2C_RECOVERY_RESET = 3U,
+#endif
 } ifx_i2c_reset_type_t;
 
 /**
@@ -72,6 +76,8 @@ typedef enum ifx_i2c_reset_type {
  *   - <b>upper_layer_ctx</b> : Context of upper layer.
  *   - <b>p_slave_vdd_pin</b> : GPIO pin for VDD. If not set, cold reset is not done.
  *   - <b>p_slave_reset_pin</b> : GPIO pin for Reset. If not set, warm reset is not done.
+ *   - <b>p_slave_ready_pin</b> : GPIO line signalling the readiness of the slave, only with #OPTIGA_COMMS_GPIOD_RESET_ENABLED.
+ *     If it cannot be watched, the start up time is waited.
  *   - <b>manage_contex_operation</b> : Used for manage context.The value of the parameter is not modified by the IFX I2C protocol stack.
  *     - The values for <b>manage_contex_operation</b> must be one of the below.
  *       - #IFX_I2C_SESSION_CONTEXT_RESTORE : restore the saved secure session.
@@ -104,6 +110,12 @@ optiga_lib_status_t ifx_i2c_open(ifx_i2c_context_t *p_ctx);
  * \note
  * - For COLD and WARM reset type: If the GPIO(VDD and/or reset) pins are not configured,<br>
  *   the API continues without any failure return status<br>
+ * - For RECOVERY reset type: The next reset type is started only if the previous one fails to
+ *   re-initialize the I2C slave. The upper layer event handler is invoked once, with the final status.<br>
+ * - With #OPTIGA_COMMS_GPIOD_RESET_ENABLED: The reset pulse is timed by #pal_gpio_pulse_low() and the
+ *   negotiation starts once #pal_gpio_is_ready() reports the ready edge, checked from the PAL OS event,
+ *   instead of the #RESET_LOW_TIME_MSEC and #STARTUP_TIME_MSEC waits. Without PAL support, the fixed
+ *   waits are used.<br>
  *
  * \param[in,out] p_ctx                  Pointer to #ifx_i2c_context_t, must not be NULL
  * \param[in,out] reset_type             type of reset
@@ -113,6 +125,37 @@ optiga_lib_status_t ifx_i2c_open(ifx_i2c_context_t *p_ctx);
  */
 optiga_lib_status_t ifx_i2c_reset(ifx_i2c_context_t *p_ctx, ifx_i2c_reset_type_t reset_type);
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+/**
+ * \brief   Reads the bus error and recovery statistics.
+ *
+ * \details
+ * Reads the bus error and recovery statistics of the given context.
+ * - Bus errors are classified by the physical and data link layer as NACK, bus busy/arbitration lost,
+ *   CRC error and timeout.
+ * - A #ifx_i2c_transceive() which fails with a classified bus error starts a recovery automatically.
+ *   The failure is reported to the upper layer once the recovery is complete, as #IFX_I2C_RECOVERED
+ *   if the I2C slave was recovered (the application must be opened again), otherwise as the original error.
+ * - Every recovery is recorded with its duration and the reset type which completed it.
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Only during a recovery, the I2C slave is polled for readiness instead of waiting for #STARTUP_TIME_MSEC.
+ * - With shielded connection, a session established before the recovery is restored with a new handshake
+ *   once the I2C slave is re-initialized.
+ *
+ * \param[in]     p_ctx                  Pointer to #ifx_i2c_context_t, must not be NULL
+ * \param[out]    p_stats                Pointer to #ifx_i2c_recovery_stats_t, must not be NULL
+ *
+ * \retval        #IFX_I2C_STACK_SUCCESS
+ * \retval        #IFX_I2C_STACK_ERROR
+ */
+optiga_lib_status_t
+ifx_i2c_get_recovery_stats(const ifx_i2c_context_t *p_ctx, ifx_i2c_recovery_stats_t *p_stats);
+#endif
+
 /**
  * \brief   Sends a command and receives a response for the command.
  *
@@ -134,6 +177,10 @@ optiga_lib_status_t ifx_i2c_reset(ifx_i2c_context_t *p_ctx, ifx_i2c_reset_type_t
  *   If the size of p_rx_data is zero or insufficient to copy the response bytes then #IFX_I2C_STACK_MEM_ERROR error is returned.
  * - If establishing a secure channel fails, #IFX_I2C_HANDSHAKE_ERROR is returned.
  * - If #IFX_I2C_SESSION_ERROR is returned, a new session must be established.
+ * - If OPTIGA_COMMS_FAST_RECOVERY_ENABLED is defined and the transceive fails with a classified bus error,
+ *   the I2C slave is recovered before the failure is reported. Refer #ifx_i2c_get_recovery_stats().
+ *   If the recovery succeeds, #IFX_I2C_RECOVERED is reported. The recovery reset closed the application,
+ *   so it must be opened again before the command is repeated. The command is not repeated by the stack.
  * - If presentation layer is enabled and the command data protection is selected,
  *   the input data provided will be modified because the data will be encrypted in the same input buffer.
  *   Hence a copy of the input data must be preserved by the caller of this API, if needed.
@@ -171,6 +218,7 @@ optiga_lib_status_t ifx_i2c_reset(ifx_i2c_context_t *p_ctx, ifx_i2c_reset_type_t
  * \retval        #IFX_I2C_STACK_MEM_ERROR
  * \retval        #IFX_I2C_HANDSHAKE_ERROR
  * \retval        #IFX_I2C_SESSION_ERROR
+ * \retval        #IFX_I2C_RECOVERED
  */
 optiga_lib_status_t ifx_i2c_transceive(
     ifx_i2c_context_t *p_ctx,
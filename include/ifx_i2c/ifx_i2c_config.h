@@ -72,6 +72,40 @@ extern "C" {
 /** @brief Start up time */
 #define STARTUP_TIME_MSEC (12000U)
 
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/** @brief Interval to check the ready line of the I2C slave, at most for #STARTUP_TIME_MSEC */
+#define IFX_I2C_READY_CHECK_INTERVAL_US (PL_POLLING_INVERVAL_US)
+#endif
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+/** @brief Delay before the first readiness poll of the I2C slave after a reset. The slave is then polled
+ *         every #PL_POLLING_INVERVAL_US for at most #PL_POLLING_MAX_CNT attempts */
+#define IFX_I2C_READY_POLL_DELAY_US (PL_POLLING_INVERVAL_US)
+
+/** @brief Bus error class: no error recorded */
+#define IFX_I2C_ERROR_CLASS_NONE (0x00)
+/** @brief Bus error class: I2C slave did not acknowledge within the polling attempts */
+#define IFX_I2C_ERROR_CLASS_NACK (0x01)
+/** @brief Bus error class: I2C bus busy or arbitration lost within the polling attempts */
+#define IFX_I2C_ERROR_CLASS_BUS (0x02)
+/** @brief Bus error class: CRC mismatch in a received data link layer frame */
+#define IFX_I2C_ERROR_CLASS_CRC (0x03)
+/** @brief Bus error class: response not available within the data link layer timeout */
+#define IFX_I2C_ERROR_CLASS_TIMEOUT (0x04)
+/** @brief Number of bus error classes */
+#define IFX_I2C_ERROR_CLASS_COUNT (0x05)
+
+/** @brief Records a bus error of the given class in the recovery statistics and for the ongoing transceive */
+#define IFX_I2C_RECORD_ERROR(p_ctx, bus_error_class) \
+    do { \
+        (p_ctx)->recovery.stats.error_count[(bus_error_class)]++; \
+        (p_ctx)->recovery.stats.last_error_class = (bus_error_class); \
+        (p_ctx)->recovery.error_class = (bus_error_class); \
+    } while (FALSE)
+#else
+#define IFX_I2C_RECORD_ERROR(p_ctx, bus_error_class)
+#endif
+
 /** @brief Protocol Stack: Status codes for success */
 #define IFX_I2C_STACK_SUCCESS (0x0000)
 /** @brief Protocol Stack: Status codes busy */
@@ -86,6 +120,8 @@ extern "C" {
 #define IFX_I2C_HANDSHAKE_ERROR (0x0107)
 /** @brief Protocol Stack: session error */
 #define IFX_I2C_SESSION_ERROR (0x0108)
+/** @brief Protocol Stack: transceive failed, the slave was recovered by a reset which closed the application */
+#define IFX_I2C_RECOVERED (0x0109)
 
 /** @brief Offset of Datalink header in tx_frame_buffer */
 #define IFX_I2C_DL_HEADER_OFFSET (0U)
@@ -370,9 +406,67 @@ typedef struct ifx_i2c_prl {
 
     // Trans repeat status
     uint8_t trans_repeat_status;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /// Session was established before the last transceive, to be restored after a recovery
+    uint8_t restore_session;
+    /// Handshake restores the session, no record is exchanged afterwards
+    uint8_t session_restore_ongoing;
+#endif
 } ifx_i2c_prl_t;
 #endif
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+/** @brief Bus error and recovery statistics */
+typedef struct ifx_i2c_recovery_stats {
+    /// Number of bus errors, indexed by the bus error class
+    uint32_t error_count[IFX_I2C_ERROR_CLASS_COUNT];
+    /// Number of recoveries which re-initialized the I2C slave
+    uint32_t recovery_count;
+    /// Number of recoveries which failed even with cold reset
+    uint32_t recovery_failure_count;
+    /// Number of times a failed reset level was escalated to the next level
+    uint32_t escalation_count;
+    /// Duration of the last recovery in milliseconds
+    uint32_t last_recovery_duration_ms;
+    /// Longest recovery duration in milliseconds
+    uint32_t max_recovery_duration_ms;
+    /// Class of the last recorded bus error
+    uint8_t last_error_class;
+    /// Reset type which completed the last recovery
+    uint8_t last_recovery_reset_type;
+} ifx_i2c_recovery_stats_t;
+
+/** @brief Recovery state structure */
+typedef struct ifx_i2c_recovery {
+    /// Recovery statistics
+    ifx_i2c_recovery_stats_t stats;
+    /// Start time of the ongoing recovery
+    uint32_t start_time;
+    /// Error which started the ongoing recovery, #IFX_I2C_STACK_SUCCESS if the recovery was requested
+    optiga_lib_status_t trigger_event;
+    /// Recovery reset is in progress
+    uint8_t ongoing;
+    /// Session of the shielded connection is being restored after the recovery reset
+    uint8_t session_restore_ongoing;
+    /// Transceive is in progress
+    uint8_t transceive_ongoing;
+    /// Class of the last bus error recorded during the ongoing transceive
+    uint8_t error_class;
+} ifx_i2c_recovery_t;
+#endif
+
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/** @brief Wait for the ready line of the I2C slave */
+typedef struct ifx_i2c_ready_wait {
+    /// Handler invoked once the slave signalled ready, at the latest after the start up time
+    void (*handler)(void *p_ctx);
+    /// Start time of the wait in microseconds
+    uint32_t start_time;
+    /// Ready line is watched for the ongoing reset
+    uint8_t is_watched;
+} ifx_i2c_ready_wait_t;
+#endif
+
 /** @brief IFX I2C context structure */
 typedef struct ifx_i2c_context {
 #if defined OPTIGA_COMMS_SHIELDED_CONNECTION
@@ -394,6 +488,10 @@ typedef struct ifx_i2c_context {
     pal_gpio_t *p_slave_vdd_pin;
     /// Pointer to pal gpio context for reset
     pal_gpio_t *p_slave_reset_pin;
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    /// Pointer to pal gpio context for the ready line of the slave
+    pal_gpio_t *p_slave_ready_pin;
+#endif
     /// Pointer to pal i2c context
     pal_i2c_t *p_pal_i2c_ctx;
     /// Upper layer event handler
@@ -439,6 +537,14 @@ typedef struct ifx_i2c_context {
     /// Variable to indicate manage context operation
     uint8_t manage_context_operation;
 #endif
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /// Bus error and recovery state
+    ifx_i2c_recovery_t recovery;
+#endif
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    /// Ongoing wait for the ready line
+    ifx_i2c_ready_wait_t ready_wait;
+#endif
 } ifx_i2c_context_t;
 
 /** @brief IFX I2C Instance */
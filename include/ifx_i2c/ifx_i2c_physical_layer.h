@@ -113,6 +113,28 @@ optiga_lib_status_t ifx_i2c_pl_write_slave_address(
     uint8_t slave_address,
     uint8_t storage_type
 );
+
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/**
+ * \brief Function to continue once the slave signalled ready on the watched ready line.
+ *
+ * \details
+ * Checks the ready line watched with #pal_gpio_watch_ready every #IFX_I2C_READY_CHECK_INTERVAL_US
+ * from the PAL OS event, without blocking.
+ * - The handler is invoked from the PAL OS event once the slave signalled ready,
+ *   at the latest after #STARTUP_TIME_MSEC
+ *
+ * \pre
+ * - #pal_gpio_watch_ready succeeded for the ready line of the context before the reset
+ *
+ * \note
+ * - The negotiation handles a slave which did not signal ready like a late slave
+ *
+ * \param[in]    p_ctx                   Pointer to IFX I2C context.
+ * \param[in]    handler                 Handler invoked with the IFX I2C context.
+ */
+void ifx_i2c_pl_wait_ready(ifx_i2c_context_t *p_ctx, void (*handler)(void *p_ctx));
+#endif
 /**
  * @}
  **/
@@ -97,6 +97,29 @@ optiga_lib_status_t ifx_i2c_prl_transceive(
  */
 optiga_lib_status_t ifx_i2c_prl_close(ifx_i2c_context_t *p_ctx, ifx_i2c_event_handler_t handler);
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+/**
+ * \brief Function to restore the secure session after a recovery reset.
+ *
+ * \details
+ * Asynchronous function to establish a new secure session with a handshake.
+ * - The session is restored only if it was established before the last #ifx_i2c_prl_transceive.
+ * - The result of the handshake is propagated to the event handler registered with #ifx_i2c_prl_init.
+ *
+ * \pre
+ * - Presentation layer must be re-initialized with #ifx_i2c_prl_init.
+ *
+ * \note
+ * - None
+ *
+ * \param[in,out] p_ctx                  Pointer to ifx i2c context.
+ *
+ * \retval        IFX_I2C_STACK_SUCCESS  If the handshake is started.
+ * \retval        IFX_I2C_STACK_ERROR    If there is no session to restore or the module is busy.
+ */
+optiga_lib_status_t ifx_i2c_prl_restore_session(ifx_i2c_context_t *p_ctx);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
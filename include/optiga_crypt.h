@@ -24,26 +24,48 @@ extern "C" {
 
 /** \brief union for OPTIGA crypt parameters */
 typedef union optiga_crypt_params {
-    /// get random params
+    /// get random params, always present to keep the union non-empty in minimal builds
     optiga_get_random_params_t optiga_get_random_params;
+#if defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED) \
+    || defined(OPTIGA_CRYPT_RSA_GENERATE_KEYPAIR_ENABLED)
     /// get key pair params
     optiga_gen_keypair_params_t optiga_gen_keypair_params;
+#endif
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) || defined(OPTIGA_CRYPT_RSA_SIGN_ENABLED)
     /// calc sign params
     optiga_calc_sign_params_t optiga_calc_sign_params;
+#endif
+#if defined(OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RSA_VERIFY_ENABLED)
     /// verify sign params
     optiga_verify_sign_params_t optiga_verify_sign_params;
+#endif
 #if defined(OPTIGA_CRYPT_RSA_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_RSA_DECRYPT_ENABLED)
     /// asymmetric encryption params
     optiga_encrypt_asym_params_t optiga_encrypt_asym_params;
 #endif
+#ifdef OPTIGA_CRYPT_HASH_ENABLED
     /// calc hash params
     optiga_calc_hash_params_t optiga_calc_hash_params;
+#endif
+#ifdef OPTIGA_CRYPT_ECDH_ENABLED
     /// calc ssec params
     optiga_calc_ssec_params_t optiga_calc_ssec_params;
+#endif
+#if defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+    || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED)
     /// derive key params
     optiga_derive_key_params_t optiga_derive_key_params;
-#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED)
-    /// derive key params
+#endif
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+    /// key schedule params
+    optiga_key_schedule_params_t optiga_key_schedule_params;
+#endif
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
+    /// symmetric encrypt and decrypt params
     optiga_encrypt_sym_params_t optiga_symmetric_enc_dec_params;
 #endif
 #ifdef OPTIGA_CRYPT_SYM_GENERATE_KEY_ENABLED
@@ -70,6 +92,24 @@ struct optiga_crypt {
     /// To provide the presentation layer protocol version to be used
     uint8_t protocol_version;
 #endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+    /// Verifications allowed to be performed on the host, combination of OPTIGA_CRYPT_VERIFY_POLICY_XXX
+    uint8_t verify_policy;
+#endif  // OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+    /// Host DRBG serving the random requests of the instance, NULL if not enabled
+    struct optiga_crypt_random_pool *p_random_pool;
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    /// Engine of the hash operations of the instance, OPTIGA_CRYPT_HASH_ENGINE_XXX
+    uint8_t hash_engine;
+#endif  // OPTIGA_CRYPT_HOST_HASH_ENABLED
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+    /// Results of the instance are looked up in and stored to the result cache
+    bool_t result_cache_enabled;
+    /// Cache entry reserved for the result of the request in progress, NULL if none
+    struct optiga_crypt_result_cache_entry *p_result_cache_entry;
+#endif  // OPTIGA_CRYPT_RESULT_CACHE_ENABLED
 };
 
 /** \brief OPTIGA crypt instance structure type*/
@@ -105,6 +145,343 @@ typedef struct optiga_crypt optiga_crypt_t;
 void optiga_crypt_set_comms_params(optiga_crypt_t *me, uint8_t parameter_type, uint8_t value);
 #endif
 
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+/// Signature verifications are performed by OPTIGA (default)
+#define OPTIGA_CRYPT_VERIFY_POLICY_CHIP_ONLY (0x00)
+/// ECDSA signature verifications with a public key from host are performed on the host
+#define OPTIGA_CRYPT_VERIFY_POLICY_HOST_ECDSA (0x01)
+/// RSA signature verifications with a public key from host are performed on the host
+#define OPTIGA_CRYPT_VERIFY_POLICY_HOST_RSA (0x02)
+
+/**
+ * \brief Sets the signature verification policy of the instance.
+ *
+ *\details
+ * Sets which signature verifications of the instance are performed on the host using #pal_crypt_verify_signature.
+ * - Verifications with a public key from a certificate data object (#OPTIGA_CRYPT_OID_DATA) are always performed by OPTIGA.
+ * - Verifications with a requested protection level (#OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL) are performed by OPTIGA.
+ * - Verifications with a key type not supported by the host crypto library are performed by OPTIGA.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - A verification performed on the host completes synchronously, the callback handler of the instance
+ *   is invoked before the verify API returns. Parallel verifications are achieved by using a separate instance per application thread.
+ *
+ * \param[in,out]  me                     Valid instance of #optiga_crypt_t
+ * \param[in]      verify_policy          Combination of #OPTIGA_CRYPT_VERIFY_POLICY_HOST_ECDSA and #OPTIGA_CRYPT_VERIFY_POLICY_HOST_RSA,
+ *                                        or #OPTIGA_CRYPT_VERIFY_POLICY_CHIP_ONLY
+ *
+ */
+LIBRARY_EXPORTS void optiga_crypt_set_verify_policy(optiga_crypt_t *me, uint8_t verify_policy);
+#endif  // OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+/// Hash operations are performed by OPTIGA (default)
+#define OPTIGA_CRYPT_HASH_ENGINE_OPTIGA (0x00)
+/// Hash operations on data from host are performed by the host crypto library
+#define OPTIGA_CRYPT_HASH_ENGINE_HOST (0x01)
+
+/**
+ * \brief Selects the engine of the hash operations of the instance.
+ *
+ *\details
+ * Selects whether #optiga_crypt_hash_start, #optiga_crypt_hash and #optiga_crypt_hash_stream are performed
+ * on the host using #pal_crypt_hash_start, #pal_crypt_hash_update and #pal_crypt_hash_finalize or by OPTIGA.
+ * - Hashing of data in OPTIGA (#OPTIGA_CRYPT_OID_DATA) with #optiga_crypt_hash is always performed by OPTIGA.
+ * - Hash operations with a requested protection level (#OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL) are performed by OPTIGA.
+ * - Hash algorithms or context buffers not supported by the host crypto library are performed by OPTIGA.
+ * - #optiga_crypt_hash_update and #optiga_crypt_hash_finalize follow the engine which started the hash context,
+ *   independent of the engine selected at the time of the call.
+ * - #OPTIGA_HASH_TYPE_SHA_384 and #OPTIGA_HASH_TYPE_SHA_512 are supported by the host engine only.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - A hash operation performed on the host completes synchronously, the callback handler of the instance
+ *   is invoked before the hash API returns.
+ * - Data in OPTIGA (#OPTIGA_CRYPT_OID_DATA) cannot be added to a hash context started on the host,
+ *   the callback handler reports #OPTIGA_CRYPT_ERROR_INVALID_INPUT.
+ *
+ * \param[in,out]  me                     Valid instance of #optiga_crypt_t
+ * \param[in]      hash_engine            #OPTIGA_CRYPT_HASH_ENGINE_OPTIGA or #OPTIGA_CRYPT_HASH_ENGINE_HOST
+ *
+ */
+LIBRARY_EXPORTS void optiga_crypt_set_hash_engine(optiga_crypt_t *me, uint8_t hash_engine);
+#endif  // OPTIGA_CRYPT_HOST_HASH_ENABLED
+
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+/// Default number of requests served by the host DRBG before it is reseeded from OPTIGA
+#define OPTIGA_CRYPT_RANDOM_POOL_DEFAULT_RESEED_INTERVAL (0x400)
+
+/**
+ * \brief Configuration of the host DRBG of an instance.
+ */
+typedef struct optiga_crypt_random_pool_config {
+    /// Number of requests served before reseeding from OPTIGA TRNG, 0 selects #OPTIGA_CRYPT_RANDOM_POOL_DEFAULT_RESEED_INTERVAL
+    uint32_t reseed_interval;
+    /// Reseed from OPTIGA TRNG before every request (prediction resistance)
+    bool_t prediction_resistance;
+} optiga_crypt_random_pool_config_t;
+
+/**
+ * \brief Enables the host DRBG for the random requests of the instance.
+ *
+ *\details
+ * Serves #optiga_crypt_random requests of type #OPTIGA_RNG_TYPE_DRNG from a HMAC_DRBG (SHA256) on the host.
+ * - The DRBG is seeded from OPTIGA TRNG with the first request and reseeded after the configured number of requests.
+ * - A request served from the DRBG completes synchronously, the callback handler is invoked before #optiga_crypt_random returns.
+ * - A request which (re)seeds the DRBG completes asynchronously after the TRNG output is received from OPTIGA.
+ * - Requests of type #OPTIGA_RNG_TYPE_TRNG bypass the DRBG and are always served by OPTIGA.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The DRBG state belongs to the instance. Use a separate instance per application thread.
+ * - Calling the API again updates the configuration and forces a reseed with the next request.
+ *
+ * \param[in,out]  me                     Valid instance of #optiga_crypt_t
+ * \param[in]      p_config               DRBG configuration, NULL selects the default configuration
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Host DRBG is enabled
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            Invalid instance
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE          A request of the instance is in progress
+ * \retval         #OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT      DRBG state could not be allocated
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_random_pool_enable(
+    optiga_crypt_t *me,
+    const optiga_crypt_random_pool_config_t *p_config
+);
+
+/**
+ * \brief Disables the host DRBG of the instance.
+ *
+ *\details
+ * Clears and releases the DRBG state, all random requests are served by OPTIGA again.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - None
+ *
+ * \param[in,out]  me                     Valid instance of #optiga_crypt_t
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Host DRBG is disabled
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            Invalid instance
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE          A request of the instance is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_random_pool_disable(optiga_crypt_t *me);
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+/// Maximum number of keypairs held by the ECDHE pool, each keypair occupies a session and an instance registration
+#define OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS (0x02)
+
+/**
+ * \brief Configuration of the pre-generated keypairs of a curve.
+ */
+typedef struct optiga_crypt_ecdhe_pool_config {
+    /// Curve of the keypairs
+    optiga_ecc_curve_t curve_id;
+    /// Key usage of the keypairs, a request is served only if it specifies the same key usage
+    uint8_t key_usage;
+    /// Number of keypairs of the curve kept ready
+    uint8_t count;
+} optiga_crypt_ecdhe_pool_config_t;
+
+/**
+ * \brief Statistics of the ECDHE pool.
+ */
+typedef struct optiga_crypt_ecdhe_pool_stats {
+    /// Number of keypairs generated in the background
+    uint32_t generated_count;
+    /// Number of keypair requests served from the pool
+    uint32_t served_count;
+    /// Number of session keypair requests generated on demand, as no matching keypair was ready
+    uint32_t miss_count;
+    /// Number of failed background keypair generations
+    uint32_t failure_count;
+    /// Number of ready keypairs discarded, as their sessions were lost or released before hibernating
+    uint32_t discarded_count;
+} optiga_crypt_ecdhe_pool_stats_t;
+
+/**
+ * \brief Starts the pre-generation of ephemeral ECC keypairs in OPTIGA sessions.
+ *
+ *\details
+ * Keeps the configured number of ephemeral keypairs ready in session data objects, to take the key generation
+ * out of the critical path of ECDHE key agreements.
+ * - The keypairs are generated one at a time, while no other command is processed by OPTIGA and at least
+ *   two sessions are free, so that a session is always left to the application.
+ * - #optiga_crypt_ecc_generate_keypair requests with #OPTIGA_KEY_ID_SESSION_BASED as private key, a configured curve
+ *   and the configured key usage are served from a ready keypair. The session holding the private key is transferred
+ *   to the requesting instance, the public key is copied and the callback handler is invoked before the API returns.
+ * - Every keypair is handed out only once. The requesting instance owns the session as if it generated the keypair,
+ *   the next keypair is generated in the background.
+ * - Requests with a protection level (#OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL) or by an instance already holding a
+ *   session are always served by OPTIGA.
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ *
+ *\note
+ * - Each keypair occupies an OPTIGA session and an instance registration (<b>OPTIGA_CMD_MAX_REGISTRATIONS</b>) until it is served
+ *   or the pool is stopped.
+ * - Keypairs are only generated while the application on OPTIGA is open.
+ * - The ready keypairs are discarded, when OPTIGA loses the sessions: CloseApplication without hibernate,
+ *   #optiga_util_open_application without restore (which resets OPTIGA) and a failed command (which may have recovered
+ *   OPTIGA by a reset).
+ * - Sessions held by the pool do not keep the power manager of #optiga_util_power_manager_start from hibernating OPTIGA,
+ *   the ready keypairs are discarded before hibernating.
+ * - After three consecutive failed generations, the pool pauses until the application is opened again.
+ *
+ * \param[in]      p_config               Array of per curve configurations
+ * \param[in]      config_count           Number of configurations in p_config
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Pre-generation is started
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            No keypair or more than #OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS keypairs are configured
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE          Pool is already started
+ * \retval         #OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT      Instances for the keypairs could not be created
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdhe_pool_start(
+    const optiga_crypt_ecdhe_pool_config_t *p_config,
+    uint8_t config_count
+);
+
+/**
+ * \brief Stops the pre-generation of ephemeral ECC keypairs.
+ *
+ *\details
+ * Stops the background generation and releases the sessions of the keypairs which are not served.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - Keypairs which are not served are discarded.
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Pool is stopped
+ * \retval         #OPTIGA_CRYPT_ERROR                          Pool is not started
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE          A keypair generation is in progress, retry later
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdhe_pool_stop(void);
+
+/**
+ * \brief Provides the statistics of the ECDHE pool.
+ *
+ *\details
+ * Provides the statistics collected since #optiga_crypt_ecdhe_pool_start.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - None
+ *
+ * \param[out]     p_stats                Statistics of the pool
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Statistics are provided
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            p_stats is NULL
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_crypt_ecdhe_pool_get_stats(optiga_crypt_ecdhe_pool_stats_t *p_stats);
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+#ifndef OPTIGA_CRYPT_RESULT_CACHE_ENTRIES
+/// Number of results held by the result cache, shared by all instances
+#define OPTIGA_CRYPT_RESULT_CACHE_ENTRIES (0x08)
+#endif
+
+/**
+ * \brief Statistics of the result cache.
+ */
+typedef struct optiga_crypt_result_cache_stats {
+    /// Number of requests served from the cache
+    uint32_t hit_count;
+    /// Number of cacheable requests performed by OPTIGA, as no result was cached
+    uint32_t miss_count;
+    /// Number of results discarded, as the data object they depend on was written
+    uint32_t invalidation_count;
+} optiga_crypt_result_cache_stats_t;
+
+/**
+ * \brief Enables the result cache for the requests of the instance.
+ *
+ *\details
+ * Memoises the results of read-only requests on data in OPTIGA, to serve repeated requests without a command to OPTIGA.
+ * - #optiga_crypt_ecdsa_verify and #optiga_crypt_rsa_verify with a public key in OPTIGA (#OPTIGA_CRYPT_OID_DATA) are
+ *   cached by OID, scheme, digest and signature. Only successful verifications are cached.
+ * - #optiga_crypt_hash with data in OPTIGA (#OPTIGA_CRYPT_OID_DATA) and #OPTIGA_HASH_TYPE_SHA_256 is cached by OID,
+ *   offset and length, the digest is stored.
+ * - A request served from the cache completes synchronously, the callback handler is invoked before the API returns.
+ * - The results depending on a data object are discarded before the data object or its metadata is written using
+ *   #optiga_util_write_data, #optiga_util_write_metadata or #optiga_util_update_count, all results are discarded before
+ *   #optiga_util_protected_update_start.
+ * - Requests with a protection level (#OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL) are always performed by OPTIGA and not cached.
+ * - The least recently used result is replaced, if all #OPTIGA_CRYPT_RESULT_CACHE_ENTRIES entries are in use.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The cache is shared by all instances which enable it. A result cached by one instance is served to the others.
+ * - Only the writes issued through this host library are observed. Do not enable the cache for data objects which are
+ *   modified by OPTIGA itself (e.g. counters), written by another host or whose access conditions depend on a state
+ *   which changes without a write (e.g. authorization or security state). Use #optiga_crypt_result_cache_clear
+ *   after such changes.
+ * - The cache keys are calculated with #pal_crypt_hash_start, #pal_crypt_hash_update and #pal_crypt_hash_finalize (SHA256).
+ *
+ * \param[in,out]  me                     Valid instance of #optiga_crypt_t
+ * \param[in]      enable                 TRUE to enable, FALSE to disable the cache for the instance
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Result cache is enabled or disabled
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            Invalid instance
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE          A request of the instance is in progress
+ * \retval         #OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT      No write handler can be attached (#OPTIGA_CMD_MAX_WRITE_HANDLERS)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_crypt_result_cache_enable(optiga_crypt_t *me, bool_t enable);
+
+/**
+ * \brief Discards all results of the result cache.
+ *
+ *\details
+ * Discards all cached results, requests in progress do not store their result.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The statistics are not reset.
+ */
+LIBRARY_EXPORTS void optiga_crypt_result_cache_clear(void);
+
+/**
+ * \brief Provides the statistics of the result cache.
+ *
+ *\details
+ * Provides the statistics collected since the start of the application.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - None
+ *
+ * \param[out]     p_stats                Statistics of the result cache
+ *
+ * \retval         #OPTIGA_LIB_SUCCESS                          Statistics are provided
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT            p_stats is NULL
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_crypt_result_cache_get_stats(optiga_crypt_result_cache_stats_t *p_stats);
+#endif  // OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+
 /**
  * \brief Create an instance of #optiga_crypt_t.
  *
@@ -174,6 +551,7 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_destroy(optiga_crypt_t *me);
  * - Error codes from lower layers is returned as it is.<br>
  * - The maximum value of the <b>random_data_length</b> parameter is size of buffer <b>random_data</b>.
  *   In case the value is greater than buffer size, memory corruption can occur.<br>
+ * - With #optiga_crypt_random_pool_enable, requests of type #OPTIGA_RNG_TYPE_DRNG are served by the host DRBG.<br>
  *
  * \param[in]      me                                       Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
  * \param[in]      rng_type                                 Type of random data generator.
@@ -244,6 +622,52 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_hash(
     uint8_t *hash_output
 );
 
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+/**
+ *
+ * \brief Hashes data provided by a reader and returns digest.
+ *
+ * \details
+ * Hashes the data provided by the reader of the stream and returns digest.<br>
+ * - The data is sent in fragments filling the complete APDU, without exporting or importing the hash context between the fragments.
+ * - The next fragment is read into the stream buffer while OPTIGA hashes the current fragment.
+ * - The progress handler of the stream is invoked after each fragment is hashed by OPTIGA.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.<br>
+ *
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
+ * - Error codes from lower layer will be returned as it is.<br>
+ * - OPTIGA is locked for the instance until the complete stream is hashed.
+ * - A stream buffer of #OPTIGA_MAX_COMMS_BUFFER_SIZE bytes allows the largest fragments.
+ * - The reader is invoked from the context of the OPTIGA event handler. It must provide at least one byte
+ *   per invocation, until the specified length of the stream is read.
+ *
+ *<br>
+ * \param[in]      me                                        Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]      hash_algorithm                            Hash algorithm of #optiga_hash_type_t.
+ * \param[in]      p_hash_stream                             Data for hashing in #hash_data_stream_t, must remain valid until completion.
+ * \param[inout]   hash_output                               Pointer to the valid buffer to store hash output.
+ *
+ * \retval         #OPTIGA_CRYPT_SUCCESS                     Successful invocation.
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT         Wrong Input arguments provided.
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE       The previous operation with the same instance is not complete.
+ * \retval         #OPTIGA_DEVICE_ERROR                      Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                           (Refer Solution Reference Manual)
+ *
+ * <b>Example</b><br>
+ * example_optiga_crypt_hash_stream.c
+ *
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_hash_stream(
+    optiga_crypt_t *me,
+    optiga_hash_type_t hash_algorithm,
+    const hash_data_stream_t *p_hash_stream,
+    uint8_t *hash_output
+);
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
+
 /**
  *
  * \brief Initializes a hash context.
@@ -382,6 +806,8 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_hash_finalize(
  * - Private key is exported only if explicitly requested otherwise it is stored in the input private key OID.
  * - Public key is always exported.
  * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the operation is asynchronously completed.
+ * - With #optiga_crypt_ecdhe_pool_start, a session based key pair may be served from a pre-generated key pair.
+ *   The callback is then invoked before the API returns.
  *
  * \pre
  * - The application on OPTIGA must be opened using #optiga_util_open_application before using this API.
@@ -473,6 +899,61 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdsa_sign(
 );
 #endif  // OPTIGA_CRYPT_ECDSA_SIGN_ENABLED
 
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+/**
+ * \brief Generates signatures for a batch of digests using the same private key.
+ *
+ * \details
+ * Generates a signature for each of the given digests using private key stored in OPTIGA.
+ * - Invokes #optiga_cmd_calc_sign API once for the whole batch.<br>
+ * - The OPTIGA lock is acquired once and kept until the last digest is signed, the items are sent back to back.
+ * - Exports the generated signatures.
+ * - The item_handler gets invoked with the item index, when the signature of an item is exported.
+ * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the whole batch is asynchronously completed.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application before using this API.<br>
+ * - If the private_key type is #OPTIGA_KEY_ID_SESSION_BASED then session must be already available in the instance. (For .e.g Using #optiga_crypt_ecc_generate_keypair )
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL
+ * - Error codes from lower layers is returned as it is.
+ * - On failure the batch is stopped. The callback registered with instance reports the error of the item following the last item reported to item_handler.
+ *
+ * \param[in]      me                                       Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]      digests                                  Digests on which signatures are generated, digest_count entries.
+ * \param[in]      digest_length                            Length of each input digest.
+ * \param[in]      digest_count                             Number of digests in the batch, must not be zero.
+ * \param[in]      private_key                              Private key OID to generate the signatures.
+ * \param[in,out]  signatures                               Buffers to store the generated signatures, digest_count entries.
+ *                                                          - The size of each buffer must be sufficient enough to accommodate the additional
+ *                                                          DER encoding formatting for R and S components of signature.
+ * \param[in,out]  signature_lengths                        Lengths of signatures, digest_count entries. Initial values set as length of buffers,
+ *                                                          later updated as the actual length of generated signatures.
+ * \param[in]      item_handler                             Handler invoked with the caller context on completion of each item, can be NULL.
+ *
+ * \retval         #OPTIGA_CRYPT_SUCCESS                    Successful invocation.
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT        Wrong Input arguments provided.<br>
+ *                                                          Session is not available in instance and the private_key type is #OPTIGA_KEY_ID_SESSION_BASED
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE      The previous operation with the same instance is not complete.
+ * \retval         #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                          (Refer Solution Reference Manual)
+ *
+ * <b>Example</b><br>
+ * example_optiga_crypt_ecdsa_sign_batch.c
+ *
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdsa_sign_batch(
+    optiga_crypt_t *me,
+    const uint8_t *const *digests,
+    uint8_t digest_length,
+    uint16_t digest_count,
+    optiga_key_id_t private_key,
+    uint8_t *const *signatures,
+    uint16_t *signature_lengths,
+    optiga_sign_batch_item_handler_t item_handler
+);
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_ENABLED && OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
 #ifdef OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
 /**
  * \brief Verifies the signature over the given digest.
@@ -490,6 +971,8 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdsa_sign(
  * \note
  * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
  * - Error codes from lower layers is returned as it is to the application.<br>
+ * - If allowed by #optiga_crypt_set_verify_policy, a public key from host is verified on the host and
+ *   #OPTIGA_CRYPT_ERROR_VERIFY_FAILED is reported for an invalid signature.
  *
  * \param[in]   me                                        Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
  * \param[in]   digest                                    Pointer to a given digest buffer, must not be NULL.
@@ -577,6 +1060,66 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_ecdh(
 );
 #endif  // OPTIGA_CRYPT_ECDH_ENABLED
 
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+/**
+ * \brief Calculates the shared secret using ECDH algorithm and derives keys from it, as a single operation.<br>
+ *
+ * \details
+ * Executes a TLS key schedule (for e.g. ECDH, master secret and key block) on OPTIGA, without releasing OPTIGA to other instances in between.
+ * - Invokes #optiga_cmd_key_schedule API, based on the input arguments.<br>
+ * - Calculates the shared secret based on input private key object ID and public key and stores it in the acquired session object ID.
+ * - Executes the key derivation steps in the given order. Each step derives from the session object ID using TLS PRF or HKDF and<br>
+ *   either stores the derived key in the session object ID, as input of the next step, or exports it to the host.
+ * - The OPTIGA lock and session are acquired once, the steps are chained without returning to the scheduler or the caller.
+ * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the last step is completed or any step failed.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ * - There must be a private key available in the "session context / data object OID" provided as input parameter.
+ * - If the private_key type is #OPTIGA_KEY_ID_SESSION_BASED then session must be already available in the instance. (For .e.g Using #optiga_crypt_ecc_generate_keypair )
+ *
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL
+ * - Error codes from lower layers is returned as it is.
+ * - The shared secret and the keys which are stored in the session object ID are never exported.
+ * - The steps and the buffers referred by them must be available until the operation is completed.
+ * - On completion, the session object ID holds the shared secret or the last derived key which is not exported.<br>
+ *   The session is released by #optiga_crypt_destroy.
+ *
+ * \param[in]      me                                          Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]      private_key                                 Object ID of the private key stored in OPTIGA.<br>
+ *                                                             - Possible values are from the #optiga_key_id_t <br>
+ *                                                             - Argument check for private_key is not done since OPTIGA will provide an error for invalid private_key.
+ * \param[in]      public_key                                  Pointer to the public key structure for shared secret generation with its properties, must not be NULL.<br>
+ *                                                             - Provide the inputs according to the structure type #public_key_from_host_t
+ * \param[in]      steps                                       Key derivation steps, executed in order, must not be NULL.<br>
+ *                                                             - Provide the inputs according to the structure type #optiga_key_schedule_step_t
+ *                                                             - derivation_type must be a #optiga_tls_prf_type_t or #optiga_hkdf_type_t
+ *                                                               enabled in the configuration.
+ *                                                             - TLS PRF steps require a seed and take no info, HKDF steps take no label.
+ *                                                             - Derivation data and info must fit in a single command, a derived key
+ *                                                               stored in the session OID is at most 66 bytes.
+ * \param[in]      step_count                                  Number of key derivation steps, must not be zero.
+ *
+ * \retval         #OPTIGA_CRYPT_SUCCESS                       Successful invocation
+ * \retval         #OPTIGA_CRYPT_ERROR_INVALID_INPUT           Wrong Input arguments provided.<br>
+ *                                                             A key derivation step is invalid, checked before any command is sent.<br>
+ *                                                             Session is not available in instance and the private_key type is #OPTIGA_KEY_ID_SESSION_BASED
+ * \retval         #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE         The previous operation with the same instance is not complete
+ * \retval         #OPTIGA_DEVICE_ERROR                        Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                             (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_key_schedule(
+    optiga_crypt_t *me,
+    optiga_key_id_t private_key,
+    public_key_from_host_t *public_key,
+    const optiga_key_schedule_step_t *steps,
+    uint8_t step_count
+);
+#endif  // OPTIGA_CRYPT_ECDH_ENABLED && OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+
 #if defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
     || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED)
 /**
@@ -949,6 +1492,8 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_rsa_sign(
  * \note
  * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
  * - Error codes from lower layers is returned as it is to the application.<br>
+ * - If allowed by #optiga_crypt_set_verify_policy, a public key from host is verified on the host and
+ *   #OPTIGA_CRYPT_ERROR_VERIFY_FAILED is reported for an invalid signature.
  *
  * \param[in]   me                                        Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
  * \param[in]   signature_scheme                          RSA signature scheme defined in #optiga_rsa_signature_scheme_t
@@ -1544,6 +2089,63 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_symmetric_encrypt_final(
     uint8_t *encrypted_data,
     uint32_t *encrypted_data_length
 );
+
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/**
+ * \brief Encrypts the data provided by a reader using symmetric encryption mode and passes the encrypted data to a writer.<br>
+ *
+ * \details
+ * Encrypts or calculates the MAC of the data provided by the reader of the stream.<br>
+ * - Invokes #optiga_cmd_encrypt_sym API in fragments filling the complete APDU, within one strict sequence.
+ * - The next fragment is read into the stream buffer while OPTIGA encrypts the current fragment.
+ * - The encrypted data (or the MAC for #OPTIGA_SYMMETRIC_CBC_MAC and #OPTIGA_SYMMETRIC_CMAC) is passed to the writer of the stream.
+ * - If padding is enabled in the stream, PKCS#7 padding is appended to the data.
+ * - The progress handler of the stream is invoked after each fragment with the throughput in bytes per second.
+ * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the operation is asynchronously completed.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.<br>
+ * - Symmetric key must be available at symmetric key OID in OPTIGA.<br>
+ *
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
+ *      - Default protection level for this API is #OPTIGA_COMMS_COMMAND_PROTECTION.
+ * - Supported modes are #OPTIGA_SYMMETRIC_ECB, #OPTIGA_SYMMETRIC_CBC, #OPTIGA_SYMMETRIC_CBC_MAC and #OPTIGA_SYMMETRIC_CMAC.<br>
+ * - Without padding, the data length must be block aligned, except for #OPTIGA_SYMMETRIC_CMAC.<br>
+ * - OPTIGA is locked for the instance until the complete stream is processed.<br>
+ * - A stream buffer of #OPTIGA_MAX_COMMS_BUFFER_SIZE bytes allows the largest fragments.<br>
+ * - The reader and the writer are invoked from the context of the OPTIGA event handler.<br>
+ * - Error codes from lower layers is returned as it is to the application.<br>
+ *
+ * \param[in]         me                                    Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]         encryption_mode                       Symmetric encryption mode
+ * \param[in]         symmetric_key_oid                     OPTIGA symmetric key OID
+ *                                                          - Symmetric key must be available at the specified OID.<br>
+ * \param[in]         iv                                    Pointer to an IV(initialization vector).
+ *                                                          - Only supported for CBC mode.
+ * \param[in]         iv_length                             Length of the IV
+ *                                                          - Only supported for CBC mode.
+ * \param[in]         p_sym_stream                          Input and output of the operation in #symmetric_data_stream_t, must remain valid until completion.
+ *
+ * \retval            #OPTIGA_CRYPT_SUCCESS                 Successful invocation
+ * \retval            #OPTIGA_CRYPT_ERROR_INVALID_INPUT     Wrong Input arguments provided
+ * \retval            #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE   The previous operation with the same instance is not complete
+ * \retval            #OPTIGA_DEVICE_ERROR                  Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                          (Refer Solution Reference Manual)
+ *
+ * <b>Example</b><br>
+ * example_optiga_crypt_symmetric_stream.c
+ *
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_symmetric_encrypt_stream(
+    optiga_crypt_t *me,
+    optiga_symmetric_encryption_mode_t encryption_mode,
+    optiga_key_id_t symmetric_key_oid,
+    const uint8_t *iv,
+    uint16_t iv_length,
+    const symmetric_data_stream_t *p_sym_stream
+);
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
 
 #ifdef OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
@@ -1831,6 +2433,63 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_symmetric_decrypt_final(
     uint8_t *plain_data,
     uint32_t *plain_data_length
 );
+
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/**
+ * \brief Decrypts the data provided by a reader using symmetric decryption mode and passes the plain data to a writer.<br>
+ *
+ * \details
+ * Decrypts the data provided by the reader of the stream.<br>
+ * - Invokes #optiga_cmd_decrypt_sym API in fragments filling the complete APDU, within one strict sequence.
+ * - The next fragment is read into the stream buffer while OPTIGA decrypts the current fragment.
+ * - The decrypted data is passed to the writer of the stream.
+ * - If padding is enabled in the stream, the PKCS#7 padding is verified and removed from the last block.
+ * - The progress handler of the stream is invoked after each fragment with the throughput in bytes per second.
+ * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the operation is asynchronously completed.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.<br>
+ * - Symmetric key must be available at symmetric key OID in OPTIGA.<br>
+ *
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
+ *      - Default protection level for this API is #OPTIGA_COMMS_RESPONSE_PROTECTION.
+ * - Supported modes are #OPTIGA_SYMMETRIC_ECB and #OPTIGA_SYMMETRIC_CBC.<br>
+ * - The encrypted data length must be block aligned.<br>
+ * - OPTIGA is locked for the instance until the complete stream is processed.<br>
+ * - A stream buffer of #OPTIGA_MAX_COMMS_BUFFER_SIZE bytes allows the largest fragments.<br>
+ * - The reader and the writer are invoked from the context of the OPTIGA event handler.<br>
+ * - Error codes from lower layers is returned as it is to the application.<br>
+ *
+ * \param[in]         me                                    Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]         encryption_mode                       Symmetric encryption mode
+ * \param[in]         symmetric_key_oid                     OPTIGA symmetric key OID
+ *                                                          - Symmetric key must be available at the specified OID.<br>
+ * \param[in]         iv                                    Pointer to an IV(initialization vector).
+ *                                                          - Only supported for CBC mode.
+ * \param[in]         iv_length                             Length of the IV
+ *                                                          - Only supported for CBC mode.
+ * \param[in]         p_sym_stream                          Input and output of the operation in #symmetric_data_stream_t, must remain valid until completion.
+ *
+ * \retval            #OPTIGA_CRYPT_SUCCESS                 Successful invocation
+ * \retval            #OPTIGA_CRYPT_ERROR_INVALID_INPUT     Wrong Input arguments provided
+ * \retval            #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE   The previous operation with the same instance is not complete
+ * \retval            #OPTIGA_DEVICE_ERROR                  Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                          (Refer Solution Reference Manual)
+ *
+ * <b>Example</b><br>
+ * example_optiga_crypt_symmetric_stream.c
+ *
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_symmetric_decrypt_stream(
+    optiga_crypt_t *me,
+    optiga_symmetric_encryption_mode_t encryption_mode,
+    optiga_key_id_t symmetric_key_oid,
+    const uint8_t *iv,
+    uint16_t iv_length,
+    const symmetric_data_stream_t *p_sym_stream
+);
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
 
 #ifdef OPTIGA_CRYPT_HMAC_ENABLED
@@ -2024,6 +2683,56 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_hmac_finalize(
     uint8_t *mac,
     uint32_t *mac_length
 );
+
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/**
+ * \brief Generates HMAC on the data provided by a reader using input secret from OPTIGA and passes the generated HMAC to a writer.<br>
+ *
+ * \details
+ * Generates HMAC on the data provided by the reader of the stream, for example a file or a socket.<br>
+ * - Invokes #optiga_cmd_encrypt_sym API in fragments filling the complete APDU, within one strict sequence.
+ * - The next fragment is read into the stream buffer while OPTIGA processes the current fragment.
+ * - The generated HMAC is passed to the writer of the stream.
+ * - The progress handler of the stream is invoked after each fragment with the throughput in bytes per second.
+ * - The callback registered with instance (#optiga_crypt_create) gets invoked, when the operation is asynchronously completed.
+ *
+ * \pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.<br>
+ * - The data object specified by input <b>secret</b> must have a secret written into it.<br>
+ *
+ * \note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL.
+ *      - Default protection level for this API is #OPTIGA_COMMS_COMMAND_PROTECTION.
+ * - Padding is not supported and must be disabled in the stream.<br>
+ * - OPTIGA is locked for the instance until the complete stream is processed.<br>
+ * - A stream buffer of #OPTIGA_MAX_COMMS_BUFFER_SIZE bytes allows the largest fragments.<br>
+ * - The reader and the writer are invoked from the context of the OPTIGA event handler.<br>
+ * - Error codes from lower layers is returned as it is to the application.<br>
+ *
+ * \param[in]         me                                    Valid instance of #optiga_crypt_t created using #optiga_crypt_create.
+ * \param[in]         type                                  HMAC type
+ * \param[in]         secret                                OPTIGA OID with input secret
+ *                                                          - Input secret must be available at the specified OID.<br>
+ *                                                          - To indicate session OID (already acquired by instance), specify #OPTIGA_KEY_ID_SESSION_BASED
+ * \param[in]         p_sym_stream                          Input data and HMAC output in #symmetric_data_stream_t, must remain valid until completion.
+ *
+ * \retval            #OPTIGA_CRYPT_SUCCESS                 Successful invocation
+ * \retval            #OPTIGA_CRYPT_ERROR_INVALID_INPUT     Wrong Input arguments provided
+ * \retval            #OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE   The previous operation with the same instance is not complete
+ * \retval            #OPTIGA_DEVICE_ERROR                  Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                          (Refer Solution Reference Manual)
+ *
+ * <b>Example</b><br>
+ * example_optiga_crypt_hmac.c
+ *
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_crypt_hmac_stream(
+    optiga_crypt_t *me,
+    optiga_hmac_type_t type,
+    uint16_t secret,
+    const symmetric_data_stream_t *p_sym_stream
+);
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_HMAC_ENABLED
 
 #ifdef OPTIGA_CRYPT_HKDF_ENABLED
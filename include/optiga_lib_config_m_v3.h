@@ -24,14 +24,22 @@ extern "C" {
 #define OPTIGA_CRYPT_RANDOM_ENABLED
 /** @brief OPTIGA CRYPT hash feature enable/disable macro */
 #define OPTIGA_CRYPT_HASH_ENABLED
+/** @brief OPTIGA CRYPT streamed hash feature enable/disable macro */
+#define OPTIGA_CRYPT_HASH_STREAM_ENABLED
 /** @brief OPTIGA CRYPT ECC generate keypair feature enable/disable macro */
 #define OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED
 /** @brief OPTIGA CRYPT ECDSA signature feature enable/disable macro */
 #define OPTIGA_CRYPT_ECDSA_SIGN_ENABLED
+/** @brief OPTIGA CRYPT ECDSA batch signature feature enable/disable macro */
+#define OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
 /** @brief OPTIGA CRYPT verify ECDSA signature feature enable/disable macro */
 #define OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
 /** @brief OPTIGA CRYPT ECDH feature enable/disable macro */
 #define OPTIGA_CRYPT_ECDH_ENABLED
+/** @brief OPTIGA CRYPT key schedule (ECDH followed by key derivations) feature.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
 /** @brief OPTIGA CRYPT ECC 521 feature enable/disable macro */
 #define OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
 /** @brief OPTIGA CRYPT ECC Brainpool feature enable/disable macro */
@@ -60,6 +68,8 @@ extern "C" {
 #define OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
 /** @brief OPTIGA CRYPT symmetric decrypt feature enable/disable macro */
 #define OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
+/** @brief OPTIGA CRYPT streamed symmetric encrypt/decrypt feature enable/disable macro */
+#define OPTIGA_CRYPT_SYM_STREAM_ENABLED
 /** @brief OPTIGA CRYPT HMAC feature enable/disable macro */
 #define OPTIGA_CRYPT_HMAC_ENABLED
 /** @brief OPTIGA CRYPT HKDF feature enable/disable macro */
@@ -94,6 +104,89 @@ extern "C" {
 #define OPTIGA_COMMS_DEFAULT_RESET_TYPE (0U)
 #endif
 
+/** @brief IFX I2C fast recovery feature, which classifies bus errors, provides the escalating recovery reset
+ *         (soft, then warm, then cold) and polls the slave for readiness instead of fixed start up waits.
+ *         A command recovered this way fails with OPTIGA_COMMS_ERROR_RECOVERED, the application must be opened
+ *         again. To enable the feature, define the macro
+ */
+//#define OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+
+/** @brief IFX I2C GPIO reset feature, which times the reset pulse with pal_gpio_pulse_low and checks the ready line
+ *         of the slave with pal_gpio_is_ready instead of the fixed reset low and start up waits. PALs without these
+ *         (e.g. other than the libgpiod v2 GPIO backend) fall back to the fixed waits. To enable the feature, define the macro
+ */
+//#define OPTIGA_COMMS_GPIOD_RESET_ENABLED
+
+/** @brief OPTIGA CRYPT host verify feature, which verifies signatures with a public key from host using
+ *         pal_crypt_verify_signature, if allowed by the verify policy of the instance.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+
+/** @brief OPTIGA CRYPT random pool feature, which serves optiga_crypt_random requests of type OPTIGA_RNG_TYPE_DRNG
+ *         from a host HMAC_DRBG seeded from the OPTIGA TRNG.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
+/** @brief OPTIGA CRYPT host hash feature, which allows optiga_crypt_hash operations on data from host
+ *         to be performed by the host crypto library instead of OPTIGA.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_HOST_HASH_ENABLED
+
+/** @brief OPTIGA CRYPT ECDHE pool feature, which pre-generates ephemeral ECC keypairs in session data objects
+ *         while OPTIGA is idle and serves session based keypair requests from them.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+/** @brief OPTIGA CRYPT result cache feature, which memoises the results of signature verifications with a public key
+ *         in OPTIGA and of hash operations on data in OPTIGA, invalidated by writes of the data objects.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+
+/** @brief OPTIGA UTIL power manager feature, which hibernates OPTIGA when idle and restores it on the next command.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+/** @brief OPTIGA UTIL key slot manager feature, which allocates key and data object OIDs and accounts their writes.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+
+/** @brief OPTIGA UTIL read cache feature, which serves repeated data object reads from the host memory.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_READ_CACHE_ENABLED
+
+/** @brief OPTIGA UTIL metadata store feature, which indexes the parsed metadata of the data and key objects.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_METADATA_STORE_ENABLED
+
+/** @brief OPTIGA UTIL write-behind feature, which coalesces small writes to data objects into one NVM write.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+
+/** @brief OPTIGA UTIL SEC governor feature, which paces low priority requests to avoid the throttling of OPTIGA.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+
+/** @brief OPTIGA UTIL performance profile feature, which switches the current limitation of OPTIGA by profiles.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
+/** @brief OPTIGA UTIL protected update stream feature, which writes the fragments of a protected update from a reader.
+ *         To enable the feature, define the macro
+ */
+//#define OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 /** @brief NULL parameter check.
  *         To disable the check, undefine the macro
  */
@@ -52,6 +52,12 @@ struct optiga_util {
     callback_handler_t handler;
     /// To provide the busy/free status of the util instance
     uint16_t instance_state;
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+    /// Reads of the instance use the read cache
+    bool_t read_cache_enabled;
+    /// Read cache entry reserved for the data of the read in progress
+    struct optiga_util_read_cache_entry *p_read_cache_entry;
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
 #ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
     /// To provide the encryption and decryption need for command and response
     uint8_t protection_level;
@@ -221,6 +227,1111 @@ optiga_util_open_application(optiga_util_t *me, bool_t perform_restore);
 LIBRARY_EXPORTS optiga_lib_status_t
 optiga_util_close_application(optiga_util_t *me, bool_t perform_hibernate);
 
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+/** \brief Power policy of the power manager */
+typedef enum optiga_util_power_policy {
+    /// Hibernate on every idle timeout, irrespective of the resume latency
+    OPTIGA_UTIL_POWER_POLICY_MIN_POWER = 0x00,
+    /// Hibernate on idle timeout, only while the average resume latency is within the latency budget
+    OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET = 0x01,
+} optiga_util_power_policy_t;
+
+/** \brief Configuration of the power manager */
+typedef struct optiga_util_power_config {
+    /// Idle time in milliseconds after which the application on OPTIGA is hibernated
+    uint32_t idle_timeout_ms;
+    /// Accepted resume latency in microseconds, used with #OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET
+    uint32_t resume_latency_budget_us;
+    /// Power policy
+    optiga_util_power_policy_t policy;
+} optiga_util_power_config_t;
+
+/** \brief Statistics of the power manager */
+typedef struct optiga_util_power_stats {
+    /// Number of successful hibernations
+    uint32_t hibernate_count;
+    /// Number of failed hibernations
+    uint32_t hibernate_failure_count;
+    /// Number of successful restores
+    uint32_t restore_count;
+    /// Number of failed restores
+    uint32_t restore_failure_count;
+    /// Resume latency of the last restore in microseconds
+    uint32_t last_resume_latency_us;
+    /// Average resume latency in microseconds
+    uint32_t average_resume_latency_us;
+    /// Maximum resume latency in microseconds
+    uint32_t max_resume_latency_us;
+} optiga_util_power_stats_t;
+
+/**
+ * \brief Starts the power manager, which hibernates and restores the application on OPTIGA automatically.
+ *
+ *\details
+ * Starts the power manager for the OPTIGA instance associated with the given #optiga_util_t instance.
+ * - Once OPTIGA is idle for the configured idle timeout, the application is hibernated with the given instance.
+ *   The CloseApplication command is queued like a request of #optiga_util_close_application and executed by the scheduler.
+ *   This powers down OPTIGA via the VDD and RST pins, if configured.<br>
+ * - The next command from any instance restores the application context first, within the same lock,
+ *   and is then executed as usual. The resume latency is measured on every restore.<br>
+ * - With #OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET, hibernation is skipped once the average resume latency exceeds the budget.<br>
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ * - The given instance is dedicated to the power manager and must not be used for other operations until #optiga_util_power_manager_stop.
+ *
+ *\note
+ * - OPTIGA is considered idle only if no request is queued and no session is acquired.
+ *   The idle time is evaluated with a granularity of one second.
+ * - OPTIGA is not hibernated, while data buffered by the write-behind is not flushed.
+ * - Hibernation fails at OPTIGA, if the SEC value is greater than zero. Failures are counted and retried after the next idle timeout.
+ * - If a restore fails, the triggering command fails with the error of the restore and the application must be opened again.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   p_config                                 Valid pointer to the power manager configuration. The idle timeout must not be zero.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a power manager is already running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_power_manager_start(optiga_util_t *me, const optiga_util_power_config_t *p_config);
+
+/**
+ * \brief Stops the power manager.
+ *
+ *\details
+ * Stops the power manager started with #optiga_util_power_manager_start.
+ * - Further idle periods do not hibernate the application and hibernated contexts are not restored automatically.<br>
+ * - The instance can be used for other operations again.<br>
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - If the application is hibernated while stopping, it must be restored using #optiga_util_open_application.
+ *
+ * \param[in]   me                                       Instance of #optiga_util_t passed to #optiga_util_power_manager_start.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Power manager is not running with the given instance
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       Hibernation with the instance is not complete
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_power_manager_stop(optiga_util_t *me);
+
+/**
+ * \brief Reads the statistics of the power manager.
+ *
+ *\details
+ * Reads the hibernate and restore counters and the resume latencies measured by the power manager.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The statistics are reset on #optiga_util_power_manager_start.
+ *
+ * \param[in]   me                                       Instance of #optiga_util_t passed to #optiga_util_power_manager_start.
+ * \param[out]  p_stats                                  Valid pointer to store the statistics.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_power_manager_get_stats(const optiga_util_t *me, optiga_util_power_stats_t *p_stats);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+#ifndef OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS
+/// Maximum number of slots managed by the key slot manager, the wear record of 12 slots fits a 140 byte data object
+#define OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS (0x0C)
+#endif
+
+/** \brief Type of a slot managed by the key slot manager */
+typedef enum optiga_util_slot_type {
+    /// ECC key object (e.g. 0xE0F1 - 0xE0F3)
+    OPTIGA_UTIL_SLOT_TYPE_ECC_KEY = 0x01,
+    /// RSA key object (e.g. 0xE0FC, 0xE0FD)
+    OPTIGA_UTIL_SLOT_TYPE_RSA_KEY = 0x02,
+    /// Data object (e.g. 0xF1D0 - 0xF1DB)
+    OPTIGA_UTIL_SLOT_TYPE_DATA = 0x03,
+} optiga_util_slot_type_t;
+
+/** \brief Slot provided to the key slot manager */
+typedef struct optiga_util_slot_config {
+    /// OID of the key or data object
+    uint16_t oid;
+    /// Type of the slot
+    optiga_util_slot_type_t slot_type;
+} optiga_util_slot_config_t;
+
+/** \brief Configuration of the key slot manager */
+typedef struct optiga_util_slot_manager_config {
+    /// Slots to be managed
+    const optiga_util_slot_config_t *p_slots;
+    /// Number of slots, at most #OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS
+    uint8_t slot_count;
+    /// OID of the data object storing the wear record, which must not be one of the slots
+    uint16_t wear_record_oid;
+} optiga_util_slot_manager_config_t;
+
+/** \brief State of a slot managed by the key slot manager */
+typedef struct optiga_util_slot_info {
+    /// OID of the key or data object
+    uint16_t oid;
+    /// Type of the slot
+    optiga_util_slot_type_t slot_type;
+    /// Slot is allocated
+    bool_t is_allocated;
+    /// Slot held a key or data when discovered
+    bool_t is_occupied;
+    /// Owner provided at allocation, 0 if the slot is free
+    uint16_t owner_id;
+    /// Number of writes accounted for the slot
+    uint32_t write_count;
+} optiga_util_slot_info_t;
+
+/**
+ * \brief Starts the key slot manager and discovers the state of the slots.
+ *
+ *\details
+ * Starts the key slot manager with the given slots and discovers their state using the given #optiga_util_t instance.
+ * - Reads the wear record (allocation, owner and write count of each slot) from the configured data object.
+ *   An empty or unreadable wear record starts all slots free with zero writes.<br>
+ * - Reads the metadata of each slot once. A key object with an algorithm (tag 0xE0) or a data object with
+ *   a used size (tag 0xC5) greater than zero is occupied. Occupied slots are allocated without owner.<br>
+ * - The callback handler of the instance is invoked once the discovery is complete.<br>
+ * - Afterwards the allocation and lookup APIs are served from memory, without communication with OPTIGA.<br>
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ *
+ *\note
+ * - The instance is busy during the discovery and can be used for other operations again afterwards.
+ * - The slots are shared by all instances of the host library. Allocations of other hosts using the same OPTIGA
+ *   are only seen after the next discovery.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   p_config                                 Valid pointer to the key slot manager configuration.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a discovery or synchronization is in progress
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_slot_manager_start(
+    optiga_util_t *me,
+    const optiga_util_slot_manager_config_t *p_config
+);
+
+/**
+ * \brief Stops the key slot manager.
+ *
+ *\details
+ * Stops the key slot manager and discards the slot states in memory.
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - Write counts accounted since the last #optiga_util_slot_manager_sync are lost.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A discovery or synchronization is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_slot_manager_stop(void);
+
+/**
+ * \brief Allocates the least worn free slot of the given type.
+ *
+ *\details
+ * Allocates the free slot of the given type with the lowest write count, the first configured one on equal counts.
+ * - The allocation is atomic across all instances and accounts one write, as the slot is written next
+ *   (e.g. by #optiga_crypt_ecc_generate_keypair or #optiga_util_write_data).<br>
+ * - No communication with OPTIGA takes place.<br>
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ *\note
+ * - The allocation is persisted by the next #optiga_util_slot_manager_sync.
+ *
+ * \param[in]   slot_type                                Type of the slot to be allocated.
+ * \param[in]   owner_id                                 Owner of the slot used with #optiga_util_slot_lookup, must not be 0.
+ * \param[out]  p_oid                                    Valid pointer to store the OID of the allocated slot.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the discovery is not complete
+ * \retval      #OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT   No free slot of the given type
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_slot_allocate(optiga_util_slot_type_t slot_type, uint16_t owner_id, uint16_t *p_oid);
+
+/**
+ * \brief Frees an allocated slot.
+ *
+ *\details
+ * Frees the slot, which makes it available to #optiga_util_slot_allocate. The content of the slot is not erased.
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ *\note
+ * - The release is persisted by the next #optiga_util_slot_manager_sync.
+ *
+ * \param[in]   oid                                      OID of the allocated slot.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         The OID is not an allocated slot or the discovery is not complete
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_slot_free(uint16_t oid);
+
+/**
+ * \brief Accounts a write of a slot.
+ *
+ *\details
+ * Accounts a further write of the slot (e.g. regeneration of the key in an allocated slot) for the wear accounting.
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ * \param[in]   oid                                      OID of a managed slot.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         The OID is not a managed slot or the discovery is not complete
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_slot_record_write(uint16_t oid);
+
+/**
+ * \brief Looks up the slot allocated by an owner.
+ *
+ *\details
+ * Provides the first slot of the given type allocated with the given owner, from memory.
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ * \param[in]   slot_type                                Type of the slot.
+ * \param[in]   owner_id                                 Owner provided to #optiga_util_slot_allocate.
+ * \param[out]  p_oid                                    Valid pointer to store the OID of the slot.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or no slot is allocated by the owner
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_slot_lookup(optiga_util_slot_type_t slot_type, uint16_t owner_id, uint16_t *p_oid);
+
+/**
+ * \brief Provides the state of a slot.
+ *
+ *\details
+ * Provides the allocation, owner and write count of the slot, from memory.
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ * \param[in]   oid                                      OID of a managed slot.
+ * \param[out]  p_info                                   Valid pointer to store the state of the slot.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the OID is not a managed slot
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_slot_get_info(uint16_t oid, optiga_util_slot_info_t *p_info);
+
+/**
+ * \brief Persists the wear record.
+ *
+ *\details
+ * Writes the allocation, owner and write count of all slots to the wear record data object using the given instance,
+ * if they changed since the last discovery or synchronization.
+ * - The callback handler of the instance is invoked once the wear record is written.<br>
+ * - If nothing changed, no write takes place and the callback handler is invoked before the API returns.<br>
+ *
+ *\pre
+ * - The key slot manager is started and the discovery is complete.
+ *
+ *\note
+ * - The wear record is written with #OPTIGA_UTIL_ERASE_AND_WRITE. Synchronizing after a batch of allocations
+ *   limits the writes of the wear record itself.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the discovery is not complete
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a synchronization is in progress
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_slot_manager_sync(optiga_util_t *me);
+#endif  // OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+#ifndef OPTIGA_UTIL_READ_CACHE_ENTRIES
+/// Number of entries of the read cache
+#define OPTIGA_UTIL_READ_CACHE_ENTRIES (0x02)
+#endif
+
+#ifndef OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE
+/// Length of the largest read held by an entry of the read cache, sized for a device certificate (0xE0E0)
+#define OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE (0x06C0)
+#endif
+
+/// OID passed to #optiga_util_read_cache_flush to discard all entries
+#define OPTIGA_UTIL_READ_CACHE_ALL_OIDS (0xFFFF)
+
+/** \brief Statistics of the read cache */
+typedef struct optiga_util_read_cache_stats {
+    /// Number of reads served from the cache
+    uint32_t hit_count;
+    /// Number of cacheable reads sent to OPTIGA
+    uint32_t miss_count;
+    /// Number of entries discarded due to writes to their data object or changes of the access state
+    uint32_t invalidation_count;
+    /// Number of entries discarded due to the expiry of the time to live
+    uint32_t expiry_count;
+    /// Number of reads extended to a read-ahead of the data object
+    uint32_t read_ahead_count;
+} optiga_util_read_cache_stats_t;
+
+/**
+ * \brief Enables or disables the read cache for the instance.
+ *
+ *\details
+ * Serves repeated #optiga_util_read_data requests of the same OID, offset and length from the host memory,
+ * and requests within the data read ahead (#optiga_util_read_cache_set_read_ahead).
+ * - A read served from the cache completes synchronously, the callback handler is invoked before the API returns.<br>
+ * - Only successful reads of at most #OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE bytes are cached. The least recently used
+ *   entry is replaced, if all #OPTIGA_UTIL_READ_CACHE_ENTRIES entries are in use.<br>
+ * - The entries of a data object are discarded before the data object or its metadata is written using
+ *   #optiga_util_write_data, #optiga_util_write_metadata or #optiga_util_update_count with any instance,
+ *   all entries are discarded before #optiga_util_protected_update_start.<br>
+ * - The read access condition of a data object may depend on the state of the application, e.g. an established
+ *   session, the auto state or the lifecycle state. All entries are discarded before #optiga_util_open_application,
+ *   #optiga_util_close_application and #optiga_crypt_clear_auto_state with any instance, and before the lifecycle
+ *   states 0xE0C0/0xF1C0 are written. Within one state, a read allowed once is allowed again.<br>
+ * - Data objects changed by OPTIGA itself (security status 0xE0C1/0xF1C1, security event counter 0xE0C5,
+ *   last error codes 0xF1C2 and monotonic counters 0xE120 - 0xE123) are never cached.<br>
+ * - Reads with a protection level (#OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL) are always performed by OPTIGA and not cached.<br>
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The cache is shared by all instances which enable it. Data read by one instance is served to the others.
+ * - Only the writes and state changes issued through this host library are observed. For data objects written
+ *   by another host, use #optiga_util_read_cache_set_ttl or #optiga_util_read_cache_flush.
+ *
+ * \param[in,out]  me                                    Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]      enable                                TRUE to enable, FALSE to disable the cache for the instance
+ *
+ * \retval         #OPTIGA_UTIL_SUCCESS                  Read cache is enabled or disabled
+ * \retval         #OPTIGA_UTIL_ERROR_INVALID_INPUT      Invalid instance
+ * \retval         #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE    A request of the instance is in progress
+ * \retval         #OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT No write handler can be attached (#OPTIGA_CMD_MAX_WRITE_HANDLERS)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_read_cache_enable(optiga_util_t *me, bool_t enable);
+
+/**
+ * \brief Sets the time to live of the read cache entries.
+ *
+ *\details
+ * Entries older than the time to live are discarded on their next use and read from OPTIGA again.
+ *
+ *\pre
+ * - None
+ *
+ * \param[in]      ttl_ms                                Time to live in milliseconds, 0 to keep entries until they are invalidated
+ */
+LIBRARY_EXPORTS void optiga_util_read_cache_set_ttl(uint32_t ttl_ms);
+
+/**
+ * \brief Sets the read-ahead length of the read cache.
+ *
+ *\details
+ * Extends #optiga_util_read_data requests at offset 0 with a length below the read-ahead length to a read of
+ * the data object up to the read-ahead length, and serves later reads at any offset within the data read from the cache.
+ * - The read is chained by OPTIGA CMD in APDUs of the maximum size and ends at the used size of the data object.<br>
+ * - If #OPTIGA_UTIL_METADATA_STORE_ENABLED is defined and the used size of the data object is known,
+ *   the read is limited to the used size and not extended if the requested length covers it.<br>
+ * - The data read ahead occupies one entry, invalidation and time to live apply as for other entries.<br>
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - The read-ahead length caps the host memory used per data object. Reads of larger data objects are served from
+ *   the cache only within the first read-ahead length bytes.
+ *
+ * \param[in]      read_ahead_length                     Read-ahead length in bytes, at most #OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE,
+ *                                                       0 to disable the read-ahead
+ *
+ * \retval         #OPTIGA_UTIL_SUCCESS                  Read-ahead length is set
+ * \retval         #OPTIGA_UTIL_ERROR_INVALID_INPUT      Read-ahead length exceeds #OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_read_cache_set_read_ahead(uint16_t read_ahead_length);
+
+/**
+ * \brief Discards entries of the read cache.
+ *
+ *\details
+ * Discards the entries of the given data object, e.g. after it was changed by another host.
+ *
+ *\pre
+ * - None
+ *
+ * \param[in]      optiga_oid                            OID of the data object, #OPTIGA_UTIL_READ_CACHE_ALL_OIDS to discard all entries
+ */
+LIBRARY_EXPORTS void optiga_util_read_cache_flush(uint16_t optiga_oid);
+
+/**
+ * \brief Provides the statistics of the read cache.
+ *
+ * \param[out]     p_stats                               Valid pointer to store the statistics
+ *
+ * \retval         #OPTIGA_UTIL_SUCCESS                  Statistics are provided
+ * \retval         #OPTIGA_UTIL_ERROR_INVALID_INPUT      NULL pointer
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_read_cache_get_stats(optiga_util_read_cache_stats_t *p_stats);
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
+
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+#ifndef OPTIGA_UTIL_METADATA_STORE_MAX_OIDS
+/// Maximum number of data and key objects indexed by the metadata store
+#define OPTIGA_UTIL_METADATA_STORE_MAX_OIDS (0x30)
+#endif
+
+#ifndef OPTIGA_UTIL_METADATA_AC_SIZE
+/// Number of bytes of an access condition held by the metadata store
+#define OPTIGA_UTIL_METADATA_AC_SIZE (0x08)
+#endif
+
+/// Lifecycle state (tag 0xC0) is present
+#define OPTIGA_UTIL_METADATA_HAS_LCS (0x0001)
+/// Maximum size (tag 0xC4) is present
+#define OPTIGA_UTIL_METADATA_HAS_MAX_SIZE (0x0002)
+/// Used size (tag 0xC5) is present
+#define OPTIGA_UTIL_METADATA_HAS_USED_SIZE (0x0004)
+/// Change access condition (tag 0xD0) is present
+#define OPTIGA_UTIL_METADATA_HAS_CHANGE_AC (0x0008)
+/// Read access condition (tag 0xD1) is present
+#define OPTIGA_UTIL_METADATA_HAS_READ_AC (0x0010)
+/// Execute access condition (tag 0xD3) is present
+#define OPTIGA_UTIL_METADATA_HAS_EXECUTE_AC (0x0020)
+/// Algorithm (tag 0xE0) is present
+#define OPTIGA_UTIL_METADATA_HAS_ALGORITHM (0x0040)
+/// Key usage (tag 0xE1) is present
+#define OPTIGA_UTIL_METADATA_HAS_KEY_USAGE (0x0080)
+/// Data object type (tag 0xE8) is present
+#define OPTIGA_UTIL_METADATA_HAS_DATA_TYPE (0x0100)
+
+/** \brief Access condition held by the metadata store */
+typedef struct optiga_util_metadata_ac {
+    /// Length of the access condition, the value is truncated to #OPTIGA_UTIL_METADATA_AC_SIZE bytes if longer
+    uint8_t length;
+    /// Access condition
+    uint8_t value[OPTIGA_UTIL_METADATA_AC_SIZE];
+} optiga_util_metadata_ac_t;
+
+/** \brief Parsed metadata of a data or key object */
+typedef struct optiga_util_metadata {
+    /// OID of the data or key object
+    uint16_t oid;
+    /// Tags present in the metadata, OPTIGA_UTIL_METADATA_HAS_XXX
+    uint16_t tag_mask;
+    /// Lifecycle state
+    uint8_t lcs;
+    /// Algorithm associated with the key (e.g. #OPTIGA_ECC_CURVE_NIST_P_256)
+    uint8_t algorithm;
+    /// Key usage, combination of #optiga_key_usage_t
+    uint8_t key_usage;
+    /// Data object type
+    uint8_t data_type;
+    /// Maximum size
+    uint16_t max_size;
+    /// Used size
+    uint16_t used_size;
+    /// Change access condition
+    optiga_util_metadata_ac_t change_ac;
+    /// Read access condition
+    optiga_util_metadata_ac_t read_ac;
+    /// Execute access condition
+    optiga_util_metadata_ac_t execute_ac;
+} optiga_util_metadata_t;
+
+/** \brief Filter of #optiga_util_metadata_find */
+typedef struct optiga_util_metadata_filter {
+    /// Tags which must be present, OPTIGA_UTIL_METADATA_HAS_XXX. The values below are compared for the given tags only
+    uint16_t tag_mask;
+    /// Lifecycle state
+    uint8_t lcs;
+    /// Algorithm
+    uint8_t algorithm;
+    /// Key usages which must all be set
+    uint8_t key_usage;
+    /// Data object type
+    uint8_t data_type;
+} optiga_util_metadata_filter_t;
+
+/**
+ * \brief Starts the metadata store and indexes the metadata of the data and key objects.
+ *
+ *\details
+ * Reads the metadata of the given objects in one pass with the given #optiga_util_t instance and indexes them in memory.
+ * - Without an OID list, all data and key objects of OPTIGA Trust M are indexed. Objects whose metadata
+ *   cannot be read (e.g. not available on the OPTIGA) are not indexed.<br>
+ * - The callback handler of the instance is invoked once all objects are read.<br>
+ * - Afterwards, #optiga_util_metadata_get and #optiga_util_metadata_find are served from memory.<br>
+ * - Writes of data or metadata with any instance mark the object stale, #optiga_util_protected_update_start marks
+ *   all objects stale. Stale objects are read again by #optiga_util_metadata_store_refresh.<br>
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ *
+ *\note
+ * - The instance is busy during the pass and can be used for other operations again afterwards.
+ * - OPTIGA has no command to read several metadata at once, the pass sends one command per object.
+ * - Changes not issued through this host library (e.g. a lifecycle state change by another host) are not observed.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   p_oids                                   OIDs to be indexed, NULL for all data and key objects.
+ * \param[in]   oid_count                                Number of OIDs, at most #OPTIGA_UTIL_METADATA_STORE_MAX_OIDS.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a pass is in progress
+ * \retval      #OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT   No write handler can be attached (#OPTIGA_CMD_MAX_WRITE_HANDLERS)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_metadata_store_start(optiga_util_t *me, const uint16_t *p_oids, uint8_t oid_count);
+
+/**
+ * \brief Reads the metadata of the stale objects again.
+ *
+ *\details
+ * Reads the metadata of the objects marked stale by writes with the given instance.
+ * - The callback handler of the instance is invoked once all stale objects are read.<br>
+ * - If no object is stale, the callback handler is invoked before the API returns.<br>
+ *
+ *\pre
+ * - The metadata store is started using #optiga_util_metadata_store_start.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the store is not started
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a pass is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_metadata_store_refresh(optiga_util_t *me);
+
+/**
+ * \brief Stops the metadata store.
+ *
+ * \param[in]   me                                       Instance of #optiga_util_t passed to #optiga_util_metadata_store_start.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A pass is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_metadata_store_stop(optiga_util_t *me);
+
+/**
+ * \brief Provides the parsed metadata of an object from memory.
+ *
+ * \param[in]   optiga_oid                               OID of the data or key object.
+ * \param[out]  p_metadata                               Valid pointer to store the parsed metadata.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the object is not indexed
+ * \retval      #OPTIGA_UTIL_ERROR                       The object is stale, see #optiga_util_metadata_store_refresh
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_metadata_get(uint16_t optiga_oid, optiga_util_metadata_t *p_metadata);
+
+/**
+ * \brief Finds the objects matching a filter from memory.
+ *
+ *\details
+ * Provides the OIDs of the indexed objects matching the filter in the order they are indexed,
+ * e.g. the ECC NIST P-256 keys with sign usage. Stale objects are not considered.
+ *
+ * \param[in]      p_filter                              Valid pointer to the filter.
+ * \param[out]     p_oids                                Valid pointer to store the OIDs found.
+ * \param[in,out]  p_oid_count                           Number of OIDs p_oids can hold, updated to the number of OIDs found.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT   More objects match than p_oids can hold, the first ones are provided
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_metadata_find(
+    const optiga_util_metadata_filter_t *p_filter,
+    uint16_t *p_oids,
+    uint8_t *p_oid_count
+);
+#endif  // OPTIGA_UTIL_METADATA_STORE_ENABLED
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+#ifndef OPTIGA_UTIL_WRITE_BEHIND_ENTRIES
+/// Maximum number of data objects buffered by the write-behind
+#define OPTIGA_UTIL_WRITE_BEHIND_ENTRIES (0x04)
+#endif
+
+#ifndef OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE
+/// Length of the data buffered per data object, sized for the application data objects 0xF1D0 - 0xF1DB
+#define OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE (0x008C)
+#endif
+
+/** \brief Configuration of the write-behind */
+typedef struct optiga_util_write_behind_config {
+    /// OIDs of the data objects of which the writes are buffered
+    const uint16_t *p_oids;
+    /// Number of OIDs, at most #OPTIGA_UTIL_WRITE_BEHIND_ENTRIES
+    uint8_t oid_count;
+    /// Time in milliseconds after the first buffered write, after which the buffered data is flushed,
+    /// 0 to coalesce until the data is flushed otherwise
+    uint32_t window_ms;
+    /// Length of the buffered data of a data object which triggers its flush,
+    /// at most #OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE, 0 to flush only when the buffer cannot hold a write
+    uint16_t flush_length;
+} optiga_util_write_behind_config_t;
+
+/** \brief Statistics of the write-behind */
+typedef struct optiga_util_write_behind_stats {
+    /// Number of writes buffered
+    uint32_t buffered_count;
+    /// Number of writes sent to OPTIGA to flush the buffered data
+    uint32_t flush_count;
+    /// Number of NVM writes saved by coalescing writes or by writes superseded by an erase and write
+    uint32_t saved_count;
+    /// Number of flush writes which failed
+    uint32_t flush_failure_count;
+} optiga_util_write_behind_stats_t;
+
+/**
+ * \brief Starts the write-behind for the given data objects.
+ *
+ *\details
+ * Buffers the #optiga_util_write_data requests to the given data objects in the host memory and coalesces them,
+ * to write several small updates with one NVM write cycle.
+ * - A write adjacent to or overlapping the buffered data of the data object is merged into it. A write with
+ *   #OPTIGA_UTIL_ERASE_AND_WRITE replaces the buffered data, as the data object is erased anyway.<br>
+ * - A buffered write completes synchronously, the callback handler is invoked before the API returns.<br>
+ * - The buffered data is written to OPTIGA with one write (chained by OPTIGA CMD in APDUs of the maximum size),
+ *   before the next write which cannot be merged or is issued after the window (window_ms), before a read of the
+ *   data object, once the buffered length reaches flush_length, and on #optiga_util_write_behind_flush,
+ *   #optiga_util_write_behind_barrier and #optiga_util_close_application (close and hibernate).
+ *   The write, read or close is performed after the flush with the same instance.<br>
+ * - Once the window is over, the buffered data of all data objects is flushed by the scheduler with an instance
+ *   created by the write-behind, even if no further operation is issued.<br>
+ * - Writes with a protection level (#OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL) and writes longer than
+ *   #OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE are written through.<br>
+ *
+ *\pre
+ * - None
+ *
+ *\note
+ * - Buffered data is lost on a reset or power loss before it is flushed. Use the write-behind only for data objects,
+ *   of which the latest updates may be lost, e.g. counters or logs, and issue #optiga_util_write_behind_barrier
+ *   where the data must be persistent.
+ * - Only one flush is performed at a time. An operation requiring a flush while another instance flushes,
+ *   as well as a write to a data object of which the buffered data is being flushed, fails with
+ *   #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE.
+ * - If a flush write fails, the error is reported to the operation which triggered the flush. The buffered data
+ *   is kept for the next flush, if the communication failed, and discarded, if OPTIGA rejected the write.
+ * - #optiga_util_read_metadata provides the used size written to OPTIGA, not including buffered data.
+ *
+ * \param[in]   p_config                                 Valid pointer to the configuration.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT   No instance is available to flush after the window
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       Data is buffered or a flush is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_write_behind_start(const optiga_util_write_behind_config_t *p_config);
+
+/**
+ * \brief Stops the write-behind.
+ *
+ *\pre
+ * - The buffered data is flushed using #optiga_util_write_behind_barrier.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       Data is buffered or a flush is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_write_behind_stop(void);
+
+/**
+ * \brief Writes the buffered data of a data object to OPTIGA.
+ *
+ *\details
+ * Writes the buffered data of the data object with the given instance. If no data is buffered,
+ * the callback handler is invoked before the API returns.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   optiga_oid                               OID of a data object passed to #optiga_util_write_behind_start.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the data object is not buffered
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a flush is in progress
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_write_behind_flush(optiga_util_t *me, uint16_t optiga_oid);
+
+/**
+ * \brief Writes all buffered data to OPTIGA.
+ *
+ *\details
+ * Writes the buffered data of all data objects with the given instance, in the order in which the data objects
+ * were first written. When the callback handler is invoked with success, every write issued before the barrier
+ * is stored in OPTIGA, and later writes are buffered anew.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the write-behind is not started
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a flush is in progress
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_write_behind_barrier(optiga_util_t *me);
+
+/**
+ * \brief Provides the statistics of the write-behind.
+ *
+ * \param[out]  p_stats                                  Valid pointer to store the statistics
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Statistics are provided
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         NULL pointer
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_write_behind_get_stats(optiga_util_write_behind_stats_t *p_stats);
+#endif  // OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+/** \brief Priority of a request paced by the SEC governor */
+typedef enum optiga_util_sec_priority {
+    /// Request is always admitted, e.g. operations the application waits for
+    OPTIGA_UTIL_SEC_PRIORITY_HIGH = 0x00,
+    /// Request is held back while the security event counter is close to the throttling threshold,
+    /// e.g. retried authentications or background operations
+    OPTIGA_UTIL_SEC_PRIORITY_LOW = 0x01,
+} optiga_util_sec_priority_t;
+
+/** \brief Configuration of the SEC governor */
+typedef struct optiga_util_sec_governor_config {
+    /// Time in milliseconds in which OPTIGA decrements the security event counter by one,
+    /// as configured in the security monitor of OPTIGA
+    uint32_t decay_period_ms;
+    /// Age in milliseconds of the SEC read from OPTIGA, after which it is read again on the next admission,
+    /// 0 to read it only on #optiga_util_sec_governor_refresh
+    uint32_t refresh_period_ms;
+    /// Delay in milliseconds which OPTIGA adds to a command, while the SEC is at or above the throttling threshold
+    uint32_t throttle_delay_ms;
+    /// SEC value from which OPTIGA delays the commands
+    uint8_t throttle_threshold;
+    /// SEC value from which low priority requests are held back, at most the throttling threshold
+    uint8_t low_priority_limit;
+} optiga_util_sec_governor_config_t;
+
+/** \brief Statistics of the SEC governor */
+typedef struct optiga_util_sec_governor_stats {
+    /// SEC value predicted from the last read and the events since, decayed to the current time
+    uint8_t current_sec;
+    /// SEC value of the last read from OPTIGA
+    uint8_t measured_sec;
+    /// Maximum SEC value predicted
+    uint8_t max_sec;
+    /// Delay in milliseconds predicted to be added by OPTIGA to the next command
+    uint32_t predicted_delay_ms;
+    /// Number of requests admitted
+    uint32_t admitted_count;
+    /// Number of low priority requests held back
+    uint32_t deferred_count;
+    /// Number of admitted requests which failed in OPTIGA and are counted as security events
+    uint32_t event_count;
+    /// Number of successful reads of the SEC
+    uint32_t refresh_count;
+    /// Number of failed reads of the SEC
+    uint32_t refresh_failure_count;
+} optiga_util_sec_governor_stats_t;
+
+/**
+ * \brief Starts the SEC governor, which paces low priority requests to keep OPTIGA below its throttling threshold.
+ *
+ *\details
+ * Models the security event counter (SEC, 0xE0C5) of OPTIGA, to avoid the delays OPTIGA adds to every command
+ * once the SEC reaches the throttling threshold.
+ * - The SEC is read with the given instance on start, on #optiga_util_sec_governor_refresh and on the admission of
+ *   a request once the last read is older than refresh_period_ms.<br>
+ * - Between reads, the SEC is predicted from the last read, decremented by one per decay_period_ms and incremented
+ *   by one per admitted request released with an error of OPTIGA.<br>
+ * - #optiga_util_sec_governor_admit holds back low priority requests while the predicted SEC, including the requests
+ *   admitted and not yet released, reaches low_priority_limit. High priority requests are always admitted.<br>
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ * - The given instance is dedicated to the SEC governor and must not be used for other operations until #optiga_util_sec_governor_stop.
+ *
+ *\note
+ * - The governor does not queue requests. Held back requests are issued again by the application after the
+ *   provided wait time, while high priority requests are issued meanwhile.
+ * - The SEC is also incremented by security events of operations which are not paced. These are accounted for
+ *   with the next read of the SEC.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   p_config                                 Valid pointer to the configuration.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a SEC governor is already running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_sec_governor_start(
+    optiga_util_t *me,
+    const optiga_util_sec_governor_config_t *p_config
+);
+
+/**
+ * \brief Stops the SEC governor.
+ *
+ *\details
+ * Stops the SEC governor started with #optiga_util_sec_governor_start. The instance can be used for other operations again.
+ *
+ * \param[in]   me                                       Instance of #optiga_util_t passed to #optiga_util_sec_governor_start.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         SEC governor is not running with the given instance
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A read of the SEC is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_sec_governor_stop(optiga_util_t *me);
+
+/**
+ * \brief Reads the SEC from OPTIGA.
+ *
+ *\details
+ * Reads the SEC with the instance passed to #optiga_util_sec_governor_start and restarts the prediction from the value read.
+ * The completion is not notified, the statistics provide the outcome.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         SEC governor is not running
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A read of the SEC is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_sec_governor_refresh(void);
+
+/**
+ * \brief Admits a request to OPTIGA, which may increment the SEC.
+ *
+ *\details
+ * Decides whether the application issues the request now.
+ * - High priority requests are admitted.<br>
+ * - Low priority requests are admitted while the predicted SEC plus the admitted requests not yet released stays
+ *   below low_priority_limit. Otherwise, the time until the predicted SEC allows the request is provided.<br>
+ * - An admitted request must be released using #optiga_util_sec_governor_release once it is completed.<br>
+ *
+ * \param[in]   priority                                 Priority of the request.
+ * \param[out]  p_wait_ms                                Valid pointer to store the time in milliseconds, after which a held back request is admitted.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Request is admitted
+ * \retval      #OPTIGA_UTIL_BUSY                        Request is held back, issue it again after the wait time
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the SEC governor is not running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_sec_governor_admit(optiga_util_sec_priority_t priority, uint32_t *p_wait_ms);
+
+/**
+ * \brief Releases a request admitted using #optiga_util_sec_governor_admit.
+ *
+ *\details
+ * Provides the outcome of the request. An error of OPTIGA (#OPTIGA_DEVICE_ERROR) is counted as security event.
+ *
+ * \param[in]   status                                   Status of the request, as provided to the callback handler.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         No admitted request to release or the SEC governor is not running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_sec_governor_release(optiga_lib_status_t status);
+
+/**
+ * \brief Provides the predicted SEC and the statistics of the SEC governor.
+ *
+ * \param[out]  p_stats                                  Valid pointer to store the statistics
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Statistics are provided
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         NULL pointer or the SEC governor is not running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_sec_governor_get_stats(optiga_util_sec_governor_stats_t *p_stats);
+#endif  // OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+/// Number of performance profiles
+#define OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT (0x03)
+/// Minimum current limitation of OPTIGA in mA
+#define OPTIGA_UTIL_PERFORMANCE_MIN_CURRENT_MA (0x06)
+/// Maximum current limitation of OPTIGA in mA
+#define OPTIGA_UTIL_PERFORMANCE_MAX_CURRENT_MA (0x0F)
+
+#ifndef OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES
+/// Maximum number of OPTIGA commands benchmarked by the performance profile manager
+#define OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES (0x08)
+#endif
+
+/** \brief Performance profiles, mapped to a current limitation of OPTIGA (0xE0C4) */
+typedef enum optiga_util_performance_profile {
+    /// Lowest current consumption
+    OPTIGA_UTIL_PERFORMANCE_PROFILE_LOW_POWER = 0x00,
+    /// Medium current consumption and performance
+    OPTIGA_UTIL_PERFORMANCE_PROFILE_BALANCED = 0x01,
+    /// Highest performance
+    OPTIGA_UTIL_PERFORMANCE_PROFILE_MAX_PERFORMANCE = 0x02,
+    /// Current limitation of OPTIGA does not match a profile or is not known
+    OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM = 0x03,
+} optiga_util_performance_profile_t;
+
+/** \brief Configuration of the performance profile manager */
+typedef struct optiga_util_performance_config {
+    /// Current limitation in mA per profile, indexed by #optiga_util_performance_profile_t,
+    /// #OPTIGA_UTIL_PERFORMANCE_MIN_CURRENT_MA to #OPTIGA_UTIL_PERFORMANCE_MAX_CURRENT_MA
+    uint8_t current_limit_ma[OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT];
+    /// Number of requests queued or processing from which the burst profile is selected, at least 2,
+    /// 0 to switch only on #optiga_util_performance_profile_set
+    uint8_t burst_queue_depth;
+    /// Profile selected while the queue depth reaches burst_queue_depth
+    optiga_util_performance_profile_t burst_profile;
+    /// Profile selected once no request is queued for idle_timeout_ms
+    optiga_util_performance_profile_t idle_profile;
+    /// Time in milliseconds without queued requests, after which the idle profile is selected
+    uint32_t idle_timeout_ms;
+} optiga_util_performance_config_t;
+
+/** \brief State of the performance profile manager */
+typedef struct optiga_util_performance_state {
+    /// Active profile
+    optiga_util_performance_profile_t profile;
+    /// Current limitation of OPTIGA in mA, 0 if it is not known
+    uint8_t current_limit_ma;
+    /// Number of requests queued or processing at the last invocation of the scheduler
+    uint8_t queue_depth;
+    /// Number of successful profile switches
+    uint32_t switch_count;
+    /// Number of failed profile switches
+    uint32_t switch_failure_count;
+} optiga_util_performance_state_t;
+
+/** \brief Latencies of an OPTIGA command measured per profile */
+typedef struct optiga_util_performance_benchmark {
+    /// OPTIGA command code, without the clear last error bit (Refer Solution Reference Manual)
+    uint8_t command;
+    /// Number of command APDUs measured per profile, indexed by #optiga_util_performance_profile_t
+    uint32_t count[OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT];
+    /// Average latency in microseconds per profile, from sending the command APDU until the response is received
+    uint32_t average_latency_us[OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT];
+} optiga_util_performance_benchmark_t;
+
+/**
+ * \brief Starts the performance profile manager, which sets the current limitation of OPTIGA by profiles.
+ *
+ *\details
+ * Manages the current limitation data object of OPTIGA (0xE0C4), which limits the current consumption and thereby the speed of OPTIGA.
+ * - The current limitation is read with the given instance and mapped to a profile. The callback handler is invoked on completion.<br>
+ * - #optiga_util_performance_profile_set writes the current limitation of a profile.<br>
+ * - With a burst queue depth, the burst profile is selected once the queue depth of the scheduler reaches it,
+ *   e.g. during a handshake, and the idle profile once no request is queued for the idle timeout.<br>
+ * - The latency of every command APDU is measured for the active profile, to compare the profiles per command.<br>
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ * - The given instance is dedicated to the performance profile manager and must not be used for other operations until
+ *   #optiga_util_performance_profile_stop.
+ *
+ *\note
+ * - Every switch writes the data object 0xE0C4. The idle timeout limits dynamic switches to two per idle timeout.
+ * - Dynamic switches are not notified to the callback handler. The state provides their outcome.
+ * - The switch to the burst profile is queued behind the requests of the burst and applies to the later commands.
+ *
+ * \param[in]   me                                       Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]   p_config                                 Valid pointer to the configuration.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       The instance is busy or a performance profile manager is already running
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_performance_profile_start(
+    optiga_util_t *me,
+    const optiga_util_performance_config_t *p_config
+);
+
+/**
+ * \brief Stops the performance profile manager.
+ *
+ *\details
+ * Stops the performance profile manager started with #optiga_util_performance_profile_start.
+ * The current limitation of OPTIGA is kept and the instance can be used for other operations again.
+ *
+ * \param[in]   me                                       Instance of #optiga_util_t passed to #optiga_util_performance_profile_start.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Performance profile manager is not running with the given instance
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A read or write of the current limitation is in progress
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_performance_profile_stop(optiga_util_t *me);
+
+/**
+ * \brief Switches OPTIGA to the given profile.
+ *
+ *\details
+ * Writes the current limitation of the profile with the instance passed to #optiga_util_performance_profile_start.
+ * If the profile is already active, the callback handler is invoked before the API returns.
+ * The profile is kept until the next switch, which is the next dynamic switch with a burst queue depth.
+ *
+ * \param[in]   profile                                  Profile to switch to.
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Successful invocation
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         Wrong Input arguments provided or the manager is not running
+ * \retval      #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE       A read or write of the current limitation is in progress
+ * \retval      #OPTIGA_DEVICE_ERROR                     Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                       (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_performance_profile_set(optiga_util_performance_profile_t profile);
+
+/**
+ * \brief Provides the active profile and the current limitation of OPTIGA.
+ *
+ * \param[out]  p_state                                  Valid pointer to store the state
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     State is provided
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         NULL pointer or the manager is not running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t
+optiga_util_performance_profile_get_state(optiga_util_performance_state_t *p_state);
+
+/**
+ * \brief Provides the command latencies measured per profile.
+ *
+ *\details
+ * Provides the latencies of up to #OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES OPTIGA commands, in the order of their first use.
+ * The latencies are reset on #optiga_util_performance_profile_start.
+ *
+ * \param[out]    p_benchmark                            Valid pointer to store the latencies
+ * \param[in,out] p_count                                Valid pointer to the number of entries of p_benchmark,
+ *                                                       provides the number of entries stored
+ *
+ * \retval      #OPTIGA_UTIL_SUCCESS                     Latencies are provided
+ * \retval      #OPTIGA_UTIL_ERROR_INVALID_INPUT         NULL pointer or the manager is not running
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_performance_profile_get_benchmark(
+    optiga_util_performance_benchmark_t *p_benchmark,
+    uint8_t *p_count
+);
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
 /**
  * \brief Reads data from optiga.
  *
@@ -501,6 +1612,75 @@ LIBRARY_EXPORTS optiga_lib_status_t optiga_util_protected_update_final(
     uint16_t fragment_length
 );
 
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+/**
+ * \brief Performs the protected update of an object with the manifest and the fragments provided by a reader.
+ *
+ *\details
+ * Writes the manifest and all fragments of the stream to OPTIGA in one strict sequence.
+ * - The fragments are read from the stream in #OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE bytes, as split by the protected update data set tool.
+ * - The next fragment is read into the stream buffer while OPTIGA processes the current fragment.
+ * - The progress handler of the stream is invoked after each fragment is written to OPTIGA.
+ * - If the reader fails, the callback is invoked with the status of the reader and the stream is suspended.
+ *   The strict sequence is kept and the stream can be continued using #optiga_util_protected_update_stream_resume.
+ *
+ *\pre
+ * - The application on OPTIGA must be opened using #optiga_util_open_application.
+ *
+ *\note
+ * - For <b>protected I2C communication</b>, Refer #OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL
+ * - Error codes from lower layers will be returned as it is.<br>
+ * - The reader is invoked from the context of the OPTIGA event handler with the offset of the data to read.
+ *   It must provide at least one byte per invocation, for example from memory, a memory mapped file or a file descriptor.
+ * - The strict sequence is terminated in case of an error from lower layer. A suspended stream is terminated
+ *   using #optiga_util_protected_update_final with NULL fragment.<br>
+ *
+ * \param[in]      me                                     Valid instance of #optiga_util_t created using #optiga_util_create.
+ * \param[in]      manifest_version                       Version of manifest to be written
+ * \param[in]      manifest                               Valid pointer to the buffer which contains manifest
+ *                                                        - It should be a valid manifest, otherwise OPTIGA returns an error.<br>
+ * \param[in]      manifest_length                        Length of manifest to be written
+ * \param[in]      p_stream                               Fragments in #protected_update_data_stream_t, must remain valid until completion.
+ *                                                        - The stream buffer must hold a complete fragment.<br>
+ *
+ * \retval         #OPTIGA_UTIL_SUCCESS                   Successful invocation
+ * \retval         #OPTIGA_UTIL_ERROR_INVALID_INPUT       Wrong Input arguments provided
+ * \retval         #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE     The previous operation with the same instance is not complete
+ * \retval         #OPTIGA_DEVICE_ERROR                   Command execution failure in OPTIGA and the LSB indicates the error code.
+ *                                                        (Refer Solution Reference Manual)
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_protected_update_stream(
+    optiga_util_t *me,
+    uint8_t manifest_version,
+    const uint8_t *manifest,
+    uint16_t manifest_length,
+    const protected_update_data_stream_t *p_stream
+);
+
+/**
+ * \brief Resumes a suspended protected update stream.
+ *
+ *\details
+ * Reads the fragment, which could not be read before, again and continues to write the stream to OPTIGA.
+ * - The stream continues with the next fragment to be written, no fragment is written twice.
+ *
+ *\pre
+ * - The stream is suspended by a failure of the reader during #optiga_util_protected_update_stream.
+ *
+ *\note
+ * - If the reader fails again, the status of the reader is returned and the stream stays suspended.
+ * - The stream cannot be resumed after it was terminated by an error from lower layer, it must be restarted
+ *   using #optiga_util_protected_update_stream.<br>
+ *
+ * \param[in]      me                                     Valid instance of #optiga_util_t, which started the stream.
+ *
+ * \retval         #OPTIGA_UTIL_SUCCESS                   Successful invocation
+ * \retval         #OPTIGA_UTIL_ERROR_INVALID_INPUT       Wrong Input arguments provided or no stream is suspended
+ * \retval         #OPTIGA_UTIL_ERROR_INSTANCE_IN_USE     The previous operation with the same instance is not complete
+ */
+LIBRARY_EXPORTS optiga_lib_status_t optiga_util_protected_update_stream_resume(optiga_util_t *me);
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 /**
  * \brief Increments the counter object by a value specified by user.
  *
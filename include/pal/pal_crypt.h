@@ -171,6 +171,163 @@ LIBRARY_EXPORTS pal_status_t pal_crypt_decrypt_aes128_ccm(
  */
 pal_status_t pal_crypt_version(uint8_t *p_crypt_lib_version_info, uint16_t *length);
 
+/**
+ * \brief Calculates a HMAC-SHA256 on the host.
+ *
+ * \details
+ * Calculates the HMAC-SHA256 of the data using the external crypto library. <br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Used by the host DRBG of OPTIGA CRYPT, if OPTIGA_CRYPT_RANDOM_POOL_ENABLED is defined.
+ *
+ * \param[in]        p_pal_crypt                            Crypt context
+ * \param[in]        p_key                                  Key
+ * \param[in]        key_length                             Length of the key
+ * \param[in]        p_data                                 Data
+ * \param[in]        data_length                            Length of the data
+ * \param[out]       p_mac                                  Buffer of 32 bytes to store the HMAC
+ *
+ * \retval           PAL_STATUS_SUCCESS                     In case of success
+ * \retval           PAL_STATUS_FAILURE                     In case of failure
+ */
+pal_status_t pal_crypt_hmac_sha256(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_key,
+    uint16_t key_length,
+    const uint8_t *p_data,
+    uint16_t data_length,
+    uint8_t *p_mac
+);
+
+/**
+ * \brief Verifies a signature with a public key on the host.
+ *
+ * \details
+ * Verifies an ECDSA or RSA PKCS#1 v1.5 signature over a digest using the external crypto library. <br>
+ * - The hash algorithm of a RSA signature is derived from the digest length (SHA256, SHA384 or SHA512).
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Used by OPTIGA CRYPT, if OPTIGA_CRYPT_HOST_VERIFY_ENABLED is defined.
+ * - #PAL_STATUS_INVALID_INPUT indicates, that the key type is not supported by the crypto library
+ *   and the verification is performed by OPTIGA.
+ *
+ * \param[in]        p_pal_crypt                            Crypt context
+ * \param[in]        p_public_key_info                      DER encoded SubjectPublicKeyInfo
+ * \param[in]        public_key_info_length                 Length of the public key info
+ * \param[in]        p_digest                               Digest which is signed
+ * \param[in]        digest_length                          Length of the digest
+ * \param[in]        p_signature                            DER encoded ECDSA signature or RSA signature
+ * \param[in]        signature_length                       Length of the signature
+ *
+ * \retval           PAL_STATUS_SUCCESS                     Signature is valid
+ * \retval           PAL_STATUS_FAILURE                     Signature is invalid
+ * \retval           PAL_STATUS_INVALID_INPUT               Public key or algorithm is not supported
+ */
+pal_status_t pal_crypt_verify_signature(
+    pal_crypt_t *p_pal_crypt,
+    const uint8_t *p_public_key_info,
+    uint16_t public_key_info_length,
+    const uint8_t *p_digest,
+    uint16_t digest_length,
+    const uint8_t *p_signature,
+    uint16_t signature_length
+);
+
+/**
+ * \brief Starts a hash calculation on the host.
+ *
+ * \details
+ * Initializes a SHA256, SHA384 or SHA512 context of the external crypto library and stores it in the context buffer. <br>
+ * - The hash algorithm is selected by the digest length.
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Used by OPTIGA CRYPT, if OPTIGA_CRYPT_HOST_HASH_ENABLED is defined.
+ * - The context buffer is not required to be aligned.
+ * - #PAL_STATUS_INVALID_INPUT indicates, that the hash algorithm is not supported or the context buffer is too small
+ *   and the hash is calculated by OPTIGA.
+ *
+ * \param[in]        p_pal_crypt                            Crypt context
+ * \param[in]        digest_length                          Length of the digest (32, 48 or 64)
+ * \param[out]       p_context                              Buffer to store the hash context
+ * \param[in]        context_length                         Length of the context buffer
+ *
+ * \retval           PAL_STATUS_SUCCESS                     In case of success
+ * \retval           PAL_STATUS_FAILURE                     In case of failure
+ * \retval           PAL_STATUS_INVALID_INPUT               Hash algorithm or context length is not supported
+ */
+pal_status_t pal_crypt_hash_start(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    uint16_t context_length
+);
+
+/**
+ * \brief Updates a hash context on the host with data.
+ *
+ * \details
+ * Updates the hash context stored by #pal_crypt_hash_start with the data. <br>
+ *
+ * \pre
+ * - The context is started using #pal_crypt_hash_start with the same digest length.
+ *
+ * \note
+ * - Used by OPTIGA CRYPT, if OPTIGA_CRYPT_HOST_HASH_ENABLED is defined.
+ *
+ * \param[in]        p_pal_crypt                            Crypt context
+ * \param[in]        digest_length                          Length of the digest (32, 48 or 64)
+ * \param[in,out]    p_context                              Hash context
+ * \param[in]        p_data                                 Data to hash
+ * \param[in]        data_length                            Length of the data
+ *
+ * \retval           PAL_STATUS_SUCCESS                     In case of success
+ * \retval           PAL_STATUS_FAILURE                     In case of failure
+ */
+pal_status_t pal_crypt_hash_update(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    uint8_t *p_context,
+    const uint8_t *p_data,
+    uint32_t data_length
+);
+
+/**
+ * \brief Finalizes a hash context on the host.
+ *
+ * \details
+ * Calculates the digest of the hash context stored by #pal_crypt_hash_start. <br>
+ * - The hash context is not modified and can be updated further.
+ *
+ * \pre
+ * - The context is started using #pal_crypt_hash_start with the same digest length.
+ *
+ * \note
+ * - Used by OPTIGA CRYPT, if OPTIGA_CRYPT_HOST_HASH_ENABLED is defined.
+ *
+ * \param[in]        p_pal_crypt                            Crypt context
+ * \param[in]        digest_length                          Length of the digest (32, 48 or 64)
+ * \param[in]        p_context                              Hash context
+ * \param[out]       p_digest                               Buffer of digest_length bytes to store the digest
+ *
+ * \retval           PAL_STATUS_SUCCESS                     In case of success
+ * \retval           PAL_STATUS_FAILURE                     In case of failure
+ */
+pal_status_t pal_crypt_hash_finalize(
+    pal_crypt_t *p_pal_crypt,
+    uint8_t digest_length,
+    const uint8_t *p_context,
+    uint8_t *p_digest
+);
+
 #ifdef __cplusplus
 }
 #endif
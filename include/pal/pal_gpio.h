@@ -109,6 +109,75 @@ LIBRARY_EXPORTS pal_status_t pal_gpio_init(const pal_gpio_t *p_gpio_context);
  */
 LIBRARY_EXPORTS pal_status_t pal_gpio_deinit(const pal_gpio_t *p_gpio_context);
 
+/**
+ * \brief Drives the GPIO pin low for the given time and then high again.
+ *
+ * \details
+ * Drives the GPIO pin low for the given time and then high again.
+ * - Used for reset pulses and power cycles, if the platform times the low level more precisely
+ *   than the PAL OS event
+ * - The default implementation does nothing and returns #PAL_STATUS_FAILURE,
+ *   the caller then times the levels with #pal_gpio_set_low and #pal_gpio_set_high
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - None
+ *
+ * \param[in] p_gpio_context                         Valid pointer to PAL layer GPIO context
+ * \param[in] low_time_us                            Low time in microseconds
+ *
+ * \retval    #PAL_STATUS_SUCCESS                    Pulse driven
+ * \retval    #PAL_STATUS_FAILURE                    Not supported or the pin is not assigned
+ */
+LIBRARY_EXPORTS pal_status_t
+pal_gpio_pulse_low(const pal_gpio_t *p_gpio_context, uint32_t low_time_us);
+
+/**
+ * \brief Starts watching the ready line of the slave for its rising edge.
+ *
+ * \details
+ * Starts watching the ready line of the slave for its rising edge.
+ * - Invoked before the reset, so that the rising edge is not missed
+ * - The default implementation does nothing and returns #PAL_STATUS_FAILURE,
+ *   the caller then waits for the start up time
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - None
+ *
+ * \param[in] p_ready_gpio                           Valid pointer to PAL layer GPIO context of the ready line
+ *
+ * \retval    #PAL_STATUS_SUCCESS                    Ready line is watched
+ * \retval    #PAL_STATUS_FAILURE                    Not supported or the pin is not assigned
+ */
+LIBRARY_EXPORTS pal_status_t pal_gpio_watch_ready(const pal_gpio_t *p_ready_gpio);
+
+/**
+ * \brief Checks without blocking whether the watched ready line signalled ready.
+ *
+ * \details
+ * Checks without blocking whether the rising edge of the ready line watched with #pal_gpio_watch_ready
+ * occurred.
+ * - The caller repeats the check from the PAL OS event until it succeeds or the start up time elapsed
+ * - The default implementation returns #PAL_STATUS_FAILURE
+ *
+ * \pre
+ * - #pal_gpio_watch_ready succeeded for the line
+ *
+ * \note
+ * - None
+ *
+ * \param[in] p_ready_gpio                           Valid pointer to PAL layer GPIO context of the ready line
+ *
+ * \retval    #PAL_STATUS_SUCCESS                    Ready edge occurred
+ * \retval    #PAL_STATUS_FAILURE                    No ready edge yet or the line is not watched
+ */
+LIBRARY_EXPORTS pal_status_t pal_gpio_is_ready(const pal_gpio_t *p_ready_gpio);
+
 #ifdef __cplusplus
 }
 #endif
@@ -28,6 +28,9 @@ extern "C" {
 extern pal_i2c_t optiga_pal_i2c_context_0;
 extern pal_gpio_t optiga_vdd_0;
 extern pal_gpio_t optiga_reset_0;
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+extern pal_gpio_t optiga_ready_0;
+#endif
 
 #ifdef __cplusplus
 }
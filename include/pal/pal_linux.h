@@ -38,9 +38,21 @@ typedef struct pal_linux {
 typedef const char *gpio_device_t;
 typedef uint16_t gpio_device_offset_t;
 
+#if !defined(LIBGPIOD_V1)
+struct gpiod_line_request;
+#endif
+
 typedef struct pal_linux_gpio_gpiod {
     gpio_device_t gpio_device;
     gpio_device_offset_t gpio_device_offset;
+#if !defined(LIBGPIOD_V1)
+    /// Line request, requested on first use and kept open for the process lifetime
+    struct gpiod_line_request *p_line_request;
+    /// Monotonic time in nanoseconds of the last transition to low
+    uint64_t low_timestamp_ns;
+    /// Monotonic time in nanoseconds of the last transition to high
+    uint64_t high_timestamp_ns;
+#endif
 } pal_linux_gpio_gpiod_t;
 
 #else
@@ -54,4 +66,35 @@ typedef struct pal_linux_gpio {
 
 #endif  // HAS_LIBGPIOD
 
+#if defined(HAS_LIBGPIOD) && !defined(LIBGPIOD_V1)
+/**
+ * @brief Reset and power timing metrics of the libgpiod v2 GPIO backend
+ *
+ * @details
+ * - Recorded by #pal_gpio_pulse_low, #pal_gpio_set_low, #pal_gpio_set_high and #pal_gpio_is_ready
+ */
+typedef struct pal_linux_gpio_metrics {
+    /// Low time of the last reset pulse in microseconds
+    uint32_t reset_pulse_us;
+    /// Off time of the last power cycle (VDD low to high) in microseconds
+    uint32_t power_cycle_us;
+    /// Time from the last reset release to the ready edge in microseconds
+    uint32_t reset_to_ready_us;
+    /// Longest time from reset release to the ready edge in microseconds
+    uint32_t max_reset_to_ready_us;
+    /// Number of ready waits which ended without the ready edge, counted when the line is watched again
+    uint32_t ready_timeout_count;
+} pal_linux_gpio_metrics_t;
+
+/**
+ * \brief Reads the reset and power timing metrics.
+ *
+ * \param[out] p_metrics          Valid pointer to store the metrics
+ *
+ * \retval    #PAL_STATUS_SUCCESS        On successful execution
+ * \retval    #PAL_STATUS_INVALID_INPUT  NULL pointer
+ */
+pal_status_t pal_gpio_gpiod_get_metrics(pal_linux_gpio_metrics_t *p_metrics);
+#endif  // HAS_LIBGPIOD && !LIBGPIOD_V1
+
 #endif
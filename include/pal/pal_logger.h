@@ -121,6 +121,190 @@ pal_logger_write(void *p_logger_context, const uint8_t *p_log_data, uint32_t log
  */
 pal_status_t pal_logger_read(void *p_logger_context, uint8_t *p_log_data, uint32_t log_data_length);
 
+#ifdef PAL_LOGGER_RING_ENABLED
+
+#ifndef PAL_LOGGER_RING_RECORD_COUNT
+/// Number of records in the logger ring, must be a power of 2
+#define PAL_LOGGER_RING_RECORD_COUNT (256U)
+#endif
+
+#ifndef PAL_LOGGER_RING_MAX_PAYLOAD
+/// Maximum number of payload bytes copied into a record, longer data is truncated
+#define PAL_LOGGER_RING_MAX_PAYLOAD (64U)
+#endif
+
+#ifndef PAL_LOGGER_RING_DRAIN_INTERVAL_US
+/// Sleep time of the drain thread when the ring is empty
+#define PAL_LOGGER_RING_DRAIN_INTERVAL_US (1000U)
+#endif
+
+/// Magic value at the start of a dumped logger ring ("OLRB")
+#define PAL_LOGGER_RING_DUMP_MAGIC (0x4F4C5242U)
+/// Version of the dumped logger ring format
+#define PAL_LOGGER_RING_DUMP_VERSION (0x0001U)
+
+/** \brief Binary log record stored in the logger ring */
+typedef struct pal_logger_ring_record {
+    /// Time stamp in microseconds
+    uint32_t timestamp_us;
+    /// Length of the logged data, may be more than payload_length
+    uint16_t data_length;
+    /// Number of bytes copied to payload
+    uint16_t payload_length;
+    /// Id of the logging layer
+    uint8_t layer_id;
+    /// Id of the logged event
+    uint8_t event_id;
+    /// Copy of the logged data
+    uint8_t payload[PAL_LOGGER_RING_MAX_PAYLOAD];
+} pal_logger_ring_record_t;
+
+/** \brief Header of a dumped logger ring, followed by record_count records */
+typedef struct pal_logger_ring_dump_header {
+    /// #PAL_LOGGER_RING_DUMP_MAGIC
+    uint32_t magic;
+    /// #PAL_LOGGER_RING_DUMP_VERSION
+    uint16_t version;
+    /// Size of each record in bytes
+    uint16_t record_size;
+    /// Number of records following the header
+    uint32_t record_count;
+    /// Number of records dropped because the ring was full
+    uint32_t overflow_count;
+} pal_logger_ring_dump_header_t;
+
+/** \brief Handler invoked by the drain thread for every record */
+typedef void (*pal_logger_ring_handler_t)(const pal_logger_ring_record_t *p_record);
+
+/**
+ * \brief Records a log event into the logger ring.
+ *
+ * \details
+ * Records a log event into the logger ring.
+ * - Copies at most #PAL_LOGGER_RING_MAX_PAYLOAD bytes of the data, no formatting is done.<br>
+ * - If the ring is full, the record is dropped and the overflow counter is incremented.<br>
+ *
+ * \pre
+ * - None.
+ *
+ * \note
+ * - The ring is lock free for multiple producers and a single consumer (the drain thread). Producers claim
+ *   a slot with compare and swap on the write counter and commit it with the sequence number of the slot.
+ * - Records are only formatted once the application started the drain thread with #pal_logger_ring_start().
+ *   Until then they stay in the ring and further records are dropped once it is full.
+ *
+ * \param[in] layer_id            Id of the logging layer
+ * \param[in] event_id            Id of the logged event
+ * \param[in] p_data              Pointer to the data to be logged, can be NULL if data_length is 0
+ * \param[in] data_length         Length of the data
+ *
+ * \retval    PAL_STATUS_SUCCESS  Record is stored
+ * \retval    PAL_STATUS_FAILURE  Ring is full, record is dropped
+ *
+ */
+pal_status_t pal_logger_ring_write(
+    uint8_t layer_id,
+    uint8_t event_id,
+    const uint8_t *p_data,
+    uint16_t data_length
+);
+
+/**
+ * \brief Reads the oldest record from the logger ring.
+ *
+ * \details
+ * Reads the oldest record from the logger ring.
+ * - Used by the drain thread. Must not be invoked while the drain thread is running.<br>
+ * - Records are read in the order of their slots. A record still written by its producer is not read,
+ *   even if later records are already committed.<br>
+ *
+ * \pre
+ * - None.
+ *
+ * \note
+ * - None
+ *
+ * \param[out] p_record           Valid pointer to store the record
+ *
+ * \retval    PAL_STATUS_SUCCESS  Record is read
+ * \retval    PAL_STATUS_FAILURE  Ring is empty
+ *
+ */
+pal_status_t pal_logger_ring_read(pal_logger_ring_record_t *p_record);
+
+/**
+ * \brief Starts the drain thread.
+ *
+ * \details
+ * Starts the drain thread.
+ * - The drain thread passes every record to the handler, which formats and writes it.<br>
+ * - The drain thread is not started by #pal_logger_init(), the application starts it,
+ *   e.g. with #optiga_lib_print_record as handler.<br>
+ *
+ * \pre
+ * - None.
+ *
+ * \note
+ * - None
+ *
+ * \param[in] handler             Record handler, must not be NULL
+ *
+ * \retval    PAL_STATUS_SUCCESS  Drain thread is started
+ * \retval    PAL_STATUS_FAILURE  Drain thread is already running or could not be created
+ *
+ */
+pal_status_t pal_logger_ring_start(pal_logger_ring_handler_t handler);
+
+/**
+ * \brief Stops the drain thread.
+ *
+ * \details
+ * Stops the drain thread.
+ * - The remaining records are drained before the API returns.<br>
+ *
+ * \pre
+ * - None.
+ *
+ * \note
+ * - None
+ *
+ * \retval    PAL_STATUS_SUCCESS  Drain thread is stopped
+ * \retval    PAL_STATUS_FAILURE  Drain thread is not running
+ *
+ */
+pal_status_t pal_logger_ring_stop(void);
+
+/**
+ * \brief Returns the number of records dropped because the ring was full.
+ *
+ * \retval    Overflow count
+ */
+uint32_t pal_logger_ring_get_overflow_count(void);
+
+/**
+ * \brief Dumps the pending records of the logger ring to a file.
+ *
+ * \details
+ * Dumps the pending records of the logger ring to a file.
+ * - Writes #pal_logger_ring_dump_header_t followed by the pending records. The records are not consumed.<br>
+ * - The dump is decoded with the logger_ring_decode tool (examples/tools/logger_ring_decode).<br>
+ *
+ * \pre
+ * - The drain thread is stopped, otherwise dumped records can be overwritten while they are written.
+ *
+ * \note
+ * - None
+ *
+ * \param[in] p_file_path         Path of the dump file
+ *
+ * \retval    PAL_STATUS_SUCCESS  Ring is dumped
+ * \retval    PAL_STATUS_FAILURE  File could not be written
+ *
+ */
+pal_status_t pal_logger_ring_dump(const char_t *p_file_path);
+
+#endif  // PAL_LOGGER_RING_ENABLED
+
 #ifdef __cplusplus
 }
 #endif
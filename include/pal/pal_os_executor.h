@@ -0,0 +1,173 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file    pal_os_executor.h
+ *
+ * \brief   This file provides the prototype declarations of the PAL OS completion executor.
+ *
+ * \ingroup grPAL
+ *
+ * @{
+ */
+
+#ifndef _PAL_OS_EXECUTOR_H_
+#define _PAL_OS_EXECUTOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "pal.h"
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+
+#ifndef PAL_OS_EXECUTOR_QUEUE_LENGTH
+/// Number of completions held by the executor queue
+#define PAL_OS_EXECUTOR_QUEUE_LENGTH (32U)
+#endif
+
+#ifndef PAL_OS_EXECUTOR_MAX_WORKERS
+/// Maximum number of worker threads of the executor
+#define PAL_OS_EXECUTOR_MAX_WORKERS (4U)
+#endif
+
+/** \brief Statistics of the completion executor */
+typedef struct pal_os_executor_stats {
+    /// Number of completions queued
+    uint32_t posted_count;
+    /// Number of queued completions invoked by the workers, #pal_os_executor_run or on a full queue
+    uint32_t executed_count;
+    /// Number of completions not queued because the queue was full, invoked by the completing context
+    /// after the completions queued before
+    uint32_t overflow_count;
+    /// Highest number of completions waiting in the queue
+    uint32_t max_queue_depth;
+} pal_os_executor_stats_t;
+
+/**
+ * \brief Starts the completion executor.
+ *
+ * \details
+ * Starts the completion executor, which invokes the callback handlers of the util and crypt instances
+ * outside of the context completing the operation (timer thread or I2C read).
+ * - With worker_count greater than 0, the completions are invoked by worker threads.<br>
+ * - With worker_count 0, the completions are invoked by the application with #pal_os_executor_run,
+ *   when the descriptor provided by #pal_os_executor_get_fd becomes readable.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Completions of different instances may be invoked concurrently by multiple workers.
+ *
+ * \param[in] worker_count        Number of worker threads, 0 to at most #PAL_OS_EXECUTOR_MAX_WORKERS
+ *
+ * \retval    #PAL_STATUS_SUCCESS        Executor is started
+ * \retval    #PAL_STATUS_INVALID_INPUT  More than #PAL_OS_EXECUTOR_MAX_WORKERS workers requested
+ * \retval    #PAL_STATUS_FAILURE        Executor is already running, or the descriptor or a worker could not be created
+ */
+pal_status_t pal_os_executor_start(uint8_t worker_count);
+
+/**
+ * \brief Stops the completion executor.
+ *
+ * \details
+ * Stops the completion executor.
+ * - The workers are joined and the completions still queued are invoked before the API returns.<br>
+ * - Later completions are invoked by the completing context again.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Must not be invoked from a callback handler.
+ *
+ * \retval    #PAL_STATUS_SUCCESS  Executor is stopped
+ * \retval    #PAL_STATUS_FAILURE  Executor is not running
+ */
+pal_status_t pal_os_executor_stop(void);
+
+/**
+ * \brief Queues a completion.
+ *
+ * \details
+ * Queues the invocation of the handler with the context and status.
+ * - Never blocks. The caller invokes the handler itself, if the completion is not queued.<br>
+ * - If the queue is full, the completions queued before are invoked before the API returns,
+ *   so the completions are invoked in the order they are posted.<br>
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Used by OPTIGA UTIL and OPTIGA CRYPT for the application handlers,
+ *   if PAL_OS_EXECUTOR_ENABLED is defined.
+ *
+ * \param[in] handler             Callback handler
+ * \param[in] p_ctx               Context passed to the handler
+ * \param[in] status              Status passed to the handler
+ *
+ * \retval    #PAL_STATUS_SUCCESS  Completion is queued
+ * \retval    #PAL_STATUS_FAILURE  Executor is not running or the queue is full
+ */
+pal_status_t
+pal_os_executor_post(callback_handler_t handler, void *p_ctx, optiga_lib_status_t status);
+
+/**
+ * \brief Provides the descriptor signalling queued completions.
+ *
+ * \details
+ * Provides an eventfd descriptor, which is readable while completions are queued,
+ * to be added to the poll/epoll set or io_uring of the application.
+ *
+ * \pre
+ * - The executor is started with 0 workers.
+ *
+ * \note
+ * - The descriptor is closed by #pal_os_executor_stop.
+ *
+ * \retval    Descriptor, -1 if the executor is not running or uses workers
+ */
+int32_t pal_os_executor_get_fd(void);
+
+/**
+ * \brief Invokes the queued completions.
+ *
+ * \details
+ * Invokes the completions queued before the call in the context of the caller and clears the descriptor
+ * provided by #pal_os_executor_get_fd.
+ *
+ * \pre
+ * - The executor is started with 0 workers.
+ *
+ * \note
+ * - Completions queued by the invoked handlers are signalled again through the descriptor.
+ *
+ * \retval    Number of invoked completions
+ */
+uint32_t pal_os_executor_run(void);
+
+/**
+ * \brief Provides the statistics of the completion executor.
+ *
+ * \param[out] p_stats            Valid pointer to store the statistics
+ *
+ * \retval    #PAL_STATUS_SUCCESS        Statistics are provided
+ * \retval    #PAL_STATUS_INVALID_INPUT  NULL pointer
+ */
+pal_status_t pal_os_executor_get_stats(pal_os_executor_stats_t *p_stats);
+
+#endif  // PAL_OS_EXECUTOR_ENABLED
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PAL_OS_EXECUTOR_H_ */
+
+/**
+ * @}
+ */
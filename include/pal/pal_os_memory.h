@@ -22,6 +22,118 @@ extern "C" {
 
 #include "pal.h"
 
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+
+/// Number of size classes maintained by the fixed block pool
+#define PAL_OS_MEMORY_POOL_CLASS_COUNT (3U)
+
+#ifndef PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS
+/// Number of blocks per size class, one per possible instance registration (OPTIGA_CMD_MAX_REGISTRATIONS)
+#define PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS (0x06U)
+#endif
+
+/// Index of the small size class, used with #pal_os_memory_pool_get_stats
+#define PAL_OS_MEMORY_POOL_CLASS_SMALL (0U)
+/// Index of the medium size class, used with #pal_os_memory_pool_get_stats
+#define PAL_OS_MEMORY_POOL_CLASS_MEDIUM (1U)
+/// Index of the large size class, used with #pal_os_memory_pool_get_stats
+#define PAL_OS_MEMORY_POOL_CLASS_LARGE (2U)
+
+#ifndef PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE
+/// Block size of the small size class
+#define PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE (96U)
+#endif
+
+#ifndef PAL_OS_MEMORY_POOL_MEDIUM_BLOCK_SIZE
+/// Block size of the medium size class
+#define PAL_OS_MEMORY_POOL_MEDIUM_BLOCK_SIZE (128U)
+#endif
+
+#ifndef PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE
+/// Block size of the large size class
+#define PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE (256U)
+#endif
+
+/**
+ * @brief Usage statistics of one size class of the PAL OS memory pool.
+ */
+typedef struct pal_os_memory_pool_stats {
+    /// Size of each block in the size class
+    uint32_t block_size;
+    /// Total number of blocks in the size class
+    uint16_t block_count;
+    /// Number of blocks currently allocated
+    uint16_t blocks_in_use;
+    /// Highest number of blocks allocated at the same time
+    uint16_t high_water_mark;
+    /// Number of requests for this size class which were served from the generic heap
+    uint32_t heap_fallback_count;
+} pal_os_memory_pool_stats_t;
+
+/**
+ * \brief Allocates a block from the fixed block pool.
+ *
+ * \details
+ * - Picks the smallest size class which fits the requested size and has a free block
+ * - The default block sizes cover the #optiga_cmd_t, #optiga_util_t and #optiga_crypt_t instances. The class
+ *   an instance lands in depends on the enabled features, since these change the instance sizes.
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - The free lists are lock free, the function can be invoked from multiple threads.
+ * - The block content is not initialized.
+ *
+ * \param[in] block_size         Size of the block
+ *
+ * \retval  Block Pointer  Block allocated from the pool
+ * \retval  NULL           No size class fits the request or all fitting blocks are in use
+ */
+void *pal_os_memory_pool_alloc(uint32_t block_size);
+
+/**
+ * \brief Returns a block to the fixed block pool.
+ *
+ * \details
+ * - Returns the block to the free list of its size class
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - None
+ *
+ * \param[in] p_block      Pointer to memory block to be freed
+ *
+ * \retval  TRUE           Block belongs to the pool and was released
+ * \retval  FALSE          Block is not owned by the pool
+ */
+bool_t pal_os_memory_pool_free(void *p_block);
+
+/**
+ * \brief Reads the usage statistics of a size class of the fixed block pool.
+ *
+ * \details
+ * - Provides the current usage and the high-water mark of the size class
+ *
+ * \pre
+ * - None
+ *
+ * \note
+ * - Size classes are ordered by ascending block size.
+ *
+ * \param[in]  class_index              Index of the size class, less than #PAL_OS_MEMORY_POOL_CLASS_COUNT
+ * \param[out] p_stats                  Valid pointer to store the statistics
+ *
+ * \retval  #PAL_STATUS_SUCCESS         Statistics are read successfully
+ * \retval  #PAL_STATUS_INVALID_INPUT   Invalid class index or NULL pointer
+ */
+LIBRARY_EXPORTS pal_status_t
+pal_os_memory_pool_get_stats(uint8_t class_index, pal_os_memory_pool_stats_t *p_stats);
+
+#endif  // PAL_OS_MEMORY_POOL_ENABLED
+
 /**
  * \brief Allocates a block of memory specified by the block size and return the pointer to it.
  *
@@ -14,6 +14,7 @@
  * @{
  */
 
+#include <stdio.h>
 #include "optiga_cmd.h"
 
 #include "optiga_comms.h"
@@ -55,7 +56,9 @@
 #define OPTIGA_CMD_DECRYPT_ASYM (0x1F | OPTIGA_CMD_CLEAR_LAST_ERROR)
 // cmd byte for SetObjectProtected command
 #define OPTIGA_CMD_SET_OBJECT_PROTECTED (0x03 | OPTIGA_CMD_CLEAR_LAST_ERROR)
-#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED)
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 // cmd byte for EncryptSym command
 #define OPTIGA_CMD_ENCRYPT_SYM (0x14 | OPTIGA_CMD_CLEAR_LAST_ERROR)
 // cmd byte for DecryptSym command
@@ -178,7 +181,9 @@
 #define OPTIGA_CMD_ENTER_HANDLER_CALL (0x80)
 #define OPTIGA_CMD_EXIT_HANDLER_CALL (0x00)
 #define OPTIGA_CMD_OUT_OF_BOUNDARY_ERROR (0x08)
-#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED)
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 /// Symmetric encrypt decrypt hmac tag value
 #define OPTIGA_CMD_ENC_DEC_SYM_ASSOCIATED_DATA_TAG (0x40)
 #define OPTIGA_CMD_ENC_DEC_SYM_IV_TAG (0x41)
@@ -221,12 +226,11 @@
 #define OPTIGA_CMD_OPERATION_MODE_SYMMETRIC_ENCRYPTION (0x01)
 // Symmetric decrypt mode
 #define OPTIGA_CMD_OPERATION_MODE_SYMMETRIC_DECRYPTION (0x00)
-#if defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
     || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 // HMAC mode
 #define OPTIGA_CMD_OPERATION_MODE_HMAC (0x02)
-#endif
-#ifdef OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED
 // Auto clear state
 #define OPTIGA_CMD_OPERATION_MODE_CLEAR_AUTO_STATE (0x03)
 #endif
@@ -424,6 +428,48 @@ struct optiga_context {
     /// Protection level status flag
     uint8_t protection_level_state;
 #endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+#if defined(OPTIGA_UTIL_POWER_MANAGER_ENABLED) || defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED)
+    /// Power state of the application on OPTIGA
+    uint8_t power_state;
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED || OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    /// Time stamp in milliseconds, when the last command released the lock
+    uint32_t last_activity_time;
+    /// Power event handler of the attached power manager
+    optiga_cmd_power_event_handler_t power_event_handler;
+    /// Context of the attached power manager
+    void *p_power_event_ctx;
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+    /// Idle handler performing background operations
+    optiga_cmd_idle_handler_t idle_handler;
+    /// Context of the idle handler
+    void *p_idle_ctx;
+    /// Sessions held by the idle handler, as reported with the last notification
+    uint8_t idle_session_count;
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+    /// Write handlers invalidating host copies of data object contents
+    optiga_cmd_write_handler_t write_handlers[OPTIGA_CMD_MAX_WRITE_HANDLERS];
+    /// Contexts of the write handlers
+    void *p_write_ctx[OPTIGA_CMD_MAX_WRITE_HANDLERS];
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+    /// Load handler adapting the performance of OPTIGA
+    optiga_cmd_load_handler_t load_handler;
+    /// Context of the load handler
+    void *p_load_ctx;
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+#ifdef OPTIGA_CMD_TIMER_ENABLED
+    /// Registered one-shot callback
+    optiga_cmd_timer_handler_t timer_handler;
+    /// Context of the one-shot callback
+    void *p_timer_ctx;
+    /// Time stamp in milliseconds, when the one-shot callback was registered
+    uint32_t timer_start_time;
+    /// Time in milliseconds, after which the one-shot callback is invoked
+    uint32_t timer_time_ms;
+#endif  // OPTIGA_CMD_TIMER_ENABLED
 };
 
 // static instance of optiga
@@ -499,16 +545,63 @@ struct optiga_cmd {
     uint16_t optiga_context_datastore_id;
     /// To Store APDU command information which is last processed
     uint16_t apdu_data;
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    /// Flag to indicate the application context is being restored before the command
+    uint8_t lazy_restore_ongoing;
+    /// Param of the command deferred during the restore
+    uint8_t deferred_cmd_param;
+    /// APDU information of the command deferred during the restore
+    uint16_t deferred_apdu_data;
+    /// Handler of the command deferred during the restore
+    optiga_cmd_handler_t deferred_cmd_hdlrs;
+    /// Input of the command deferred during the restore
+    void *p_deferred_input;
+    /// Time stamp in microseconds, when the restore started
+    uint32_t restore_start_time;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    /// Manage context option of the command deferred during the restore
+    uint8_t deferred_manage_context_operation;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+    /// Time stamp in microseconds, when the command APDU was sent
+    uint32_t transceive_start_time;
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
 };
 
 _STATIC_H optiga_lib_status_t optiga_cmd_get_error_code_handler(optiga_cmd_t *me);
 
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+_STATIC_H void optiga_cmd_notify_write(const optiga_cmd_t *me, uint16_t oid);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+_STATIC_H optiga_lib_status_t optiga_cmd_open_application_handler(optiga_cmd_t *me);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
 #if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) || defined(OPTIGA_CRYPT_RSA_SIGN_ENABLED)
 _STATIC_H void optiga_cmd_ecc_r_s_padding_check(uint8_t *sig, uint16_t *sig_len);
 #endif  // (OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) || defined(OPTIGA_CRYPT_RSA_SIGN_ENABLED)
 
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+_STATIC_H void optiga_cmd_calc_hash_stream_read_ahead(const optiga_cmd_t *me);
+#endif  // (OPTIGA_CRYPT_HASH_ENABLED) && (OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+
+#if (defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+     || defined(OPTIGA_CRYPT_HMAC_ENABLED)) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+_STATIC_H void optiga_cmd_sym_stream_read_ahead(const optiga_cmd_t *me);
+_STATIC_H bool_t optiga_cmd_sym_stream_is_failed(const optiga_cmd_t *me);
+#endif  // ((OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || (OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_ENABLED)) && (OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+_STATIC_H void optiga_cmd_set_object_protected_stream_read_ahead(const optiga_cmd_t *me);
+_STATIC_H bool_t optiga_cmd_set_object_protected_stream_is_suspended(const optiga_cmd_t *me);
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 #if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
-    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED)
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 
 _STATIC_H uint16_t optiga_cmd_sym_get_block_size(const optiga_encrypt_sym_params_t *param) {
 #define OPTIGA_CMD_MIN_BLOCK_SIZE_VALUE (0x01)
@@ -658,6 +751,151 @@ _STATIC_H uint8_t optiga_cmd_sym_get_current_enc_dec_sequence(
 
     return (param->current_sequence);
 }
+
+#if (defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+     || defined(OPTIGA_CRYPT_HMAC_ENABLED)) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+// Limits the packet length of a streamed symmetric operation to the block aligned stream buffer
+_STATIC_H uint16_t optiga_cmd_sym_stream_get_max_packet_length(
+    const optiga_encrypt_sym_params_t *param,
+    uint16_t max_packet_length
+) {
+    uint16_t block_size = optiga_cmd_sym_get_block_size(param);
+    uint16_t buffer_packet_length =
+        (uint16_t)(param->p_sym_stream->buffer_length
+                   - (param->p_sym_stream->buffer_length % block_size));
+
+    return ((uint16_t)MIN(max_packet_length, buffer_packet_length));
+}
+
+_STATIC_H void
+optiga_cmd_sym_stream_read(optiga_encrypt_sym_params_t *param, uint16_t fragment_length) {
+    const symmetric_data_stream_t *p_sym_stream = param->p_sym_stream;
+    uint16_t requested_length;
+    uint16_t read_length;
+
+    while ((OPTIGA_LIB_SUCCESS == param->stream_status)
+           && (param->stream_buffered_length < fragment_length)) {
+        requested_length = fragment_length - param->stream_buffered_length;
+        if (param->stream_read_length < p_sym_stream->length) {
+            requested_length =
+                (uint16_t)MIN(requested_length, (p_sym_stream->length - param->stream_read_length));
+            read_length = 0;
+            param->stream_status = p_sym_stream->reader(
+                p_sym_stream->p_stream_ctx,
+                p_sym_stream->p_buffer + param->stream_buffered_length,
+                requested_length,
+                &read_length
+            );
+            // Stream ended before the specified length or the reader exceeded the buffer
+            if ((OPTIGA_LIB_SUCCESS == param->stream_status)
+                && ((0U == read_length) || (read_length > requested_length))) {
+                param->stream_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+            }
+        } else {
+            // PKCS#7 padding after the end of the data to be encrypted
+            read_length = requested_length;
+            pal_os_memset(
+                p_sym_stream->p_buffer + param->stream_buffered_length,
+                (uint8_t)(param->in_data_length - p_sym_stream->length),
+                read_length
+            );
+        }
+        if (OPTIGA_LIB_SUCCESS == param->stream_status) {
+            param->stream_buffered_length += read_length;
+            param->stream_read_length += read_length;
+        }
+    }
+}
+
+_STATIC_H void optiga_cmd_sym_stream_read_ahead(const optiga_cmd_t *me) {
+    optiga_encrypt_sym_params_t *param = (optiga_encrypt_sym_params_t *)me->p_input;
+    uint16_t max_packet_length;
+
+    if ((NULL != param->p_sym_stream) && (param->in_data_length != param->sent_data_length)) {
+        max_packet_length = optiga_cmd_sym_stream_get_max_packet_length(
+            param,
+            optiga_cmd_sym_get_max_packet_length(
+                param,
+                optiga_cmd_sym_get_max_indata_header_length(param)
+            )
+        );
+        optiga_cmd_sym_stream_read(
+            param,
+            (uint16_t)MIN(max_packet_length, (param->in_data_length - param->sent_data_length))
+        );
+    }
+}
+
+_STATIC_H bool_t optiga_cmd_sym_stream_is_failed(const optiga_cmd_t *me) {
+    const optiga_encrypt_sym_params_t *param = (const optiga_encrypt_sym_params_t *)me->p_input;
+
+    return (
+        (((OPTIGA_CMD_ENCRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))
+          || (OPTIGA_CMD_DECRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)))
+         && (NULL != param->p_sym_stream) && (OPTIGA_LIB_SUCCESS != param->stream_status))
+            ? TRUE
+            : FALSE
+    );
+}
+
+// Writes the output of a streamed symmetric operation and removes the PKCS#7 padding from the last block
+_STATIC_H optiga_lib_status_t optiga_cmd_sym_stream_write(
+    const optiga_cmd_t *me,
+    optiga_encrypt_sym_params_t *param,
+    const uint8_t *p_data,
+    uint16_t data_length
+) {
+    const symmetric_data_stream_t *p_sym_stream = param->p_sym_stream;
+    optiga_lib_status_t return_status = OPTIGA_LIB_SUCCESS;
+    uint32_t elapsed_time;
+    uint32_t processed_length;
+    uint16_t padding_length;
+    uint16_t index;
+
+    do {
+        if ((TRUE == p_sym_stream->padding)
+            && (OPTIGA_CMD_DECRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))
+            && (param->in_data_length == param->sent_data_length)) {
+            padding_length = (0U != data_length) ? p_data[data_length - 1U] : 0U;
+            if ((0U == padding_length) || (padding_length > optiga_cmd_sym_get_block_size(param))
+                || (padding_length > data_length)) {
+                return_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+                break;
+            }
+            for (index = data_length - padding_length; index < data_length; index++) {
+                if (padding_length != p_data[index]) {
+                    return_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+                    break;
+                }
+            }
+            if (OPTIGA_LIB_SUCCESS != return_status) {
+                break;
+            }
+            data_length -= padding_length;
+        }
+        if (0U != data_length) {
+            return_status = p_sym_stream->writer(p_sym_stream->p_stream_ctx, p_data, data_length);
+            if (OPTIGA_LIB_SUCCESS != return_status) {
+                break;
+            }
+        }
+        if (NULL != p_sym_stream->progress_handler) {
+            processed_length = MIN(param->sent_data_length, p_sym_stream->length);
+            elapsed_time = pal_os_timer_get_time_in_milliseconds() - param->stream_start_time;
+            p_sym_stream->progress_handler(
+                p_sym_stream->p_stream_ctx,
+                processed_length,
+                p_sym_stream->length,
+                (0U != elapsed_time) ? (uint32_t)(((uint64_t)processed_length * 1000U) / elapsed_time)
+                                     : 0U
+            );
+        }
+    } while (FALSE);
+
+    return (return_status);
+}
+#endif  // ((OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || (OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_ENABLED)) && (OPTIGA_CRYPT_SYM_STREAM_ENABLED)
 #endif  //(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || (OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_ENABLED)
 #ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
 // lint --e{714} suppress "This function is defined here but referred from other modules"
@@ -748,6 +986,9 @@ _STATIC_H void optiga_cmd_execute(
     me->chaining_ongoing = FALSE;
     me->cmd_param = cmd_param;
     me->apdu_data = apdu_data;
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    me->lazy_restore_ongoing = FALSE;
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
     optiga_cmd_execute_handler(me, OPTIGA_LIB_SUCCESS);
 }
 
@@ -868,6 +1109,299 @@ _STATIC_H void optiga_cmd_queue_deassign_slot(optiga_cmd_t *me) {
     me->queue_id = 0;
 }
 
+#if defined(OPTIGA_UTIL_POWER_MANAGER_ENABLED) || defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED)
+/*
+ * Tracks the power state from the successfully processed OpenApplication and CloseApplication
+ */
+_STATIC_H void optiga_cmd_power_update_state(const optiga_cmd_t *me) {
+    if (OPTIGA_CMD_OPEN_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+        me->p_optiga->power_state = OPTIGA_CMD_POWER_STATE_ACTIVE;
+    } else if (OPTIGA_CMD_CLOSE_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+        me->p_optiga->power_state =
+            ((OPTIGA_CMD_PARAM_INITIALIZE_APP_CONTEXT != me->cmd_param)
+                 ? (OPTIGA_CMD_POWER_STATE_HIBERNATED)
+                 : (OPTIGA_CMD_POWER_STATE_CLOSED));
+    } else {
+        // Other commands do not change the power state
+    }
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED || OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+/*
+ * Notifies the attached power manager about the idle time of OPTIGA.
+ * OPTIGA is idle, if the application is open, no request is queued, no slot is processing or holding
+ * a strict lock and no session is acquired, apart from the sessions held by the idle handler.
+ */
+static int dbg_last = -1;
+#define DBGR(r) do { if (dbg_last != (r)) { dbg_last = (r); fprintf(stderr, "DBGR %d s%u i%u\n", (r), session_count, p_optiga_ctx->idle_session_count); } } while (0)
+_STATIC_H void optiga_cmd_power_idle_check(optiga_context_t *p_optiga_ctx) {
+    uint8_t index;
+    uint8_t session_count = 0;
+    uint32_t idle_time;
+
+    do {
+        if ((NULL == p_optiga_ctx->power_event_handler)
+            || (OPTIGA_CMD_POWER_STATE_ACTIVE != p_optiga_ctx->power_state)) {
+            DBGR(1);
+            break;
+        }
+        if ((0
+             != optiga_cmd_queue_get_count_of(
+                 p_optiga_ctx,
+                 OPTIGA_CMD_QUEUE_SLOT_STATE,
+                 OPTIGA_CMD_QUEUE_REQUEST
+             ))
+            || (0
+                != optiga_cmd_queue_get_count_of(
+                    p_optiga_ctx,
+                    OPTIGA_CMD_QUEUE_SLOT_STATE,
+                    OPTIGA_CMD_QUEUE_PROCESSING
+                ))
+            || (0
+                != optiga_cmd_queue_get_count_of(
+                    p_optiga_ctx,
+                    OPTIGA_CMD_QUEUE_SLOT_LOCK_TYPE,
+                    OPTIGA_CMD_QUEUE_REQUEST_STRICT_LOCK
+                ))) {
+            DBGR(2);
+            break;
+        }
+        for (index = 0; index < OPTIGA_CMD_MAX_NUMBER_OF_SESSIONS; index++) {
+            if (OPTIGA_CMD_SESSION_ASSIGNED == p_optiga_ctx->sessions[index]) {
+                session_count++;
+            }
+        }
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+        // Sessions of the idle handler are released before hibernating
+        if (session_count > p_optiga_ctx->idle_session_count) {
+            DBGR(3);
+            break;
+        }
+#else
+        if (0 != session_count) {
+            break;
+        }
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+        idle_time = pal_os_timer_get_time_in_milliseconds() - p_optiga_ctx->last_activity_time;
+        DBGR(4);
+        { static unsigned c; if ((++c % 50) == 0) fprintf(stderr, "DBGC %u idle %u\n", c, idle_time); }
+        p_optiga_ctx->power_event_handler(
+            p_optiga_ctx->p_power_event_ctx,
+            OPTIGA_CMD_POWER_EVENT_IDLE,
+            idle_time
+        );
+    } while (FALSE);
+}
+
+/*
+ * Defers the command and switches to OpenApplication with restore of the hibernated context.
+ * The lock is already acquired, so the state machine continues with comms open.
+ */
+_STATIC_H void optiga_cmd_lazy_restore_start(optiga_cmd_t *me) {
+    me->lazy_restore_ongoing = TRUE;
+    me->restore_start_time = pal_os_timer_get_time_in_microseconds();
+
+    me->deferred_cmd_hdlrs = me->cmd_hdlrs;
+    me->p_deferred_input = me->p_input;
+    me->deferred_cmd_param = me->cmd_param;
+    me->deferred_apdu_data = me->apdu_data;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    me->deferred_manage_context_operation = me->manage_context_operation;
+    me->manage_context_operation = OPTIGA_COMMS_SESSION_CONTEXT_RESTORE;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+
+    me->cmd_hdlrs = optiga_cmd_open_application_handler;
+    me->p_input = NULL;
+    me->cmd_param = (uint8_t)TRUE;
+    // lint --e{835} suppress "Upper 8 bits of apdu_data is kept as zero and is reserved for future enhancements"
+    me->apdu_data =
+        OPTIGA_CMD_SET_APDU_DATA(OPTIGA_CMD_OPEN_APPLICATION, OPTIGA_CMD_ZERO_LENGTH_OR_VALUE);
+
+    me->cmd_next_execution_state = OPTIGA_CMD_EXEC_COMMS_OPEN;
+    me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_COMMS_OPEN_START;
+}
+
+/*
+ * Resumes the deferred command
+ */
+_STATIC_H void optiga_cmd_lazy_restore_resume(optiga_cmd_t *me) {
+    me->lazy_restore_ongoing = FALSE;
+
+    me->cmd_hdlrs = me->deferred_cmd_hdlrs;
+    me->p_input = me->p_deferred_input;
+    me->cmd_param = me->deferred_cmd_param;
+    me->apdu_data = me->deferred_apdu_data;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    me->manage_context_operation = me->deferred_manage_context_operation;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+}
+
+/*
+ * Resumes the deferred command after a successful restore
+ */
+_STATIC_H void optiga_cmd_lazy_restore_done(optiga_cmd_t *me) {
+    uint32_t resume_latency = pal_os_timer_get_time_in_microseconds() - me->restore_start_time;
+
+    optiga_cmd_lazy_restore_resume(me);
+    me->cmd_next_execution_state = OPTIGA_CMD_EXEC_PREPARE_COMMAND;
+    me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_PREPARE_APDU;
+
+    if (NULL != me->p_optiga->power_event_handler) {
+        me->p_optiga->power_event_handler(
+            me->p_optiga->p_power_event_ctx,
+            OPTIGA_CMD_POWER_EVENT_RESTORED,
+            resume_latency
+        );
+    }
+}
+
+/*
+ * Handles a failed restore, the hibernated context is consumed and the application is closed
+ */
+_STATIC_H void optiga_cmd_lazy_restore_failed(optiga_cmd_t *me) {
+    if (TRUE == me->lazy_restore_ongoing) {
+        optiga_cmd_lazy_restore_resume(me);
+        me->p_optiga->power_state = OPTIGA_CMD_POWER_STATE_CLOSED;
+        if (NULL != me->p_optiga->power_event_handler) {
+            me->p_optiga->power_event_handler(
+                me->p_optiga->p_power_event_ctx,
+                OPTIGA_CMD_POWER_EVENT_RESTORE_FAILED,
+                (uint32_t)me->exit_status
+            );
+        }
+    }
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+/*
+ * Notifies the attached idle handler, if the application is open and no request is queued
+ * and no slot is processing or holding a strict lock
+ */
+_STATIC_H void optiga_cmd_idle_check(optiga_context_t *p_optiga_ctx) {
+    uint8_t index;
+    uint8_t free_session_count = 0;
+
+    p_optiga_ctx->idle_session_count = 0;
+    if ((NULL != p_optiga_ctx->idle_handler)
+        && (OPTIGA_CMD_POWER_STATE_ACTIVE == p_optiga_ctx->power_state)
+        && (0
+            == optiga_cmd_queue_get_count_of(
+                p_optiga_ctx,
+                OPTIGA_CMD_QUEUE_SLOT_STATE,
+                OPTIGA_CMD_QUEUE_REQUEST
+            ))
+        && (0
+            == optiga_cmd_queue_get_count_of(
+                p_optiga_ctx,
+                OPTIGA_CMD_QUEUE_SLOT_STATE,
+                OPTIGA_CMD_QUEUE_PROCESSING
+            ))
+        && (0
+            == optiga_cmd_queue_get_count_of(
+                p_optiga_ctx,
+                OPTIGA_CMD_QUEUE_SLOT_LOCK_TYPE,
+                OPTIGA_CMD_QUEUE_REQUEST_STRICT_LOCK
+            ))) {
+        for (index = 0; index < OPTIGA_CMD_MAX_NUMBER_OF_SESSIONS; index++) {
+            if (OPTIGA_CMD_SESSION_ASSIGNED != p_optiga_ctx->sessions[index]) {
+                free_session_count++;
+            }
+        }
+        p_optiga_ctx->idle_session_count = p_optiga_ctx->idle_handler(
+            p_optiga_ctx->p_idle_ctx,
+            OPTIGA_CMD_IDLE_EVENT_IDLE,
+            free_session_count
+        );
+    }
+}
+
+/*
+ * Notifies the attached idle handler about a release or open event
+ */
+_STATIC_H void optiga_cmd_idle_notify(optiga_context_t *p_optiga_ctx, uint8_t event) {
+    if (NULL != p_optiga_ctx->idle_handler) {
+        p_optiga_ctx->idle_session_count =
+            p_optiga_ctx->idle_handler(p_optiga_ctx->p_idle_ctx, event, 0);
+    }
+}
+
+/*
+ * Releases the sessions of the idle handler after the successfully processed OpenApplication without restore
+ * and CloseApplication without hibernate, as the keys in the sessions are lost. Notifies every successfully
+ * processed OpenApplication afterwards.
+ */
+_STATIC_H void optiga_cmd_idle_update_state(const optiga_cmd_t *me) {
+    if (((OPTIGA_CMD_OPEN_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))
+         || (OPTIGA_CMD_CLOSE_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)))
+        && (OPTIGA_CMD_PARAM_INITIALIZE_APP_CONTEXT == me->cmd_param)) {
+        optiga_cmd_idle_notify(me->p_optiga, OPTIGA_CMD_IDLE_EVENT_RELEASE);
+    }
+    if (OPTIGA_CMD_OPEN_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+        optiga_cmd_idle_notify(me->p_optiga, OPTIGA_CMD_IDLE_EVENT_OPEN);
+    }
+}
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+/*
+ * Notifies the attached load handler about the number of requests queued or processing
+ */
+_STATIC_H void optiga_cmd_load_check(const optiga_context_t *p_optiga_ctx) {
+    uint8_t queue_depth;
+
+    if (NULL != p_optiga_ctx->load_handler) {
+        queue_depth = optiga_cmd_queue_get_count_of(
+                          p_optiga_ctx,
+                          OPTIGA_CMD_QUEUE_SLOT_STATE,
+                          OPTIGA_CMD_QUEUE_REQUEST
+                      )
+                      + optiga_cmd_queue_get_count_of(
+                          p_optiga_ctx,
+                          OPTIGA_CMD_QUEUE_SLOT_STATE,
+                          OPTIGA_CMD_QUEUE_RESUME
+                      )
+                      + optiga_cmd_queue_get_count_of(
+                          p_optiga_ctx,
+                          OPTIGA_CMD_QUEUE_SLOT_STATE,
+                          OPTIGA_CMD_QUEUE_PROCESSING
+                      );
+        p_optiga_ctx->load_handler(
+            p_optiga_ctx->p_load_ctx,
+            OPTIGA_CMD_LOAD_EVENT_QUEUE_DEPTH,
+            0,
+            queue_depth
+        );
+    }
+}
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
+#ifdef OPTIGA_CMD_TIMER_ENABLED
+/*
+ * Invokes the registered one-shot callback, once its time elapsed
+ */
+_STATIC_H void optiga_cmd_timer_check(optiga_context_t *p_optiga_ctx) {
+    optiga_cmd_timer_handler_t handler = NULL;
+    void *p_ctx = NULL;
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_optiga_ctx->timer_handler)
+        && ((pal_os_timer_get_time_in_milliseconds() - p_optiga_ctx->timer_start_time)
+            >= p_optiga_ctx->timer_time_ms)) {
+        handler = p_optiga_ctx->timer_handler;
+        p_ctx = p_optiga_ctx->p_timer_ctx;
+        p_optiga_ctx->timer_handler = NULL;
+        p_optiga_ctx->p_timer_ctx = NULL;
+    }
+    pal_os_lock_exit_critical_section();
+    // The callback may register itself again
+    if (NULL != handler) {
+        handler(p_ctx);
+    }
+}
+#endif  // OPTIGA_CMD_TIMER_ENABLED
+
 /*
  * Select next optiga cmd instance from the execution queue based on a rule
  * 1. A slot with OPTIGA_CMD_QUEUE_RESUME state should exist
@@ -888,6 +1422,9 @@ _STATIC_H void optiga_cmd_queue_scheduler(void *p_optiga) {
 
     pal_os_event_t *my_os_event = p_optiga_ctx->p_pal_os_event_ctx;
 
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+    optiga_cmd_load_check(p_optiga_ctx);
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
     if (((0
           == optiga_cmd_queue_get_count_of(
               p_optiga_ctx,
@@ -911,6 +1448,17 @@ _STATIC_H void optiga_cmd_queue_scheduler(void *p_optiga) {
                     OPTIGA_CMD_QUEUE_SLOT_LOCK_TYPE,
                     OPTIGA_CMD_QUEUE_REQUEST_STRICT_LOCK
                 )))) {
+#ifdef OPTIGA_CMD_TIMER_ENABLED
+        optiga_cmd_timer_check(p_optiga_ctx);
+#endif  // OPTIGA_CMD_TIMER_ENABLED
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+        // Background operations first, a started operation defers the power idle check
+        optiga_cmd_idle_check(p_optiga_ctx);
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+        optiga_cmd_power_idle_check(p_optiga_ctx);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+        { extern unsigned dbg_sched_idle; dbg_sched_idle++; }
         // call self
         pal_os_event_register_callback_oneshot(
             my_os_event,
@@ -919,6 +1467,7 @@ _STATIC_H void optiga_cmd_queue_scheduler(void *p_optiga) {
             OPTIGA_CMD_SCHEDULER_IDLING_TIME_MS
         );
     } else {
+        { extern unsigned dbg_sched_busy; dbg_sched_busy++; }
         pal_os_event_stop(my_os_event);
         // continue checking if no context selected and overflow detected
         do {
@@ -1059,6 +1608,9 @@ _STATIC_H void optiga_cmd_queue_reset_slot(const optiga_cmd_t *me) {
     // set the slot state to assigned
     me->p_optiga->optiga_cmd_execution_queue[me->queue_id].state_of_entry =
         OPTIGA_CMD_QUEUE_ASSIGNED;
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    me->p_optiga->last_activity_time = pal_os_timer_get_time_in_milliseconds();
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
     // start the event scheduler
     pal_os_event_start(me->p_optiga->p_pal_os_event_ctx, optiga_cmd_queue_scheduler, me->p_optiga);
 }
@@ -1341,6 +1893,16 @@ _STATIC_H void optiga_cmd_execute_prepare_command(optiga_cmd_t *me, uint8_t *exi
             }
             case OPTIGA_CMD_EXEC_PREPARE_APDU: {
                 *exit_loop = TRUE;
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+                // Restore the hibernated application context before the command is sent
+                if ((NULL != me->p_optiga->power_event_handler)
+                    && (OPTIGA_CMD_POWER_STATE_HIBERNATED == me->p_optiga->power_state)
+                    && (OPTIGA_CMD_OPEN_APPLICATION != OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))) {
+                    optiga_cmd_lazy_restore_start(me);
+                    *exit_loop = FALSE;
+                    break;
+                }
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
                 me->exit_status = optiga_cmd_handler(me);
                 if (OPTIGA_LIB_SUCCESS != me->exit_status) {
                     me->cmd_next_execution_state = OPTIGA_CMD_EXEC_ERROR_HANDLER;
@@ -1354,6 +1916,9 @@ _STATIC_H void optiga_cmd_execute_prepare_command(optiga_cmd_t *me, uint8_t *exi
                 me->p_optiga->protection_level_state |= me->protection_level;
 #endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
                 (void)optiga_comms_set_callback_context(me->p_optiga->p_optiga_comms, me);
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+                me->transceive_start_time = pal_os_timer_get_time_in_microseconds();
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
                 me->exit_status = optiga_comms_transceive(
                     me->p_optiga->p_optiga_comms,
                     me->p_optiga->optiga_comms_buffer,
@@ -1378,6 +1943,27 @@ _STATIC_H void optiga_cmd_execute_prepare_command(optiga_cmd_t *me, uint8_t *exi
                 me->cmd_next_execution_state = OPTIGA_CMD_EXEC_PROCESS_RESPONSE;
                 me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_PROCESS_OPTIGA_RESPONSE;
                 SET_DEV_ERROR_NOTIFICATION(OPTIGA_CMD_ENTER_HANDLER_CALL);
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+                // Read the next fragment of a streamed hash while OPTIGA processes the current one
+                if (OPTIGA_CMD_CALC_HASH == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+                    optiga_cmd_calc_hash_stream_read_ahead(me);
+                }
+#endif
+#if (defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+     || defined(OPTIGA_CRYPT_HMAC_ENABLED)) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+                // Read the next fragment of a streamed symmetric operation while OPTIGA processes the current one
+                if ((OPTIGA_CMD_ENCRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))
+                    || (OPTIGA_CMD_DECRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))) {
+                    optiga_cmd_sym_stream_read_ahead(me);
+                }
+#endif
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+                // Read the next fragment of a streamed protected update while OPTIGA processes the current one
+                if (OPTIGA_CMD_SET_OBJECT_PROTECTED == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+                    optiga_cmd_set_object_protected_stream_read_ahead(me);
+                }
+#endif
                 break;
             }
             default:
@@ -1417,6 +2003,12 @@ _STATIC_H void optiga_cmd_execute_process_optiga_response(optiga_cmd_t *me, uint
             break;
         }
         if (OPTIGA_LIB_SUCCESS == me->exit_status) {
+#if defined(OPTIGA_UTIL_POWER_MANAGER_ENABLED) || defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED)
+            optiga_cmd_power_update_state(me);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED || OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+            optiga_cmd_idle_update_state(me);
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
             // After successful Close Application, change state to invoke optiga_comms_close
             if (OPTIGA_CMD_CLOSE_APPLICATION == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
                 pal_os_event_register_callback_oneshot(
@@ -1428,7 +2020,21 @@ _STATIC_H void optiga_cmd_execute_process_optiga_response(optiga_cmd_t *me, uint
                 *exit_loop = TRUE;
                 me->cmd_next_execution_state = OPTIGA_CMD_EXEC_COMMS_CLOSE;
                 me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_COMMS_CLOSE_START;
-            } else {
+            }
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+            // After successful restore, trigger preparing of the deferred command
+            else if (TRUE == me->lazy_restore_ongoing) {
+                optiga_cmd_lazy_restore_done(me);
+                pal_os_event_register_callback_oneshot(
+                    me->p_optiga->p_pal_os_event_ctx,
+                    (register_callback)optiga_cmd_event_trigger_execute,
+                    (void *)me,
+                    OPTIGA_CMD_SCHEDULER_RUNNING_TIME_MS
+                );
+                *exit_loop = TRUE;
+            }
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+            else {
                 if (FALSE == me->chaining_ongoing) {
                     if ((OPTIGA_CMD_STATE_EXIT != me->cmd_sub_execution_state)
                         && (OPTIGA_CMD_EXEC_RELEASE_SESSION != me->cmd_sub_execution_state)) {
@@ -1439,11 +2045,32 @@ _STATIC_H void optiga_cmd_execute_process_optiga_response(optiga_cmd_t *me, uint
                 }
                 // for chaining, trigger preparing of next command
                 else {
+                    uint32_t chaining_trigger_time = OPTIGA_CMD_SCHEDULER_IDLING_TIME_MS;
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+                    // Signature batch items are independent commands, the next item is sent without idling
+                    if (OPTIGA_CMD_CALC_SIGN == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+                        chaining_trigger_time = OPTIGA_CMD_SCHEDULER_RUNNING_TIME_MS;
+                    }
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+                    // Key schedule steps are independent commands, only chained by the key schedule
+                    if (OPTIGA_CMD_DERIVE_KEY == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+                        chaining_trigger_time = OPTIGA_CMD_SCHEDULER_RUNNING_TIME_MS;
+                    }
+#endif  // OPTIGA_CRYPT_ECDH_ENABLED && OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+                    // The next fragment of a streamed protected update is already read
+                    if (OPTIGA_CMD_SET_OBJECT_PROTECTED == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)) {
+                        chaining_trigger_time = OPTIGA_CMD_SCHEDULER_RUNNING_TIME_MS;
+                    }
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
                     pal_os_event_register_callback_oneshot(
                         me->p_optiga->p_pal_os_event_ctx,
                         (register_callback)optiga_cmd_event_trigger_execute,
                         (void *)me,
-                        OPTIGA_CMD_SCHEDULER_IDLING_TIME_MS
+                        chaining_trigger_time
                     );
                     *exit_loop = TRUE;
 
@@ -1457,13 +2084,26 @@ _STATIC_H void optiga_cmd_execute_process_optiga_response(optiga_cmd_t *me, uint
             }
         } else {
             // After OPTIGA error is analyzed, invoke upper layer handler and release lock
-            if (OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == me->exit_status) {
+            if ((OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == me->exit_status)
+#if (defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+     || defined(OPTIGA_CRYPT_HMAC_ENABLED)) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+                // The output of a streamed symmetric operation is rejected by the host
+                || (TRUE == optiga_cmd_sym_stream_is_failed(me))
+#endif
+            ) {
                 me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_RELEASE_LOCK;
                 *exit_loop = FALSE;
                 break;
             } else if (OPTIGA_CMD_EXEC_RELEASE_SESSION == me->cmd_sub_execution_state) {
                 *exit_loop = FALSE;
             }
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+            // The reader of a streamed protected update failed, the strict lock is kept to resume the stream
+            else if (TRUE == optiga_cmd_set_object_protected_stream_is_suspended(me)) {
+                *exit_loop = FALSE;
+            }
+#endif
             // After OPTIGA responds with failure, invoke the next state to check which error occurred
             else {
                 me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_GET_DEVICE_ERROR;
@@ -1478,6 +2118,17 @@ _STATIC_H void optiga_cmd_execute_process_response(optiga_cmd_t *me, uint8_t *ex
     do {
         switch (me->cmd_sub_execution_state) {
             case OPTIGA_CMD_EXEC_PROCESS_OPTIGA_RESPONSE: {
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+                if (NULL != me->p_optiga->load_handler) {
+                    me->p_optiga->load_handler(
+                        me->p_optiga->p_load_ctx,
+                        OPTIGA_CMD_LOAD_EVENT_COMMAND,
+                        (uint8_t)(OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)
+                                  & (uint8_t)(~OPTIGA_CMD_CLEAR_LAST_ERROR)),
+                        pal_os_timer_get_time_in_microseconds() - me->transceive_start_time
+                    );
+                }
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
                 optiga_cmd_execute_process_optiga_response(me, exit_loop);
                 break;
             }
@@ -1536,6 +2187,10 @@ _STATIC_H void optiga_cmd_execute_handler(void *p_ctx, optiga_lib_status_t event
 #ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
         optiga_cmd_clear_app_ctx(p_ctx);
 #endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+        // OPTIGA may be reset by the recovery of the failed transceive
+        optiga_cmd_idle_notify(me->p_optiga, OPTIGA_CMD_IDLE_EVENT_RELEASE);
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
         me->cmd_next_execution_state = OPTIGA_CMD_EXEC_ERROR_HANDLER;
         me->exit_status = event;
     }
@@ -1559,6 +2214,9 @@ _STATIC_H void optiga_cmd_execute_handler(void *p_ctx, optiga_lib_status_t event
                 break;
             }
             case OPTIGA_CMD_EXEC_ERROR_HANDLER: {
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+                optiga_cmd_lazy_restore_failed(me);
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
                 optiga_cmd_execute_error_handler(me, &exit_loop);
                 break;
             }
@@ -1645,6 +2303,30 @@ optiga_lib_status_t optiga_cmd_destroy(optiga_cmd_t *me) {
                     optiga_comms_destroy(me->p_optiga->p_optiga_comms);
                     me->p_optiga->p_optiga_comms = NULL;
                     pal_os_event_destroy(me->p_optiga->p_pal_os_event_ctx);
+#if defined(OPTIGA_UTIL_POWER_MANAGER_ENABLED) || defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED)
+                    me->p_optiga->power_state = OPTIGA_CMD_POWER_STATE_CLOSED;
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED || OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+                    me->p_optiga->power_event_handler = NULL;
+                    me->p_optiga->p_power_event_ctx = NULL;
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+                    me->p_optiga->idle_handler = NULL;
+                    me->p_optiga->p_idle_ctx = NULL;
+                    me->p_optiga->idle_session_count = 0;
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+                    me->p_optiga->load_handler = NULL;
+                    me->p_optiga->p_load_ctx = NULL;
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+                    pal_os_memset(
+                        me->p_optiga->write_handlers,
+                        0x00,
+                        sizeof(me->p_optiga->write_handlers)
+                    );
+                    pal_os_memset(me->p_optiga->p_write_ctx, 0x00, sizeof(me->p_optiga->p_write_ctx));
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
                 }
             }
 
@@ -1774,6 +2456,9 @@ _STATIC_H optiga_lib_status_t optiga_cmd_open_application_handler(optiga_cmd_t *
     switch ((uint8_t)me->cmd_next_execution_state) {
         case OPTIGA_CMD_EXEC_PREPARE_COMMAND: {
             OPTIGA_CMD_LOG_MESSAGE("Sending open app command...");
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+            optiga_cmd_notify_write(me, OPTIGA_CMD_WRITE_ACCESS_STATE);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
 
             total_apdu_length =
                 OPTIGA_CMD_APDU_HEADER_SIZE + sizeof(g_optiga_unique_application_identifier);
@@ -1895,6 +2580,9 @@ _STATIC_H optiga_lib_status_t optiga_cmd_close_application_handler(optiga_cmd_t
     switch ((uint8_t)me->cmd_next_execution_state) {
         case OPTIGA_CMD_EXEC_PREPARE_COMMAND: {
             OPTIGA_CMD_LOG_MESSAGE("Sending close app command..");
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+            optiga_cmd_notify_write(me, OPTIGA_CMD_WRITE_ACCESS_STATE);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
 
             total_apdu_length = OPTIGA_CMD_APDU_HEADER_SIZE;
             // lint --e{774} suppress "If OPTIGA_MAX_COMMS_BUFFER_SIZE is set to lesser value it will fail"
@@ -1967,6 +2655,200 @@ optiga_cmd_close_application(optiga_cmd_t *me, uint8_t cmd_param, void *params)
     return (OPTIGA_LIB_SUCCESS);
 }
 
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+optiga_lib_status_t optiga_cmd_power_manager_attach(
+    optiga_cmd_t *me,
+    optiga_cmd_power_event_handler_t handler,
+    void *p_ctx
+) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+
+    pal_os_lock_enter_critical_section();
+    do {
+        if ((NULL != handler) && (NULL != me->p_optiga->power_event_handler)) {
+            break;
+        }
+        me->p_optiga->power_event_handler = handler;
+        me->p_optiga->p_power_event_ctx = ((NULL != handler) ? (p_ctx) : (NULL));
+        me->p_optiga->last_activity_time = pal_os_timer_get_time_in_milliseconds();
+        return_status = OPTIGA_CMD_SUCCESS;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+
+optiga_lib_status_t optiga_cmd_power_hibernate_request(optiga_cmd_t *me) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+
+    pal_os_lock_enter_critical_section();
+    do {
+        if (OPTIGA_CMD_QUEUE_ASSIGNED
+            != me->p_optiga->optiga_cmd_execution_queue[me->queue_id].state_of_entry) {
+            break;
+        }
+        // Same state as after the lock request of optiga_cmd_close_application,
+        // the scheduler picks up the request like any other queued command
+        me->p_input = NULL;
+        me->cmd_next_execution_state = OPTIGA_CMD_EXEC_PREPARE_COMMAND;
+        me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_PREPARE_APDU;
+        me->cmd_hdlrs = optiga_cmd_close_application_handler;
+        me->chaining_ongoing = FALSE;
+        me->cmd_param = (uint8_t)TRUE;
+        // lint --e{835} suppress "Upper 8 bits of apdu_data is kept as zero and is reserved for future enhancements"
+        me->apdu_data =
+            OPTIGA_CMD_SET_APDU_DATA(OPTIGA_CMD_CLOSE_APPLICATION, OPTIGA_CMD_ZERO_LENGTH_OR_VALUE);
+        me->lazy_restore_ongoing = FALSE;
+        optiga_cmd_queue_update_slot(me, OPTIGA_CMD_QUEUE_REQUEST_LOCK);
+        return_status = OPTIGA_CMD_SUCCESS;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+    // The sessions of background operations are not kept across the hibernation
+    if (OPTIGA_CMD_SUCCESS == return_status) {
+        optiga_cmd_idle_notify(me->p_optiga, OPTIGA_CMD_IDLE_EVENT_RELEASE);
+    }
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+    return (return_status);
+}
+
+uint8_t optiga_cmd_get_power_state(const optiga_cmd_t *me) {
+    return (me->p_optiga->power_state);
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+optiga_lib_status_t
+optiga_cmd_idle_handler_attach(optiga_cmd_t *me, optiga_cmd_idle_handler_t handler, void *p_ctx) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+
+    pal_os_lock_enter_critical_section();
+    do {
+        if ((NULL != handler) && (NULL != me->p_optiga->idle_handler)) {
+            break;
+        }
+        me->p_optiga->idle_handler = handler;
+        me->p_optiga->p_idle_ctx = ((NULL != handler) ? (p_ctx) : (NULL));
+        return_status = OPTIGA_CMD_SUCCESS;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+
+optiga_lib_status_t optiga_cmd_session_transfer(optiga_cmd_t *p_source, optiga_cmd_t *p_target) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+
+    pal_os_lock_enter_critical_section();
+    if ((OPTIGA_CMD_NO_SESSION_OID != p_source->session_oid)
+        && (OPTIGA_CMD_NO_SESSION_OID == p_target->session_oid)) {
+        p_target->session_oid = p_source->session_oid;
+        p_source->session_oid = OPTIGA_CMD_NO_SESSION_OID;
+        return_status = OPTIGA_CMD_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+optiga_lib_status_t
+optiga_cmd_write_handler_attach(optiga_cmd_t *me, optiga_cmd_write_handler_t handler, void *p_ctx) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT;
+    uint8_t free_index = OPTIGA_CMD_MAX_WRITE_HANDLERS;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_CMD_MAX_WRITE_HANDLERS; index++) {
+        if (handler == me->p_optiga->write_handlers[index]) {
+            return_status = OPTIGA_CMD_ERROR;
+            break;
+        }
+        if ((NULL == me->p_optiga->write_handlers[index])
+            && (OPTIGA_CMD_MAX_WRITE_HANDLERS == free_index)) {
+            free_index = index;
+        }
+    }
+    if ((OPTIGA_CMD_ERROR != return_status) && (OPTIGA_CMD_MAX_WRITE_HANDLERS != free_index)) {
+        me->p_optiga->write_handlers[free_index] = handler;
+        me->p_optiga->p_write_ctx[free_index] = p_ctx;
+        return_status = OPTIGA_CMD_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+
+optiga_lib_status_t
+optiga_cmd_write_handler_detach(optiga_cmd_t *me, optiga_cmd_write_handler_t handler) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_CMD_MAX_WRITE_HANDLERS; index++) {
+        if ((NULL != handler) && (handler == me->p_optiga->write_handlers[index])) {
+            me->p_optiga->write_handlers[index] = NULL;
+            me->p_optiga->p_write_ctx[index] = NULL;
+            return_status = OPTIGA_CMD_SUCCESS;
+            break;
+        }
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+
+_STATIC_H void optiga_cmd_notify_write(const optiga_cmd_t *me, uint16_t oid) {
+    uint8_t index;
+
+    for (index = 0; index < OPTIGA_CMD_MAX_WRITE_HANDLERS; index++) {
+        if (NULL != me->p_optiga->write_handlers[index]) {
+            me->p_optiga->write_handlers[index](me->p_optiga->p_write_ctx[index], oid);
+        }
+    }
+}
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
+
+#ifdef OPTIGA_CMD_TIMER_ENABLED
+optiga_lib_status_t optiga_cmd_register_callback_oneshot(
+    optiga_cmd_t *me,
+    optiga_cmd_timer_handler_t handler,
+    void *p_ctx,
+    uint32_t time_ms
+) {
+    pal_os_lock_enter_critical_section();
+    me->p_optiga->timer_handler = handler;
+    me->p_optiga->p_timer_ctx = ((NULL != handler) ? (p_ctx) : (NULL));
+    me->p_optiga->timer_start_time = pal_os_timer_get_time_in_milliseconds();
+    me->p_optiga->timer_time_ms = time_ms;
+    pal_os_lock_exit_critical_section();
+
+    return (OPTIGA_CMD_SUCCESS);
+}
+#endif  // OPTIGA_CMD_TIMER_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+optiga_lib_status_t
+optiga_cmd_load_handler_attach(optiga_cmd_t *me, optiga_cmd_load_handler_t handler, void *p_ctx) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR;
+
+    pal_os_lock_enter_critical_section();
+    do {
+        if ((NULL != handler) && (NULL != me->p_optiga->load_handler)) {
+            break;
+        }
+        me->p_optiga->load_handler = handler;
+        me->p_optiga->p_load_ctx = ((NULL != handler) ? (p_ctx) : (NULL));
+        return_status = OPTIGA_CMD_SUCCESS;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+
+    return (return_status);
+}
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
 /*
  * Get Data Object handler
  */
@@ -2130,6 +3012,9 @@ _STATIC_H optiga_lib_status_t optiga_cmd_set_data_object_handler(optiga_cmd_t *m
         case OPTIGA_CMD_EXEC_PREPARE_COMMAND: {
             OPTIGA_CMD_LOG_MESSAGE("Sending set data command...");
             me->chaining_ongoing = FALSE;
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+            optiga_cmd_notify_write(me, p_optiga_write_data->oid);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
             // oid
             optiga_common_set_uint16(
                 &me->p_optiga->optiga_comms_buffer[index_for_data],
@@ -2353,6 +3238,34 @@ optiga_cmd_get_random(optiga_cmd_t *me, uint8_t cmd_param, optiga_get_random_par
 #endif  // OPTIGA_CRYPT_RANDOM_ENABLED
 
 #if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) || defined(OPTIGA_CRYPT_RSA_SIGN_ENABLED)
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+/*
+ * Reports the signed batch item and selects the next one, the lock is kept until the last item is signed
+ */
+_STATIC_H void
+optiga_cmd_calc_sign_batch_next(optiga_cmd_t *me, optiga_calc_sign_params_t *p_optiga_calc_sign) {
+    optiga_calc_sign_batch_t *p_batch = &p_optiga_calc_sign->batch;
+
+    if (OPTIGA_CMD_ZERO_LENGTH_OR_VALUE != p_batch->item_count) {
+        if (NULL != p_batch->item_handler) {
+            p_batch->item_handler(
+                p_batch->p_item_handler_ctx,
+                p_batch->item_index,
+                OPTIGA_LIB_SUCCESS
+            );
+        }
+        p_batch->item_index++;
+        if (p_batch->item_index < p_batch->item_count) {
+            p_optiga_calc_sign->p_digest = p_batch->p_digests[p_batch->item_index];
+            p_optiga_calc_sign->p_signature = p_batch->p_signatures[p_batch->item_index];
+            p_optiga_calc_sign->p_signature_length =
+                &p_batch->p_signature_lengths[p_batch->item_index];
+            me->chaining_ongoing = TRUE;
+        }
+    }
+}
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
 /*
  * CalcSign handler
  */
@@ -2422,6 +3335,7 @@ _STATIC_H optiga_lib_status_t optiga_cmd_calc_sign_handler(optiga_cmd_t *me) {
         } break;
         case OPTIGA_CMD_EXEC_PROCESS_RESPONSE: {
             OPTIGA_CMD_LOG_MESSAGE("Processing response for calculate sign command...");
+            me->chaining_ongoing = FALSE;
             // check if the calculate signature command was successful
             if (OPTIGA_CMD_APDU_SUCCESS
                 == me->p_optiga->optiga_comms_buffer[OPTIGA_COMMS_DATA_OFFSET]) {
@@ -2448,6 +3362,9 @@ _STATIC_H optiga_lib_status_t optiga_cmd_calc_sign_handler(optiga_cmd_t *me) {
                     optiga_cmd_ecc_r_s_padding_check(p_signature, p_signature_length);
 
                     OPTIGA_CMD_LOG_MESSAGE("Response of calculate sign command is processed...");
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+                    optiga_cmd_calc_sign_batch_next(me, p_optiga_calc_sign);
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
                     return_status = OPTIGA_LIB_SUCCESS;
                 }
             } else {
@@ -3060,6 +3977,92 @@ optiga_cmd_derive_key(optiga_cmd_t *me, uint8_t cmd_param, optiga_derive_key_par
 }
 #endif  //(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || (OPTIGA_CRYPT_HKDF_ENABLED)
 
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+/*
+ * Key schedule handler, the shared secret calculation and each key derivation step are processed
+ * by their own handlers and chained without releasing the lock
+ */
+_STATIC_H optiga_lib_status_t optiga_cmd_key_schedule_handler(optiga_cmd_t *me) {
+    optiga_lib_status_t return_status;
+    optiga_key_schedule_params_t *p_key_schedule = (optiga_key_schedule_params_t *)me->p_input;
+    const optiga_key_schedule_step_t *p_step;
+
+    if (OPTIGA_CMD_ZERO_LENGTH_OR_VALUE == p_key_schedule->step_index) {
+        me->p_input = &p_key_schedule->calc_ssec;
+        return_status = optiga_cmd_calc_ssec_handler(me);
+    } else {
+        me->p_input = &p_key_schedule->derive_key;
+        return_status = optiga_cmd_derive_key_handler(me);
+    }
+    me->p_input = p_key_schedule;
+
+    if (OPTIGA_CMD_EXEC_PROCESS_RESPONSE == me->cmd_next_execution_state) {
+        me->chaining_ongoing = FALSE;
+        if ((OPTIGA_LIB_SUCCESS == return_status)
+            && (p_key_schedule->step_index < p_key_schedule->step_count)) {
+            // Select the next key derivation step, which derives from the session OID
+            p_step = &p_key_schedule->p_steps[p_key_schedule->step_index];
+            p_key_schedule->derive_key.input_shared_secret_oid =
+                (uint16_t)OPTIGA_KEY_ID_SESSION_BASED;
+            p_key_schedule->derive_key.random_data = p_step->random_data;
+            p_key_schedule->derive_key.random_data_length = p_step->random_data_length;
+            p_key_schedule->derive_key.label = p_step->label;
+            p_key_schedule->derive_key.label_length = p_step->label_length;
+            p_key_schedule->derive_key.info = p_step->info;
+            p_key_schedule->derive_key.info_length = p_step->info_length;
+            p_key_schedule->derive_key.derived_key = p_step->derived_key;
+            p_key_schedule->derive_key.derived_key_length = p_step->derived_key_length;
+            p_key_schedule->step_index++;
+
+            me->cmd_param = p_step->derivation_type;
+            // lint --e{835} suppress "Upper 8 bits of apdu_data is kept as zero and is reserved for future enhancements"
+            me->apdu_data =
+                OPTIGA_CMD_SET_APDU_DATA(OPTIGA_CMD_DERIVE_KEY, OPTIGA_CMD_ZERO_LENGTH_OR_VALUE);
+            me->chaining_ongoing = TRUE;
+        }
+    }
+
+    return (return_status);
+}
+
+optiga_lib_status_t optiga_cmd_key_schedule(
+    optiga_cmd_t *me,
+    uint8_t cmd_param,
+    optiga_key_schedule_params_t *params
+) {
+    optiga_lib_status_t return_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+    OPTIGA_CMD_LOG_MESSAGE(__FUNCTION__);
+
+    do {
+        if ((OPTIGA_KEY_ID_SESSION_BASED == params->calc_ssec.private_key)
+            && (OPTIGA_CMD_ZERO_LENGTH_OR_VALUE == me->session_oid)) {
+            break;
+        }
+        // The shared secret and the intermediate keys are never exported
+        params->calc_ssec.export_to_host = FALSE;
+        params->step_index = OPTIGA_CMD_ZERO_LENGTH_OR_VALUE;
+
+        optiga_cmd_execute(
+            me,
+            cmd_param,
+            optiga_cmd_key_schedule_handler,
+            OPTIGA_CMD_EXEC_PREPARE_COMMAND,
+            OPTIGA_CMD_EXEC_REQUEST_SESSION,
+            params,
+            // lint --e{835} suppress "Upper 8 bits of apdu_data is kept as zero and is reserved for future enhancements"
+            OPTIGA_CMD_SET_APDU_DATA(OPTIGA_CMD_CALC_SSEC, OPTIGA_CMD_ZERO_LENGTH_OR_VALUE)
+        );
+
+        return_status = OPTIGA_LIB_SUCCESS;
+
+    } while (FALSE);
+
+    return (return_status);
+}
+#endif  // OPTIGA_CRYPT_ECDH_ENABLED && OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+
 #if defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED) \
     || defined(OPTIGA_CRYPT_RSA_GENERATE_KEYPAIR_ENABLED)
 
@@ -3674,7 +4677,8 @@ _STATIC_H void optiga_cmd_calc_hash_set_current_hash_sequence(const optiga_cmd_t
     p_optiga_calc_hash->current_hash_sequence = p_optiga_calc_hash->hash_sequence;
 
     // Check for hash sequence as S&F
-    if (OPTIGA_CRYPT_HASH_START_FINAL == p_optiga_calc_hash->hash_sequence) {
+    if ((OPTIGA_CRYPT_HASH_START_FINAL == p_optiga_calc_hash->hash_sequence)
+        && (NULL != p_optiga_calc_hash->p_hash_data)) {
         // Calculate the apparent comms buffer size and compare with hash data length
         if (apparent_comms_buffer_size < p_optiga_calc_hash->p_hash_data->length) {
             // sent data is 0 hence change the hash sequence to S
@@ -3707,6 +4711,52 @@ _STATIC_H uint16_t optiga_cmd_check_hash_alg_length(uint8_t algo_identifier) {
     return hash_output_len;
 }
 
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+// Maximum data of a streamed hash sent in one CalcHash command
+#define OPTIGA_CMD_HASH_STREAM_MAX_FRAGMENT_SIZE \
+    (OPTIGA_MAX_COMMS_BUFFER_SIZE \
+     - (OPTIGA_CMD_APDU_INDATA_OFFSET + OPTIGA_CMD_HASH_HEADER_SIZE + OPTIGA_CMD_INTERMEDIATE_CONTEXT_HEADER))
+
+_STATIC_H void optiga_cmd_calc_hash_stream_read(optiga_calc_hash_params_t *p_optiga_calc_hash) {
+    const hash_data_stream_t *p_hash_stream = p_optiga_calc_hash->p_hash_stream;
+    uint32_t fragment_length;
+    uint16_t read_length;
+
+    fragment_length =
+        MIN(MIN(p_hash_stream->buffer_length, OPTIGA_CMD_HASH_STREAM_MAX_FRAGMENT_SIZE),
+            (p_hash_stream->length - p_optiga_calc_hash->stream_read_length));
+
+    while ((OPTIGA_LIB_SUCCESS == p_optiga_calc_hash->stream_read_status)
+           && (p_optiga_calc_hash->stream_buffered_length < fragment_length)) {
+        read_length = 0;
+        p_optiga_calc_hash->stream_read_status = p_hash_stream->reader(
+            p_hash_stream->p_stream_ctx,
+            p_hash_stream->p_buffer + p_optiga_calc_hash->stream_buffered_length,
+            (uint16_t)(fragment_length - p_optiga_calc_hash->stream_buffered_length),
+            &read_length
+        );
+        // Stream ended before the specified length or the reader exceeded the buffer
+        if ((OPTIGA_LIB_SUCCESS == p_optiga_calc_hash->stream_read_status)
+            && ((0U == read_length)
+                || (read_length > (fragment_length - p_optiga_calc_hash->stream_buffered_length)))) {
+            p_optiga_calc_hash->stream_read_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+        }
+        if (OPTIGA_LIB_SUCCESS == p_optiga_calc_hash->stream_read_status) {
+            p_optiga_calc_hash->stream_buffered_length += read_length;
+            p_optiga_calc_hash->stream_read_length += read_length;
+        }
+    }
+}
+
+_STATIC_H void optiga_cmd_calc_hash_stream_read_ahead(const optiga_cmd_t *me) {
+    optiga_calc_hash_params_t *p_optiga_calc_hash = (optiga_calc_hash_params_t *)me->p_input;
+
+    if ((NULL != p_optiga_calc_hash->p_hash_stream) && (TRUE == me->chaining_ongoing)) {
+        optiga_cmd_calc_hash_stream_read(p_optiga_calc_hash);
+    }
+}
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
+
 /*
  * CalCHash handler
  */
@@ -3726,6 +4776,52 @@ _STATIC_H optiga_lib_status_t optiga_cmd_calc_hash_handler(optiga_cmd_t *me) {
             me->chaining_ongoing = FALSE;
 
             // add data if available
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+            if (NULL != p_optiga_calc_hash->p_hash_stream) {
+                // The first fragment is read here, the next ones while the previous one is processed
+                if (0U == p_optiga_calc_hash->stream_buffered_length) {
+                    optiga_cmd_calc_hash_stream_read(p_optiga_calc_hash);
+                }
+                if (OPTIGA_LIB_SUCCESS != p_optiga_calc_hash->stream_read_status) {
+                    return_status = p_optiga_calc_hash->stream_read_status;
+                    break;
+                }
+                length_to_hash = p_optiga_calc_hash->stream_buffered_length;
+
+                if (0U == p_optiga_calc_hash->data_sent) {
+                    p_optiga_calc_hash->current_hash_sequence =
+                        ((length_to_hash == p_optiga_calc_hash->p_hash_stream->length)
+                             ? OPTIGA_CRYPT_HASH_START_FINAL
+                             : OPTIGA_CRYPT_HASH_START);
+                } else {
+                    p_optiga_calc_hash->current_hash_sequence =
+                        (((p_optiga_calc_hash->data_sent + length_to_hash)
+                          == p_optiga_calc_hash->p_hash_stream->length)
+                             ? OPTIGA_CRYPT_HASH_FINAL
+                             : OPTIGA_CRYPT_HASH_CONTINUE);
+                }
+                *(me->p_optiga->optiga_comms_buffer + index_for_data++) =
+                    p_optiga_calc_hash->current_hash_sequence;
+                optiga_common_set_uint16(
+                    (me->p_optiga->optiga_comms_buffer + index_for_data),
+                    (uint16_t)length_to_hash
+                );
+                index_for_data += OPTIGA_CMD_UINT16_SIZE_IN_BYTES;
+
+                pal_os_memcpy(
+                    me->p_optiga->optiga_comms_buffer + index_for_data,
+                    p_optiga_calc_hash->p_hash_stream->p_buffer,
+                    length_to_hash
+                );
+                index_for_data += length_to_hash;
+
+                p_optiga_calc_hash->data_sent += length_to_hash;
+                p_optiga_calc_hash->stream_buffered_length = 0;
+                if (p_optiga_calc_hash->data_sent != p_optiga_calc_hash->p_hash_stream->length) {
+                    me->chaining_ongoing = TRUE;
+                }
+            } else
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
             if (NULL != p_optiga_calc_hash->p_hash_data) {
                 // lint --e{734} suppress "length_to_hash parameter is of uint16 type, while the arguments used for
                 // calculating are of uint32 type. The final value calculated never crosses uint16 max value and for
@@ -3843,6 +4939,16 @@ _STATIC_H optiga_lib_status_t optiga_cmd_calc_hash_handler(optiga_cmd_t *me) {
                 SET_DEV_ERROR_NOTIFICATION(OPTIGA_CMD_EXIT_HANDLER_CALL);
                 break;
             }
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+            if ((NULL != p_optiga_calc_hash->p_hash_stream)
+                && (NULL != p_optiga_calc_hash->p_hash_stream->progress_handler)) {
+                p_optiga_calc_hash->p_hash_stream->progress_handler(
+                    p_optiga_calc_hash->p_hash_stream->p_stream_ctx,
+                    p_optiga_calc_hash->data_sent,
+                    p_optiga_calc_hash->p_hash_stream->length
+                );
+            }
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
             // Copy the digest to buffer, if chaining is false and digest out buffer is not NULL
             if ((FALSE == me->chaining_ongoing) && (NULL != p_optiga_calc_hash->p_out_digest)) {
                 // If the out data tag is not the digest out then return failure
@@ -3911,6 +5017,11 @@ optiga_cmd_calc_hash(optiga_cmd_t *me, uint8_t cmd_param, optiga_calc_hash_param
     OPTIGA_CMD_LOG_MESSAGE(__FUNCTION__);
 
     p_optiga_calc_hash->data_sent = 0;
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+    p_optiga_calc_hash->stream_read_length = 0;
+    p_optiga_calc_hash->stream_buffered_length = 0;
+    p_optiga_calc_hash->stream_read_status = OPTIGA_LIB_SUCCESS;
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
 
     optiga_cmd_execute(
         me,
@@ -3949,6 +5060,12 @@ _STATIC_H optiga_lib_status_t optiga_cmd_enc_dec_sym_handler(optiga_cmd_t *me) {
     switch ((uint8_t)me->cmd_next_execution_state) {
         case OPTIGA_CMD_EXEC_PREPARE_COMMAND: {
             OPTIGA_CMD_LOG_MESSAGE("Sending symmetric encrypt/decrypt command..");
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+            if (OPTIGA_CMD_OPERATION_MODE_CLEAR_AUTO_STATE
+                == p_optiga_sym_enc_dec_params->operation_mode) {
+                optiga_cmd_notify_write(me, OPTIGA_CMD_WRITE_ACCESS_STATE);
+            }
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
 
             /// Calculate length of data to be send
             in_data_length =
@@ -3962,6 +5079,14 @@ _STATIC_H optiga_lib_status_t optiga_cmd_enc_dec_sym_handler(optiga_cmd_t *me) {
             }
             max_packet_length =
                 optiga_cmd_sym_get_max_packet_length(p_optiga_sym_enc_dec_params, in_data_length);
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+            if (NULL != p_optiga_sym_enc_dec_params->p_sym_stream) {
+                max_packet_length = optiga_cmd_sym_stream_get_max_packet_length(
+                    p_optiga_sym_enc_dec_params,
+                    max_packet_length
+                );
+            }
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
             /// If the mode is HMAC compare the input_data_length and maximum_packet_length
             if ((TRUE == OPTIGA_CMD_IS_MODE_HMAC(p_optiga_sym_enc_dec_params->mode)
                  && (OPTIGA_CMD_DECRYPT_SYM == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data)))) {
@@ -4030,6 +5155,23 @@ _STATIC_H optiga_lib_status_t optiga_cmd_enc_dec_sym_handler(optiga_cmd_t *me) {
             }
             index_for_data += OPTIGA_CMD_UINT16_SIZE_IN_BYTES;
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+            if (NULL != p_optiga_sym_enc_dec_params->p_sym_stream) {
+                // The first fragment is read here, the next ones while the previous one is processed
+                optiga_cmd_sym_stream_read(p_optiga_sym_enc_dec_params, length_to_send);
+                if (OPTIGA_LIB_SUCCESS != p_optiga_sym_enc_dec_params->stream_status) {
+                    return_status = p_optiga_sym_enc_dec_params->stream_status;
+                    break;
+                }
+                pal_os_memcpy(
+                    me->p_optiga->optiga_comms_buffer + index_for_data,
+                    p_optiga_sym_enc_dec_params->p_sym_stream->p_buffer,
+                    length_to_send
+                );
+                index_for_data += length_to_send;
+                p_optiga_sym_enc_dec_params->stream_buffered_length = 0;
+            } else
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
             if (NULL != p_optiga_sym_enc_dec_params->in_data) {
                 pal_os_memcpy(
                     me->p_optiga->optiga_comms_buffer + index_for_data,
@@ -4173,6 +5315,23 @@ _STATIC_H optiga_lib_status_t optiga_cmd_enc_dec_sym_handler(optiga_cmd_t *me) {
                         &response_data_length
                     );
                 }
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+                if (NULL != p_optiga_sym_enc_dec_params->p_sym_stream) {
+                    return_status = optiga_cmd_sym_stream_write(
+                        me,
+                        p_optiga_sym_enc_dec_params,
+                        &me->p_optiga->optiga_comms_buffer
+                             [(OPTIGA_CMD_APDU_INDATA_OFFSET + OPTIGA_CMD_UINT16_SIZE_IN_BYTES
+                               + OPTIGA_CMD_NO_OF_BYTES_IN_TAG)],
+                        response_data_length
+                    );
+                    if (OPTIGA_LIB_SUCCESS != return_status) {
+                        p_optiga_sym_enc_dec_params->stream_status = return_status;
+                        break;
+                    }
+                    p_optiga_sym_enc_dec_params->received_data_length += response_data_length;
+                } else
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
                 // check if output buffer is available
                 if ((NULL != p_optiga_sym_enc_dec_params->out_data_length)
                     && (NULL != p_optiga_sym_enc_dec_params->out_data)) {
@@ -4252,6 +5411,12 @@ optiga_cmd_encrypt_sym(optiga_cmd_t *me, uint8_t cmd_param, optiga_encrypt_sym_p
     params->sent_data_length = 0;
     params->current_sequence = OPTIGA_CMD_RESET_SEQUENCE;
     params->received_data_length = 0;
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    params->stream_read_length = 0;
+    params->stream_buffered_length = 0;
+    params->stream_status = OPTIGA_LIB_SUCCESS;
+    params->stream_start_time = pal_os_timer_get_time_in_milliseconds();
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 
     if ((OPTIGA_KEY_ID_SESSION_BASED == (optiga_key_id_t)params->symmetric_key_oid)
         && (OPTIGA_CMD_ZERO_LENGTH_OR_VALUE == me->session_oid)
@@ -4336,6 +5501,12 @@ optiga_cmd_decrypt_sym(optiga_cmd_t *me, uint8_t cmd_param, optiga_decrypt_sym_p
     params->sent_data_length = 0;
     params->current_sequence = OPTIGA_CMD_RESET_SEQUENCE;
     params->received_data_length = 0;
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    params->stream_read_length = 0;
+    params->stream_buffered_length = 0;
+    params->stream_status = OPTIGA_LIB_SUCCESS;
+    params->stream_start_time = pal_os_timer_get_time_in_milliseconds();
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 
     // No session is acquired by instance and mode is HMAC
     if ((OPTIGA_CMD_ZERO_LENGTH_OR_VALUE == me->session_oid)
@@ -4388,6 +5559,75 @@ optiga_cmd_decrypt_sym(optiga_cmd_t *me, uint8_t cmd_param, optiga_decrypt_sym_p
 }
 #endif  //(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) || (OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+_STATIC_H void
+optiga_cmd_set_object_protected_stream_read(optiga_set_object_protected_params_t *p_params) {
+    const protected_update_data_stream_t *p_stream = p_params->p_stream;
+    uint32_t fragment_length;
+    uint16_t read_length;
+
+    fragment_length = MIN(
+        OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE,
+        (p_stream->length - p_params->stream_sent_length)
+    );
+
+    while ((OPTIGA_LIB_SUCCESS == p_params->stream_read_status)
+           && (p_params->stream_buffered_length < fragment_length)) {
+        read_length = 0;
+        p_params->stream_read_status = p_stream->reader(
+            p_stream->p_stream_ctx,
+            p_params->stream_sent_length + p_params->stream_buffered_length,
+            p_stream->p_buffer + p_params->stream_buffered_length,
+            (uint16_t)(fragment_length - p_params->stream_buffered_length),
+            &read_length
+        );
+        // Stream ended before the specified length or the reader exceeded the buffer
+        if ((OPTIGA_LIB_SUCCESS == p_params->stream_read_status)
+            && ((0U == read_length)
+                || (read_length > (fragment_length - p_params->stream_buffered_length)))) {
+            p_params->stream_read_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
+        }
+        if (OPTIGA_LIB_SUCCESS == p_params->stream_read_status) {
+            p_params->stream_buffered_length += read_length;
+        }
+    }
+}
+
+_STATIC_H void optiga_cmd_set_object_protected_stream_read_ahead(const optiga_cmd_t *me) {
+    optiga_set_object_protected_params_t *p_params =
+        (optiga_set_object_protected_params_t *)me->p_input;
+
+    if ((NULL != p_params->p_stream) && (TRUE == me->chaining_ongoing)) {
+        optiga_cmd_set_object_protected_stream_read(p_params);
+    }
+}
+
+/*
+ * Reads the fragment of a suspended stream again, before the stream is resumed
+ */
+_STATIC_H optiga_lib_status_t
+optiga_cmd_set_object_protected_stream_resume(optiga_set_object_protected_params_t *p_params) {
+    if ((OPTIGA_SET_PROTECTED_UPDATE_CONTINUE == p_params->set_obj_protected_tag)
+        && (OPTIGA_LIB_SUCCESS != p_params->stream_read_status)) {
+        p_params->stream_read_status = OPTIGA_LIB_SUCCESS;
+        optiga_cmd_set_object_protected_stream_read(p_params);
+    }
+    return (p_params->stream_read_status);
+}
+
+_STATIC_H bool_t optiga_cmd_set_object_protected_stream_is_suspended(const optiga_cmd_t *me) {
+    const optiga_set_object_protected_params_t *p_params =
+        (const optiga_set_object_protected_params_t *)me->p_input;
+
+    return (
+        ((OPTIGA_CMD_SET_OBJECT_PROTECTED == OPTIGA_CMD_GET_APDU_CMD(me->apdu_data))
+         && (NULL != p_params->p_stream) && (OPTIGA_CMD_STATE_EXIT == me->cmd_sub_execution_state))
+            ? TRUE
+            : FALSE
+    );
+}
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 /*
  * Set Data Object handler for protected update
  */
@@ -4402,6 +5642,26 @@ _STATIC_H optiga_lib_status_t optiga_cmd_set_object_protected_handler(optiga_cmd
         case OPTIGA_CMD_EXEC_PREPARE_COMMAND: {
             OPTIGA_CMD_LOG_MESSAGE("Sending set data object command..");
             me->chaining_ongoing = FALSE;
+#ifdef OPTIGA_CMD_WRITE_HANDLER_ENABLED
+            optiga_cmd_notify_write(me, OPTIGA_CMD_WRITE_ALL_OIDS);
+#endif  // OPTIGA_CMD_WRITE_HANDLER_ENABLED
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+            // After the manifest, the fragments read from the stream are sent
+            if ((NULL != p_optiga_write_protected_data->p_stream)
+                && (OPTIGA_SET_PROTECTED_UPDATE_START
+                    != p_optiga_write_protected_data->set_obj_protected_tag)) {
+                p_optiga_write_protected_data->set_obj_protected_tag =
+                    (((p_optiga_write_protected_data->stream_sent_length
+                       + p_optiga_write_protected_data->stream_buffered_length)
+                      == p_optiga_write_protected_data->p_stream->length)
+                         ? OPTIGA_SET_PROTECTED_UPDATE_FINAL
+                         : OPTIGA_SET_PROTECTED_UPDATE_CONTINUE);
+                p_optiga_write_protected_data->p_protected_update_buffer =
+                    p_optiga_write_protected_data->p_stream->p_buffer;
+                p_optiga_write_protected_data->p_protected_update_buffer_length =
+                    p_optiga_write_protected_data->stream_buffered_length;
+            }
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
 
             // APDU header size + Set Object protected tag 1 bytes + length of buffer 2 bytes + size of data to send
             total_apdu_length = OPTIGA_CMD_APDU_HEADER_SIZE + OPTIGA_CMD_NO_OF_BYTES_IN_TAG
@@ -4437,6 +5697,20 @@ _STATIC_H optiga_lib_status_t optiga_cmd_set_object_protected_handler(optiga_cmd
             );
 
             me->p_optiga->comms_tx_size = (index_for_data - OPTIGA_COMMS_DATA_OFFSET);
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+            if (NULL != p_optiga_write_protected_data->p_stream) {
+                if (OPTIGA_SET_PROTECTED_UPDATE_START
+                    != p_optiga_write_protected_data->set_obj_protected_tag) {
+                    p_optiga_write_protected_data->stream_sent_length +=
+                        p_optiga_write_protected_data->stream_buffered_length;
+                    p_optiga_write_protected_data->stream_buffered_length = 0;
+                }
+                if (OPTIGA_SET_PROTECTED_UPDATE_FINAL
+                    != p_optiga_write_protected_data->set_obj_protected_tag) {
+                    me->chaining_ongoing = TRUE;
+                }
+            }
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
 
             return_status = OPTIGA_LIB_SUCCESS;
         } break;
@@ -4452,10 +5726,40 @@ _STATIC_H optiga_lib_status_t optiga_cmd_set_object_protected_handler(optiga_cmd
                 SET_DEV_ERROR_NOTIFICATION(OPTIGA_CMD_EXIT_HANDLER_CALL);
                 break;
             }
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+            if (NULL != p_optiga_write_protected_data->p_stream) {
+                if ((OPTIGA_SET_PROTECTED_UPDATE_START
+                     != p_optiga_write_protected_data->set_obj_protected_tag)
+                    && (NULL != p_optiga_write_protected_data->p_stream->progress_handler)) {
+                    p_optiga_write_protected_data->p_stream->progress_handler(
+                        p_optiga_write_protected_data->p_stream->p_stream_ctx,
+                        p_optiga_write_protected_data->stream_sent_length,
+                        p_optiga_write_protected_data->p_stream->length
+                    );
+                }
+                if (OPTIGA_SET_PROTECTED_UPDATE_START
+                    == p_optiga_write_protected_data->set_obj_protected_tag) {
+                    p_optiga_write_protected_data->set_obj_protected_tag =
+                        OPTIGA_SET_PROTECTED_UPDATE_CONTINUE;
+                }
+                // The next fragment could not be read, the stream is suspended until it is resumed
+                if (OPTIGA_LIB_SUCCESS != p_optiga_write_protected_data->stream_read_status) {
+                    me->chaining_ongoing = FALSE;
+                    me->cmd_sub_execution_state = OPTIGA_CMD_STATE_EXIT;
+                    pal_os_event_start(
+                        me->p_optiga->p_pal_os_event_ctx,
+                        optiga_cmd_queue_scheduler,
+                        me->p_optiga
+                    );
+                    return_status = p_optiga_write_protected_data->stream_read_status;
+                    break;
+                }
+            }
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
             if (OPTIGA_SET_PROTECTED_UPDATE_FINAL
                 == p_optiga_write_protected_data->set_obj_protected_tag) {
                 me->cmd_sub_execution_state = OPTIGA_CMD_EXEC_RELEASE_LOCK;
-            } else {
+            } else if (FALSE == me->chaining_ongoing) {
                 me->cmd_sub_execution_state = OPTIGA_CMD_STATE_EXIT;
                 pal_os_event_start(
                     me->p_optiga->p_pal_os_event_ctx,
@@ -4492,7 +5796,15 @@ optiga_lib_status_t optiga_cmd_set_object_protected(
 
     {
         return_status = OPTIGA_CMD_ERROR_INVALID_INPUT;
-    } else {
+    }
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+    // The stream stays suspended if the reader still fails
+    else if ((NULL != params->p_stream)
+             && (OPTIGA_LIB_SUCCESS != optiga_cmd_set_object_protected_stream_resume(params))) {
+        return_status = params->stream_read_status;
+    }
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+    else {
         if ((NULL == params->p_protected_update_buffer)
             && (OPTIGA_SET_PROTECTED_UPDATE_FINAL == params->set_obj_protected_tag)) {
             /// Release the strict sequence
@@ -4719,3 +6031,12 @@ _STATIC_H void optiga_cmd_ecc_r_s_padding_check(uint8_t *sig, uint16_t *sig_len)
 /**
  * @}
  */
+unsigned dbg_sched_idle, dbg_sched_busy;
+void dbg_dump(void) {
+    pal_os_event_t *e = g_optiga.p_pal_os_event_ctx;
+    int i;
+    fprintf(stderr, "DBGD idle %u busy %u trig %d cb %p sched %p ps %d\n", dbg_sched_idle, dbg_sched_busy, (int)e->is_event_triggered, (void*)e->callback_registered, (void*)optiga_cmd_queue_scheduler, (int)g_optiga.power_state);
+    for (i = 0; i < OPTIGA_CMD_MAX_REGISTRATIONS; i++) fprintf(stderr, " q%d st %d rt %d\n", i, g_optiga.optiga_cmd_execution_queue[i].state_of_entry, g_optiga.optiga_cmd_execution_queue[i].request_type);
+    { extern void dbg_ev_dump(void); dbg_ev_dump(); }
+    for (i = 0; i < OPTIGA_CMD_MAX_NUMBER_OF_SESSIONS; i++) fprintf(stderr, " s%d %d\n", i, g_optiga.sessions[i]);
+}
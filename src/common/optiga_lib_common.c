@@ -44,6 +44,16 @@ void optiga_common_get_uint16(const uint8_t *p_input_buffer, uint16_t *p_two_byt
     *p_two_byte_value |= (uint16_t)(*(p_input_buffer + 1));
 }
 
+bool_t optiga_common_is_equal(const uint8_t *p_buffer_1, const uint8_t *p_buffer_2, uint16_t length) {
+    uint8_t difference = 0;
+    uint16_t index;
+
+    for (index = 0; index < length; index++) {
+        difference |= (uint8_t)(p_buffer_1[index] ^ p_buffer_2[index]);
+    }
+    return ((0U == difference) ? TRUE : FALSE);
+}
+
 /**
  * @}
  */
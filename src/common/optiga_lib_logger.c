@@ -84,6 +84,36 @@ _STATIC_H void optiga_lib_word_to_hex_string(uint16_t value, uint8_t *p_buffer)
     }
 }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+/* Maps the layer information to the layer id of the binary log record */
+_STATIC_H uint8_t optiga_lib_logger_layer_id(const char_t *p_log_layer) {
+    const char_t *layer_names[] = OPTIGA_LIB_LOGGER_LAYER_NAMES;
+    uint8_t layer_id;
+
+    for (layer_id = OPTIGA_LIB_LOGGER_LAYER_ID_UTIL; layer_id < OPTIGA_LIB_LOGGER_LAYER_COUNT;
+         layer_id++) {
+        if (0 == strcmp(p_log_layer, layer_names[layer_id])) {
+            return (layer_id);
+        }
+    }
+    return (OPTIGA_LIB_LOGGER_LAYER_ID_NONE);
+}
+
+/* Writes the log string and a new line to the logger port */
+_STATIC_H void optiga_lib_logger_write_line(const char_t *p_log_string) {
+    uint8_t new_line_characters[2] = {OPTIGA_LOGGER_NEW_LINE_CHAR};
+
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_write(
+        &logger_console,
+        (const uint8_t *)p_log_string,
+        (uint32_t)strlen(p_log_string)
+    );
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_write(&logger_console, new_line_characters, 2);
+}
+#endif
+
 /* Converts the uint16 value to hex string format */
 _STATIC_H void optiga_lib_print_length_of_data(uint16_t value) {
     uint8_t uint16t_conv_buffer[10] = {0};
@@ -102,6 +132,17 @@ void optiga_lib_print_string(const char_t *p_log_string) {
         return;
     }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_ring_write(
+        OPTIGA_LIB_LOGGER_LAYER_ID_NONE,
+        OPTIGA_LIB_LOGGER_EVENT_STRING,
+        (const uint8_t *)p_log_string,
+        (uint16_t)strlen(p_log_string)
+    );
+    return;
+#endif
+
     // lint --e{534} The return value is not used hence not checked*/
     pal_logger_write(
         &logger_console,
@@ -117,6 +158,17 @@ void optiga_lib_print_string_with_newline(const char_t *p_log_string) {
         return;
     }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_ring_write(
+        OPTIGA_LIB_LOGGER_LAYER_ID_NONE,
+        OPTIGA_LIB_LOGGER_EVENT_STRING_NEWLINE,
+        (const uint8_t *)p_log_string,
+        (uint16_t)strlen(p_log_string)
+    );
+    return;
+#endif
+
     // lint --e{534} The return value is not used hence not checked*/
     pal_logger_write(
         &logger_console,
@@ -139,6 +191,17 @@ void optiga_lib_print_message(
         return;
     }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_ring_write(
+        optiga_lib_logger_layer_id(p_log_layer),
+        OPTIGA_LIB_LOGGER_EVENT_MESSAGE,
+        (const uint8_t *)p_log_string,
+        (uint16_t)strlen(p_log_string)
+    );
+    return;
+#endif
+
     OPTIGA_LIB_LOGGER_PRINT_INFO(color_buffer, p_log_string, p_log_layer, p_log_color);
     // lint --e{534} The return value is not used hence not checked*/
     pal_logger_write(
@@ -165,6 +228,19 @@ void optiga_lib_print_status(
         return;
     }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+    uint8_t status_bytes[2] = {(uint8_t)(return_value >> 8), (uint8_t)return_value};
+
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_ring_write(
+        optiga_lib_logger_layer_id(p_log_layer),
+        OPTIGA_LIB_LOGGER_EVENT_STATUS,
+        status_bytes,
+        sizeof(status_bytes)
+    );
+    return;
+#endif
+
     // if return value is successful, log SUCCESS
     if (OPTIGA_LIB_SUCCESS == return_value) {
         strcat(string_buffer, p_log_layer);
@@ -212,6 +288,19 @@ void optiga_lib_print_array_hex_format(
         return;
     }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+    // lint --e{534} The return value is not used hence not checked*/
+    pal_logger_ring_write(
+        OPTIGA_LIB_LOGGER_LAYER_ID_NONE,
+        (0 == strcmp(p_log_color, OPTIGA_PROTECTED_DATA_COLOR))
+            ? OPTIGA_LIB_LOGGER_EVENT_HEX_DATA_PROTECTED
+            : OPTIGA_LIB_LOGGER_EVENT_HEX_DATA,
+        p_log_string,
+        length
+    );
+    return;
+#endif
+
     optiga_lib_print_length_of_data(length);
 
     // Logging the arrays in chunks of 16 bytes through chaining
@@ -245,6 +334,103 @@ void optiga_lib_print_array_hex_format(
     }
 }
 
+#ifdef PAL_LOGGER_RING_ENABLED
+void optiga_lib_print_record(const pal_logger_ring_record_t *p_record) {
+    const char_t *layer_names[] = OPTIGA_LIB_LOGGER_LAYER_NAMES;
+    const char_t *p_layer = OPTIGA_LAYER_EMPTY;
+    uint8_t uint16t_conv_buffer[10] = {0};
+    uint8_t temp_buffer[(PAL_LOGGER_RING_MAX_PAYLOAD * 3) + 1];
+    char_t text_buffer[PAL_LOGGER_RING_MAX_PAYLOAD + 1];
+    char_t print_buffer[(PAL_LOGGER_RING_MAX_PAYLOAD * 3) + 64];
+    uint16_t index;
+    uint16_t temp_length;
+    uint8_t buffer_window = 16;  // Alignment of 16 bytes per line
+
+    if (NULL == p_record) {
+        return;
+    }
+    if (p_record->layer_id < OPTIGA_LIB_LOGGER_LAYER_COUNT) {
+        p_layer = layer_names[p_record->layer_id];
+    }
+    pal_os_memcpy(text_buffer, p_record->payload, p_record->payload_length);
+    text_buffer[p_record->payload_length] = 0x00;
+
+    switch (p_record->event_id) {
+        case OPTIGA_LIB_LOGGER_EVENT_STRING: {
+            // lint --e{534} The return value is not used hence not checked*/
+            pal_logger_write(&logger_console, p_record->payload, p_record->payload_length);
+            break;
+        }
+        case OPTIGA_LIB_LOGGER_EVENT_STRING_NEWLINE: {
+            optiga_lib_logger_write_line(text_buffer);
+            break;
+        }
+        case OPTIGA_LIB_LOGGER_EVENT_MESSAGE: {
+            sprintf(print_buffer, "%10u us %s%s", (unsigned int)p_record->timestamp_us, p_layer, text_buffer);
+            optiga_lib_logger_write_line(print_buffer);
+            break;
+        }
+        case OPTIGA_LIB_LOGGER_EVENT_STATUS: {
+            sprintf(print_buffer, "%10u us %s", (unsigned int)p_record->timestamp_us, p_layer);
+            if ((2U == p_record->payload_length) && (0x00 == p_record->payload[0])
+                && (0x00 == p_record->payload[1])) {
+                strcat(print_buffer, "Passed");
+            } else if (2U == p_record->payload_length) {
+                strcat(print_buffer, "Failed with return value - ");
+                optiga_lib_word_to_hex_string(
+                    (uint16_t)((p_record->payload[0] << 8) | p_record->payload[1]),
+                    uint16t_conv_buffer
+                );
+                strcat(print_buffer, (char_t *)uint16t_conv_buffer);
+            }
+            optiga_lib_logger_write_line(print_buffer);
+            break;
+        }
+        case OPTIGA_LIB_LOGGER_EVENT_HEX_DATA:
+        case OPTIGA_LIB_LOGGER_EVENT_HEX_DATA_PROTECTED: {
+            sprintf(
+                print_buffer,
+                "%10u us %sLength of data - ",
+                (unsigned int)p_record->timestamp_us,
+                OPTIGA_LAYER_EMPTY
+            );
+            optiga_lib_word_to_hex_string(p_record->data_length, uint16t_conv_buffer);
+            strcat(print_buffer, (char_t *)uint16t_conv_buffer);
+            optiga_lib_logger_write_line(print_buffer);
+
+            // Logging the copied payload in chunks of 16 bytes
+            for (index = 0; index < p_record->payload_length; index += buffer_window) {
+                temp_length = buffer_window;
+                if ((p_record->payload_length - index) < buffer_window) {
+                    temp_length = p_record->payload_length - index;
+                }
+                optiga_lib_byte_to_hex_string(
+                    p_record->payload + index,
+                    temp_buffer,
+                    temp_length,
+                    FALSE
+                );
+                OPTIGA_LIB_LOGGER_PRINT_ARRAY(
+                    print_buffer,
+                    temp_buffer,
+                    (OPTIGA_LIB_LOGGER_EVENT_HEX_DATA_PROTECTED == p_record->event_id)
+                        ? OPTIGA_PROTECTED_DATA_COLOR
+                        : OPTIGA_UNPROTECTED_DATA_COLOR
+                );
+                optiga_lib_logger_write_line(print_buffer);
+            }
+            if (p_record->data_length > p_record->payload_length) {
+                sprintf(print_buffer, "%s...", OPTIGA_LAYER_EMPTY);
+                optiga_lib_logger_write_line(print_buffer);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+#endif
+
 /**
  * @}
  */
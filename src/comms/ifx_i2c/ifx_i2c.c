@@ -16,6 +16,12 @@
 #include "ifx_i2c.h"
 
 #include "pal_os_event.h"
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+#include "pal_os_timer.h"
+#endif
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+#include "ifx_i2c_physical_layer.h"
+#endif
 
 #ifndef OPTIGA_COMMS_SHIELDED_CONNECTION
 #include "ifx_i2c_transport_layer.h"
@@ -52,6 +58,13 @@ _STATIC_H void ifx_i2c_prl_close_event_handler(
 );
 #endif
 _STATIC_H optiga_lib_status_t ifx_i2c_init(ifx_i2c_context_t *p_ifx_i2c_context);
+_STATIC_H void ifx_i2c_wait_startup(ifx_i2c_context_t *p_ifx_i2c_context);
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+_STATIC_H void
+ifx_i2c_recovery_start(ifx_i2c_context_t *p_ctx, optiga_lib_status_t trigger_event);
+_STATIC_H bool_t
+ifx_i2c_recovery_event_handler(ifx_i2c_context_t *p_ctx, optiga_lib_status_t *p_event);
+#endif
 
 // lint --e{526} suppress "This API is defined in ifx_i2c_physical_layer.c file. As it is a low level API, it is not exposed in header file"
 extern optiga_lib_status_t ifx_i2c_pl_write_slave_address(
@@ -93,6 +106,14 @@ optiga_lib_status_t ifx_i2c_reset(ifx_i2c_context_t *p_ctx, ifx_i2c_reset_type_t
         p_ctx->reset_type = (uint8_t)reset_type;
         p_ctx->reset_state = IFX_I2C_STATE_RESET_PIN_LOW;
         p_ctx->do_pal_init = FALSE;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        p_ctx->recovery.ongoing = FALSE;
+        p_ctx->recovery.session_restore_ongoing = FALSE;
+        p_ctx->recovery.transceive_ongoing = FALSE;
+        if (IFX_I2C_RECOVERY_RESET == reset_type) {
+            ifx_i2c_recovery_start(p_ctx, IFX_I2C_STACK_SUCCESS);
+        }
+#endif
 
         api_status = ifx_i2c_init(p_ctx);
         if (IFX_I2C_STACK_SUCCESS == api_status) {
@@ -114,6 +135,10 @@ optiga_lib_status_t ifx_i2c_transceive(
     if ((IFX_I2C_STATE_IDLE == p_ctx->state) && (IFX_I2C_STATUS_BUSY != p_ctx->status)) {
         p_ctx->p_upper_layer_rx_buffer = p_rx_buffer;
         p_ctx->p_upper_layer_rx_buffer_len = p_rx_buffer_len;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        p_ctx->recovery.error_class = IFX_I2C_ERROR_CLASS_NONE;
+        p_ctx->recovery.transceive_ongoing = TRUE;
+#endif
 #ifndef OPTIGA_COMMS_SHIELDED_CONNECTION
         api_status = ifx_i2c_tl_transceive(
             p_ctx,
@@ -138,6 +163,11 @@ optiga_lib_status_t ifx_i2c_transceive(
             && (IFX_I2C_STACK_SUCCESS == p_ctx->close_state)) {
             p_ctx->status = IFX_I2C_STATUS_BUSY;
         }
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        if (IFX_I2C_STACK_SUCCESS != api_status) {
+            p_ctx->recovery.transceive_ongoing = FALSE;
+        }
+#endif
     }
     return (api_status);
 }
@@ -176,6 +206,19 @@ optiga_lib_status_t ifx_i2c_close(ifx_i2c_context_t *p_ctx) {
     return (api_status);
 }
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+optiga_lib_status_t
+ifx_i2c_get_recovery_stats(const ifx_i2c_context_t *p_ctx, ifx_i2c_recovery_stats_t *p_stats) {
+    optiga_lib_status_t api_status = (int32_t)IFX_I2C_STACK_ERROR;
+
+    if ((NULL != p_ctx) && (NULL != p_stats)) {
+        *p_stats = p_ctx->recovery.stats;
+        api_status = IFX_I2C_STACK_SUCCESS;
+    }
+    return (api_status);
+}
+#endif
+
 optiga_lib_status_t
 ifx_i2c_set_slave_address(ifx_i2c_context_t *p_ctx, uint8_t slave_address, uint8_t persistent) {
     optiga_lib_status_t api_status = (int32_t)IFX_I2C_STACK_ERROR;
@@ -198,6 +241,12 @@ void ifx_i2c_tl_event_handler(
     const uint8_t *p_data,
     uint16_t data_len
 ) {
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    // Classified bus errors are recovered, upper layer is notified once the recovery is complete
+    if (TRUE == ifx_i2c_recovery_event_handler(p_ctx, &event)) {
+        return;
+    }
+#endif
     // If there is no upper layer handler, don't do anything and return
     if (NULL != p_ctx->upper_layer_event_handler) {
         p_ctx->upper_layer_event_handler(p_ctx->p_upper_layer_ctx, event);
@@ -244,13 +293,65 @@ _STATIC_H void ifx_i2c_prl_close_event_handler(
     }
 }
 #endif
+_STATIC_H void ifx_i2c_wait_startup(ifx_i2c_context_t *p_ifx_i2c_context) {
+    uint32_t startup_time = STARTUP_TIME_MSEC;
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    // During recovery, physical layer polls the slave until it acknowledges,
+    // instead of waiting for the start up time
+    if (TRUE == p_ifx_i2c_context->recovery.ongoing) {
+        startup_time = IFX_I2C_READY_POLL_DELAY_US;
+    }
+#endif
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    // Initialized once the slave signals ready, at the latest after the start up time
+    if (TRUE == p_ifx_i2c_context->ready_wait.is_watched) {
+        ifx_i2c_pl_wait_ready(p_ifx_i2c_context, (register_callback)ifx_i2c_init);
+        return;
+    }
+#endif
+    pal_os_event_register_callback_oneshot(
+        p_ifx_i2c_context->pal_os_event_ctx,
+        (register_callback)ifx_i2c_init,
+        (void *)p_ifx_i2c_context,
+        startup_time
+    );
+}
+
 _STATIC_H optiga_lib_status_t ifx_i2c_init(ifx_i2c_context_t *p_ifx_i2c_context) {
     optiga_lib_status_t api_status = IFX_I2C_STACK_ERROR;
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    pal_status_t pulse_status;
+#endif
 
     if (((uint8_t)IFX_I2C_WARM_RESET == p_ifx_i2c_context->reset_type)
         || ((uint8_t)IFX_I2C_COLD_RESET == p_ifx_i2c_context->reset_type)) {
         switch (p_ifx_i2c_context->reset_state) {
             case IFX_I2C_STATE_RESET_PIN_LOW: {
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+                // Ready line is watched before the reset, so that its rising edge is not missed
+                p_ifx_i2c_context->ready_wait.is_watched = (uint8_t)(
+                    PAL_STATUS_SUCCESS == pal_gpio_watch_ready(p_ifx_i2c_context->p_slave_ready_pin)
+                );
+                // Reset pulse is timed by the GPIO PAL, if supported
+                if ((uint8_t)IFX_I2C_COLD_RESET == p_ifx_i2c_context->reset_type) {
+                    pal_gpio_set_low(p_ifx_i2c_context->p_slave_reset_pin);
+                    pulse_status =
+                        pal_gpio_pulse_low(p_ifx_i2c_context->p_slave_vdd_pin, RESET_LOW_TIME_MSEC);
+                    if (PAL_STATUS_SUCCESS == pulse_status) {
+                        pal_gpio_set_high(p_ifx_i2c_context->p_slave_reset_pin);
+                    }
+                } else {
+                    pulse_status =
+                        pal_gpio_pulse_low(p_ifx_i2c_context->p_slave_reset_pin, RESET_LOW_TIME_MSEC);
+                }
+                if (PAL_STATUS_SUCCESS == pulse_status) {
+                    p_ifx_i2c_context->reset_state = IFX_I2C_STATE_RESET_INIT;
+                    ifx_i2c_wait_startup(p_ifx_i2c_context);
+                    api_status = IFX_I2C_STACK_SUCCESS;
+                    break;
+                }
+#endif
                 // Setting the Vdd & Reset pin to low
                 if ((uint8_t)IFX_I2C_COLD_RESET == p_ifx_i2c_context->reset_type) {
                     pal_gpio_set_low(p_ifx_i2c_context->p_slave_vdd_pin);
@@ -273,12 +374,7 @@ _STATIC_H optiga_lib_status_t ifx_i2c_init(ifx_i2c_context_t *p_ifx_i2c_context)
                 }
                 pal_gpio_set_high(p_ifx_i2c_context->p_slave_reset_pin);
                 p_ifx_i2c_context->reset_state = IFX_I2C_STATE_RESET_INIT;
-                pal_os_event_register_callback_oneshot(
-                    p_ifx_i2c_context->pal_os_event_ctx,
-                    (register_callback)ifx_i2c_init,
-                    (void *)p_ifx_i2c_context,
-                    STARTUP_TIME_MSEC
-                );
+                ifx_i2c_wait_startup(p_ifx_i2c_context);
                 api_status = IFX_I2C_STACK_SUCCESS;
                 break;
             }
@@ -297,6 +393,13 @@ _STATIC_H optiga_lib_status_t ifx_i2c_init(ifx_i2c_context_t *p_ifx_i2c_context)
     }
     // soft reset
     else {
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+        // Ready line is watched before the soft reset, so that its rising edge is not missed.
+        // Without ready line, physical layer waits for the start up time
+        p_ifx_i2c_context->ready_wait.is_watched = (uint8_t)(
+            PAL_STATUS_SUCCESS == pal_gpio_watch_ready(p_ifx_i2c_context->p_slave_ready_pin)
+        );
+#endif
         p_ifx_i2c_context->pl.request_soft_reset = (uint8_t)TRUE;  // Soft reset
 #ifndef OPTIGA_COMMS_SHIELDED_CONNECTION
         api_status = ifx_i2c_tl_init(p_ifx_i2c_context, ifx_i2c_tl_event_handler);
@@ -306,9 +409,108 @@ _STATIC_H optiga_lib_status_t ifx_i2c_init(ifx_i2c_context_t *p_ifx_i2c_context)
     }
     if (api_status != IFX_I2C_STACK_SUCCESS) {
         ifx_i2c_tl_event_handler(p_ifx_i2c_context, api_status, 0, 0);
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        // Recovery still ongoing, the next reset level has been scheduled
+        if (TRUE == p_ifx_i2c_context->recovery.ongoing) {
+            api_status = IFX_I2C_STACK_SUCCESS;
+        }
+#endif
     }
     return (api_status);
 }
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+_STATIC_H void
+ifx_i2c_recovery_start(ifx_i2c_context_t *p_ctx, optiga_lib_status_t trigger_event) {
+    // Recovery starts with the least intrusive reset
+    p_ctx->reset_type = (uint8_t)IFX_I2C_SOFT_RESET;
+    p_ctx->reset_state = IFX_I2C_STATE_RESET_PIN_LOW;
+    p_ctx->do_pal_init = FALSE;
+    p_ctx->recovery.ongoing = TRUE;
+    p_ctx->recovery.trigger_event = trigger_event;
+    p_ctx->recovery.start_time = pal_os_timer_get_time_in_milliseconds();
+}
+
+_STATIC_H bool_t
+ifx_i2c_recovery_event_handler(ifx_i2c_context_t *p_ctx, optiga_lib_status_t *p_event) {
+    bool_t event_handled = FALSE;
+    uint8_t transceive_ongoing = p_ctx->recovery.transceive_ongoing;
+    ifx_i2c_recovery_stats_t *p_stats = &p_ctx->recovery.stats;
+    uint32_t duration;
+
+    p_ctx->recovery.transceive_ongoing = FALSE;
+    do {
+        if ((FALSE == p_ctx->recovery.ongoing)
+            && (FALSE == p_ctx->recovery.session_restore_ongoing)) {
+            // Transceive failed with a classified bus error, the slave is recovered before the failure is reported
+            if ((TRUE == transceive_ongoing) && (IFX_I2C_STACK_SUCCESS != *p_event)
+                && (IFX_I2C_ERROR_CLASS_NONE != p_ctx->recovery.error_class)) {
+                ifx_i2c_recovery_start(p_ctx, *p_event);
+                pal_os_event_register_callback_oneshot(
+                    p_ctx->pal_os_event_ctx,
+                    (register_callback)ifx_i2c_init,
+                    (void *)p_ctx,
+                    PL_POLLING_INVERVAL_US
+                );
+                event_handled = TRUE;
+            }
+            break;
+        }
+
+        if (TRUE == p_ctx->recovery.ongoing) {
+            if ((IFX_I2C_STACK_SUCCESS != *p_event)
+                && ((uint8_t)IFX_I2C_COLD_RESET != p_ctx->reset_type)) {
+                // Soft reset escalates to warm reset, warm reset escalates to cold reset
+                p_ctx->reset_type = ((uint8_t)IFX_I2C_SOFT_RESET == p_ctx->reset_type)
+                    ? (uint8_t)IFX_I2C_WARM_RESET
+                    : (uint8_t)IFX_I2C_COLD_RESET;
+                p_ctx->reset_state = IFX_I2C_STATE_RESET_PIN_LOW;
+                p_ctx->pl.request_soft_reset = (uint8_t)FALSE;
+                p_stats->escalation_count++;
+                pal_os_event_register_callback_oneshot(
+                    p_ctx->pal_os_event_ctx,
+                    (register_callback)ifx_i2c_init,
+                    (void *)p_ctx,
+                    PL_POLLING_INVERVAL_US
+                );
+                event_handled = TRUE;
+                break;
+            }
+            p_ctx->recovery.ongoing = FALSE;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+            // The secure session established before the failure is restored with a new handshake
+            if (IFX_I2C_STACK_SUCCESS == *p_event) {
+                p_ctx->recovery.session_restore_ongoing = TRUE;
+                if (IFX_I2C_STACK_SUCCESS == ifx_i2c_prl_restore_session(p_ctx)) {
+                    event_handled = TRUE;
+                    break;
+                }
+            }
+#endif
+        }
+        p_ctx->recovery.session_restore_ongoing = FALSE;
+
+        duration = pal_os_timer_get_time_in_milliseconds() - p_ctx->recovery.start_time;
+        p_stats->last_recovery_duration_ms = duration;
+        if (duration > p_stats->max_recovery_duration_ms) {
+            p_stats->max_recovery_duration_ms = duration;
+        }
+        if (IFX_I2C_STACK_SUCCESS == *p_event) {
+            p_stats->recovery_count++;
+            p_stats->last_recovery_reset_type = p_ctx->reset_type;
+        } else {
+            p_stats->recovery_failure_count++;
+        }
+        // Recovered transceive still fails, the reset closed the application. The command is not
+        // repeated, the upper layer opens the application again on IFX_I2C_RECOVERED
+        if (IFX_I2C_STACK_SUCCESS != p_ctx->recovery.trigger_event) {
+            *p_event = (IFX_I2C_STACK_SUCCESS == *p_event) ? IFX_I2C_RECOVERED
+                                                           : p_ctx->recovery.trigger_event;
+        }
+    } while (FALSE);
+    return (event_handled);
+}
+#endif
 /// @endcond
 /**
  * @}
@@ -88,6 +88,10 @@ ifx_i2c_context_t ifx_i2c_context_0 = {
     &optiga_vdd_0,
     /// Pointer to pal gpio context for reset
     &optiga_reset_0,
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    /// Pointer to pal gpio context for the ready line
+    &optiga_ready_0,
+#endif
     /// Pointer to pal i2c context
     &optiga_pal_i2c_context_0,
     /// Upper layer event handler
@@ -133,6 +137,10 @@ ifx_i2c_context_t ifx_i2c_context_0 = {
     /// Variable to indicate manage context operation
     0,
 #endif
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /// Bus error and recovery state
+    {{{0}}},
+#endif
 };
 
 /**
@@ -346,6 +346,7 @@ _STATIC_H void ifx_i2c_dl_resend_frame(ifx_i2c_context_t *p_ctx, uint8_t seqctr_
             p_ctx->dl.state = DL_STATE_NACK;
         }
     } else {
+        IFX_I2C_RECORD_ERROR(p_ctx, IFX_I2C_ERROR_CLASS_TIMEOUT);
         p_ctx->dl.state = DL_STATE_ERROR;
     }
 }
@@ -434,6 +435,9 @@ _STATIC_H void ifx_i2c_pl_event_handler(
                     LOG_DL(
                         "[IFX-DL]: NACK for CRC error,Data frame length is not correct,RFU in SEQCTR\n"
                     );
+                    if (crc_received != crc_calculated) {
+                        IFX_I2C_RECORD_ERROR(p_ctx, IFX_I2C_ERROR_CLASS_CRC);
+                    }
                     p_ctx->dl.state = DL_STATE_NACK;
                     break;
                 }
@@ -487,6 +491,7 @@ _STATIC_H void ifx_i2c_pl_event_handler(
                 if (crc_received != crc_calculated) {
                     // Re-Transmit frame in case of CF CRC error
                     LOG_DL("[IFX-DL]: Retransmit frame for CF CRC error\n");
+                    IFX_I2C_RECORD_ERROR(p_ctx, IFX_I2C_ERROR_CLASS_CRC);
                     p_ctx->dl.state = DL_STATE_RESEND;
                     break;
                 }
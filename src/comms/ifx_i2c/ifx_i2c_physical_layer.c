@@ -123,6 +123,10 @@ _STATIC_H void ifx_i2c_pl_pal_event_handler(void *p_ctx, optiga_lib_status_t eve
 /// Physical layer low level event handler for set slave address
 _STATIC_H void
 ifx_i2c_pl_pal_slave_addr_event_handler(void *p_input_ctx, optiga_lib_status_t event);
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+/// Physical layer check of the ready line
+_STATIC_H void ifx_i2c_pl_ready_check_callback(void *p_input_ctx);
+#endif
 
 /// @endcond
 
@@ -526,6 +530,7 @@ _STATIC_H void ifx_i2c_pl_frame_event_handler(ifx_i2c_context_t *p_ctx, optiga_l
                                 PL_DATA_POLLING_INVERVAL_US
                             );
                         } else {
+                            IFX_I2C_RECORD_ERROR(p_ctx, IFX_I2C_ERROR_CLASS_TIMEOUT);
                             p_ctx->pl.frame_state = PL_STATE_READY;
                             p_ctx->pl.upper_layer_event_handler(p_ctx, IFX_I2C_STACK_ERROR, 0, 0);
                         }
@@ -559,6 +564,7 @@ _STATIC_H void ifx_i2c_pl_frame_event_handler(ifx_i2c_context_t *p_ctx, optiga_l
                             PL_DATA_POLLING_INVERVAL_US
                         );
                     } else {
+                        IFX_I2C_RECORD_ERROR(p_ctx, IFX_I2C_ERROR_CLASS_TIMEOUT);
                         p_ctx->pl.frame_state = PL_STATE_READY;
                         p_ctx->pl.upper_layer_event_handler(p_ctx, IFX_I2C_STACK_ERROR, 0, 0);
                     }
@@ -643,6 +649,11 @@ _STATIC_H void ifx_i2c_pl_pal_event_handler(void *p_ctx, optiga_lib_status_t eve
                 );
             } else {
                 LOG_PL("[IFX-PL]: PAL Error -> Stop\n");
+                // Busy event reports a busy bus or lost arbitration, error event reports a missing acknowledge
+                IFX_I2C_RECORD_ERROR(
+                    p_local_ctx,
+                    (PAL_I2C_EVENT_BUSY == event) ? IFX_I2C_ERROR_CLASS_BUS : IFX_I2C_ERROR_CLASS_NACK
+                );
                 ifx_i2c_pl_frame_event_handler(p_local_ctx, IFX_I2C_FATAL_ERROR);
             }
             break;
@@ -691,6 +702,22 @@ _STATIC_H void ifx_i2c_pl_soft_reset(ifx_i2c_context_t *p_ctx) {
         }
         case PL_RESET_STARTUP: {
             p_ctx->pl.request_soft_reset = PL_RESET_INIT;
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+            // Continue once the slave signals ready on the line watched before the soft reset,
+            // at the latest after the start up time
+            if (TRUE == p_ctx->ready_wait.is_watched) {
+                ifx_i2c_pl_wait_ready(p_ctx, (register_callback)ifx_i2c_pl_soft_reset);
+                break;
+            }
+#endif
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+            // During recovery, poll the status register until the slave acknowledges,
+            // instead of waiting for the start up time
+            if (TRUE == p_ctx->recovery.ongoing) {
+                ifx_i2c_pl_read_register(p_ctx, PL_REG_I2C_STATE, PL_REG_LEN_I2C_STATE);
+                break;
+            }
+#endif
             pal_os_event_register_callback_oneshot(
                 p_ctx->pal_os_event_ctx,
                 (register_callback)ifx_i2c_pl_soft_reset,
@@ -715,6 +742,37 @@ _STATIC_H void ifx_i2c_pl_pal_slave_addr_event_handler(void *p_ctx, optiga_lib_s
     g_pal_event_status = event;
 }
 
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+_STATIC_H void ifx_i2c_pl_ready_check_callback(void *p_input_ctx) {
+    ifx_i2c_context_t *p_ctx = (ifx_i2c_context_t *)p_input_ctx;
+    uint32_t wait_time = pal_os_timer_get_time_in_microseconds() - p_ctx->ready_wait.start_time;
+
+    if ((PAL_STATUS_SUCCESS == pal_gpio_is_ready(p_ctx->p_slave_ready_pin))
+        || (wait_time >= STARTUP_TIME_MSEC)) {
+        p_ctx->ready_wait.handler(p_ctx);
+    } else {
+        pal_os_event_register_callback_oneshot(
+            p_ctx->pal_os_event_ctx,
+            ifx_i2c_pl_ready_check_callback,
+            (void *)p_ctx,
+            IFX_I2C_READY_CHECK_INTERVAL_US
+        );
+    }
+}
+
+void ifx_i2c_pl_wait_ready(ifx_i2c_context_t *p_ctx, void (*handler)(void *p_ctx)) {
+    p_ctx->ready_wait.is_watched = FALSE;
+    p_ctx->ready_wait.handler = handler;
+    p_ctx->ready_wait.start_time = pal_os_timer_get_time_in_microseconds();
+    pal_os_event_register_callback_oneshot(
+        p_ctx->pal_os_event_ctx,
+        ifx_i2c_pl_ready_check_callback,
+        (void *)p_ctx,
+        IFX_I2C_READY_CHECK_INTERVAL_US
+    );
+}
+#endif
+
 /**
  * @}
  */
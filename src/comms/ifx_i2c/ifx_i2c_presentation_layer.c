@@ -203,12 +203,41 @@ optiga_lib_status_t ifx_i2c_prl_init(ifx_i2c_context_t *p_ctx, ifx_i2c_event_han
         p_ctx->prl.return_status = IFX_I2C_STACK_SUCCESS;
         p_ctx->prl.hs_state = PRL_HS_SEND_HELLO;
         p_ctx->prl.alert_type = PRL_DEFAULT_ALERT;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        p_ctx->prl.session_restore_ongoing = FALSE;
+#endif
         return_status = IFX_I2C_STACK_SUCCESS;
     } while (FALSE);
 
     return (return_status);
 }
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+optiga_lib_status_t ifx_i2c_prl_restore_session(ifx_i2c_context_t *p_ctx) {
+    optiga_lib_status_t return_status = IFX_I2C_STACK_ERROR;
+    LOG_PRL("[IFX-PRL]: Restore session\n");
+
+    do {
+        // Presentation Layer must be idle and a session must have been established
+        if ((PRL_STATE_IDLE != p_ctx->prl.state) || (FALSE == p_ctx->prl.restore_session)) {
+            break;
+        }
+        p_ctx->prl.restore_session = FALSE;
+        p_ctx->prl.session_restore_ongoing = TRUE;
+        p_ctx->prl.state = PRL_STATE_HANDSHAKE;
+        p_ctx->prl.hs_state = PRL_HS_SEND_HELLO;
+        p_ctx->prl.negotiation_state = PRL_NEGOTIATION_NOT_DONE;
+        p_ctx->prl.trans_repeat_status = FALSE;
+        p_ctx->prl.return_status = IFX_I2C_STACK_SUCCESS;
+        p_ctx->prl.alert_type = PRL_DEFAULT_ALERT;
+
+        ifx_i2c_prl_event_handler(p_ctx, IFX_I2C_STACK_SUCCESS, p_ctx->prl.prl_txrx_buffer, 0);
+        return_status = IFX_I2C_STACK_SUCCESS;
+    } while (FALSE);
+    return (return_status);
+}
+#endif
+
 optiga_lib_status_t ifx_i2c_prl_close(ifx_i2c_context_t *p_ctx, ifx_i2c_event_handler_t handler) {
     optiga_lib_status_t return_status = IFX_I2C_STACK_ERROR;
     LOG_PRL("[IFX-PRL]: Close\n");
@@ -261,6 +290,9 @@ optiga_lib_status_t ifx_i2c_prl_transceive(
         }
         p_ctx->prl.p_actual_payload = p_tx_data;
         p_ctx->prl.actual_payload_length = tx_data_len;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+        p_ctx->prl.restore_session = (PRL_NEGOTIATION_DONE == p_ctx->prl.negotiation_state);
+#endif
 
         if ((SLAVE_PROTECTION == (p_ctx->protection_level & PRL_PROTECTION_MASK))
             || (FULL_PROTECTION == (p_ctx->protection_level & PRL_PROTECTION_MASK))) {
@@ -806,6 +838,9 @@ _STATIC_H void ifx_i2c_prl_event_handler(
         switch (p_ctx->prl.state) {
             case PRL_STATE_IDLE: {
                 LOG_PRL("[IFX-PRL]: PRL_STATE_IDLE %d\n", p_ctx->prl.return_status);
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+                p_ctx->prl.session_restore_ongoing = FALSE;
+#endif
                 p_ctx->prl.upper_layer_event_handler(p_ctx, p_ctx->prl.return_status, 0, 0);
                 exit_machine = FALSE;
             } break;
@@ -854,6 +889,12 @@ _STATIC_H void ifx_i2c_prl_event_handler(
 
                 if (PRL_NEGOTIATION_DONE == p_ctx->prl.negotiation_state) {
                     p_ctx->prl.state = PRL_STATE_TXRX;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+                    // Restored session is reported without exchanging a record
+                    if (TRUE == p_ctx->prl.session_restore_ongoing) {
+                        p_ctx->prl.state = PRL_STATE_IDLE;
+                    }
+#endif
                 } else {
                     exit_machine = FALSE;
                 }
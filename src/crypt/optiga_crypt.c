@@ -18,6 +18,16 @@
 #include "optiga_lib_common_internal.h"
 #include "optiga_lib_logger.h"
 #include "pal_os_memory.h"
+#if defined(OPTIGA_CRYPT_HOST_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RANDOM_POOL_ENABLED) \
+    || defined(OPTIGA_CRYPT_HOST_HASH_ENABLED) || defined(OPTIGA_CRYPT_RESULT_CACHE_ENABLED)
+#include "pal_crypt.h"
+#endif
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) || defined(OPTIGA_CRYPT_RESULT_CACHE_ENABLED)
+#include "pal_os_lock.h"
+#endif
+#ifdef PAL_OS_EXECUTOR_ENABLED
+#include "pal_os_executor.h"
+#endif
 
 /// ECDSA FIPS 186-3 without hash
 #define OPTIGA_CRYPT_ECDSA_FIPS_186_3_WITHOUT_HASH (0x11)
@@ -29,21 +39,22 @@
 #define OPTIGA_CRYTP_RANDOM_PARAM_PRE_MASTER_SECRET (0x04)
 /// Minimum optional data length
 #define OPTIGA_CRYPT_MINIMUM_OPTIONAL_DATA_LENGTH (0x3A)
-#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) && defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED)
+#if defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 /// Symmetric Encryption
 #define OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION (0x01)
 /// Symmetric Decryption
 #define OPTIGA_CRYPT_SYMMETRIC_DECRYPTION (0x00)
-#endif
-#if defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
-    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 /// MAC generation using HMAC operation
 #define OPTIGA_CRYPT_HMAC (0x02)
-#endif
-#ifdef OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED
 /// Clearing AUTOREF state using clear auto ref operation
 #define OPTIGA_CRYPT_CLEAR_AUTO_STATE (0x03)
 #endif
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+/// Block size of the symmetric modes supported for streaming
+#define OPTIGA_CRYPT_SYM_STREAM_BLOCK_SIZE (0x10)
+#endif
 
 #if defined(OPTIGA_LIB_ENABLE_LOGGING) && defined(OPTIGA_LIB_ENABLE_CRYPT_LOGGING)
 
@@ -83,13 +94,453 @@
 
 #endif
 
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+// Size of the HMAC_DRBG key and value (SHA256)
+#define OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE (0x20)
+// Entropy input and nonce read from OPTIGA TRNG to (re)seed the HMAC_DRBG
+#define OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE (0x30)
+// Maximum length of a random request, same as for OPTIGA
+#define OPTIGA_CRYPT_RANDOM_POOL_MAX_REQUEST_LENGTH (0x100)
+
+/** \brief Host HMAC_DRBG state of a crypt instance */
+struct optiga_crypt_random_pool {
+    /// HMAC_DRBG key
+    uint8_t key[OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE];
+    /// HMAC_DRBG value
+    uint8_t value[OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE];
+    /// TRNG output received from OPTIGA
+    uint8_t seed[OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE];
+    /// Requests served since the last (re)seed
+    uint32_t reseed_counter;
+    /// Requests served before reseeding
+    uint32_t reseed_interval;
+    /// Reseed before every request
+    bool_t prediction_resistance;
+    /// Key and value are initialized
+    bool_t is_instantiated;
+    /// TRNG output is requested from OPTIGA
+    bool_t is_seed_pending;
+    /// Buffer of the request waiting for the seed
+    uint8_t *p_random_data;
+    /// Length of the request waiting for the seed
+    uint16_t random_data_length;
+};
+
+/** \brief Host HMAC_DRBG state type */
+typedef struct optiga_crypt_random_pool optiga_crypt_random_pool_t;
+
+// HMAC_DRBG update function (NIST SP 800-90A, 10.1.2.2)
+_STATIC_H pal_status_t optiga_crypt_random_pool_update(
+    optiga_crypt_random_pool_t *p_pool,
+    const uint8_t *p_provided_data,
+    uint16_t provided_data_length
+) {
+    uint8_t buffer[OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE + 1 + OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE];
+    pal_status_t return_status = PAL_STATUS_SUCCESS;
+    uint8_t round;
+
+    for (round = 0x00; round <= 0x01; round++) {
+        pal_os_memcpy(buffer, p_pool->value, OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE);
+        buffer[OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE] = round;
+        if (0U != provided_data_length) {
+            pal_os_memcpy(
+                &buffer[OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE + 1],
+                p_provided_data,
+                provided_data_length
+            );
+        }
+        return_status = pal_crypt_hmac_sha256(
+            NULL,
+            p_pool->key,
+            OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE,
+            buffer,
+            OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE + 1 + provided_data_length,
+            p_pool->key
+        );
+        if (PAL_STATUS_SUCCESS == return_status) {
+            return_status = pal_crypt_hmac_sha256(
+                NULL,
+                p_pool->key,
+                OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE,
+                p_pool->value,
+                OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE,
+                p_pool->value
+            );
+        }
+        if ((PAL_STATUS_SUCCESS != return_status) || (0U == provided_data_length)) {
+            break;
+        }
+    }
+    pal_os_memset(buffer, 0x00, sizeof(buffer));
+    return (return_status);
+}
+
+// Instantiates or reseeds the HMAC_DRBG with the TRNG output and generates the requested random data
+_STATIC_H optiga_lib_status_t optiga_crypt_random_pool_generate(
+    optiga_crypt_random_pool_t *p_pool,
+    bool_t is_seed_available,
+    uint8_t *p_random_data,
+    uint16_t random_data_length
+) {
+    uint16_t offset = 0;
+    uint16_t block_length;
+    pal_status_t return_status = PAL_STATUS_SUCCESS;
+
+    if (TRUE == is_seed_available) {
+        if (FALSE == p_pool->is_instantiated) {
+            pal_os_memset(p_pool->key, 0x00, OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE);
+            pal_os_memset(p_pool->value, 0x01, OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE);
+        }
+        return_status =
+            optiga_crypt_random_pool_update(p_pool, p_pool->seed, OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE);
+        pal_os_memset(p_pool->seed, 0x00, OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE);
+        p_pool->is_instantiated = (PAL_STATUS_SUCCESS == return_status) ? TRUE : FALSE;
+        p_pool->reseed_counter = 0;
+    }
+
+    while ((PAL_STATUS_SUCCESS == return_status) && (offset < random_data_length)) {
+        return_status = pal_crypt_hmac_sha256(
+            NULL,
+            p_pool->key,
+            OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE,
+            p_pool->value,
+            OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE,
+            p_pool->value
+        );
+        block_length = random_data_length - offset;
+        if (block_length > OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE) {
+            block_length = OPTIGA_CRYPT_RANDOM_POOL_STATE_SIZE;
+        }
+        pal_os_memcpy(&p_random_data[offset], p_pool->value, block_length);
+        offset += block_length;
+    }
+    if (PAL_STATUS_SUCCESS == return_status) {
+        return_status = optiga_crypt_random_pool_update(p_pool, NULL, 0);
+    }
+    p_pool->reseed_counter++;
+
+    if (PAL_STATUS_SUCCESS != return_status) {
+        // Force a new instantiation with the next request
+        p_pool->is_instantiated = FALSE;
+        return (OPTIGA_CRYPT_ERROR);
+    }
+    return (OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+// Size of the key and of the largest result of a cache entry (SHA256)
+#define OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE (0x20)
+// Operation of a cache key: signature verification with a public key in OPTIGA
+#define OPTIGA_CRYPT_RESULT_CACHE_OPERATION_VERIFY (0x01)
+// Operation of a cache key: hash of data in OPTIGA
+#define OPTIGA_CRYPT_RESULT_CACHE_OPERATION_HASH (0x02)
+// Cache entry is not used
+#define OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE (0x00)
+// Cache entry is reserved for the result of a request in progress
+#define OPTIGA_CRYPT_RESULT_CACHE_ENTRY_PENDING (0x01)
+// Cache entry holds a result
+#define OPTIGA_CRYPT_RESULT_CACHE_ENTRY_VALID (0x02)
+
+/** \brief Entry of the result cache */
+struct optiga_crypt_result_cache_entry {
+    /// Digest of the operation, OID and inputs of the request
+    uint8_t key[OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE];
+    /// Result data of the request
+    uint8_t result[OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE];
+    /// Output buffer of the request in progress, the result data is copied from
+    uint8_t *p_result_output;
+    /// Instance of the request in progress
+    const optiga_crypt_t *p_owner;
+    /// Use counter value at the last store or hit
+    uint32_t last_use;
+    /// Data object the result depends on
+    uint16_t oid;
+    /// Length of the result data, 0 if the result is the success of the request only
+    uint8_t result_length;
+    /// OPTIGA_CRYPT_RESULT_CACHE_ENTRY_XXX
+    uint8_t state;
+};
+
+/** \brief Entry of the result cache type */
+typedef struct optiga_crypt_result_cache_entry optiga_crypt_result_cache_entry_t;
+
+/** \brief Result cache shared by all instances */
+typedef struct optiga_crypt_result_cache {
+    /// Cache entries
+    optiga_crypt_result_cache_entry_t entries[OPTIGA_CRYPT_RESULT_CACHE_ENTRIES];
+    /// Counter ordering the entries by their last use
+    uint32_t use_counter;
+    /// Statistics
+    optiga_crypt_result_cache_stats_t stats;
+} optiga_crypt_result_cache_t;
+
+// Result cache
+_STATIC_H optiga_crypt_result_cache_t g_optiga_crypt_result_cache = {0};
+
+// Write handler attached to the OPTIGA instance, discards the results depending on the written data object
+_STATIC_H void optiga_crypt_result_cache_write_handler(void *p_ctx, uint16_t oid) {
+    optiga_crypt_result_cache_t *p_cache = (optiga_crypt_result_cache_t *)p_ctx;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_CRYPT_RESULT_CACHE_ENTRIES; index++) {
+        if ((OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE != p_cache->entries[index].state)
+            && ((OPTIGA_CMD_WRITE_ALL_OIDS == oid) || (oid == p_cache->entries[index].oid))) {
+            p_cache->entries[index].state = OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE;
+            p_cache->stats.invalidation_count++;
+        }
+    }
+    pal_os_lock_exit_critical_section();
+}
+
+// Stores the result of the request of the instance to the reserved entry, or releases the entry if it failed
+_STATIC_H void optiga_crypt_result_cache_complete(optiga_crypt_t *me, optiga_lib_status_t event) {
+    optiga_crypt_result_cache_t *p_cache = &g_optiga_crypt_result_cache;
+    optiga_crypt_result_cache_entry_t *p_entry;
+
+    pal_os_lock_enter_critical_section();
+    p_entry = me->p_result_cache_entry;
+    me->p_result_cache_entry = NULL;
+    // The entry is freed and possibly reused, if the data object was written meanwhile
+    if ((NULL != p_entry) && (OPTIGA_CRYPT_RESULT_CACHE_ENTRY_PENDING == p_entry->state)
+        && (me == p_entry->p_owner)) {
+        p_entry->state = OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE;
+        if (OPTIGA_LIB_SUCCESS == event) {
+            if (0U != p_entry->result_length) {
+                pal_os_memcpy(p_entry->result, p_entry->p_result_output, p_entry->result_length);
+            }
+            p_entry->last_use = ++p_cache->use_counter;
+            p_entry->state = OPTIGA_CRYPT_RESULT_CACHE_ENTRY_VALID;
+        }
+        p_entry->p_result_output = NULL;
+        p_entry->p_owner = NULL;
+    }
+    pal_os_lock_exit_critical_section();
+}
+
+#if defined(OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RSA_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_HASH_ENABLED)
+// Calculates the cache key over the operation, parameter, OID and the inputs of a request
+_STATIC_H pal_status_t optiga_crypt_result_cache_key(
+    uint8_t operation,
+    uint8_t parameter,
+    uint16_t oid,
+    const uint8_t *p_input,
+    uint16_t input_length,
+    const uint8_t *p_extra_input,
+    uint16_t extra_input_length,
+    uint8_t *p_key
+) {
+    uint8_t context[OPTIGA_HASH_CONTEXT_LENGTH_SHA_256];
+    uint8_t header[6];
+    pal_status_t pal_return_status;
+
+    header[0] = operation;
+    header[1] = parameter;
+    optiga_common_set_uint16(&header[2], oid);
+    // The length of the first input separates it from the extra input
+    optiga_common_set_uint16(&header[4], input_length);
+
+    do {
+        pal_return_status = pal_crypt_hash_start(
+            NULL,
+            OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE,
+            context,
+            sizeof(context)
+        );
+        if (PAL_STATUS_SUCCESS != pal_return_status) {
+            break;
+        }
+        pal_return_status = pal_crypt_hash_update(
+            NULL,
+            OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE,
+            context,
+            header,
+            sizeof(header)
+        );
+        if (PAL_STATUS_SUCCESS != pal_return_status) {
+            break;
+        }
+        pal_return_status = pal_crypt_hash_update(
+            NULL,
+            OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE,
+            context,
+            p_input,
+            input_length
+        );
+        if ((PAL_STATUS_SUCCESS != pal_return_status) || (0U == extra_input_length)) {
+            break;
+        }
+        pal_return_status = pal_crypt_hash_update(
+            NULL,
+            OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE,
+            context,
+            p_extra_input,
+            extra_input_length
+        );
+    } while (FALSE);
+
+    if (PAL_STATUS_SUCCESS == pal_return_status) {
+        pal_return_status =
+            pal_crypt_hash_finalize(NULL, OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE, context, p_key);
+    }
+    pal_os_memset(context, 0x00, sizeof(context));
+
+    return (pal_return_status);
+}
+
+// Serves the request from the cache, otherwise reserves an entry for its result
+_STATIC_H bool_t optiga_crypt_result_cache_lookup(
+    optiga_crypt_t *me,
+    const uint8_t *p_key,
+    uint16_t oid,
+    uint8_t *p_result_output,
+    uint8_t result_length
+) {
+    optiga_crypt_result_cache_t *p_cache = &g_optiga_crypt_result_cache;
+    optiga_crypt_result_cache_entry_t *p_entry = NULL;
+    optiga_crypt_result_cache_entry_t *p_free_entry = NULL;
+    bool_t is_served = FALSE;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    do {
+        for (index = 0; index < OPTIGA_CRYPT_RESULT_CACHE_ENTRIES; index++) {
+            p_entry = &p_cache->entries[index];
+            if ((OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE != p_entry->state)
+                && (TRUE
+                    == optiga_common_is_equal(
+                        p_entry->key,
+                        p_key,
+                        OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE
+                    ))) {
+                break;
+            }
+            // Free entry, otherwise the least recently used result
+            if ((OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE == p_entry->state)
+                || ((OPTIGA_CRYPT_RESULT_CACHE_ENTRY_VALID == p_entry->state)
+                    && ((NULL == p_free_entry)
+                        || ((OPTIGA_CRYPT_RESULT_CACHE_ENTRY_VALID == p_free_entry->state)
+                            && (p_entry->last_use < p_free_entry->last_use))))) {
+                p_free_entry = p_entry;
+            }
+            p_entry = NULL;
+        }
+
+        if ((NULL != p_entry) && (OPTIGA_CRYPT_RESULT_CACHE_ENTRY_VALID == p_entry->state)) {
+            if (0U != result_length) {
+                pal_os_memcpy(p_result_output, p_entry->result, result_length);
+            }
+            p_entry->last_use = ++p_cache->use_counter;
+            p_cache->stats.hit_count++;
+            is_served = TRUE;
+            break;
+        }
+
+        p_cache->stats.miss_count++;
+        // The same request is in progress, its result is stored by the owner
+        if ((NULL != p_entry) || (NULL == p_free_entry)) {
+            break;
+        }
+        pal_os_memcpy(p_free_entry->key, p_key, OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE);
+        p_free_entry->oid = oid;
+        p_free_entry->p_result_output = p_result_output;
+        p_free_entry->result_length = result_length;
+        p_free_entry->p_owner = me;
+        p_free_entry->state = OPTIGA_CRYPT_RESULT_CACHE_ENTRY_PENDING;
+        me->p_result_cache_entry = p_free_entry;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+
+    return (is_served);
+}
+
+// Checks whether the requests of the instance use the result cache
+_STATIC_H bool_t optiga_crypt_result_cache_is_selected(const optiga_crypt_t *me) {
+    bool_t is_selected = me->result_cache_enabled;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    // Protected communication is requested, the request is performed by OPTIGA
+    if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+        is_selected = FALSE;
+    }
+#endif
+    return (is_selected);
+}
+#endif  // (OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || (OPTIGA_CRYPT_RSA_VERIFY_ENABLED) || (OPTIGA_CRYPT_HASH_ENABLED)
+#endif  // OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) && defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED)
+_STATIC_H void optiga_crypt_ecdhe_pool_generated(void *p_ctx, optiga_lib_status_t event);
+#endif
+
+/*
+ * Checks whether the handler is a step of an operation chained by the library
+ */
+_STATIC_H bool_t optiga_crypt_is_internal_handler(callback_handler_t handler) {
+    bool_t is_internal = FALSE;
+
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) && defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED)
+    if (optiga_crypt_ecdhe_pool_generated == handler) {
+        is_internal = TRUE;
+    }
+#else
+    (void)handler;
+#endif
+    return (is_internal);
+}
+#endif  // PAL_OS_EXECUTOR_ENABLED
+
 _STATIC_H void optiga_crypt_generic_event_handler(void *p_ctx, optiga_lib_status_t event) {
     optiga_crypt_t *me = (optiga_crypt_t *)p_ctx;
 
     me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+    if ((NULL != me->p_random_pool) && (TRUE == me->p_random_pool->is_seed_pending)) {
+        me->p_random_pool->is_seed_pending = FALSE;
+        if (OPTIGA_LIB_SUCCESS == event) {
+            event = optiga_crypt_random_pool_generate(
+                me->p_random_pool,
+                TRUE,
+                me->p_random_pool->p_random_data,
+                me->p_random_pool->random_data_length
+            );
+        } else {
+            pal_os_memset(me->p_random_pool->seed, 0x00, OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE);
+        }
+    }
+#endif
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+    if (NULL != me->p_result_cache_entry) {
+        optiga_crypt_result_cache_complete(me, event);
+    }
+#endif
+#ifdef PAL_OS_EXECUTOR_ENABLED
+    // Only the application handler is queued, the steps of the library continue in the completing context.
+    // Invoked by the completing context as well, if the executor is not running or its queue is full.
+    if ((TRUE == optiga_crypt_is_internal_handler(me->handler))
+        || (PAL_STATUS_SUCCESS != pal_os_executor_post(me->handler, me->caller_context, event))) {
+        me->handler(me->caller_context, event);
+    }
+#else
     me->handler(me->caller_context, event);
+#endif
 }
 
+// Used by every operation, not compiled when the crypt service is configured without operations
+#if defined(OPTIGA_CRYPT_RANDOM_ENABLED) || defined(OPTIGA_CRYPT_HASH_ENABLED) \
+    || defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED) || defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) \
+    || defined(OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_ECDH_ENABLED) \
+    || defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+    || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED) \
+    || defined(OPTIGA_CRYPT_RSA_GENERATE_KEYPAIR_ENABLED) || defined(OPTIGA_CRYPT_RSA_SIGN_ENABLED) \
+    || defined(OPTIGA_CRYPT_RSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RSA_ENCRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_RSA_DECRYPT_ENABLED) || defined(OPTIGA_CRYPT_RSA_PRE_MASTER_SECRET_ENABLED) \
+    || defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+    || defined(OPTIGA_CRYPT_HMAC_ENABLED) || defined(OPTIGA_CRYPT_HMAC_VERIFY_ENABLED) \
+    || defined(OPTIGA_CRYPT_SYM_GENERATE_KEY_ENABLED) || defined(OPTIGA_CRYPT_GENERATE_AUTH_CODE_ENABLED) \
+    || defined(OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED)
 _STATIC_H void optiga_crypt_reset_protection_level(optiga_crypt_t *me) {
 #ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
     if (NULL != me)
@@ -98,6 +549,7 @@ _STATIC_H void optiga_crypt_reset_protection_level(optiga_crypt_t *me) {
         OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL(me, OPTIGA_COMMS_DEFAULT_PROTECTION_LEVEL);
     }
 }
+#endif
 
 extern void optiga_cmd_set_shielded_connection_option(
     optiga_cmd_t *me,
@@ -220,6 +672,196 @@ _STATIC_H optiga_lib_status_t optiga_crypt_sign(
 }
 #endif  // (OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) || (OPTIGA_CRYPT_RSA_SIGN_ENABLED)
 
+#if defined(OPTIGA_CRYPT_HOST_VERIFY_ENABLED) \
+    && (defined(OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RSA_VERIFY_ENABLED))
+// Maximum size of the DER encoded SubjectPublicKeyInfo built for the host verification
+#define OPTIGA_CRYPT_HOST_VERIFY_KEY_INFO_MAX_SIZE (0x140)
+// Maximum size of the DER encoded ECDSA signature built for the host verification
+#define OPTIGA_CRYPT_HOST_VERIFY_SIGNATURE_MAX_SIZE (0x94)
+// DER tag of a SEQUENCE
+#define OPTIGA_CRYPT_DER_TAG_SEQUENCE (0x30)
+// Size of the DER tag and length encoding
+#define OPTIGA_CRYPT_DER_HEADER_SIZE(length) (((length) < 0x80U) ? 2U : (((length) < 0x100U) ? 3U : 4U))
+
+// ecPublicKey algorithm identifier
+static const uint8_t optiga_crypt_oid_ec_public_key[] =
+    {0x06, 0x07, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01};
+// rsaEncryption algorithm identifier with NULL parameters
+static const uint8_t optiga_crypt_oid_rsa_encryption[] =
+    {0x06, 0x09, 0x2A, 0x86, 0x48, 0x86, 0xF7, 0x0D, 0x01, 0x01, 0x01, 0x05, 0x00};
+// Named curve identifiers
+static const uint8_t optiga_crypt_oid_nist_p_256[] =
+    {0x06, 0x08, 0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x03, 0x01, 0x07};
+static const uint8_t optiga_crypt_oid_nist_p_384[] = {0x06, 0x05, 0x2B, 0x81, 0x04, 0x00, 0x22};
+#ifdef OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
+static const uint8_t optiga_crypt_oid_nist_p_521[] = {0x06, 0x05, 0x2B, 0x81, 0x04, 0x00, 0x23};
+#endif  // OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
+#ifdef OPTIGA_CRYPT_ECC_BRAINPOOL_P_R1_ENABLED
+static const uint8_t optiga_crypt_oid_brainpool_p_256r1[] =
+    {0x06, 0x09, 0x2B, 0x24, 0x03, 0x03, 0x02, 0x08, 0x01, 0x01, 0x07};
+static const uint8_t optiga_crypt_oid_brainpool_p_384r1[] =
+    {0x06, 0x09, 0x2B, 0x24, 0x03, 0x03, 0x02, 0x08, 0x01, 0x01, 0x0B};
+static const uint8_t optiga_crypt_oid_brainpool_p_512r1[] =
+    {0x06, 0x09, 0x2B, 0x24, 0x03, 0x03, 0x02, 0x08, 0x01, 0x01, 0x0D};
+#endif  // OPTIGA_CRYPT_ECC_BRAINPOOL_P_R1_ENABLED
+
+_STATIC_H uint16_t optiga_crypt_der_set_header(uint8_t *p_buffer, uint8_t tag, uint16_t length) {
+    uint16_t index = 0;
+
+    p_buffer[index++] = tag;
+    if (length >= 0x100U) {
+        p_buffer[index++] = 0x82;
+        p_buffer[index++] = (uint8_t)(length >> 8);
+    } else if (length >= 0x80U) {
+        p_buffer[index++] = 0x81;
+    } else {
+        // Short form
+    }
+    p_buffer[index++] = (uint8_t)length;
+    return (index);
+}
+
+_STATIC_H bool_t optiga_crypt_host_verify(
+    const optiga_crypt_t *me,
+    uint8_t cmd_param,
+    const uint8_t *p_digest,
+    uint8_t digest_length,
+    const uint8_t *p_signature,
+    uint16_t signature_length,
+    const public_key_from_host_t *p_public_key,
+    optiga_lib_status_t *p_verify_status
+) {
+    uint8_t key_info[OPTIGA_CRYPT_HOST_VERIFY_KEY_INFO_MAX_SIZE];
+    uint8_t der_signature[OPTIGA_CRYPT_HOST_VERIFY_SIGNATURE_MAX_SIZE];
+    const uint8_t *p_algorithm = optiga_crypt_oid_ec_public_key;
+    uint16_t algorithm_length = sizeof(optiga_crypt_oid_ec_public_key);
+    const uint8_t *p_curve = NULL;
+    uint16_t curve_length = 0;
+    uint16_t key_info_length;
+    uint16_t index;
+    pal_status_t pal_return_status;
+    bool_t is_verified_on_host = FALSE;
+
+    do {
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        // Protected communication is requested, the verification is performed by OPTIGA
+        if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+            break;
+        }
+#endif
+        if (OPTIGA_CRYPT_ECDSA_FIPS_186_3_WITHOUT_HASH == cmd_param) {
+            if (0U == (me->verify_policy & OPTIGA_CRYPT_VERIFY_POLICY_HOST_ECDSA)) {
+                break;
+            }
+            switch (p_public_key->key_type) {
+                case OPTIGA_ECC_CURVE_NIST_P_256: {
+                    p_curve = optiga_crypt_oid_nist_p_256;
+                    curve_length = sizeof(optiga_crypt_oid_nist_p_256);
+                    break;
+                }
+                case OPTIGA_ECC_CURVE_NIST_P_384: {
+                    p_curve = optiga_crypt_oid_nist_p_384;
+                    curve_length = sizeof(optiga_crypt_oid_nist_p_384);
+                    break;
+                }
+#ifdef OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
+                case OPTIGA_ECC_CURVE_NIST_P_521: {
+                    p_curve = optiga_crypt_oid_nist_p_521;
+                    curve_length = sizeof(optiga_crypt_oid_nist_p_521);
+                    break;
+                }
+#endif  // OPTIGA_CRYPT_ECC_NIST_P_521_ENABLED
+#ifdef OPTIGA_CRYPT_ECC_BRAINPOOL_P_R1_ENABLED
+                case OPTIGA_ECC_CURVE_BRAIN_POOL_P_256R1: {
+                    p_curve = optiga_crypt_oid_brainpool_p_256r1;
+                    curve_length = sizeof(optiga_crypt_oid_brainpool_p_256r1);
+                    break;
+                }
+                case OPTIGA_ECC_CURVE_BRAIN_POOL_P_384R1: {
+                    p_curve = optiga_crypt_oid_brainpool_p_384r1;
+                    curve_length = sizeof(optiga_crypt_oid_brainpool_p_384r1);
+                    break;
+                }
+                case OPTIGA_ECC_CURVE_BRAIN_POOL_P_512R1: {
+                    p_curve = optiga_crypt_oid_brainpool_p_512r1;
+                    curve_length = sizeof(optiga_crypt_oid_brainpool_p_512r1);
+                    break;
+                }
+#endif  // OPTIGA_CRYPT_ECC_BRAINPOOL_P_R1_ENABLED
+                default: {
+                    break;
+                }
+            }
+            // OPTIGA expects the r and s integers only, the host library the Ecdsa-Sig-Value sequence
+            if ((NULL == p_curve)
+                || ((OPTIGA_CRYPT_DER_HEADER_SIZE(signature_length) + signature_length)
+                    > sizeof(der_signature))) {
+                break;
+            }
+            index = optiga_crypt_der_set_header(
+                der_signature,
+                OPTIGA_CRYPT_DER_TAG_SEQUENCE,
+                signature_length
+            );
+            pal_os_memcpy(&der_signature[index], p_signature, signature_length);
+            p_signature = der_signature;
+            signature_length += index;
+        } else {
+            if ((0U == (me->verify_policy & OPTIGA_CRYPT_VERIFY_POLICY_HOST_RSA))
+                || ((OPTIGA_RSA_KEY_1024_BIT_EXPONENTIAL != p_public_key->key_type)
+                    && (OPTIGA_RSA_KEY_2048_BIT_EXPONENTIAL != p_public_key->key_type))) {
+                break;
+            }
+            p_algorithm = optiga_crypt_oid_rsa_encryption;
+            algorithm_length = sizeof(optiga_crypt_oid_rsa_encryption);
+        }
+
+        // SubjectPublicKeyInfo: SEQUENCE {SEQUENCE {algorithm, curve}, BIT STRING public key}
+        if (p_public_key->length > OPTIGA_CRYPT_HOST_VERIFY_KEY_INFO_MAX_SIZE) {
+            break;
+        }
+        key_info_length = OPTIGA_CRYPT_DER_HEADER_SIZE(algorithm_length + curve_length) + algorithm_length
+            + curve_length + p_public_key->length;
+        if ((OPTIGA_CRYPT_DER_HEADER_SIZE(key_info_length) + key_info_length) > sizeof(key_info)) {
+            break;
+        }
+        index = optiga_crypt_der_set_header(key_info, OPTIGA_CRYPT_DER_TAG_SEQUENCE, key_info_length);
+        index += optiga_crypt_der_set_header(
+            &key_info[index],
+            OPTIGA_CRYPT_DER_TAG_SEQUENCE,
+            algorithm_length + curve_length
+        );
+        pal_os_memcpy(&key_info[index], p_algorithm, algorithm_length);
+        index += algorithm_length;
+        if (NULL != p_curve) {
+            pal_os_memcpy(&key_info[index], p_curve, curve_length);
+            index += curve_length;
+        }
+        pal_os_memcpy(&key_info[index], p_public_key->public_key, p_public_key->length);
+        index += p_public_key->length;
+
+        pal_return_status = pal_crypt_verify_signature(
+            NULL,
+            key_info,
+            index,
+            p_digest,
+            digest_length,
+            p_signature,
+            signature_length
+        );
+        // Key type is not supported by the host crypto library, the verification is performed by OPTIGA
+        if (PAL_STATUS_INVALID_INPUT == pal_return_status) {
+            break;
+        }
+        *p_verify_status = (PAL_STATUS_SUCCESS == pal_return_status) ? OPTIGA_LIB_SUCCESS
+                                                                     : OPTIGA_CRYPT_ERROR_VERIFY_FAILED;
+        is_verified_on_host = TRUE;
+    } while (FALSE);
+
+    return (is_verified_on_host);
+}
+#endif  // OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+
 #if defined(OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED) || defined(OPTIGA_CRYPT_RSA_VERIFY_ENABLED)
 // lint --e{715} suppress "The salt_length argument is kept for future use"
 _STATIC_H optiga_lib_status_t optiga_crypt_verify(
@@ -235,6 +877,12 @@ _STATIC_H optiga_lib_status_t optiga_crypt_verify(
 ) {
     optiga_verify_sign_params_t *p_params;
     optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+    optiga_lib_status_t verify_status = OPTIGA_CRYPT_ERROR;
+#endif
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+    uint8_t cache_key[OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE];
+#endif
 
     do {
 #ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
@@ -250,6 +898,55 @@ _STATIC_H optiga_lib_status_t optiga_crypt_verify(
             break;
         }
 
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+        if ((OPTIGA_CRYPT_OID_DATA != public_key_source_type)
+            && (TRUE
+                == optiga_crypt_host_verify(
+                    me,
+                    cmd_param,
+                    p_digest,
+                    digest_length,
+                    p_signature,
+                    signature_length,
+                    (const public_key_from_host_t *)p_public_key,
+                    &verify_status
+                ))) {
+            // Verified on the host, the handler is invoked before returning
+            me->handler(me->caller_context, verify_status);
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+#endif
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+        if ((OPTIGA_CRYPT_OID_DATA == public_key_source_type)
+            && (TRUE == optiga_crypt_result_cache_is_selected(me))
+            && (PAL_STATUS_SUCCESS
+                == optiga_crypt_result_cache_key(
+                    OPTIGA_CRYPT_RESULT_CACHE_OPERATION_VERIFY,
+                    cmd_param,
+                    *((const uint16_t *)p_public_key),
+                    p_digest,
+                    digest_length,
+                    p_signature,
+                    signature_length,
+                    cache_key
+                ))
+            && (TRUE
+                == optiga_crypt_result_cache_lookup(
+                    me,
+                    cache_key,
+                    *((const uint16_t *)p_public_key),
+                    NULL,
+                    0
+                ))) {
+            // Verified before, the handler is invoked before returning
+            me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+#endif
+
         me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
         p_params = (optiga_verify_sign_params_t *)&(me->params.optiga_verify_sign_params);
         pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
@@ -275,6 +972,9 @@ _STATIC_H optiga_lib_status_t optiga_crypt_verify(
         );
         if (OPTIGA_LIB_SUCCESS != return_value) {
             me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+            optiga_crypt_result_cache_complete(me, return_value);
+#endif
         }
     } while (FALSE);
     optiga_crypt_reset_protection_level(me);
@@ -503,6 +1203,123 @@ _STATIC_H optiga_lib_status_t optiga_crypt_symmetric_mode_generic(
 
 #endif  //(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || (OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_ENABLED) || (OPTIGA_CRYPT_HMAC_VERIFY_ENABLED)
 
+#if (defined(OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || defined(OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) \
+     || defined(OPTIGA_CRYPT_HMAC_ENABLED)) \
+    && defined(OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+_STATIC_H optiga_lib_status_t optiga_crypt_symmetric_stream_generic(
+    optiga_crypt_t *me,
+    uint8_t mode,
+    uint16_t symmetric_key_oid,
+    const uint8_t *iv,
+    uint16_t iv_length,
+    const symmetric_data_stream_t *p_sym_stream,
+    uint8_t enc_dec_type,
+    uint8_t operation_mode
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+    optiga_encrypt_sym_params_t *p_params;
+    bool_t is_block_mode = (((uint8_t)OPTIGA_SYMMETRIC_ECB == mode)
+                            || ((uint8_t)OPTIGA_SYMMETRIC_CBC == mode))
+                               ? TRUE
+                               : FALSE;
+    uint32_t in_data_length = p_sym_stream->length;
+
+    do {
+        if (0U == p_sym_stream->length) {
+            break;
+        }
+#ifdef OPTIGA_CRYPT_HMAC_ENABLED
+        if (OPTIGA_CRYPT_HMAC == operation_mode) {
+            // HMAC processes data of any length
+            if ((TRUE == p_sym_stream->padding) || (0U == p_sym_stream->buffer_length)) {
+                break;
+            }
+        } else
+#endif  // OPTIGA_CRYPT_HMAC_ENABLED
+        {
+            if (OPTIGA_CRYPT_SYM_STREAM_BLOCK_SIZE > p_sym_stream->buffer_length) {
+                break;
+            }
+            // Padding and decryption are supported only for the block modes
+            if (((TRUE == p_sym_stream->padding)
+                 || (OPTIGA_CRYPT_SYMMETRIC_DECRYPTION == enc_dec_type))
+                && (FALSE == is_block_mode)) {
+                break;
+            }
+            if ((FALSE == is_block_mode) && ((uint8_t)OPTIGA_SYMMETRIC_CBC_MAC != mode)
+                && ((uint8_t)OPTIGA_SYMMETRIC_CMAC != mode)) {
+                break;
+            }
+            if ((TRUE == p_sym_stream->padding)
+                && (OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION == enc_dec_type)) {
+                // PKCS#7 padding adds a complete block to block aligned data
+                in_data_length += OPTIGA_CRYPT_SYM_STREAM_BLOCK_SIZE
+                                  - (p_sym_stream->length % OPTIGA_CRYPT_SYM_STREAM_BLOCK_SIZE);
+            } else if (((uint8_t)OPTIGA_SYMMETRIC_CMAC != mode)
+                       && (0U != (p_sym_stream->length % OPTIGA_CRYPT_SYM_STREAM_BLOCK_SIZE))) {
+                // Only CMAC processes data which is not block aligned
+                break;
+            }
+        }
+        // Check if instance is in use
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+
+        p_params = (optiga_encrypt_sym_params_t *)&(me->params.optiga_symmetric_enc_dec_params);
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
+
+        p_params->mode = mode;
+        p_params->symmetric_key_oid = symmetric_key_oid;
+        p_params->in_data_length = in_data_length;
+        p_params->iv = iv;
+        p_params->iv_length = iv_length;
+        p_params->original_sequence = OPTIGA_CRYPT_SYM_START_FINAL;
+        p_params->operation_mode = operation_mode;
+        p_params->p_sym_stream = p_sym_stream;
+
+        switch (enc_dec_type) {
+#ifdef OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
+            case OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION: {
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+                me->protection_level |= OPTIGA_COMMS_COMMAND_PROTECTION;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+                OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+                OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+                return_value = optiga_cmd_encrypt_sym(me->my_cmd, mode, p_params);
+            } break;
+#endif  // OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
+
+#ifdef OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
+            case OPTIGA_CRYPT_SYMMETRIC_DECRYPTION: {
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+                me->protection_level |= OPTIGA_COMMS_RESPONSE_PROTECTION;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+                OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+                OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+                return_value = optiga_cmd_decrypt_sym(
+                    me->my_cmd,
+                    mode,
+                    (optiga_decrypt_sym_params_t *)p_params
+                );
+            } break;
+#endif  // OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
+
+            default:
+                break;
+        }
+
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+
+    return (return_value);
+}
+#endif  // ((OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED) || (OPTIGA_CRYPT_SYM_DECRYPT_ENABLED) || (OPTIGA_CRYPT_HMAC_ENABLED)) && (OPTIGA_CRYPT_SYM_STREAM_ENABLED)
+
 #if defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
     || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED)
 _STATIC_H optiga_lib_status_t optiga_crypt_derive_key_generic(
@@ -564,6 +1381,7 @@ _STATIC_H optiga_lib_status_t optiga_crypt_derive_key_generic(
     return (return_value);
 }
 
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
 optiga_lib_status_t optiga_crypt_tls_prf_sha256(
     optiga_crypt_t *me,
     uint16_t secret,
@@ -588,7 +1406,9 @@ optiga_lib_status_t optiga_crypt_tls_prf_sha256(
         derived_key
     ));
 }
+#endif  // OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
 
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED
 optiga_lib_status_t optiga_crypt_tls_prf_sha384(
     optiga_crypt_t *me,
     uint16_t secret,
@@ -613,7 +1433,9 @@ optiga_lib_status_t optiga_crypt_tls_prf_sha384(
         derived_key
     ));
 }
+#endif  // OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED
 
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED
 optiga_lib_status_t optiga_crypt_tls_prf_sha512(
     optiga_crypt_t *me,
     uint16_t secret,
@@ -638,15 +1460,231 @@ optiga_lib_status_t optiga_crypt_tls_prf_sha512(
         derived_key
     ));
 }
+#endif  // OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED
 
 #endif  //(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED || OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || (OPTIGA_CRYPT_HKDF_ENABLED)
 
-#ifdef OPTIGA_CRYPT_HASH_ENABLED
-_STATIC_H optiga_lib_status_t optiga_crypt_hash_generic(
-    optiga_crypt_t *me,
-    uint8_t hash_algorithm,
-    uint8_t hash_sequence,
-    uint8_t source_of_data_to_hash,
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HOST_HASH_ENABLED)
+// Size of the tag identifying a hash context started on the host
+#define OPTIGA_CRYPT_HOST_HASH_TAG_SIZE (0x08)
+
+// Tag of a hash context started on the host, followed by the hash context of pal_crypt
+static const uint8_t optiga_crypt_host_hash_tag[OPTIGA_CRYPT_HOST_HASH_TAG_SIZE] =
+    {0x48, 0x4F, 0x53, 0x54, 0x48, 0x41, 0x53, 0x48};
+
+_STATIC_H uint8_t optiga_crypt_host_hash_digest_length(uint8_t hash_algorithm) {
+    uint8_t digest_length = 0;
+
+    switch (hash_algorithm) {
+        case OPTIGA_HASH_TYPE_SHA_256: {
+            digest_length = 32;
+            break;
+        }
+        case OPTIGA_HASH_TYPE_SHA_384: {
+            digest_length = 48;
+            break;
+        }
+        case OPTIGA_HASH_TYPE_SHA_512: {
+            digest_length = 64;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    return (digest_length);
+}
+
+_STATIC_H bool_t optiga_crypt_host_hash_is_selected(const optiga_crypt_t *me) {
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    // Protected communication is requested, the hash is calculated by OPTIGA
+    if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+        return (FALSE);
+    }
+#endif
+    return ((OPTIGA_CRYPT_HASH_ENGINE_HOST == me->hash_engine) ? TRUE : FALSE);
+}
+
+_STATIC_H bool_t optiga_crypt_host_hash_is_host_context(const optiga_hash_context_t *hash_ctx) {
+    uint8_t index;
+
+    if (hash_ctx->context_buffer_length <= OPTIGA_CRYPT_HOST_HASH_TAG_SIZE) {
+        return (FALSE);
+    }
+    for (index = 0; index < OPTIGA_CRYPT_HOST_HASH_TAG_SIZE; index++) {
+        if (optiga_crypt_host_hash_tag[index] != hash_ctx->context_buffer[index]) {
+            return (FALSE);
+        }
+    }
+    return (TRUE);
+}
+
+_STATIC_H bool_t optiga_crypt_host_hash(
+    const optiga_crypt_t *me,
+    uint8_t hash_algorithm,
+    uint8_t hash_sequence,
+    uint8_t source_of_data_to_hash,
+    optiga_hash_context_t *hash_ctx,
+    const void *data_to_hash,
+    uint8_t *hash_output,
+    optiga_lib_status_t *p_hash_status
+) {
+    uint8_t context[OPTIGA_HASH_CONTEXT_LENGTH_SHA_512];
+    uint8_t *p_context = context;
+    uint16_t context_length = sizeof(context);
+    uint8_t digest_length;
+    const hash_data_from_host_t *p_hash_data = (const hash_data_from_host_t *)data_to_hash;
+    pal_status_t pal_return_status = PAL_STATUS_SUCCESS;
+    bool_t is_hashed_on_host = FALSE;
+
+    do {
+        if ((OPTIGA_CRYPT_HASH_CONTINUE == hash_sequence)
+            || (OPTIGA_CRYPT_HASH_FINAL == hash_sequence)) {
+            // Continued by the engine which started the hash context
+            if (FALSE == optiga_crypt_host_hash_is_host_context(hash_ctx)) {
+                break;
+            }
+            is_hashed_on_host = TRUE;
+            digest_length = optiga_crypt_host_hash_digest_length(hash_ctx->hash_algo);
+            p_context = &hash_ctx->context_buffer[OPTIGA_CRYPT_HOST_HASH_TAG_SIZE];
+            if (OPTIGA_CRYPT_HASH_FINAL == hash_sequence) {
+                pal_return_status =
+                    pal_crypt_hash_finalize(NULL, digest_length, p_context, hash_output);
+            } else if (OPTIGA_CRYPT_OID_DATA == source_of_data_to_hash) {
+                // Data in OPTIGA cannot be added to a hash context on the host
+                *p_hash_status = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+                break;
+            } else {
+                pal_return_status = pal_crypt_hash_update(
+                    NULL,
+                    digest_length,
+                    p_context,
+                    p_hash_data->buffer,
+                    p_hash_data->length
+                );
+            }
+            *p_hash_status =
+                (PAL_STATUS_SUCCESS == pal_return_status) ? OPTIGA_LIB_SUCCESS : OPTIGA_CRYPT_ERROR;
+            break;
+        }
+
+        digest_length = optiga_crypt_host_hash_digest_length(hash_algorithm);
+        if ((FALSE == optiga_crypt_host_hash_is_selected(me)) || (0U == digest_length)) {
+            break;
+        }
+        if (OPTIGA_CRYPT_HASH_START == hash_sequence) {
+            if (hash_ctx->context_buffer_length <= OPTIGA_CRYPT_HOST_HASH_TAG_SIZE) {
+                break;
+            }
+            p_context = &hash_ctx->context_buffer[OPTIGA_CRYPT_HOST_HASH_TAG_SIZE];
+            context_length = hash_ctx->context_buffer_length - OPTIGA_CRYPT_HOST_HASH_TAG_SIZE;
+        } else if (OPTIGA_CRYPT_OID_DATA == source_of_data_to_hash) {
+            // Data in OPTIGA is hashed by OPTIGA
+            break;
+        } else {
+            // Single hash in a local context
+        }
+        // Hash algorithm or context buffer is not supported by the host crypto library, the hash is calculated by OPTIGA
+        if (PAL_STATUS_SUCCESS != pal_crypt_hash_start(NULL, digest_length, p_context, context_length)) {
+            break;
+        }
+        is_hashed_on_host = TRUE;
+        if (OPTIGA_CRYPT_HASH_START == hash_sequence) {
+            pal_os_memcpy(
+                hash_ctx->context_buffer,
+                optiga_crypt_host_hash_tag,
+                OPTIGA_CRYPT_HOST_HASH_TAG_SIZE
+            );
+        } else {
+            pal_return_status = pal_crypt_hash_update(
+                NULL,
+                digest_length,
+                p_context,
+                p_hash_data->buffer,
+                p_hash_data->length
+            );
+            if (PAL_STATUS_SUCCESS == pal_return_status) {
+                pal_return_status =
+                    pal_crypt_hash_finalize(NULL, digest_length, p_context, hash_output);
+            }
+        }
+        *p_hash_status =
+            (PAL_STATUS_SUCCESS == pal_return_status) ? OPTIGA_LIB_SUCCESS : OPTIGA_CRYPT_ERROR;
+    } while (FALSE);
+
+    return (is_hashed_on_host);
+}
+
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+_STATIC_H bool_t optiga_crypt_host_hash_stream(
+    const optiga_crypt_t *me,
+    uint8_t hash_algorithm,
+    const hash_data_stream_t *p_hash_stream,
+    uint8_t *hash_output,
+    optiga_lib_status_t *p_hash_status
+) {
+    uint8_t context[OPTIGA_HASH_CONTEXT_LENGTH_SHA_512];
+    uint8_t digest_length = optiga_crypt_host_hash_digest_length(hash_algorithm);
+    uint32_t hashed_length = 0;
+    uint32_t fragment_length;
+    uint16_t read_length;
+    optiga_lib_status_t hash_status = OPTIGA_LIB_SUCCESS;
+
+    if ((FALSE == optiga_crypt_host_hash_is_selected(me)) || (0U == digest_length)
+        || (PAL_STATUS_SUCCESS != pal_crypt_hash_start(NULL, digest_length, context, sizeof(context)))) {
+        return (FALSE);
+    }
+
+    while ((OPTIGA_LIB_SUCCESS == hash_status) && (hashed_length < p_hash_stream->length)) {
+        fragment_length = p_hash_stream->length - hashed_length;
+        if (fragment_length > p_hash_stream->buffer_length) {
+            fragment_length = p_hash_stream->buffer_length;
+        }
+        read_length = 0;
+        hash_status = p_hash_stream->reader(
+            p_hash_stream->p_stream_ctx,
+            p_hash_stream->p_buffer,
+            (uint16_t)fragment_length,
+            &read_length
+        );
+        if (OPTIGA_LIB_SUCCESS != hash_status) {
+            break;
+        }
+        // Stream ended before the specified length or the reader exceeded the buffer
+        if ((0U == read_length) || (read_length > fragment_length)) {
+            hash_status = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+        if (PAL_STATUS_SUCCESS
+            != pal_crypt_hash_update(NULL, digest_length, context, p_hash_stream->p_buffer, read_length)) {
+            hash_status = OPTIGA_CRYPT_ERROR;
+            break;
+        }
+        hashed_length += read_length;
+        if (NULL != p_hash_stream->progress_handler) {
+            p_hash_stream->progress_handler(
+                p_hash_stream->p_stream_ctx,
+                hashed_length,
+                p_hash_stream->length
+            );
+        }
+    }
+    if ((OPTIGA_LIB_SUCCESS == hash_status)
+        && (PAL_STATUS_SUCCESS != pal_crypt_hash_finalize(NULL, digest_length, context, hash_output))) {
+        hash_status = OPTIGA_CRYPT_ERROR;
+    }
+    *p_hash_status = hash_status;
+    return (TRUE);
+}
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
+#endif  // (OPTIGA_CRYPT_HASH_ENABLED) && (OPTIGA_CRYPT_HOST_HASH_ENABLED)
+
+#ifdef OPTIGA_CRYPT_HASH_ENABLED
+_STATIC_H optiga_lib_status_t optiga_crypt_hash_generic(
+    optiga_crypt_t *me,
+    uint8_t hash_algorithm,
+    uint8_t hash_sequence,
+    uint8_t source_of_data_to_hash,
     optiga_hash_context_t *hash_ctx,
     uint32_t context_length,
     const void *data_to_hash,
@@ -655,12 +1693,73 @@ _STATIC_H optiga_lib_status_t optiga_crypt_hash_generic(
 ) {
     optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
     optiga_calc_hash_params_t *p_params;
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    optiga_lib_status_t hash_status = OPTIGA_CRYPT_ERROR;
+#endif
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+    uint8_t cache_key[OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE];
+    const hash_data_in_optiga_t *p_hash_oid = (const hash_data_in_optiga_t *)data_to_hash;
+    uint8_t hash_range[4];
+#endif
     do {
         if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
             return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
             break;
         }
 
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+        if (TRUE
+            == optiga_crypt_host_hash(
+                me,
+                hash_algorithm,
+                hash_sequence,
+                source_of_data_to_hash,
+                hash_ctx,
+                data_to_hash,
+                hash_output,
+                &hash_status
+            )) {
+            // Hashed on the host, the handler is invoked before returning
+            me->handler(me->caller_context, hash_status);
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+#endif
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+        if ((OPTIGA_CRYPT_HASH_START_FINAL == hash_sequence)
+            && (OPTIGA_CRYPT_OID_DATA == source_of_data_to_hash)
+            && ((uint8_t)OPTIGA_HASH_TYPE_SHA_256 == hash_algorithm)
+            && (TRUE == optiga_crypt_result_cache_is_selected(me))) {
+            optiga_common_set_uint16(&hash_range[0], p_hash_oid->offset);
+            optiga_common_set_uint16(&hash_range[2], p_hash_oid->length);
+            if ((PAL_STATUS_SUCCESS
+                 == optiga_crypt_result_cache_key(
+                     OPTIGA_CRYPT_RESULT_CACHE_OPERATION_HASH,
+                     hash_algorithm,
+                     p_hash_oid->oid,
+                     hash_range,
+                     sizeof(hash_range),
+                     NULL,
+                     0,
+                     cache_key
+                 ))
+                && (TRUE
+                    == optiga_crypt_result_cache_lookup(
+                        me,
+                        cache_key,
+                        p_hash_oid->oid,
+                        hash_output,
+                        OPTIGA_CRYPT_RESULT_CACHE_DIGEST_SIZE
+                    ))) {
+                // Hashed before, the handler is invoked before returning
+                me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+                return_value = OPTIGA_LIB_SUCCESS;
+                break;
+            }
+        }
+#endif
+
         me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
         p_params = (optiga_calc_hash_params_t *)&(me->params.optiga_calc_hash_params);
         pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
@@ -689,6 +1788,9 @@ _STATIC_H optiga_lib_status_t optiga_crypt_hash_generic(
             optiga_cmd_calc_hash(me->my_cmd, hash_algorithm, (optiga_calc_hash_params_t *)p_params);
         if (OPTIGA_LIB_SUCCESS != return_value) {
             me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+            optiga_crypt_result_cache_complete(me, return_value);
+#endif
         }
     } while (FALSE);
     optiga_crypt_reset_protection_level(me);
@@ -715,6 +1817,18 @@ void optiga_crypt_set_comms_params(optiga_crypt_t *me, uint8_t parameter_type, u
 }
 #endif
 
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+void optiga_crypt_set_verify_policy(optiga_crypt_t *me, uint8_t verify_policy) {
+    me->verify_policy = verify_policy;
+}
+#endif
+
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+void optiga_crypt_set_hash_engine(optiga_crypt_t *me, uint8_t hash_engine) {
+    me->hash_engine = hash_engine;
+}
+#endif
+
 optiga_crypt_t *
 optiga_crypt_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context) {
     optiga_crypt_t *me = NULL;
@@ -757,6 +1871,15 @@ optiga_lib_status_t optiga_crypt_destroy(optiga_crypt_t *me) {
             return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
             break;
         }
+#endif
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+        if (NULL != me->p_random_pool) {
+            pal_os_memset(me->p_random_pool, 0x00, sizeof(optiga_crypt_random_pool_t));
+            pal_os_free(me->p_random_pool);
+        }
+#endif
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+        optiga_crypt_result_cache_complete(me, OPTIGA_CRYPT_ERROR);
 #endif
         return_value = optiga_cmd_destroy(me->my_cmd);
         pal_os_free(me);
@@ -780,6 +1903,50 @@ optiga_lib_status_t optiga_crypt_random(
             return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
             break;
         }
+#endif
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+        if ((NULL != me->p_random_pool) && (OPTIGA_RNG_TYPE_DRNG == rng_type)
+            && (OPTIGA_CRYPT_MINIMUM_RANDOM_DATA_LENGTH <= random_data_length)
+            && (OPTIGA_CRYPT_RANDOM_POOL_MAX_REQUEST_LENGTH >= random_data_length)) {
+            if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+                return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+                break;
+            }
+            if ((TRUE == me->p_random_pool->is_instantiated)
+                && (FALSE == me->p_random_pool->prediction_resistance)
+                && (me->p_random_pool->reseed_counter < me->p_random_pool->reseed_interval)) {
+                // Served from the host DRBG, the handler is invoked before returning
+                optiga_crypt_reset_protection_level(me);
+                me->handler(
+                    me->caller_context,
+                    optiga_crypt_random_pool_generate(
+                        me->p_random_pool,
+                        FALSE,
+                        random_data,
+                        random_data_length
+                    )
+                );
+                return_value = OPTIGA_LIB_SUCCESS;
+                break;
+            }
+            // (Re)seed from OPTIGA TRNG, the request is completed in the event handler
+            me->p_random_pool->p_random_data = random_data;
+            me->p_random_pool->random_data_length = random_data_length;
+            me->p_random_pool->is_seed_pending = TRUE;
+            return_value = optiga_crypt_get_random(
+                me,
+                (uint8_t)OPTIGA_RNG_TYPE_TRNG,
+                me->p_random_pool->seed,
+                OPTIGA_CRYPT_RANDOM_POOL_SEED_SIZE,
+                NULL,
+                0x00,
+                FALSE
+            );
+            if (OPTIGA_LIB_SUCCESS != return_value) {
+                me->p_random_pool->is_seed_pending = FALSE;
+            }
+            break;
+        }
 #endif
         return_value = optiga_crypt_get_random(
             me,
@@ -796,6 +1963,75 @@ optiga_lib_status_t optiga_crypt_random(
 }
 #endif  // OPTIGA_CRYPT_RANDOM_ENABLED
 
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+optiga_lib_status_t optiga_crypt_random_pool_enable(
+    optiga_crypt_t *me,
+    const optiga_crypt_random_pool_config_t *p_config
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == me) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        if (NULL == me->p_random_pool) {
+            me->p_random_pool =
+                (optiga_crypt_random_pool_t *)pal_os_calloc(1, sizeof(optiga_crypt_random_pool_t));
+            if (NULL == me->p_random_pool) {
+                return_value = OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+                break;
+            }
+        }
+
+        me->p_random_pool->reseed_interval = OPTIGA_CRYPT_RANDOM_POOL_DEFAULT_RESEED_INTERVAL;
+        me->p_random_pool->prediction_resistance = FALSE;
+        if (NULL != p_config) {
+            if (0U != p_config->reseed_interval) {
+                me->p_random_pool->reseed_interval = p_config->reseed_interval;
+            }
+            me->p_random_pool->prediction_resistance = p_config->prediction_resistance;
+        }
+        // Reseed with the next request
+        me->p_random_pool->reseed_counter = me->p_random_pool->reseed_interval;
+        return_value = OPTIGA_LIB_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_crypt_random_pool_disable(optiga_crypt_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == me) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        if (NULL != me->p_random_pool) {
+            pal_os_memset(me->p_random_pool, 0x00, sizeof(optiga_crypt_random_pool_t));
+            pal_os_free(me->p_random_pool);
+            me->p_random_pool = NULL;
+        }
+        return_value = OPTIGA_LIB_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
 #ifdef OPTIGA_CRYPT_HASH_ENABLED
 optiga_lib_status_t optiga_crypt_hash_start(optiga_crypt_t *me, optiga_hash_context_t *hash_ctx) {
     optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
@@ -916,7 +2152,489 @@ optiga_lib_status_t optiga_crypt_hash(
 
     return (return_value);
 }
-#endif  // OPTIGA_CRYPT_HASH_ENABLED
+#endif  // OPTIGA_CRYPT_HASH_ENABLED
+
+#if defined(OPTIGA_CRYPT_HASH_ENABLED) && defined(OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+optiga_lib_status_t optiga_crypt_hash_stream(
+    optiga_crypt_t *me,
+    optiga_hash_type_t hash_algorithm,
+    const hash_data_stream_t *p_hash_stream,
+    uint8_t *hash_output
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_calc_hash_params_t *p_params;
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    optiga_lib_status_t hash_status = OPTIGA_CRYPT_ERROR;
+#endif
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_hash_stream)
+            || (NULL == p_hash_stream->reader) || (NULL == p_hash_stream->p_buffer)
+            || (NULL == hash_output)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if ((0U == p_hash_stream->length) || (0U == p_hash_stream->buffer_length)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+        if (TRUE
+            == optiga_crypt_host_hash_stream(
+                me,
+                (uint8_t)hash_algorithm,
+                p_hash_stream,
+                hash_output,
+                &hash_status
+            )) {
+            // Hashed on the host, the handler is invoked before returning
+            me->handler(me->caller_context, hash_status);
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+#endif
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        p_params = (optiga_calc_hash_params_t *)&(me->params.optiga_calc_hash_params);
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
+
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+        p_params->hash_sequence = OPTIGA_CRYPT_HASH_START_FINAL;
+        p_params->p_hash_stream = p_hash_stream;
+        p_params->p_out_digest = hash_output;
+
+        return_value = optiga_cmd_calc_hash(
+            me->my_cmd,
+            (uint8_t)hash_algorithm,
+            (optiga_calc_hash_params_t *)p_params
+        );
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+
+    return (return_value);
+}
+#endif  // (OPTIGA_CRYPT_HASH_ENABLED) && (OPTIGA_CRYPT_HASH_STREAM_ENABLED)
+
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) && defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED)
+// Size of the public key buffer, sufficient for a BIT STRING encoded NIST P-521 public key
+#define OPTIGA_CRYPT_ECDHE_POOL_PUBLIC_KEY_SIZE (0x89)
+// Consecutive failed generations, after which the pool pauses until the application is opened again
+#define OPTIGA_CRYPT_ECDHE_POOL_MAX_FAILURES (0x03)
+// Free sessions required to start a generation, one session is always left to the application
+#define OPTIGA_CRYPT_ECDHE_POOL_MIN_FREE_SESSIONS (0x02)
+
+// Keypair slot is empty
+#define OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY (0x00)
+// Keypair is being generated
+#define OPTIGA_CRYPT_ECDHE_POOL_SLOT_GENERATING (0x01)
+// Keypair is ready to be served
+#define OPTIGA_CRYPT_ECDHE_POOL_SLOT_READY (0x02)
+// Keypair is being served
+#define OPTIGA_CRYPT_ECDHE_POOL_SLOT_SERVING (0x03)
+
+/** \brief Pre-generated ephemeral keypair */
+typedef struct optiga_crypt_ecdhe_pool_slot {
+    /// Instance holding the session with the private key
+    optiga_crypt_t *p_crypt;
+    /// Curve of the keypair
+    optiga_ecc_curve_t curve_id;
+    /// Key usage of the keypair
+    uint8_t key_usage;
+    /// State of the slot, OPTIGA_CRYPT_ECDHE_POOL_SLOT_XXX
+    volatile uint8_t state;
+    /// Length of the public key
+    uint16_t public_key_length;
+    /// Public key of the keypair
+    uint8_t public_key[OPTIGA_CRYPT_ECDHE_POOL_PUBLIC_KEY_SIZE];
+} optiga_crypt_ecdhe_pool_slot_t;
+
+/** \brief Pool of pre-generated ephemeral keypairs */
+typedef struct optiga_crypt_ecdhe_pool {
+    /// Keypair slots
+    optiga_crypt_ecdhe_pool_slot_t slots[OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS];
+    /// Number of configured slots, 0 if the pool is not started
+    uint8_t slot_count;
+    /// Number of consecutive failed generations
+    uint8_t failure_count;
+    /// Statistics
+    optiga_crypt_ecdhe_pool_stats_t stats;
+} optiga_crypt_ecdhe_pool_t;
+
+// Pool of OPTIGA instance 0
+_STATIC_H optiga_crypt_ecdhe_pool_t g_optiga_crypt_ecdhe_pool = {0};
+
+/*
+ * Completion of a background keypair generation
+ */
+_STATIC_H void optiga_crypt_ecdhe_pool_generated(void *p_ctx, optiga_lib_status_t event) {
+    optiga_crypt_ecdhe_pool_slot_t *p_slot = (optiga_crypt_ecdhe_pool_slot_t *)p_ctx;
+
+    if (OPTIGA_LIB_SUCCESS == event) {
+        g_optiga_crypt_ecdhe_pool.stats.generated_count++;
+        g_optiga_crypt_ecdhe_pool.failure_count = 0;
+        p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_READY;
+    } else {
+        g_optiga_crypt_ecdhe_pool.stats.failure_count++;
+        g_optiga_crypt_ecdhe_pool.failure_count++;
+        // lint --e{534} suppress "Releasing a session does not fail"
+        optiga_cmd_release_session(p_slot->p_crypt->my_cmd);
+        p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY;
+    }
+}
+
+/*
+ * Discards the ready keypairs and releases the sessions of the slots, which are not generating or serving.
+ * Returns the number of sessions still held by the pool.
+ */
+_STATIC_H uint8_t optiga_crypt_ecdhe_pool_release(optiga_crypt_ecdhe_pool_t *p_pool) {
+    optiga_crypt_ecdhe_pool_slot_t *p_slot;
+    uint8_t held_session_count = 0;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < p_pool->slot_count; index++) {
+        p_slot = &p_pool->slots[index];
+        if ((OPTIGA_CRYPT_ECDHE_POOL_SLOT_GENERATING == p_slot->state)
+            || (OPTIGA_CRYPT_ECDHE_POOL_SLOT_SERVING == p_slot->state)) {
+            held_session_count++;
+        } else if (OPTIGA_CRYPT_ECDHE_POOL_SLOT_READY == p_slot->state) {
+            // lint --e{534} suppress "Releasing a session does not fail"
+            optiga_cmd_release_session(p_slot->p_crypt->my_cmd);
+            pal_os_memset(p_slot->public_key, 0x00, sizeof(p_slot->public_key));
+            p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY;
+            p_pool->stats.discarded_count++;
+        } else {
+            // Empty slots hold no session
+        }
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (held_session_count);
+}
+
+/*
+ * Generates the keypair of the next empty slot, while OPTIGA is idle.
+ * Returns the number of sessions held by the pool.
+ */
+_STATIC_H uint8_t
+optiga_crypt_ecdhe_pool_idle_handler(void *p_ctx, uint8_t event, uint8_t free_session_count) {
+    optiga_crypt_ecdhe_pool_t *p_pool = (optiga_crypt_ecdhe_pool_t *)p_ctx;
+    optiga_crypt_ecdhe_pool_slot_t *p_slot = NULL;
+    optiga_key_id_t private_key = OPTIGA_KEY_ID_SESSION_BASED;
+    uint8_t held_session_count = 0;
+    uint8_t index;
+
+    do {
+        if (OPTIGA_CMD_IDLE_EVENT_RELEASE == event) {
+            held_session_count = optiga_crypt_ecdhe_pool_release(p_pool);
+            break;
+        }
+        for (index = 0; index < p_pool->slot_count; index++) {
+            if (OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY != p_pool->slots[index].state) {
+                held_session_count++;
+            }
+        }
+        if (OPTIGA_CMD_IDLE_EVENT_OPEN == event) {
+            // OPTIGA is usable again, the failures before are not counted
+            p_pool->failure_count = 0;
+            break;
+        }
+        if ((OPTIGA_CRYPT_ECDHE_POOL_MAX_FAILURES <= p_pool->failure_count)
+            || (OPTIGA_CRYPT_ECDHE_POOL_MIN_FREE_SESSIONS > free_session_count)) {
+            break;
+        }
+        for (index = 0; index < p_pool->slot_count; index++) {
+            // One generation at a time, to leave OPTIGA to the application as soon as possible
+            if (OPTIGA_CRYPT_ECDHE_POOL_SLOT_GENERATING == p_pool->slots[index].state) {
+                p_slot = NULL;
+                break;
+            }
+            if ((NULL == p_slot) && (OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY == p_pool->slots[index].state)) {
+                p_slot = &p_pool->slots[index];
+            }
+        }
+        if (NULL == p_slot) {
+            break;
+        }
+
+        p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_GENERATING;
+        p_slot->public_key_length = sizeof(p_slot->public_key);
+        if (OPTIGA_LIB_SUCCESS
+            != optiga_crypt_generate_keypair(
+                p_slot->p_crypt,
+                (uint8_t)p_slot->curve_id,
+                p_slot->key_usage,
+                FALSE,
+                &private_key,
+                p_slot->public_key,
+                &p_slot->public_key_length
+            )) {
+            optiga_crypt_ecdhe_pool_generated(p_slot, OPTIGA_CRYPT_ERROR);
+        } else {
+            held_session_count++;
+        }
+    } while (FALSE);
+
+    return (held_session_count);
+}
+
+/*
+ * Serves a session based keypair request from a ready keypair.
+ * Returns TRUE, if the session and the public key are handed over to the instance
+ */
+_STATIC_H bool_t optiga_crypt_ecdhe_pool_serve(
+    optiga_crypt_t *me,
+    optiga_ecc_curve_t curve_id,
+    uint8_t key_usage,
+    bool_t export_private_key,
+    const void *private_key,
+    uint8_t *public_key,
+    uint16_t *public_key_length
+) {
+    optiga_crypt_ecdhe_pool_t *p_pool = &g_optiga_crypt_ecdhe_pool;
+    optiga_crypt_ecdhe_pool_slot_t *p_slot = NULL;
+    bool_t is_served = FALSE;
+    uint8_t index;
+
+    do {
+        if ((0 == p_pool->slot_count) || (NULL == me) || (NULL == me->my_cmd) || (NULL == private_key)
+            || (NULL == public_key) || (NULL == public_key_length) || (FALSE != export_private_key)
+            || (OPTIGA_KEY_ID_SESSION_BASED != (optiga_key_id_t)(*((const uint16_t *)private_key)))
+            || (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state)) {
+            break;
+        }
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        // Protected communication is requested, the keypair is generated by OPTIGA
+        if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+            break;
+        }
+#endif
+
+        // Claim a ready keypair, a keypair is served only once
+        pal_os_lock_enter_critical_section();
+        for (index = 0; index < p_pool->slot_count; index++) {
+            if ((OPTIGA_CRYPT_ECDHE_POOL_SLOT_READY == p_pool->slots[index].state)
+                && (curve_id == p_pool->slots[index].curve_id)
+                && (key_usage == p_pool->slots[index].key_usage)
+                && (*public_key_length >= p_pool->slots[index].public_key_length)) {
+                p_slot = &p_pool->slots[index];
+                p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_SERVING;
+                break;
+            }
+        }
+        pal_os_lock_exit_critical_section();
+
+        if (NULL == p_slot) {
+            p_pool->stats.miss_count++;
+            break;
+        }
+
+        if (OPTIGA_LIB_SUCCESS == optiga_cmd_session_transfer(p_slot->p_crypt->my_cmd, me->my_cmd)) {
+            pal_os_memcpy(public_key, p_slot->public_key, p_slot->public_key_length);
+            *public_key_length = p_slot->public_key_length;
+            p_pool->stats.served_count++;
+            is_served = TRUE;
+        } else {
+            // The instance holds a session already, the keypair stays in the pool
+            p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_READY;
+            break;
+        }
+
+        pal_os_memset(p_slot->public_key, 0x00, sizeof(p_slot->public_key));
+        p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY;
+    } while (FALSE);
+
+    return (is_served);
+}
+
+optiga_lib_status_t optiga_crypt_ecdhe_pool_start(
+    const optiga_crypt_ecdhe_pool_config_t *p_config,
+    uint8_t config_count
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_crypt_ecdhe_pool_t *p_pool = &g_optiga_crypt_ecdhe_pool;
+    optiga_crypt_ecdhe_pool_slot_t *p_slot;
+    uint8_t config_index;
+    uint8_t keypair_count = 0;
+    uint8_t index;
+
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == p_config) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (0 != p_pool->slot_count) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        for (config_index = 0; config_index < config_count; config_index++) {
+            keypair_count += p_config[config_index].count;
+            if (OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS < keypair_count) {
+                break;
+            }
+        }
+        if ((0 == keypair_count) || (OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS < keypair_count)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        pal_os_memset(p_pool, 0x00, sizeof(optiga_crypt_ecdhe_pool_t));
+        return_value = OPTIGA_LIB_SUCCESS;
+        for (config_index = 0; config_index < config_count; config_index++) {
+            for (index = 0; index < p_config[config_index].count; index++) {
+                p_slot = &p_pool->slots[p_pool->slot_count];
+                p_slot->curve_id = p_config[config_index].curve_id;
+                p_slot->key_usage = p_config[config_index].key_usage;
+                p_slot->state = OPTIGA_CRYPT_ECDHE_POOL_SLOT_EMPTY;
+                p_slot->p_crypt = optiga_crypt_create(0, optiga_crypt_ecdhe_pool_generated, p_slot);
+                if (NULL == p_slot->p_crypt) {
+                    return_value = OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+                    break;
+                }
+                p_pool->slot_count++;
+            }
+        }
+        if ((OPTIGA_LIB_SUCCESS == return_value)
+            && (OPTIGA_LIB_SUCCESS
+                != optiga_cmd_idle_handler_attach(
+                    p_pool->slots[0].p_crypt->my_cmd,
+                    optiga_crypt_ecdhe_pool_idle_handler,
+                    p_pool
+                ))) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+        }
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            for (index = 0; index < p_pool->slot_count; index++) {
+                // lint --e{534} suppress "The instance is not in use, destroy does not fail"
+                optiga_crypt_destroy(p_pool->slots[index].p_crypt);
+            }
+            p_pool->slot_count = 0;
+        }
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_crypt_ecdhe_pool_stop(void) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_crypt_ecdhe_pool_t *p_pool = &g_optiga_crypt_ecdhe_pool;
+    uint8_t index;
+
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+        if (0 == p_pool->slot_count) {
+            break;
+        }
+        for (index = 0; index < p_pool->slot_count; index++) {
+            if ((OPTIGA_CRYPT_ECDHE_POOL_SLOT_GENERATING == p_pool->slots[index].state)
+                || (OPTIGA_CRYPT_ECDHE_POOL_SLOT_SERVING == p_pool->slots[index].state)) {
+                break;
+            }
+        }
+        if (index != p_pool->slot_count) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        // lint --e{534} suppress "Detaching the idle handler does not fail"
+        optiga_cmd_idle_handler_attach(p_pool->slots[0].p_crypt->my_cmd, NULL, NULL);
+        // Destroying the instances releases the sessions of the keypairs not served
+        for (index = 0; index < p_pool->slot_count; index++) {
+            // lint --e{534} suppress "The instance is not in use, destroy does not fail"
+            optiga_crypt_destroy(p_pool->slots[index].p_crypt);
+        }
+        pal_os_memset(p_pool->slots, 0x00, sizeof(p_pool->slots));
+        p_pool->slot_count = 0;
+        return_value = OPTIGA_LIB_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_crypt_ecdhe_pool_get_stats(optiga_crypt_ecdhe_pool_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+
+    if (NULL != p_stats) {
+        *p_stats = g_optiga_crypt_ecdhe_pool.stats;
+        return_value = OPTIGA_LIB_SUCCESS;
+    }
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED && OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+optiga_lib_status_t optiga_crypt_result_cache_enable(optiga_crypt_t *me, bool_t enable) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_lib_status_t attach_status;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        if (TRUE == enable) {
+            attach_status = optiga_cmd_write_handler_attach(
+                me->my_cmd,
+                optiga_crypt_result_cache_write_handler,
+                &g_optiga_crypt_result_cache
+            );
+            // Writes would not be observed, the cache is not enabled
+            if (OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == attach_status) {
+                return_value = OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+                break;
+            }
+            // Writes were not observed before the handler is attached, the cached results are discarded
+            if (OPTIGA_CMD_SUCCESS == attach_status) {
+                optiga_crypt_result_cache_clear();
+            }
+        }
+        me->result_cache_enabled = enable;
+        return_value = OPTIGA_LIB_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+void optiga_crypt_result_cache_clear(void) {
+    optiga_crypt_result_cache_t *p_cache = &g_optiga_crypt_result_cache;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_CRYPT_RESULT_CACHE_ENTRIES; index++) {
+        p_cache->entries[index].state = OPTIGA_CRYPT_RESULT_CACHE_ENTRY_FREE;
+    }
+    pal_os_lock_exit_critical_section();
+}
+
+optiga_lib_status_t optiga_crypt_result_cache_get_stats(optiga_crypt_result_cache_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+
+    if (NULL != p_stats) {
+        *p_stats = g_optiga_crypt_result_cache.stats;
+        return_value = OPTIGA_LIB_SUCCESS;
+    }
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_RESULT_CACHE_ENABLED
 
 #ifdef OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED
 optiga_lib_status_t optiga_crypt_ecc_generate_keypair(
@@ -928,16 +2646,37 @@ optiga_lib_status_t optiga_crypt_ecc_generate_keypair(
     uint8_t *public_key,
     uint16_t *public_key_length
 ) {
+    optiga_lib_status_t return_value;
     OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
-    return (optiga_crypt_generate_keypair(
-        me,
-        (uint8_t)curve_id,
-        key_usage,
-        export_private_key,
-        private_key,
-        public_key,
-        public_key_length
-    ));
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+    if (TRUE
+        == optiga_crypt_ecdhe_pool_serve(
+            me,
+            curve_id,
+            key_usage,
+            export_private_key,
+            private_key,
+            public_key,
+            public_key_length
+        )) {
+        // Served from a pre-generated keypair, the handler is invoked before returning
+        me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+        return_value = OPTIGA_LIB_SUCCESS;
+    } else
+#endif
+    {
+        return_value = optiga_crypt_generate_keypair(
+            me,
+            (uint8_t)curve_id,
+            key_usage,
+            export_private_key,
+            private_key,
+            public_key,
+            public_key_length
+        );
+    }
+    return (return_value);
 }
 #endif  // OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED
 
@@ -964,6 +2703,86 @@ optiga_lib_status_t optiga_crypt_ecdsa_sign(
 }
 #endif  // OPTIGA_CRYPT_ECDSA_SIGN_ENABLED
 
+#if defined(OPTIGA_CRYPT_ECDSA_SIGN_ENABLED) && defined(OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED)
+optiga_lib_status_t optiga_crypt_ecdsa_sign_batch(
+    optiga_crypt_t *me,
+    const uint8_t *const *digests,
+    uint8_t digest_length,
+    uint16_t digest_count,
+    optiga_key_id_t private_key,
+    uint8_t *const *signatures,
+    uint16_t *signature_lengths,
+    optiga_sign_batch_item_handler_t item_handler
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_calc_sign_params_t *p_params;
+    uint16_t item_index;
+
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == digests) || (NULL == signatures)
+            || (NULL == signature_lengths)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+        for (item_index = 0; item_index < digest_count; item_index++) {
+            if ((NULL == digests[item_index]) || (NULL == signatures[item_index])) {
+                break;
+            }
+        }
+        if (item_index < digest_count) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (0U == digest_count) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+
+        p_params = (optiga_calc_sign_params_t *)&(me->params.optiga_calc_sign_params);
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
+
+        // The command layer moves on to the next item after each signature
+        item_index = 0;
+        p_params->p_digest = digests[item_index];
+        p_params->digest_length = digest_length;
+        p_params->private_key_oid = private_key;
+        p_params->p_signature = signatures[item_index];
+        p_params->p_signature_length = &signature_lengths[item_index];
+        p_params->batch.p_digests = digests;
+        p_params->batch.p_signatures = signatures;
+        p_params->batch.p_signature_lengths = signature_lengths;
+        p_params->batch.item_handler = item_handler;
+        p_params->batch.p_item_handler_ctx = me->caller_context;
+        p_params->batch.item_count = digest_count;
+        p_params->batch.item_index = item_index;
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+
+        return_value = optiga_cmd_calc_sign(
+            me->my_cmd,
+            OPTIGA_CRYPT_ECDSA_FIPS_186_3_WITHOUT_HASH,
+            (optiga_calc_sign_params_t *)p_params
+        );
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_ENABLED && OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
 #ifdef OPTIGA_CRYPT_ECDSA_VERIFY_ENABLED
 optiga_lib_status_t optiga_crypt_ecdsa_verify(
     optiga_crypt_t *me,
@@ -1043,6 +2862,169 @@ optiga_lib_status_t optiga_crypt_ecdh(
 }
 #endif  // OPTIGA_CRYPT_ECDH_ENABLED
 
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+// APDU header and TLV headers of the secret OID, key length, info, derivation data and output of DeriveKey
+#define OPTIGA_CRYPT_KEY_SCHEDULE_DERIVE_KEY_OVERHEAD (0x19)
+// Maximum length of a derived key stored in the session OID
+#define OPTIGA_CRYPT_KEY_SCHEDULE_SESSION_KEY_MAX_LENGTH (0x42)
+// Response header of an exported derived key
+#define OPTIGA_CRYPT_KEY_SCHEDULE_RESPONSE_HEADER_SIZE (0x04)
+
+/*
+ * Checks the key derivation steps before queuing, a step rejected later would abort the key
+ * schedule after the shared secret calculation
+ */
+_STATIC_H optiga_lib_status_t optiga_crypt_key_schedule_check_steps(
+    const optiga_key_schedule_step_t *steps,
+    uint8_t step_count
+) {
+    optiga_lib_status_t return_value = OPTIGA_LIB_SUCCESS;
+    const optiga_key_schedule_step_t *p_step;
+    uint32_t apdu_length;
+    uint8_t step_index;
+
+    for (step_index = 0; step_index < step_count; step_index++) {
+        p_step = &steps[step_index];
+        switch (p_step->derivation_type) {
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED
+            case (uint8_t)OPTIGA_TLS12_PRF_SHA_256:
+#endif
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED
+            case (uint8_t)OPTIGA_TLS12_PRF_SHA_384:
+#endif
+#ifdef OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED
+            case (uint8_t)OPTIGA_TLS12_PRF_SHA_512:
+#endif
+#if defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+    || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED)
+            {
+                // TLS PRF derives from label and seed, the seed is mandatory
+                if ((0U != p_step->info_length) || (0U == p_step->random_data_length)) {
+                    return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+                }
+                break;
+            }
+#endif
+#ifdef OPTIGA_CRYPT_HKDF_ENABLED
+            case (uint8_t)OPTIGA_HKDF_SHA_256:
+            case (uint8_t)OPTIGA_HKDF_SHA_384:
+            case (uint8_t)OPTIGA_HKDF_SHA_512: {
+                // HKDF derives from salt and info
+                if (0U != p_step->label_length) {
+                    return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+                }
+                break;
+            }
+#endif
+            default: {
+                return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+                break;
+            }
+        }
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            break;
+        }
+
+        if (((NULL == p_step->label) && (0U != p_step->label_length))
+            || ((NULL == p_step->random_data) && (0U != p_step->random_data_length))
+            || ((NULL == p_step->info) && (0U != p_step->info_length))
+            || (0U == p_step->derived_key_length)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        // The derivation data and info must fit in a single DeriveKey command
+        apdu_length = (uint32_t)OPTIGA_CRYPT_KEY_SCHEDULE_DERIVE_KEY_OVERHEAD
+                      + p_step->label_length + p_step->random_data_length + p_step->info_length;
+        if ((uint32_t)OPTIGA_MAX_COMMS_BUFFER_SIZE < apdu_length) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        // The derived key is either exported in the response or stored in the session OID
+        if (((NULL != p_step->derived_key)
+             && ((OPTIGA_MAX_COMMS_BUFFER_SIZE - OPTIGA_CRYPT_KEY_SCHEDULE_RESPONSE_HEADER_SIZE)
+                 < p_step->derived_key_length))
+            || ((NULL == p_step->derived_key)
+                && (OPTIGA_CRYPT_KEY_SCHEDULE_SESSION_KEY_MAX_LENGTH
+                    < p_step->derived_key_length))) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_crypt_key_schedule(
+    optiga_crypt_t *me,
+    optiga_key_id_t private_key,
+    public_key_from_host_t *public_key,
+    const optiga_key_schedule_step_t *steps,
+    uint8_t step_count
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    optiga_key_schedule_params_t *p_params;
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == public_key)
+            || (NULL == public_key->public_key) || (NULL == steps)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (0U == step_count) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        return_value = optiga_crypt_key_schedule_check_steps(steps, step_count);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            break;
+        }
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+
+        p_params = (optiga_key_schedule_params_t *)&(me->params.optiga_key_schedule_params);
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_crypt_params_t));
+
+        p_params->calc_ssec.private_key = private_key;
+        p_params->calc_ssec.public_key = public_key;
+        p_params->calc_ssec.export_to_host = FALSE;
+        p_params->p_steps = steps;
+        p_params->step_count = step_count;
+
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        // The key derivation steps derive from the session OID
+        me->protection_level |= OPTIGA_COMMS_COMMAND_PROTECTION;
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+
+        return_value = optiga_cmd_key_schedule(
+            me->my_cmd,
+            OPTIGA_CRYPT_ECDH_KEY_AGREEMENT_ALGORITHM,
+            p_params
+        );
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_ECDH_ENABLED && OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED
+
 #if defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
     || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED)
 optiga_lib_status_t optiga_crypt_tls_prf(
@@ -1596,6 +3578,41 @@ optiga_lib_status_t optiga_crypt_symmetric_encrypt_ecb(
     return (return_value);
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+optiga_lib_status_t optiga_crypt_symmetric_encrypt_stream(
+    optiga_crypt_t *me,
+    optiga_symmetric_encryption_mode_t encryption_mode,
+    optiga_key_id_t symmetric_key_oid,
+    const uint8_t *iv,
+    uint16_t iv_length,
+    const symmetric_data_stream_t *p_sym_stream
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_sym_stream)
+            || (NULL == p_sym_stream->reader) || (NULL == p_sym_stream->writer)
+            || (NULL == p_sym_stream->p_buffer)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        return_value = optiga_crypt_symmetric_stream_generic(
+            me,
+            (uint8_t)encryption_mode,
+            (uint16_t)symmetric_key_oid,
+            iv,
+            iv_length,
+            p_sym_stream,
+            OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION,
+            OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION
+        );
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_SYM_ENCRYPT_ENABLED
 
 #ifdef OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
@@ -1820,6 +3837,41 @@ optiga_lib_status_t optiga_crypt_symmetric_decrypt_final(
     return (return_value);
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+optiga_lib_status_t optiga_crypt_symmetric_decrypt_stream(
+    optiga_crypt_t *me,
+    optiga_symmetric_encryption_mode_t encryption_mode,
+    optiga_key_id_t symmetric_key_oid,
+    const uint8_t *iv,
+    uint16_t iv_length,
+    const symmetric_data_stream_t *p_sym_stream
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_sym_stream)
+            || (NULL == p_sym_stream->reader) || (NULL == p_sym_stream->writer)
+            || (NULL == p_sym_stream->p_buffer)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        return_value = optiga_crypt_symmetric_stream_generic(
+            me,
+            (uint8_t)encryption_mode,
+            (uint16_t)symmetric_key_oid,
+            iv,
+            iv_length,
+            p_sym_stream,
+            OPTIGA_CRYPT_SYMMETRIC_DECRYPTION,
+            OPTIGA_CRYPT_SYMMETRIC_DECRYPTION
+        );
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_SYM_DECRYPT_ENABLED
 
 #ifdef OPTIGA_CRYPT_HMAC_ENABLED
@@ -1986,6 +4038,39 @@ optiga_lib_status_t optiga_crypt_hmac_finalize(
     return (return_value);
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+optiga_lib_status_t optiga_crypt_hmac_stream(
+    optiga_crypt_t *me,
+    optiga_hmac_type_t type,
+    uint16_t secret,
+    const symmetric_data_stream_t *p_sym_stream
+) {
+    optiga_lib_status_t return_value = OPTIGA_CRYPT_ERROR;
+    OPTIGA_CRYPT_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_sym_stream)
+            || (NULL == p_sym_stream->reader) || (NULL == p_sym_stream->writer)
+            || (NULL == p_sym_stream->p_buffer)) {
+            return_value = OPTIGA_CRYPT_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        return_value = optiga_crypt_symmetric_stream_generic(
+            me,
+            (uint8_t)type,
+            secret,
+            NULL,
+            0,
+            p_sym_stream,
+            OPTIGA_CRYPT_SYMMETRIC_ENCRYPTION,
+            OPTIGA_CRYPT_HMAC
+        );
+    } while (FALSE);
+    optiga_crypt_reset_protection_level(me);
+    return (return_value);
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
 #endif  // OPTIGA_CRYPT_HMAC_ENABLED
 
 #ifdef OPTIGA_CRYPT_HKDF_ENABLED
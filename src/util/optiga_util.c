@@ -13,11 +13,24 @@
  * @{
  */
 
+#include <stdio.h>
 #include "optiga_util.h"
 
 #include "optiga_lib_common_internal.h"
 #include "optiga_lib_logger.h"
 #include "pal_os_memory.h"
+#ifdef PAL_OS_EXECUTOR_ENABLED
+#include "pal_os_executor.h"
+#endif
+#if defined(OPTIGA_UTIL_SLOT_MANAGER_ENABLED) || defined(OPTIGA_UTIL_READ_CACHE_ENABLED) \
+    || defined(OPTIGA_UTIL_METADATA_STORE_ENABLED) || defined(OPTIGA_UTIL_WRITE_BEHIND_ENABLED) \
+    || defined(OPTIGA_UTIL_SEC_GOVERNOR_ENABLED) || defined(OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED)
+#include "pal_os_lock.h"
+#endif
+#if defined(OPTIGA_UTIL_READ_CACHE_ENABLED) || defined(OPTIGA_UTIL_WRITE_BEHIND_ENABLED) \
+    || defined(OPTIGA_UTIL_SEC_GOVERNOR_ENABLED) || defined(OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED)
+#include "pal_os_timer.h"
+#endif
 
 #if defined(OPTIGA_LIB_ENABLE_LOGGING) && defined(OPTIGA_LIB_ENABLE_UTIL_LOGGING)
 
@@ -59,226 +72,3413 @@ extern void optiga_cmd_set_shielded_connection_option(
     uint8_t shielded_connection_option
 );
 
-_STATIC_H void optiga_util_generic_event_handler(void *me, optiga_lib_status_t event) {
-    optiga_util_t *p_optiga_util = (optiga_util_t *)me;
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+// Cache entry is not used
+#define OPTIGA_UTIL_READ_CACHE_ENTRY_FREE (0x00)
+// Cache entry is reserved for the data of a read in progress
+#define OPTIGA_UTIL_READ_CACHE_ENTRY_PENDING (0x01)
+// Cache entry holds data
+#define OPTIGA_UTIL_READ_CACHE_ENTRY_VALID (0x02)
+// Global lifecycle state, evaluated by the access conditions of all data objects
+#define OPTIGA_UTIL_READ_CACHE_LCSG_OID (0xE0C0)
+// Application lifecycle state, evaluated by the access conditions of all data objects
+#define OPTIGA_UTIL_READ_CACHE_LCSA_OID (0xF1C0)
+
+/** \brief Entry of the read cache */
+struct optiga_util_read_cache_entry {
+    /// Data read
+    uint8_t data[OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE];
+    /// Output buffer of the read in progress, the data is copied from or to in case of a read-ahead
+    uint8_t *p_output;
+    /// Output length of the read in progress
+    uint16_t *p_output_length;
+    /// Instance of the read in progress
+    const optiga_util_t *p_owner;
+    /// Use counter value at the last store or hit
+    uint32_t last_use;
+    /// Time stamp in milliseconds, when the data was stored
+    uint32_t store_time;
+    /// Data object read
+    uint16_t oid;
+    /// Offset of the read
+    uint16_t offset;
+    /// Length requested by the read
+    uint16_t requested_length;
+    /// Length of the data read
+    uint16_t length;
+    /// OPTIGA_UTIL_READ_CACHE_ENTRY_XXX
+    uint8_t state;
+    /// Data is read ahead into the entry and serves reads at any offset within
+    bool_t is_read_ahead;
+};
+
+/** \brief Entry of the read cache type */
+typedef struct optiga_util_read_cache_entry optiga_util_read_cache_entry_t;
+
+/** \brief Read cache shared by all instances */
+typedef struct optiga_util_read_cache {
+    /// Cache entries
+    optiga_util_read_cache_entry_t entries[OPTIGA_UTIL_READ_CACHE_ENTRIES];
+    /// Counter ordering the entries by their last use
+    uint32_t use_counter;
+    /// Time to live of the entries in milliseconds, 0 if they do not expire
+    uint32_t ttl_ms;
+    /// Read-ahead length, 0 if disabled
+    uint16_t read_ahead_length;
+    /// Statistics
+    optiga_util_read_cache_stats_t stats;
+} optiga_util_read_cache_t;
+
+// Read cache
+_STATIC_H optiga_util_read_cache_t g_optiga_util_read_cache = {0};
+
+// Discards the data of the entry, a reserved entry is released by its owner
+_STATIC_H void optiga_util_read_cache_discard(optiga_util_read_cache_entry_t *p_entry) {
+    // The data of a read-ahead in progress is read into the entry, which must not be reused meanwhile
+    if (OPTIGA_UTIL_READ_CACHE_ENTRY_PENDING == p_entry->state) {
+        p_entry->p_owner = NULL;
+    } else {
+        p_entry->state = OPTIGA_UTIL_READ_CACHE_ENTRY_FREE;
+    }
+}
 
-    p_optiga_util->instance_state = OPTIGA_LIB_INSTANCE_FREE;
-    p_optiga_util->handler(p_optiga_util->caller_context, event);
+// Write handler attached to the OPTIGA instance, discards the data of the written data object.
+// The read access conditions may evaluate differently after the application is opened or closed,
+// the auto state is cleared or a lifecycle state is written, all data is discarded.
+_STATIC_H void optiga_util_read_cache_write_handler(void *p_ctx, uint16_t oid) {
+    optiga_util_read_cache_t *p_cache = (optiga_util_read_cache_t *)p_ctx;
+    bool_t is_all = FALSE;
+    uint8_t index;
+
+    if ((OPTIGA_CMD_WRITE_ALL_OIDS == oid) || (OPTIGA_CMD_WRITE_ACCESS_STATE == oid)
+        || (OPTIGA_UTIL_READ_CACHE_LCSG_OID == oid) || (OPTIGA_UTIL_READ_CACHE_LCSA_OID == oid)) {
+        is_all = TRUE;
+    }
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_UTIL_READ_CACHE_ENTRIES; index++) {
+        if ((OPTIGA_UTIL_READ_CACHE_ENTRY_FREE != p_cache->entries[index].state)
+            && ((TRUE == is_all) || (oid == p_cache->entries[index].oid))) {
+            optiga_util_read_cache_discard(&p_cache->entries[index]);
+            p_cache->stats.invalidation_count++;
+        }
+    }
+    pal_os_lock_exit_critical_section();
 }
 
-_STATIC_H void optiga_util_reset_protection_level(optiga_util_t *me) {
-#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-    if (NULL != me)
-#endif
-    {
-        OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL(me, OPTIGA_COMMS_DEFAULT_PROTECTION_LEVEL);
+// Stores the data of the read of the instance to the reserved entry, or releases the entry if it failed
+_STATIC_H void optiga_util_read_cache_complete(optiga_util_t *me, optiga_lib_status_t event) {
+    optiga_util_read_cache_t *p_cache = &g_optiga_util_read_cache;
+    optiga_util_read_cache_entry_t *p_entry;
+
+    pal_os_lock_enter_critical_section();
+    p_entry = me->p_read_cache_entry;
+    me->p_read_cache_entry = NULL;
+    if ((NULL != p_entry) && (OPTIGA_UTIL_READ_CACHE_ENTRY_PENDING == p_entry->state)) {
+        p_entry->state = OPTIGA_UTIL_READ_CACHE_ENTRY_FREE;
+        if (TRUE == p_entry->is_read_ahead) {
+            // The requested window is provided, even if the data object was written meanwhile
+            if (OPTIGA_LIB_SUCCESS == event) {
+                *p_entry->p_output_length = MIN(*p_entry->p_output_length, p_entry->length);
+                pal_os_memcpy(p_entry->p_output, p_entry->data, *p_entry->p_output_length);
+            } else {
+                *p_entry->p_output_length = 0;
+            }
+        } else if ((OPTIGA_LIB_SUCCESS == event)
+                   && (*p_entry->p_output_length <= p_entry->requested_length)) {
+            p_entry->length = *p_entry->p_output_length;
+            pal_os_memcpy(p_entry->data, p_entry->p_output, p_entry->length);
+        } else {
+            // Read failed, the data is not stored
+            p_entry->p_owner = NULL;
+        }
+        // The data is not stored, if the data object was written meanwhile
+        if ((OPTIGA_LIB_SUCCESS == event) && (me == p_entry->p_owner)) {
+            p_entry->last_use = ++p_cache->use_counter;
+            p_entry->store_time = pal_os_timer_get_time_in_milliseconds();
+            p_entry->state = OPTIGA_UTIL_READ_CACHE_ENTRY_VALID;
+        }
+        p_entry->p_output = NULL;
+        p_entry->p_output_length = NULL;
+        p_entry->p_owner = NULL;
     }
+    pal_os_lock_exit_critical_section();
 }
 
-_STATIC_H optiga_lib_status_t optiga_util_write_data_wrapper(
-    optiga_util_t *me,
-    uint16_t optiga_oid,
-    uint8_t write_type,
+// Checks whether the entry holds or reads the data requested
+_STATIC_H bool_t optiga_util_read_cache_is_match(
+    const optiga_util_read_cache_entry_t *p_entry,
+    uint16_t oid,
     uint16_t offset,
-    const uint8_t *p_buffer,
     uint16_t length
 ) {
-    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
-    optiga_set_data_object_params_t *p_params;
+    bool_t is_match = FALSE;
+
+    if ((OPTIGA_UTIL_READ_CACHE_ENTRY_FREE != p_entry->state) && (oid == p_entry->oid)) {
+        if (FALSE == p_entry->is_read_ahead) {
+            is_match = ((offset == p_entry->offset) && (length == p_entry->requested_length)) ? TRUE
+                                                                                              : FALSE;
+        } else if (OPTIGA_UTIL_READ_CACHE_ENTRY_PENDING == p_entry->state) {
+            // The data object is read ahead, the read is sent to OPTIGA without reserving another entry
+            is_match = TRUE;
+        } else {
+            // Within the data read, or beyond it if the data object ended before the read-ahead length
+            is_match = (((uint32_t)offset + length <= p_entry->length)
+                        || ((p_entry->length < p_entry->requested_length) && (offset < p_entry->length)))
+                ? TRUE
+                : FALSE;
+        }
+    }
+    return (is_match);
+}
 
+// Serves the read from the cache, otherwise reserves an entry for its data or the data read ahead
+_STATIC_H bool_t optiga_util_read_cache_lookup(
+    optiga_util_t *me,
+    uint16_t oid,
+    uint16_t offset,
+    uint8_t *p_buffer,
+    uint16_t *p_length,
+    uint16_t read_ahead_length
+) {
+    optiga_util_read_cache_t *p_cache = &g_optiga_util_read_cache;
+    optiga_util_read_cache_entry_t *p_entry = NULL;
+    optiga_util_read_cache_entry_t *p_free_entry = NULL;
+    bool_t is_served = FALSE;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
     do {
-#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_buffer)) {
-            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+        for (index = 0; index < OPTIGA_UTIL_READ_CACHE_ENTRIES; index++) {
+            p_entry = &p_cache->entries[index];
+            if ((OPTIGA_UTIL_READ_CACHE_ENTRY_VALID == p_entry->state) && (0U != p_cache->ttl_ms)
+                && ((pal_os_timer_get_time_in_milliseconds() - p_entry->store_time)
+                    >= p_cache->ttl_ms)) {
+                p_entry->state = OPTIGA_UTIL_READ_CACHE_ENTRY_FREE;
+                p_cache->stats.expiry_count++;
+            }
+            if (TRUE == optiga_util_read_cache_is_match(p_entry, oid, offset, *p_length)) {
+                break;
+            }
+            // Free entry, otherwise the least recently used data
+            if ((OPTIGA_UTIL_READ_CACHE_ENTRY_FREE == p_entry->state)
+                || ((OPTIGA_UTIL_READ_CACHE_ENTRY_VALID == p_entry->state)
+                    && ((NULL == p_free_entry)
+                        || ((OPTIGA_UTIL_READ_CACHE_ENTRY_VALID == p_free_entry->state)
+                            && (p_entry->last_use < p_free_entry->last_use))))) {
+                p_free_entry = p_entry;
+            }
+            p_entry = NULL;
+        }
+
+        if ((NULL != p_entry) && (OPTIGA_UTIL_READ_CACHE_ENTRY_VALID == p_entry->state)) {
+            if (TRUE == p_entry->is_read_ahead) {
+                *p_length = MIN(*p_length, (p_entry->length - offset));
+                pal_os_memcpy(p_buffer, &p_entry->data[offset], *p_length);
+            } else {
+                pal_os_memcpy(p_buffer, p_entry->data, p_entry->length);
+                *p_length = p_entry->length;
+            }
+            p_entry->last_use = ++p_cache->use_counter;
+            p_cache->stats.hit_count++;
+            is_served = TRUE;
+            break;
+        }
+
+        p_cache->stats.miss_count++;
+        // The same read is in progress, its data is stored by the owner
+        if ((NULL != p_entry) || (NULL == p_free_entry)) {
             break;
         }
+        p_free_entry->oid = oid;
+        p_free_entry->offset = offset;
+        p_free_entry->requested_length = *p_length;
+        p_free_entry->is_read_ahead = FALSE;
+        if (0U != read_ahead_length) {
+            p_free_entry->requested_length = read_ahead_length;
+            p_free_entry->length = 0;
+            p_free_entry->is_read_ahead = TRUE;
+            p_cache->stats.read_ahead_count++;
+        }
+        p_free_entry->p_output = p_buffer;
+        p_free_entry->p_output_length = p_length;
+        p_free_entry->p_owner = me;
+        p_free_entry->state = OPTIGA_UTIL_READ_CACHE_ENTRY_PENDING;
+        me->p_read_cache_entry = p_free_entry;
+    } while (FALSE);
+    pal_os_lock_exit_critical_section();
+
+    return (is_served);
+}
+
+// Provides the length the read is extended to, 0 if the read is not extended
+_STATIC_H uint16_t
+optiga_util_read_cache_get_read_ahead_length(uint16_t oid, uint16_t offset, uint16_t length) {
+    uint16_t read_ahead_length = g_optiga_util_read_cache.read_ahead_length;
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+    optiga_util_metadata_t metadata;
 #endif
 
-        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
-            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    if ((0U != offset) || (0U == length) || (length >= read_ahead_length)) {
+        read_ahead_length = 0;
+    }
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+    // The used size limits the read, a read covering it is not extended
+    if ((0U != read_ahead_length)
+        && (OPTIGA_LIB_SUCCESS == optiga_util_metadata_get(oid, &metadata))
+        && (0U != (OPTIGA_UTIL_METADATA_HAS_USED_SIZE & metadata.tag_mask))) {
+        read_ahead_length = (metadata.used_size > length) ? MIN(read_ahead_length, metadata.used_size)
+                                                          : 0U;
+    }
+#else
+    (void)oid;
+#endif
+    return (read_ahead_length);
+}
+
+// Checks whether the read of the instance uses the read cache
+_STATIC_H bool_t
+optiga_util_read_cache_is_selected(const optiga_util_t *me, uint16_t oid, uint16_t length) {
+    bool_t is_selected = me->read_cache_enabled;
+
+    // Security status, security event counter, last error codes and monotonic counters change without a write
+    if ((OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE < length) || (0xE0C1 == oid) || (0xF1C1 == oid)
+        || (0xE0C5 == oid) || (0xF1C2 == oid) || ((0xE120 <= oid) && (0xE123 >= oid))) {
+        is_selected = FALSE;
+    }
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    // Protected communication is requested, the read is performed by OPTIGA
+    if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+        is_selected = FALSE;
+    }
+#endif
+    return (is_selected);
+}
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+_STATIC_H void optiga_util_slot_manager_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+_STATIC_H void optiga_util_metadata_store_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+_STATIC_H void optiga_util_write_behind_handler(void *p_ctx, optiga_lib_status_t event);
+_STATIC_H void optiga_util_write_behind_window_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+_STATIC_H void optiga_util_sec_governor_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+_STATIC_H void optiga_util_performance_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+_STATIC_H void optiga_util_power_manager_hibernate_handler(void *p_ctx, optiga_lib_status_t event);
+#endif
+
+/*
+ * Checks whether the handler is a step of an operation chained by the library
+ */
+_STATIC_H bool_t optiga_util_is_internal_handler(callback_handler_t handler) {
+    bool_t is_internal = FALSE;
+
+    // Not compared if none of the chaining features is enabled
+    (void)handler;
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+    if (optiga_util_slot_manager_handler == handler) {
+        is_internal = TRUE;
+    }
+#endif
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+    if (optiga_util_metadata_store_handler == handler) {
+        is_internal = TRUE;
+    }
+#endif
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+    if ((optiga_util_write_behind_handler == handler)
+        || (optiga_util_write_behind_window_handler == handler)) {
+        is_internal = TRUE;
+    }
+#endif
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+    if (optiga_util_sec_governor_handler == handler) {
+        is_internal = TRUE;
+    }
+#endif
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+    if (optiga_util_performance_handler == handler) {
+        is_internal = TRUE;
+    }
+#endif
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    if (optiga_util_power_manager_hibernate_handler == handler) {
+        is_internal = TRUE;
+    }
+#endif
+    return (is_internal);
+}
+#endif  // PAL_OS_EXECUTOR_ENABLED
+
+/*
+ * Invokes the handler on completion of an operation. Only the application handler is queued to the
+ * completion executor, the steps chained by the library continue in the completing context.
+ */
+_STATIC_H void optiga_util_complete(callback_handler_t handler, void *p_ctx, optiga_lib_status_t event) {
+#ifdef PAL_OS_EXECUTOR_ENABLED
+    // Invoked by the completing context as well, if the executor is not running or its queue is full
+    if ((TRUE == optiga_util_is_internal_handler(handler))
+        || (PAL_STATUS_SUCCESS != pal_os_executor_post(handler, p_ctx, event))) {
+        handler(p_ctx, event);
+    }
+#else
+    handler(p_ctx, event);
+#endif
+}
+
+_STATIC_H void optiga_util_generic_event_handler(void *me, optiga_lib_status_t event) {
+    optiga_util_t *p_optiga_util = (optiga_util_t *)me;
+
+    p_optiga_util->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+    if (NULL != p_optiga_util->p_read_cache_entry) {
+        optiga_util_read_cache_complete(p_optiga_util, event);
+    }
+#endif
+    optiga_util_complete(p_optiga_util->handler, p_optiga_util->caller_context, event);
+}
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+// Weight of the previous average in the average resume latency, as power of two
+#define OPTIGA_UTIL_POWER_LATENCY_AVERAGE_SHIFT (3U)
+
+/** \brief Power manager of an OPTIGA instance */
+typedef struct optiga_util_power_manager {
+    /// Instance used to hibernate, NULL if the power manager is not running
+    optiga_util_t *p_util;
+    /// Configuration provided by the application
+    optiga_util_power_config_t config;
+    /// Statistics
+    optiga_util_power_stats_t stats;
+    /// Callback handler of the instance, restored on stop
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on stop
+    void *caller_context;
+} optiga_util_power_manager_t;
+
+// Power manager of OPTIGA instance 0
+_STATIC_H optiga_util_power_manager_t g_optiga_util_power_manager = {0};
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+// Identifier and version of the wear record
+#define OPTIGA_UTIL_SLOT_RECORD_MAGIC (0x534DU)
+#define OPTIGA_UTIL_SLOT_RECORD_VERSION (0x01U)
+// Wear record header: magic (2), version (1), slot count (1)
+#define OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE (0x04U)
+// Wear record entry: OID (2), flags (1), owner (2), write count (4)
+#define OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE (0x09U)
+#define OPTIGA_UTIL_SLOT_RECORD_SIZE \
+    (OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE \
+     + (OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS * OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE))
+// Flag of an allocated slot in the wear record
+#define OPTIGA_UTIL_SLOT_RECORD_FLAG_ALLOCATED (0x01U)
+// Maximum size of the metadata of a slot
+#define OPTIGA_UTIL_SLOT_METADATA_SIZE (0x40U)
+// Metadata tags evaluated by the discovery
+#define OPTIGA_UTIL_SLOT_METADATA_TAG (0x20U)
+#define OPTIGA_UTIL_SLOT_METADATA_TAG_USED_SIZE (0xC5U)
+#define OPTIGA_UTIL_SLOT_METADATA_TAG_ALGORITHM (0xE0U)
+
+/** \brief Operation of the key slot manager in progress */
+typedef enum optiga_util_slot_manager_state {
+    /// No operation
+    OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE = 0x00,
+    /// Reading the wear record
+    OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_RECORD,
+    /// Reading the metadata of the slots
+    OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_METADATA,
+    /// Writing the wear record
+    OPTIGA_UTIL_SLOT_MANAGER_STATE_WRITE_RECORD,
+} optiga_util_slot_manager_state_t;
+
+/** \brief Key slot manager */
+typedef struct optiga_util_slot_manager {
+    /// State of the slots
+    optiga_util_slot_info_t slots[OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS];
+    /// Number of slots
+    uint8_t slot_count;
+    /// OID of the wear record
+    uint16_t wear_record_oid;
+    /// Discovery is complete
+    bool_t is_ready;
+    /// Slots changed since the last discovery or synchronization
+    bool_t is_dirty;
+    /// Operation in progress
+    optiga_util_slot_manager_state_t state;
+    /// Slot of which the metadata is read
+    uint8_t slot_index;
+    /// Instance used for the operation in progress
+    optiga_util_t *p_util;
+    /// Callback handler of the instance, restored on completion
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on completion
+    void *caller_context;
+    /// Wear record read or written
+    uint8_t record[OPTIGA_UTIL_SLOT_RECORD_SIZE];
+    /// Metadata read
+    uint8_t metadata[OPTIGA_UTIL_SLOT_METADATA_SIZE];
+    /// Length of the wear record or metadata read
+    uint16_t length;
+} optiga_util_slot_manager_t;
+
+// Key slot manager shared by all instances
+_STATIC_H optiga_util_slot_manager_t g_optiga_util_slot_manager = {0};
+
+/*
+ * Provides the slot of the given OID, NULL if the OID is not managed
+ */
+_STATIC_H optiga_util_slot_info_t *
+optiga_util_slot_manager_find(optiga_util_slot_manager_t *p_manager, uint16_t oid) {
+    optiga_util_slot_info_t *p_slot = NULL;
+    uint8_t index;
+
+    for (index = 0; index < p_manager->slot_count; index++) {
+        if (oid == p_manager->slots[index].oid) {
+            p_slot = &p_manager->slots[index];
             break;
         }
+    }
+    return (p_slot);
+}
 
-        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
-        p_params = (optiga_set_data_object_params_t *)&(me->params.optiga_set_data_object_params);
-        pal_os_memset(&me->params, 0x00, sizeof(optiga_util_params_t));
+/*
+ * Restores the allocations and write counts of the configured slots from the wear record read
+ */
+_STATIC_H void optiga_util_slot_manager_parse_record(optiga_util_slot_manager_t *p_manager) {
+    const uint8_t *p_entry = p_manager->record + OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE;
+    optiga_util_slot_info_t *p_slot;
+    uint8_t entry_count = p_manager->record[3];
+    uint16_t value;
+    uint8_t index;
+
+    optiga_common_get_uint16(p_manager->record, &value);
+
+    if ((OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE <= p_manager->length)
+        && (OPTIGA_UTIL_SLOT_RECORD_MAGIC == value)
+        && (OPTIGA_UTIL_SLOT_RECORD_VERSION == p_manager->record[2])
+        && ((OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE + (entry_count * OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE))
+            <= p_manager->length)) {
+        // Entries of slots no longer configured are dropped
+        for (index = 0; index < entry_count; index++) {
+            optiga_common_get_uint16(p_entry, &value);
+            p_slot = optiga_util_slot_manager_find(p_manager, value);
+            if (NULL != p_slot) {
+                p_slot->is_allocated =
+                    (0U != (p_entry[2] & OPTIGA_UTIL_SLOT_RECORD_FLAG_ALLOCATED)) ? TRUE : FALSE;
+                optiga_common_get_uint16(&p_entry[3], &p_slot->owner_id);
+                p_slot->write_count = optiga_common_get_uint32(&p_entry[5]);
+            }
+            p_entry += OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE;
+        }
+    }
+}
 
-        if (OPTIGA_UTIL_COUNT_DATA_OBJECT == write_type) {
-            p_params->count = p_buffer[0];
-            p_params->buffer = NULL;
+/*
+ * Evaluates the metadata read for the slot, an occupied slot stays allocated
+ */
+_STATIC_H void optiga_util_slot_manager_parse_metadata(
+    const optiga_util_slot_manager_t *p_manager,
+    optiga_util_slot_info_t *p_slot
+) {
+    const uint8_t *p_metadata = p_manager->metadata;
+    uint16_t end;
+    uint16_t used_size;
+    uint16_t index = 2;
+
+    p_slot->is_occupied = FALSE;
+    if ((2U <= p_manager->length) && (OPTIGA_UTIL_SLOT_METADATA_TAG == p_metadata[0])) {
+        end = (uint16_t)(2U + p_metadata[1]);
+        end = (end > p_manager->length) ? p_manager->length : end;
+        while ((index + 2U) <= end) {
+            if ((OPTIGA_UTIL_SLOT_TYPE_DATA == p_slot->slot_type)
+                && (OPTIGA_UTIL_SLOT_METADATA_TAG_USED_SIZE == p_metadata[index])
+                && (2U == p_metadata[index + 1U]) && ((index + 4U) <= end)) {
+                optiga_common_get_uint16(&p_metadata[index + 2U], &used_size);
+                p_slot->is_occupied = (0U != used_size) ? TRUE : FALSE;
+            }
+            if ((OPTIGA_UTIL_SLOT_TYPE_DATA != p_slot->slot_type)
+                && (OPTIGA_UTIL_SLOT_METADATA_TAG_ALGORITHM == p_metadata[index])) {
+                p_slot->is_occupied = TRUE;
+            }
+            index += (uint16_t)(2U + p_metadata[index + 1U]);
+        }
+    }
+    if (TRUE == p_slot->is_occupied) {
+        p_slot->is_allocated = TRUE;
+    }
+}
+
+/*
+ * Serializes the slots into the wear record to be written
+ */
+_STATIC_H void optiga_util_slot_manager_build_record(optiga_util_slot_manager_t *p_manager) {
+    uint8_t *p_entry = p_manager->record + OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE;
+    const optiga_util_slot_info_t *p_slot;
+    uint8_t index;
+
+    optiga_common_set_uint16(p_manager->record, OPTIGA_UTIL_SLOT_RECORD_MAGIC);
+    p_manager->record[2] = OPTIGA_UTIL_SLOT_RECORD_VERSION;
+    p_manager->record[3] = p_manager->slot_count;
+    for (index = 0; index < p_manager->slot_count; index++) {
+        p_slot = &p_manager->slots[index];
+        optiga_common_set_uint16(p_entry, p_slot->oid);
+        p_entry[2] = (TRUE == p_slot->is_allocated) ? OPTIGA_UTIL_SLOT_RECORD_FLAG_ALLOCATED : 0U;
+        optiga_common_set_uint16(&p_entry[3], p_slot->owner_id);
+        optiga_common_set_uint32(&p_entry[5], p_slot->write_count);
+        p_entry += OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE;
+    }
+    p_manager->length = (uint16_t)(OPTIGA_UTIL_SLOT_RECORD_HEADER_SIZE
+                                   + (p_manager->slot_count * OPTIGA_UTIL_SLOT_RECORD_ENTRY_SIZE));
+}
+
+/*
+ * Completion of the discovery and synchronization steps, issues the next step or completes the operation
+ */
+_STATIC_H void optiga_util_slot_manager_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_slot_manager_t *p_manager = (optiga_util_slot_manager_t *)p_ctx;
+    optiga_util_t *p_util = p_manager->p_util;
+    optiga_lib_status_t return_value = event;
+    bool_t is_complete = TRUE;
+
+    switch (p_manager->state) {
+        case OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_RECORD: {
+            // An empty or not yet written wear record starts all slots free
+            if (OPTIGA_LIB_SUCCESS == event) {
+                optiga_util_slot_manager_parse_record(p_manager);
+            }
+            p_manager->state = OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_METADATA;
+            p_manager->slot_index = 0;
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+        case OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_METADATA: {
+            if (OPTIGA_LIB_SUCCESS == event) {
+                optiga_util_slot_manager_parse_metadata(
+                    p_manager,
+                    &p_manager->slots[p_manager->slot_index]
+                );
+                p_manager->slot_index++;
+            }
+            break;
+        }
+        case OPTIGA_UTIL_SLOT_MANAGER_STATE_WRITE_RECORD: {
+            if (OPTIGA_LIB_SUCCESS != event) {
+                pal_os_lock_enter_critical_section();
+                p_manager->is_dirty = TRUE;
+                pal_os_lock_exit_critical_section();
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if ((OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_METADATA == p_manager->state)
+        && (OPTIGA_LIB_SUCCESS == return_value)) {
+        if (p_manager->slot_index < p_manager->slot_count) {
+            p_manager->length = sizeof(p_manager->metadata);
+            return_value = optiga_util_read_metadata(
+                p_util,
+                p_manager->slots[p_manager->slot_index].oid,
+                p_manager->metadata,
+                &p_manager->length
+            );
+            is_complete = (OPTIGA_LIB_SUCCESS != return_value) ? TRUE : FALSE;
         } else {
-            p_params->count = 0;
-            p_params->buffer = p_buffer;
+            p_manager->is_ready = TRUE;
         }
-        p_params->oid = optiga_oid;
-        p_params->offset = offset;
-        p_params->data_or_metadata = 0;  // for Data
-        p_params->size = length;
-        p_params->written_size = 0;
-        p_params->write_type = write_type;
+    }
 
-        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
-        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+    if (TRUE == is_complete) {
+        p_manager->state = OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE;
+        p_util->handler = p_manager->handler;
+        p_util->caller_context = p_manager->caller_context;
+        p_manager->p_util = NULL;
+        optiga_util_complete(p_util->handler, p_util->caller_context, return_value);
+    }
+}
 
-        return_value = optiga_cmd_set_data_object(
-            me->my_cmd,
-            write_type,
-            (optiga_set_data_object_params_t *)p_params
+/*
+ * Issues the first step of an operation with the instance, restores its handler if the step fails
+ */
+_STATIC_H optiga_lib_status_t optiga_util_slot_manager_begin(
+    optiga_util_slot_manager_t *p_manager,
+    optiga_util_t *me,
+    optiga_util_slot_manager_state_t state
+) {
+    optiga_lib_status_t return_value;
+
+    p_manager->p_util = me;
+    p_manager->state = state;
+    p_manager->handler = me->handler;
+    p_manager->caller_context = me->caller_context;
+    me->handler = optiga_util_slot_manager_handler;
+    me->caller_context = p_manager;
+
+    if (OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_RECORD == state) {
+        p_manager->length = sizeof(p_manager->record);
+        return_value =
+            optiga_util_read_data(me, p_manager->wear_record_oid, 0, p_manager->record, &p_manager->length);
+    } else {
+        return_value = optiga_util_write_data(
+            me,
+            p_manager->wear_record_oid,
+            OPTIGA_UTIL_ERASE_AND_WRITE,
+            0,
+            p_manager->record,
+            p_manager->length
         );
-        if (OPTIGA_LIB_SUCCESS != return_value) {
-            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+    }
+    if (OPTIGA_LIB_SUCCESS != return_value) {
+        me->handler = p_manager->handler;
+        me->caller_context = p_manager->caller_context;
+        p_manager->p_util = NULL;
+        p_manager->state = OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE;
+    }
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+// Maximum size of the metadata of an object
+#define OPTIGA_UTIL_METADATA_STORE_BUFFER_SIZE (0x40U)
+// Object is not indexed, its metadata could not be read
+#define OPTIGA_UTIL_METADATA_STATE_ABSENT (0x00)
+// Object is indexed
+#define OPTIGA_UTIL_METADATA_STATE_VALID (0x01)
+// Object was written, its metadata is read again on the next refresh
+#define OPTIGA_UTIL_METADATA_STATE_STALE (0x02)
+// Access conditions held per object: change, read, execute
+#define OPTIGA_UTIL_METADATA_AC_COUNT (0x03U)
+
+/** \brief Metadata store, indexed as struct of arrays to scan single attributes */
+typedef struct optiga_util_metadata_store {
+    /// OIDs of the objects
+    uint16_t oid[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// OPTIGA_UTIL_METADATA_STATE_XXX
+    uint8_t state[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Tags present, OPTIGA_UTIL_METADATA_HAS_XXX
+    uint16_t tag_mask[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Lifecycle states
+    uint8_t lcs[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Algorithms
+    uint8_t algorithm[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Key usages
+    uint8_t key_usage[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Data object types
+    uint8_t data_type[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Maximum sizes
+    uint16_t max_size[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Used sizes
+    uint16_t used_size[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS];
+    /// Change, read and execute access conditions
+    optiga_util_metadata_ac_t ac[OPTIGA_UTIL_METADATA_STORE_MAX_OIDS][OPTIGA_UTIL_METADATA_AC_COUNT];
+    /// Number of objects
+    uint8_t oid_count;
+    /// Pass in progress
+    bool_t is_busy;
+    /// Object of which the metadata is read
+    uint8_t index;
+    /// Object of which the metadata is read was written meanwhile
+    bool_t is_read_written;
+    /// Instance used for the pass in progress, NULL if the store is not started
+    optiga_util_t *p_util;
+    /// Callback handler of the instance, restored on completion
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on completion
+    void *caller_context;
+    /// Metadata read
+    uint8_t buffer[OPTIGA_UTIL_METADATA_STORE_BUFFER_SIZE];
+    /// Length of the metadata read
+    uint16_t length;
+} optiga_util_metadata_store_t;
+
+// Data and key objects of OPTIGA Trust M indexed by default
+_STATIC_H const uint16_t g_optiga_util_metadata_store_default_oids[] = {
+    0xE0C0, 0xE0C1, 0xE0C2, 0xE0C3, 0xE0C4, 0xE0C5, 0xE0C6, 0xE0E0, 0xE0E1, 0xE0E2, 0xE0E3,
+    0xE0E8, 0xE0E9, 0xE0EF, 0xE0F0, 0xE0F1, 0xE0F2, 0xE0F3, 0xE0FC, 0xE0FD, 0xE120, 0xE121,
+    0xE122, 0xE123, 0xE140, 0xE200, 0xF1C0, 0xF1C1, 0xF1C2, 0xF1D0, 0xF1D1, 0xF1D2, 0xF1D3,
+    0xF1D4, 0xF1D5, 0xF1D6, 0xF1D7, 0xF1D8, 0xF1D9, 0xF1DA, 0xF1DB, 0xF1E0, 0xF1E1,
+};
+
+// Metadata store shared by all instances
+_STATIC_H optiga_util_metadata_store_t g_optiga_util_metadata_store = {0};
+
+/*
+ * Provides the index of the object, the number of objects if it is not indexed
+ */
+_STATIC_H uint8_t
+optiga_util_metadata_store_find(const optiga_util_metadata_store_t *p_store, uint16_t oid) {
+    uint8_t index;
+
+    for (index = 0; index < p_store->oid_count; index++) {
+        if (oid == p_store->oid[index]) {
+            break;
         }
-    } while (FALSE);
-    optiga_util_reset_protection_level(me);
+    }
+    return (index);
+}
+
+// Write handler attached to the OPTIGA instance, marks the written objects stale
+_STATIC_H void optiga_util_metadata_store_write_handler(void *p_ctx, uint16_t oid) {
+    optiga_util_metadata_store_t *p_store = (optiga_util_metadata_store_t *)p_ctx;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < p_store->oid_count; index++) {
+        if ((OPTIGA_CMD_WRITE_ALL_OIDS == oid) || (oid == p_store->oid[index])) {
+            if (OPTIGA_UTIL_METADATA_STATE_VALID == p_store->state[index]) {
+                p_store->state[index] = OPTIGA_UTIL_METADATA_STATE_STALE;
+            }
+            if ((TRUE == p_store->is_busy) && (index == p_store->index)) {
+                p_store->is_read_written = TRUE;
+            }
+        }
+    }
+    pal_os_lock_exit_critical_section();
+}
+
+/*
+ * Indexes the metadata read for the object at the given index
+ */
+_STATIC_H void optiga_util_metadata_store_parse(optiga_util_metadata_store_t *p_store, uint8_t index) {
+    const uint8_t *p_metadata = p_store->buffer;
+    optiga_util_metadata_ac_t *p_ac;
+    uint16_t end;
+    uint16_t offset = 2;
+    uint16_t value;
+    uint8_t tag;
+    uint8_t length;
+    uint8_t byte_index;
+
+    p_store->tag_mask[index] = 0;
+    pal_os_memset(p_store->ac[index], 0x00, sizeof(p_store->ac[index]));
+    end = (uint16_t)(2U + p_metadata[1]);
+    end = (end > p_store->length) ? p_store->length : end;
+    while ((offset + 2U) <= end) {
+        tag = p_metadata[offset];
+        length = p_metadata[offset + 1U];
+        offset += 2U;
+        if ((offset + length) > end) {
+            break;
+        }
+        // Sizes are encoded in one or two bytes
+        value = 0;
+        for (byte_index = 0; (byte_index < length) && (byte_index < 2U); byte_index++) {
+            value = (uint16_t)((value << 8) | p_metadata[offset + byte_index]);
+        }
+        p_ac = NULL;
+        switch (tag) {
+            case 0xC0: {
+                p_store->lcs[index] = (uint8_t)value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_LCS;
+                break;
+            }
+            case 0xC4: {
+                p_store->max_size[index] = value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_MAX_SIZE;
+                break;
+            }
+            case 0xC5: {
+                p_store->used_size[index] = value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_USED_SIZE;
+                break;
+            }
+            case 0xD0: {
+                p_ac = &p_store->ac[index][0];
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_CHANGE_AC;
+                break;
+            }
+            case 0xD1: {
+                p_ac = &p_store->ac[index][1];
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_READ_AC;
+                break;
+            }
+            case 0xD3: {
+                p_ac = &p_store->ac[index][2];
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_EXECUTE_AC;
+                break;
+            }
+            case 0xE0: {
+                p_store->algorithm[index] = (uint8_t)value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_ALGORITHM;
+                break;
+            }
+            case 0xE1: {
+                p_store->key_usage[index] = (uint8_t)value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_KEY_USAGE;
+                break;
+            }
+            case 0xE8: {
+                p_store->data_type[index] = (uint8_t)value;
+                p_store->tag_mask[index] |= OPTIGA_UTIL_METADATA_HAS_DATA_TYPE;
+                break;
+            }
+            default:
+                break;
+        }
+        if (NULL != p_ac) {
+            p_ac->length = length;
+            pal_os_memcpy(
+                p_ac->value,
+                &p_metadata[offset],
+                (length > OPTIGA_UTIL_METADATA_AC_SIZE) ? OPTIGA_UTIL_METADATA_AC_SIZE : length
+            );
+        }
+        offset += length;
+    }
+}
+
+/*
+ * Issues the read of the next stale object, provides FALSE if no object is stale
+ */
+_STATIC_H bool_t optiga_util_metadata_store_read_next(
+    optiga_util_metadata_store_t *p_store,
+    optiga_lib_status_t *p_return_value
+) {
+    bool_t is_issued = FALSE;
+
+    while ((p_store->index < p_store->oid_count)
+           && (OPTIGA_UTIL_METADATA_STATE_STALE != p_store->state[p_store->index])) {
+        p_store->index++;
+    }
+    if (p_store->index < p_store->oid_count) {
+        p_store->is_read_written = FALSE;
+        p_store->length = sizeof(p_store->buffer);
+        *p_return_value = optiga_util_read_metadata(
+            p_store->p_util,
+            p_store->oid[p_store->index],
+            p_store->buffer,
+            &p_store->length
+        );
+        is_issued = (OPTIGA_LIB_SUCCESS == *p_return_value) ? TRUE : FALSE;
+    }
+    return (is_issued);
+}
+
+/*
+ * Completion of a metadata read of the pass, issues the next read or completes the pass
+ */
+_STATIC_H void optiga_util_metadata_store_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_metadata_store_t *p_store = (optiga_util_metadata_store_t *)p_ctx;
+    optiga_util_t *p_util = p_store->p_util;
+    optiga_lib_status_t return_value = event;
+
+    pal_os_lock_enter_critical_section();
+    // Written meanwhile, the object stays stale and is read again by the next refresh
+    if (FALSE == p_store->is_read_written) {
+        if ((OPTIGA_LIB_SUCCESS == event) && (2U <= p_store->length)) {
+            optiga_util_metadata_store_parse(p_store, p_store->index);
+            p_store->state[p_store->index] = OPTIGA_UTIL_METADATA_STATE_VALID;
+        } else if (OPTIGA_DEVICE_ERROR == (event & OPTIGA_DEVICE_ERROR)) {
+            // Not available on this OPTIGA
+            p_store->state[p_store->index] = OPTIGA_UTIL_METADATA_STATE_ABSENT;
+        } else {
+            // Kept stale to be read by the next refresh
+        }
+    }
+    pal_os_lock_exit_critical_section();
+
+    if ((OPTIGA_LIB_SUCCESS == event) || (OPTIGA_DEVICE_ERROR == (event & OPTIGA_DEVICE_ERROR))) {
+        p_store->index++;
+        return_value = OPTIGA_LIB_SUCCESS;
+        if (TRUE == optiga_util_metadata_store_read_next(p_store, &return_value)) {
+            p_util = NULL;
+        }
+    }
+
+    if (NULL != p_util) {
+        p_util->handler = p_store->handler;
+        p_util->caller_context = p_store->caller_context;
+        p_store->is_busy = FALSE;
+        optiga_util_complete(p_util->handler, p_util->caller_context, return_value);
+    }
+}
+
+/*
+ * Claims the store for a refresh, if neither the instance nor the store is busy.
+ * Checked and claimed within the same lock, a concurrent start or refresh is rejected.
+ */
+_STATIC_H bool_t
+optiga_util_metadata_store_claim(const optiga_util_t *me, optiga_util_metadata_store_t *p_store) {
+    bool_t is_claimed = FALSE;
+
+    pal_os_lock_enter_critical_section();
+    if ((OPTIGA_LIB_INSTANCE_BUSY != me->instance_state) && (FALSE == p_store->is_busy)) {
+        p_store->is_busy = TRUE;
+        is_claimed = TRUE;
+    }
+    pal_os_lock_exit_critical_section();
+    return (is_claimed);
+}
+
+/*
+ * Reads the stale objects with the instance, the handler of the instance is invoked on completion
+ */
+_STATIC_H optiga_lib_status_t
+optiga_util_metadata_store_begin(optiga_util_metadata_store_t *p_store, optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_LIB_SUCCESS;
 
+    p_store->p_util = me;
+    p_store->index = 0;
+    p_store->handler = me->handler;
+    p_store->caller_context = me->caller_context;
+    me->handler = optiga_util_metadata_store_handler;
+    me->caller_context = p_store;
+
+    if (FALSE == optiga_util_metadata_store_read_next(p_store, &return_value)) {
+        me->handler = p_store->handler;
+        me->caller_context = p_store->caller_context;
+        p_store->is_busy = FALSE;
+        // Nothing is stale, the handler is invoked before returning
+        if (OPTIGA_LIB_SUCCESS == return_value) {
+            me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+        }
+    }
     return (return_value);
 }
+#endif  // OPTIGA_UTIL_METADATA_STORE_ENABLED
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+// OID passed to flush the buffered data of all data objects
+#define OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS (0xFFFF)
+// No data is buffered
+#define OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE (0x00)
+// Data is buffered
+#define OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING (0x01)
+// Buffered data is written to OPTIGA
+#define OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FLUSHING (0x02)
+// Flush is followed by no operation, the handler of the instance is invoked
+#define OPTIGA_UTIL_WRITE_BEHIND_THEN_NONE (0x00)
+// Flush is followed by the write which could not be buffered
+#define OPTIGA_UTIL_WRITE_BEHIND_THEN_WRITE (0x01)
+// Flush is followed by the read of the data object
+#define OPTIGA_UTIL_WRITE_BEHIND_THEN_READ (0x02)
+// Flush is followed by closing the application
+#define OPTIGA_UTIL_WRITE_BEHIND_THEN_CLOSE (0x03)
+// Time in milliseconds, after which the flush after the window is retried, if another flush is in progress
+#define OPTIGA_UTIL_WRITE_BEHIND_RETRY_TIME_MS (10U)
+
+/** \brief Data object buffered by the write-behind */
+typedef struct optiga_util_write_behind_entry {
+    /// Buffered data
+    uint8_t data[OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE];
+    /// Sequence number of the first buffered write, orders the flushes
+    uint32_t sequence;
+    /// Time stamp in milliseconds of the first buffered write
+    uint32_t first_write_time;
+    /// Data object
+    uint16_t oid;
+    /// Offset of the buffered data
+    uint16_t offset;
+    /// Length of the buffered data
+    uint16_t length;
+    /// Number of writes coalesced into the buffered data
+    uint16_t write_count;
+    /// OPTIGA_UTIL_WRITE_BEHIND_ENTRY_XXX
+    uint8_t state;
+    /// Data object is erased before the buffered data is written
+    bool_t is_erase;
+} optiga_util_write_behind_entry_t;
+
+/** \brief Write-behind shared by all instances */
+typedef struct optiga_util_write_behind {
+    /// Buffered data objects
+    optiga_util_write_behind_entry_t entries[OPTIGA_UTIL_WRITE_BEHIND_ENTRIES];
+    /// Number of buffered data objects, 0 if the write-behind is not started
+    uint8_t entry_count;
+    /// Coalescing window in milliseconds, 0 if unlimited
+    uint32_t window_ms;
+    /// Buffered length which triggers a flush
+    uint16_t flush_length;
+    /// Counter ordering the first buffered writes
+    uint32_t sequence;
+    /// Statistics
+    optiga_util_write_behind_stats_t stats;
+    /// Instance flushing the buffered data after the window, NULL if the window is unlimited
+    optiga_util_t *p_window_util;
+    /// Flush after the window is registered with the scheduler
+    bool_t is_window_armed;
+    /// Flush in progress
+    bool_t is_busy;
+    /// Instance used for the flush in progress
+    optiga_util_t *p_util;
+    /// Callback handler of the instance, restored on completion
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on completion
+    void *caller_context;
+    /// Data object flushed, OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS for all
+    uint16_t flush_oid;
+    /// Entry written to OPTIGA
+    optiga_util_write_behind_entry_t *p_flush_entry;
+    /// OPTIGA_UTIL_WRITE_BEHIND_THEN_XXX
+    uint8_t continuation;
+    /// Data object of the continued write or read
+    uint16_t oid;
+    /// Offset of the continued write or read
+    uint16_t offset;
+    /// Length of the continued write
+    uint16_t length;
+    /// Write type of the continued write
+    uint8_t write_type;
+    /// Hibernate option of the continued close
+    bool_t perform_hibernate;
+    /// Data of the continued write
+    const uint8_t *p_write_buffer;
+    /// Buffer of the continued read
+    uint8_t *p_read_buffer;
+    /// Length of the continued read
+    uint16_t *p_read_length;
+} optiga_util_write_behind_t;
+
+// Write-behind
+_STATIC_H optiga_util_write_behind_t g_optiga_util_write_behind = {0};
+
+/*
+ * Provides the entry of the data object, NULL if it is not buffered
+ */
+_STATIC_H optiga_util_write_behind_entry_t *
+optiga_util_write_behind_find(optiga_util_write_behind_t *p_write_behind, uint16_t oid) {
+    optiga_util_write_behind_entry_t *p_entry = NULL;
+    uint8_t index;
+
+    for (index = 0; index < p_write_behind->entry_count; index++) {
+        if (oid == p_write_behind->entries[index].oid) {
+            p_entry = &p_write_behind->entries[index];
+            break;
+        }
+    }
+    return (p_entry);
+}
 
+/*
+ * Provides the entry of the data object, if the operation of the instance is intercepted, NULL otherwise
+ */
+_STATIC_H optiga_util_write_behind_entry_t *
+optiga_util_write_behind_get_entry(const optiga_util_t *me, uint16_t oid) {
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    optiga_util_write_behind_entry_t *p_entry;
+
+    pal_os_lock_enter_critical_section();
+    p_entry = optiga_util_write_behind_find(p_write_behind, oid);
+    // The flush writes are not intercepted
+    if ((NULL != p_entry) && (TRUE == p_write_behind->is_busy) && (me == p_write_behind->p_util)) {
+        p_entry = NULL;
+    }
+    pal_os_lock_exit_critical_section();
 #ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
-void optiga_util_set_comms_params(optiga_util_t *me, uint8_t parameter_type, uint8_t value) {
-    switch (parameter_type) {
-        case OPTIGA_COMMS_PROTECTION_LEVEL: {
-            me->protection_level = value;
+    // Protected communication is requested, the operation is performed by OPTIGA
+    if (OPTIGA_COMMS_NO_PROTECTION != me->protection_level) {
+        p_entry = NULL;
+    }
+#endif
+    return (p_entry);
+}
+
+/*
+ * Checks whether data is buffered, the lock is held by the caller
+ */
+_STATIC_H bool_t optiga_util_write_behind_has_data(const optiga_util_write_behind_t *p_write_behind) {
+    bool_t has_data = FALSE;
+    uint8_t index;
+
+    for (index = 0; index < p_write_behind->entry_count; index++) {
+        if (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE != p_write_behind->entries[index].state) {
+            has_data = TRUE;
             break;
         }
-        case OPTIGA_COMMS_PROTOCOL_VERSION: {
-            me->protocol_version = value;
+    }
+    return (has_data);
+}
+
+/*
+ * Checks whether data is buffered, which is not being flushed by the instance itself
+ */
+_STATIC_H bool_t optiga_util_write_behind_is_pending(const optiga_util_t *me) {
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    bool_t is_pending = FALSE;
+
+    pal_os_lock_enter_critical_section();
+    if ((FALSE == p_write_behind->is_busy) || (me != p_write_behind->p_util)) {
+        is_pending = optiga_util_write_behind_has_data(p_write_behind);
+    }
+    pal_os_lock_exit_critical_section();
+    return (is_pending);
+}
+
+/*
+ * Merges the write into the buffered data of the entry, provides FALSE if the write cannot be buffered
+ */
+_STATIC_H bool_t optiga_util_write_behind_merge(
+    optiga_util_write_behind_t *p_write_behind,
+    optiga_util_write_behind_entry_t *p_entry,
+    uint8_t write_type,
+    uint16_t offset,
+    const uint8_t *p_buffer,
+    uint16_t length
+) {
+    uint32_t end = (uint32_t)offset + length;
+    uint32_t entry_end = (uint32_t)p_entry->offset + p_entry->length;
+    uint32_t merged_end = (end > entry_end) ? end : entry_end;
+    uint16_t start = MIN(offset, p_entry->offset);
+    uint16_t shift = p_entry->offset - start;
+    uint16_t index;
+    bool_t is_merged = FALSE;
+
+    do {
+        // The buffered data is being written to OPTIGA and is released on completion
+        if ((0U == length) || (OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE < length)
+            || (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FLUSHING == p_entry->state)) {
             break;
         }
-        default: {
+        if (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING == p_entry->state) {
+            // The window is over, the buffered data is flushed first
+            if ((0U != p_write_behind->window_ms)
+                && ((pal_os_timer_get_time_in_milliseconds() - p_entry->first_write_time)
+                    >= p_write_behind->window_ms)) {
+                break;
+            }
+            // The data object is erased, the buffered writes are superseded
+            if (OPTIGA_UTIL_ERASE_AND_WRITE == write_type) {
+                p_write_behind->stats.saved_count += p_entry->write_count;
+                p_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE;
+            }
+        }
+        if (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE == p_entry->state) {
+            pal_os_memcpy(p_entry->data, p_buffer, length);
+            p_entry->offset = offset;
+            p_entry->length = length;
+            p_entry->write_count = 1;
+            p_entry->is_erase = (OPTIGA_UTIL_ERASE_AND_WRITE == write_type) ? TRUE : FALSE;
+            p_entry->sequence = ++p_write_behind->sequence;
+            p_entry->first_write_time = pal_os_timer_get_time_in_milliseconds();
+            p_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING;
+            p_write_behind->stats.buffered_count++;
+            is_merged = TRUE;
+            break;
+        }
+        // Neither adjacent nor overlapping, or too long
+        if ((offset > entry_end) || (end < p_entry->offset)
+            || ((merged_end - start) > OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE)) {
+            break;
+        }
+        // Preceding write, the buffered data is moved behind it
+        for (index = p_entry->length; (0U != shift) && (0U != index); index--) {
+            p_entry->data[(index - 1U) + shift] = p_entry->data[index - 1U];
+        }
+        pal_os_memcpy(&p_entry->data[offset - start], p_buffer, length);
+        p_entry->length = (uint16_t)(merged_end - start);
+        p_entry->offset = start;
+        p_entry->write_count++;
+        p_write_behind->stats.buffered_count++;
+        p_write_behind->stats.saved_count++;
+        is_merged = TRUE;
+    } while (FALSE);
+
+    return (is_merged);
+}
+
+/*
+ * Issues the write of the next buffered data to flush, provides FALSE if no data is left
+ */
+_STATIC_H bool_t optiga_util_write_behind_flush_next(
+    optiga_util_write_behind_t *p_write_behind,
+    optiga_lib_status_t *p_return_value
+) {
+    optiga_util_write_behind_entry_t *p_entry = NULL;
+    bool_t is_issued = FALSE;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    // The oldest buffered data first
+    for (index = 0; index < p_write_behind->entry_count; index++) {
+        if ((OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING == p_write_behind->entries[index].state)
+            && ((OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS == p_write_behind->flush_oid)
+                || (p_write_behind->flush_oid == p_write_behind->entries[index].oid))
+            && ((NULL == p_entry)
+                || (p_write_behind->entries[index].sequence < p_entry->sequence))) {
+            p_entry = &p_write_behind->entries[index];
+        }
+    }
+    if (NULL != p_entry) {
+        p_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FLUSHING;
+    }
+    p_write_behind->p_flush_entry = p_entry;
+    pal_os_lock_exit_critical_section();
+
+    if (NULL != p_entry) {
+        *p_return_value = optiga_util_write_data(
+            p_write_behind->p_util,
+            p_entry->oid,
+            (TRUE == p_entry->is_erase) ? OPTIGA_UTIL_ERASE_AND_WRITE : OPTIGA_UTIL_WRITE_ONLY,
+            p_entry->offset,
+            p_entry->data,
+            p_entry->length
+        );
+        if (OPTIGA_LIB_SUCCESS == *p_return_value) {
+            is_issued = TRUE;
+        } else {
+            p_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING;
+        }
+    }
+    return (is_issued);
+}
+
+/*
+ * Completes the flush, restores the instance and continues with the operation which triggered the flush.
+ * If nothing is flushed, the operation is completed before returning and not queued to the executor.
+ */
+_STATIC_H void optiga_util_write_behind_complete(
+    optiga_util_write_behind_t *p_write_behind,
+    optiga_lib_status_t status,
+    bool_t is_flushed
+) {
+    optiga_util_t *p_util = p_write_behind->p_util;
+    optiga_lib_status_t return_value = status;
+    bool_t is_completed = FALSE;
+
+    p_util->handler = p_write_behind->handler;
+    p_util->caller_context = p_write_behind->caller_context;
+    p_write_behind->is_busy = FALSE;
+
+    if (OPTIGA_LIB_SUCCESS == status) {
+        switch (p_write_behind->continuation) {
+            case OPTIGA_UTIL_WRITE_BEHIND_THEN_WRITE: {
+                return_value = optiga_util_write_data(
+                    p_util,
+                    p_write_behind->oid,
+                    p_write_behind->write_type,
+                    p_write_behind->offset,
+                    p_write_behind->p_write_buffer,
+                    p_write_behind->length
+                );
+                break;
+            }
+            case OPTIGA_UTIL_WRITE_BEHIND_THEN_READ: {
+                return_value = optiga_util_read_data(
+                    p_util,
+                    p_write_behind->oid,
+                    p_write_behind->offset,
+                    p_write_behind->p_read_buffer,
+                    p_write_behind->p_read_length
+                );
+                break;
+            }
+            case OPTIGA_UTIL_WRITE_BEHIND_THEN_CLOSE: {
+                return_value =
+                    optiga_util_close_application(p_util, p_write_behind->perform_hibernate);
+                break;
+            }
+            default: {
+                is_completed = TRUE;
+                break;
+            }
+        }
+    }
+    // The continued operation is not issued, its handler is not invoked
+    if (OPTIGA_LIB_SUCCESS != return_value) {
+        is_completed = TRUE;
+    }
+    if ((TRUE == is_completed) && (TRUE == is_flushed)) {
+        optiga_util_complete(p_util->handler, p_util->caller_context, return_value);
+    } else if (TRUE == is_completed) {
+        p_util->handler(p_util->caller_context, return_value);
+    } else {
+        // Completed by the continued operation
+    }
+}
+
+/*
+ * Completion of a flush write, issues the next write or completes the flush
+ */
+_STATIC_H void optiga_util_write_behind_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_write_behind_t *p_write_behind = (optiga_util_write_behind_t *)p_ctx;
+    optiga_lib_status_t return_value = event;
+
+    pal_os_lock_enter_critical_section();
+    if (OPTIGA_LIB_SUCCESS == event) {
+        p_write_behind->stats.flush_count++;
+        p_write_behind->p_flush_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE;
+    } else if (OPTIGA_DEVICE_ERROR == (event & OPTIGA_DEVICE_ERROR)) {
+        // OPTIGA rejects the data, retrying would fail the same way and the buffered data is discarded
+        p_write_behind->stats.flush_failure_count++;
+        p_write_behind->p_flush_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE;
+    } else {
+        // The communication failed, the buffered data is kept for the next flush
+        p_write_behind->stats.flush_failure_count++;
+        p_write_behind->p_flush_entry->state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING;
+    }
+    pal_os_lock_exit_critical_section();
+
+    if ((OPTIGA_LIB_SUCCESS != event)
+        || (FALSE == optiga_util_write_behind_flush_next(p_write_behind, &return_value))) {
+        optiga_util_write_behind_complete(p_write_behind, return_value, TRUE);
+    }
+}
+
+/*
+ * Reserves the flush for the instance
+ */
+_STATIC_H optiga_lib_status_t optiga_util_write_behind_acquire(optiga_util_t *me) {
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+
+    pal_os_lock_enter_critical_section();
+    if (FALSE == p_write_behind->is_busy) {
+        p_write_behind->is_busy = TRUE;
+        p_write_behind->p_util = me;
+        return_value = OPTIGA_LIB_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+    return (return_value);
+}
+
+/*
+ * Flushes the buffered data of the data object or of all data objects with the instance, which reserved
+ * the flush, and continues with the given operation. The handler of the instance is invoked on completion.
+ */
+_STATIC_H optiga_lib_status_t
+optiga_util_write_behind_begin(optiga_util_t *me, uint16_t oid, uint8_t continuation) {
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    optiga_lib_status_t return_value = OPTIGA_LIB_SUCCESS;
+
+    p_write_behind->flush_oid = oid;
+    p_write_behind->continuation = continuation;
+    p_write_behind->handler = me->handler;
+    p_write_behind->caller_context = me->caller_context;
+    me->handler = optiga_util_write_behind_handler;
+    me->caller_context = p_write_behind;
+
+    if (FALSE == optiga_util_write_behind_flush_next(p_write_behind, &return_value)) {
+        if (OPTIGA_LIB_SUCCESS == return_value) {
+            // Nothing is buffered, the operation is continued before returning
+            optiga_util_write_behind_complete(p_write_behind, OPTIGA_LIB_SUCCESS, FALSE);
+        } else {
+            me->handler = p_write_behind->handler;
+            me->caller_context = p_write_behind->caller_context;
+            p_write_behind->is_busy = FALSE;
+        }
+    }
+    return (return_value);
+}
+
+/*
+ * Completion of the flush after the window, the failures are counted in the statistics
+ */
+_STATIC_H void optiga_util_write_behind_window_handler(void *p_ctx, optiga_lib_status_t event) {
+    (void)p_ctx;
+    (void)event;
+}
+
+_STATIC_H void optiga_util_write_behind_window_expired(void *p_ctx);
+
+/*
+ * Registers the flush after the given time with the scheduler, unless it is registered already
+ */
+_STATIC_H void optiga_util_write_behind_arm(optiga_util_write_behind_t *p_write_behind, uint32_t time_ms) {
+    bool_t is_arm_required = FALSE;
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_write_behind->p_window_util) && (FALSE == p_write_behind->is_window_armed)) {
+        p_write_behind->is_window_armed = TRUE;
+        is_arm_required = TRUE;
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (TRUE == is_arm_required) {
+        // lint --e{534} suppress "Registering the callback always succeeds"
+        optiga_cmd_register_callback_oneshot(
+            p_write_behind->p_window_util->my_cmd,
+            optiga_util_write_behind_window_expired,
+            p_write_behind,
+            time_ms
+        );
+    }
+}
+
+/*
+ * Flushes the buffered data of all data objects, once the window of the first buffered write is over
+ */
+_STATIC_H void optiga_util_write_behind_window_expired(void *p_ctx) {
+    optiga_util_write_behind_t *p_write_behind = (optiga_util_write_behind_t *)p_ctx;
+    optiga_util_t *p_util;
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+
+    // The flush is reserved within the same lock, the write-behind is not stopped in between
+    pal_os_lock_enter_critical_section();
+    p_write_behind->is_window_armed = FALSE;
+    p_util = p_write_behind->p_window_util;
+    if ((NULL != p_util) && (FALSE == p_write_behind->is_busy)
+        && (OPTIGA_LIB_INSTANCE_BUSY != p_util->instance_state)) {
+        p_write_behind->is_busy = TRUE;
+        p_write_behind->p_util = p_util;
+        return_value = OPTIGA_LIB_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (OPTIGA_LIB_SUCCESS == return_value) {
+        return_value = optiga_util_write_behind_begin(
+            p_util,
+            OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS,
+            OPTIGA_UTIL_WRITE_BEHIND_THEN_NONE
+        );
+    } else if (NULL != p_util) {
+        // Another flush is in progress, which may not include the data of which the window is over
+        optiga_util_write_behind_arm(p_write_behind, OPTIGA_UTIL_WRITE_BEHIND_RETRY_TIME_MS);
+    } else {
+        // The write-behind is stopped
+    }
+}
+
+/*
+ * Exchanges the instance flushing after the window, the lock is held by the caller
+ */
+_STATIC_H void optiga_util_write_behind_swap_window_util(
+    optiga_util_write_behind_t *p_write_behind,
+    optiga_util_t **pp_window_util
+) {
+    optiga_util_t *p_window_util = p_write_behind->p_window_util;
+
+    p_write_behind->p_window_util = *pp_window_util;
+    p_write_behind->is_window_armed = FALSE;
+    *pp_window_util = p_window_util;
+}
+
+/*
+ * Cancels the flush after the window and destroys the instance, which is no longer used
+ */
+_STATIC_H void optiga_util_write_behind_release_window_util(optiga_util_t *p_window_util) {
+    if (NULL != p_window_util) {
+        // lint --e{534} suppress "Cancelling the callback always succeeds"
+        optiga_cmd_register_callback_oneshot(p_window_util->my_cmd, NULL, NULL, 0);
+        // lint --e{534} suppress "The instance is not in use, destroy does not fail"
+        optiga_util_destroy(p_window_util);
+    }
+}
+
+/*
+ * Buffers the write, otherwise flushes the buffered data first. Provides FALSE if the write is written through.
+ */
+_STATIC_H bool_t optiga_util_write_behind_write(
+    optiga_util_t *me,
+    optiga_util_write_behind_entry_t *p_entry,
+    uint8_t write_type,
+    uint16_t offset,
+    const uint8_t *p_buffer,
+    uint16_t length,
+    optiga_lib_status_t *p_return_value
+) {
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    bool_t is_merged;
+    bool_t is_first_write;
+    bool_t is_flush_required = FALSE;
+    bool_t is_handled = TRUE;
+
+    // The state is checked again under the lock, a flush may have started in between
+    pal_os_lock_enter_critical_section();
+    is_first_write = (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE == p_entry->state) ? TRUE : FALSE;
+    is_merged = optiga_util_write_behind_merge(p_write_behind, p_entry, write_type, offset, p_buffer, length);
+    if ((TRUE == is_merged) && (0U != p_write_behind->flush_length)
+        && (p_entry->length >= p_write_behind->flush_length)) {
+        is_flush_required = TRUE;
+    }
+    if ((FALSE == is_merged) && (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE == p_entry->state)) {
+        is_handled = FALSE;
+    }
+    pal_os_lock_exit_critical_section();
+
+    // The buffered data is flushed after the window, even if no further operation triggers the flush
+    if ((TRUE == is_merged) && (TRUE == is_first_write)) {
+        optiga_util_write_behind_arm(p_write_behind, p_write_behind->window_ms);
+    }
+    if (TRUE == is_merged) {
+        *p_return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+        if ((TRUE == is_flush_required) && (OPTIGA_LIB_SUCCESS == optiga_util_write_behind_acquire(me))) {
+            *p_return_value =
+                optiga_util_write_behind_begin(me, p_entry->oid, OPTIGA_UTIL_WRITE_BEHIND_THEN_NONE);
+        }
+        // The flush is not started, the data stays buffered and the handler is invoked before returning
+        if (OPTIGA_LIB_SUCCESS != *p_return_value) {
+            *p_return_value = OPTIGA_LIB_SUCCESS;
+            me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+        }
+    } else if (TRUE == is_handled) {
+        *p_return_value = optiga_util_write_behind_acquire(me);
+        if (OPTIGA_LIB_SUCCESS == *p_return_value) {
+            p_write_behind->oid = p_entry->oid;
+            p_write_behind->write_type = write_type;
+            p_write_behind->offset = offset;
+            p_write_behind->p_write_buffer = p_buffer;
+            p_write_behind->length = length;
+            *p_return_value =
+                optiga_util_write_behind_begin(me, p_entry->oid, OPTIGA_UTIL_WRITE_BEHIND_THEN_WRITE);
+        }
+    } else {
+        // Too long to be buffered and no data is buffered, the write is sent to OPTIGA
+    }
+    return (is_handled);
+}
+#endif  // OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+// OID of the security event counter
+#define OPTIGA_UTIL_SEC_GOVERNOR_OID (0xE0C5)
+// Maximum value of the security event counter
+#define OPTIGA_UTIL_SEC_GOVERNOR_MAX_SEC (0xFFU)
+
+/** \brief SEC governor of OPTIGA instance 0 */
+typedef struct optiga_util_sec_governor {
+    /// Instance used to read the SEC, NULL if the governor is not running
+    optiga_util_t *p_util;
+    /// Configuration provided by the application
+    optiga_util_sec_governor_config_t config;
+    /// Statistics
+    optiga_util_sec_governor_stats_t stats;
+    /// Callback handler of the instance, restored on stop
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on stop
+    void *caller_context;
+    /// Time stamp in milliseconds, from which the predicted SEC decays
+    uint32_t base_time;
+    /// Time stamp in milliseconds of the last read of the SEC
+    uint32_t refresh_time;
+    /// Number of admitted requests not released
+    uint16_t in_progress_count;
+    /// Predicted SEC at the base time
+    uint8_t base_sec;
+    /// Number of events released while the SEC is read, which may not be included in the value read
+    uint8_t read_event_count;
+    /// Read of the SEC in progress
+    bool_t is_busy;
+    /// SEC read
+    uint8_t buffer[1];
+    /// Length of the SEC read
+    uint16_t length;
+} optiga_util_sec_governor_t;
+
+// SEC governor of OPTIGA instance 0
+_STATIC_H optiga_util_sec_governor_t g_optiga_util_sec_governor = {0};
+
+/*
+ * Updates the predicted values of the statistics, the caller holds the lock
+ */
+_STATIC_H void optiga_util_sec_governor_update_stats(optiga_util_sec_governor_t *p_governor) {
+    p_governor->stats.current_sec = p_governor->base_sec;
+    if (p_governor->base_sec > p_governor->stats.max_sec) {
+        p_governor->stats.max_sec = p_governor->base_sec;
+    }
+    p_governor->stats.predicted_delay_ms =
+        (p_governor->base_sec >= p_governor->config.throttle_threshold)
+        ? p_governor->config.throttle_delay_ms
+        : 0;
+}
+
+/*
+ * Decays the predicted SEC to the given time, the caller holds the lock
+ */
+_STATIC_H void optiga_util_sec_governor_decay(optiga_util_sec_governor_t *p_governor, uint32_t now) {
+    uint32_t decayed = (now - p_governor->base_time) / p_governor->config.decay_period_ms;
+
+    if (decayed >= p_governor->base_sec) {
+        p_governor->base_sec = 0;
+        p_governor->base_time = now;
+    } else {
+        p_governor->base_sec -= (uint8_t)decayed;
+        p_governor->base_time += decayed * p_governor->config.decay_period_ms;
+    }
+    optiga_util_sec_governor_update_stats(p_governor);
+}
+
+/*
+ * Completion of the read of the SEC
+ */
+_STATIC_H void optiga_util_sec_governor_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_sec_governor_t *p_governor = (optiga_util_sec_governor_t *)p_ctx;
+    uint32_t now = pal_os_timer_get_time_in_milliseconds();
+    uint16_t sec;
+
+    pal_os_lock_enter_critical_section();
+    if ((OPTIGA_LIB_SUCCESS == event) && (sizeof(p_governor->buffer) == p_governor->length)) {
+        p_governor->stats.measured_sec = p_governor->buffer[0];
+        p_governor->stats.refresh_count++;
+        sec = (uint16_t)p_governor->buffer[0] + p_governor->read_event_count;
+        p_governor->base_sec = (uint8_t)MIN(sec, OPTIGA_UTIL_SEC_GOVERNOR_MAX_SEC);
+        p_governor->base_time = now;
+    } else {
+        p_governor->stats.refresh_failure_count++;
+    }
+    // A failed read is retried after the refresh period as well
+    p_governor->refresh_time = now;
+    p_governor->read_event_count = 0;
+    p_governor->is_busy = FALSE;
+    optiga_util_sec_governor_decay(p_governor, now);
+    pal_os_lock_exit_critical_section();
+}
+
+/*
+ * Reads the SEC, the read is claimed by the caller
+ */
+_STATIC_H optiga_lib_status_t optiga_util_sec_governor_read(optiga_util_sec_governor_t *p_governor) {
+    optiga_lib_status_t return_value;
+
+    p_governor->length = sizeof(p_governor->buffer);
+    return_value = optiga_util_read_data(
+        p_governor->p_util,
+        OPTIGA_UTIL_SEC_GOVERNOR_OID,
+        0,
+        p_governor->buffer,
+        &p_governor->length
+    );
+    if (OPTIGA_LIB_SUCCESS != return_value) {
+        pal_os_lock_enter_critical_section();
+        p_governor->stats.refresh_failure_count++;
+        p_governor->read_event_count = 0;
+        p_governor->is_busy = FALSE;
+        pal_os_lock_exit_critical_section();
+    }
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+// OID of the current limitation
+#define OPTIGA_UTIL_PERFORMANCE_OID (0xE0C4)
+
+/** \brief Performance profile manager of OPTIGA instance 0 */
+typedef struct optiga_util_performance_manager {
+    /// Instance used to read and write the current limitation, NULL if the manager is not running
+    optiga_util_t *p_util;
+    /// Configuration provided by the application
+    optiga_util_performance_config_t config;
+    /// State
+    optiga_util_performance_state_t state;
+    /// Latencies per command
+    optiga_util_performance_benchmark_t benchmark[OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES];
+    /// Number of commands benchmarked
+    uint8_t benchmark_count;
+    /// Callback handler of the instance, restored on stop
+    callback_handler_t handler;
+    /// Callback context of the instance, restored on stop
+    void *caller_context;
+    /// Time stamp in milliseconds, when a request was queued or processing at the last time
+    uint32_t last_busy_time;
+    /// Profile written by the switch in progress, OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM for the read on start
+    optiga_util_performance_profile_t pending_profile;
+    /// Time stamp in milliseconds of the last failed switch
+    uint32_t failure_time;
+    /// Last switch failed
+    bool_t is_failed;
+    /// Read or write in progress
+    bool_t is_busy;
+    /// Completion of the read or write in progress is notified to the callback handler
+    bool_t is_notified;
+    /// Current limitation read or written
+    uint8_t buffer[1];
+    /// Length of the current limitation read
+    uint16_t length;
+} optiga_util_performance_manager_t;
+
+// Performance profile manager of OPTIGA instance 0
+_STATIC_H optiga_util_performance_manager_t g_optiga_util_performance_manager = {0};
+
+/*
+ * Provides the profile of the current limitation, OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM if no profile matches
+ */
+_STATIC_H optiga_util_performance_profile_t optiga_util_performance_find_profile(
+    const optiga_util_performance_manager_t *p_manager,
+    uint8_t current_limit_ma
+) {
+    optiga_util_performance_profile_t profile = OPTIGA_UTIL_PERFORMANCE_PROFILE_LOW_POWER;
+
+    while ((OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM != profile)
+           && (current_limit_ma != p_manager->config.current_limit_ma[profile])) {
+        profile = (optiga_util_performance_profile_t)((uint8_t)profile + 1U);
+    }
+    return (profile);
+}
+
+/*
+ * Records the latency of a command for the active profile, the caller holds the lock
+ */
+_STATIC_H void optiga_util_performance_record(
+    optiga_util_performance_manager_t *p_manager,
+    uint8_t command,
+    uint32_t latency_us
+) {
+    optiga_util_performance_benchmark_t *p_entry;
+    uint8_t profile = (uint8_t)p_manager->state.profile;
+    uint8_t index = 0;
+
+    while ((index < p_manager->benchmark_count) && (command != p_manager->benchmark[index].command)) {
+        index++;
+    }
+    if ((index == p_manager->benchmark_count) && (OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES > index)) {
+        pal_os_memset(&p_manager->benchmark[index], 0x00, sizeof(p_manager->benchmark[index]));
+        p_manager->benchmark[index].command = command;
+        p_manager->benchmark_count++;
+    }
+    if (index < p_manager->benchmark_count) {
+        p_entry = &p_manager->benchmark[index];
+        p_entry->count[profile]++;
+        // Cumulative average, which does not overflow with the number of commands
+        if (latency_us >= p_entry->average_latency_us[profile]) {
+            p_entry->average_latency_us[profile] +=
+                (latency_us - p_entry->average_latency_us[profile]) / p_entry->count[profile];
+        } else {
+            p_entry->average_latency_us[profile] -=
+                (p_entry->average_latency_us[profile] - latency_us) / p_entry->count[profile];
+        }
+    }
+}
+
+/*
+ * Completion of the read or write of the current limitation
+ */
+_STATIC_H void optiga_util_performance_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_performance_manager_t *p_manager = (optiga_util_performance_manager_t *)p_ctx;
+    bool_t is_notified;
+
+    pal_os_lock_enter_critical_section();
+    if (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM == p_manager->pending_profile) {
+        if ((OPTIGA_LIB_SUCCESS == event) && (sizeof(p_manager->buffer) == p_manager->length)) {
+            p_manager->state.current_limit_ma = p_manager->buffer[0];
+            p_manager->state.profile =
+                optiga_util_performance_find_profile(p_manager, p_manager->buffer[0]);
+        }
+    } else if (OPTIGA_LIB_SUCCESS == event) {
+        p_manager->state.current_limit_ma = p_manager->buffer[0];
+        p_manager->state.profile = p_manager->pending_profile;
+        p_manager->state.switch_count++;
+        p_manager->is_failed = FALSE;
+    } else {
+        p_manager->state.switch_failure_count++;
+        p_manager->failure_time = pal_os_timer_get_time_in_milliseconds();
+        p_manager->is_failed = TRUE;
+    }
+    is_notified = p_manager->is_notified;
+    p_manager->is_busy = FALSE;
+    pal_os_lock_exit_critical_section();
+
+    if (TRUE == is_notified) {
+        optiga_util_complete(p_manager->handler, p_manager->caller_context, event);
+    }
+}
+
+/*
+ * Writes the current limitation of the profile, the write is claimed by the caller
+ */
+_STATIC_H optiga_lib_status_t optiga_util_performance_switch(
+    optiga_util_performance_manager_t *p_manager,
+    optiga_util_performance_profile_t profile
+) {
+    optiga_lib_status_t return_value;
+
+    p_manager->pending_profile = profile;
+    p_manager->buffer[0] = p_manager->config.current_limit_ma[profile];
+    return_value = optiga_util_write_data(
+        p_manager->p_util,
+        OPTIGA_UTIL_PERFORMANCE_OID,
+        OPTIGA_UTIL_ERASE_AND_WRITE,
+        0,
+        p_manager->buffer,
+        sizeof(p_manager->buffer)
+    );
+    if (OPTIGA_LIB_SUCCESS != return_value) {
+        pal_os_lock_enter_critical_section();
+        p_manager->state.switch_failure_count++;
+        p_manager->failure_time = pal_os_timer_get_time_in_milliseconds();
+        p_manager->is_failed = TRUE;
+        p_manager->is_busy = FALSE;
+        pal_os_lock_exit_critical_section();
+    }
+    return (return_value);
+}
+
+/*
+ * Load handler invoked from the command layer, records the latencies and switches the profile dynamically
+ */
+_STATIC_H void optiga_util_performance_load_handler(
+    void *p_ctx,
+    uint8_t event,
+    uint8_t command,
+    uint32_t value
+) {
+    optiga_util_performance_manager_t *p_manager = (optiga_util_performance_manager_t *)p_ctx;
+    optiga_util_performance_profile_t target = OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM;
+    uint32_t now = pal_os_timer_get_time_in_milliseconds();
+
+    pal_os_lock_enter_critical_section();
+    if (OPTIGA_CMD_LOAD_EVENT_COMMAND == event) {
+        if (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM != p_manager->state.profile) {
+            optiga_util_performance_record(p_manager, command, value);
+        }
+    } else {
+        p_manager->state.queue_depth = (uint8_t)value;
+        if (0 != value) {
+            p_manager->last_busy_time = now;
+        }
+        if (0 == p_manager->config.burst_queue_depth) {
+            // Switched only by the application
+        } else if (value >= p_manager->config.burst_queue_depth) {
+            target = p_manager->config.burst_profile;
+        } else if ((0 == value)
+                   && ((now - p_manager->last_busy_time) >= p_manager->config.idle_timeout_ms)) {
+            target = p_manager->config.idle_profile;
+        } else {
+            // Kept until the burst ends or the idle timeout expires
+        }
+        // A failed switch is retried after the idle timeout
+        if ((OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM != target) && (target != p_manager->state.profile)
+            && (FALSE == p_manager->is_busy) && (NULL != p_manager->p_util)
+            && ((FALSE == p_manager->is_failed)
+                || ((now - p_manager->failure_time) >= p_manager->config.idle_timeout_ms))) {
+            p_manager->is_busy = TRUE;
+            p_manager->is_notified = FALSE;
+        } else {
+            target = OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM;
+        }
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM != target) {
+        // lint --e{534} suppress "A failed switch is counted in the state and retried after the idle timeout"
+        optiga_util_performance_switch(p_manager, target);
+    }
+}
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
+_STATIC_H void optiga_util_reset_protection_level(optiga_util_t *me) {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+    if (NULL != me)
+#endif
+    {
+        OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL(me, OPTIGA_COMMS_DEFAULT_PROTECTION_LEVEL);
+    }
+}
+
+_STATIC_H optiga_lib_status_t optiga_util_write_data_wrapper(
+    optiga_util_t *me,
+    uint16_t optiga_oid,
+    uint8_t write_type,
+    uint16_t offset,
+    const uint8_t *p_buffer,
+    uint16_t length
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_set_data_object_params_t *p_params;
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+    optiga_util_write_behind_entry_t *p_write_behind_entry;
+#endif
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_buffer)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+        if (OPTIGA_UTIL_COUNT_DATA_OBJECT != write_type) {
+            p_write_behind_entry = optiga_util_write_behind_get_entry(me, optiga_oid);
+            if ((NULL != p_write_behind_entry)
+                && (TRUE
+                    == optiga_util_write_behind_write(
+                        me,
+                        p_write_behind_entry,
+                        write_type,
+                        offset,
+                        p_buffer,
+                        length,
+                        &return_value
+                    ))) {
+                break;
+            }
+        }
+#endif
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        p_params = (optiga_set_data_object_params_t *)&(me->params.optiga_set_data_object_params);
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_util_params_t));
+
+        if (OPTIGA_UTIL_COUNT_DATA_OBJECT == write_type) {
+            p_params->count = p_buffer[0];
+            p_params->buffer = NULL;
+        } else {
+            p_params->count = 0;
+            p_params->buffer = p_buffer;
+        }
+        p_params->oid = optiga_oid;
+        p_params->offset = offset;
+        p_params->data_or_metadata = 0;  // for Data
+        p_params->size = length;
+        p_params->written_size = 0;
+        p_params->write_type = write_type;
+
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+
+        return_value = optiga_cmd_set_data_object(
+            me->my_cmd,
+            write_type,
+            (optiga_set_data_object_params_t *)p_params
+        );
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    optiga_util_reset_protection_level(me);
+
+    return (return_value);
+}
+
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+void optiga_util_set_comms_params(optiga_util_t *me, uint8_t parameter_type, uint8_t value) {
+    switch (parameter_type) {
+        case OPTIGA_COMMS_PROTECTION_LEVEL: {
+            me->protection_level = value;
+            break;
+        }
+        case OPTIGA_COMMS_PROTOCOL_VERSION: {
+            me->protocol_version = value;
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+#endif
+
+optiga_util_t *
+optiga_util_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context) {
+    optiga_util_t *me = NULL;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == handler) {
+            break;
+        }
+#endif
+        me = (optiga_util_t *)pal_os_calloc(1, sizeof(optiga_util_t));
+        if (NULL == me) {
+            break;
+        }
+
+        me->handler = handler;
+        me->caller_context = caller_context;
+        me->instance_state = OPTIGA_LIB_SUCCESS;
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        me->protocol_version = OPTIGA_COMMS_PROTOCOL_VERSION_PRE_SHARED_SECRET;
+        me->protection_level = OPTIGA_COMMS_DEFAULT_PROTECTION_LEVEL;
+#endif
+        me->my_cmd = optiga_cmd_create(optiga_instance_id, optiga_util_generic_event_handler, me);
+        if (NULL == me->my_cmd) {
+            pal_os_free(me);
+            me = NULL;
+        }
+    } while (FALSE);
+
+    return (me);
+}
+
+optiga_lib_status_t optiga_util_destroy(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_LIB_SUCCESS;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == me) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+        if (me == g_optiga_util_power_manager.p_util) {
+            // lint --e{534} suppress "Detaching the power manager always succeeds"
+            optiga_cmd_power_manager_attach(me->my_cmd, NULL, NULL);
+            g_optiga_util_power_manager.p_util = NULL;
+        }
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+        if (me == g_optiga_util_sec_governor.p_util) {
+            pal_os_lock_enter_critical_section();
+            g_optiga_util_sec_governor.p_util = NULL;
+            pal_os_lock_exit_critical_section();
+        }
+#endif  // OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+        if (me == g_optiga_util_performance_manager.p_util) {
+            // lint --e{534} suppress "Detaching the load handler always succeeds"
+            optiga_cmd_load_handler_attach(me->my_cmd, NULL, NULL);
+            pal_os_lock_enter_critical_section();
+            g_optiga_util_performance_manager.p_util = NULL;
+            pal_os_lock_exit_critical_section();
+        }
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+        optiga_util_read_cache_complete(me, OPTIGA_UTIL_ERROR);
+#endif
+        return_value = optiga_cmd_destroy(me->my_cmd);
+        pal_os_free(me);
+    } while (FALSE);
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_open_application(optiga_util_t *me, bool_t perform_restore) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        if (FALSE == perform_restore) {
+            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_NONE);
+        } else {
+            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_RESTORE);
+        }
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+
+        return_value = optiga_cmd_open_application(me->my_cmd, perform_restore, NULL);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+
+    } while (FALSE);
+    optiga_util_reset_protection_level(me);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_close_application(optiga_util_t *me, bool_t perform_hibernate) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+        if (TRUE == optiga_util_write_behind_is_pending(me)) {
+            // Data is buffered, it is written before the application is closed
+            return_value = optiga_util_write_behind_acquire(me);
+            if (OPTIGA_LIB_SUCCESS == return_value) {
+                g_optiga_util_write_behind.perform_hibernate = perform_hibernate;
+                return_value = optiga_util_write_behind_begin(
+                    me,
+                    OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS,
+                    OPTIGA_UTIL_WRITE_BEHIND_THEN_CLOSE
+                );
+            }
+            break;
+        }
+#endif
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+        if (FALSE == perform_hibernate) {
+            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_NONE);
+        } else {
+            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_SAVE);
+        }
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+
+        return_value = optiga_cmd_close_application(me->my_cmd, perform_hibernate, NULL);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+
+    } while (FALSE);
+    optiga_util_reset_protection_level(me);
+
+    return (return_value);
+}
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+/*
+ * Completion of the hibernation triggered by the power manager
+ */
+_STATIC_H void optiga_util_power_manager_hibernate_handler(void *p_ctx, optiga_lib_status_t event) {
+    optiga_util_power_manager_t *p_manager = (optiga_util_power_manager_t *)p_ctx;
+
+    if (OPTIGA_LIB_SUCCESS == event) {
+        p_manager->stats.hibernate_count++;
+    } else {
+        p_manager->stats.hibernate_failure_count++;
+    }
+}
+
+/*
+ * Power event handler invoked from the command layer
+ */
+_STATIC_H void optiga_util_power_manager_event_handler(void *p_ctx, uint8_t event, uint32_t value) {
+    optiga_util_power_manager_t *p_manager = (optiga_util_power_manager_t *)p_ctx;
+    optiga_util_power_stats_t *p_stats = &p_manager->stats;
+    optiga_util_t *p_util = p_manager->p_util;
+
+    switch (event) {
+        case OPTIGA_CMD_POWER_EVENT_IDLE: {
+            if ((value < p_manager->config.idle_timeout_ms)
+                || (OPTIGA_LIB_INSTANCE_BUSY == p_util->instance_state)) {
+                { static int l=-1; int r = (value < p_manager->config.idle_timeout_ms) ? 1 : 2; if (r != l) { l = r; fprintf(stderr, "DBGP %d\n", r);} }
+                break;
+            }
+            // Stay awake, if restoring is known to be slower than the budget
+            if ((OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET == p_manager->config.policy)
+                && (0 != p_stats->restore_count)
+                && (p_stats->average_resume_latency_us
+                    > p_manager->config.resume_latency_budget_us)) {
+                break;
+            }
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+            // Stay awake, until the buffered data is written
+            if (TRUE == optiga_util_write_behind_is_pending(p_util)) {
+                break;
+            }
+#endif
+            // Invoked from the scheduler, the command is only queued and executed by the scheduler
+            p_util->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+            OPTIGA_PROTECTION_ENABLE(p_util->my_cmd, p_util);
+            OPTIGA_PROTECTION_SET_VERSION(p_util->my_cmd, p_util);
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+            OPTIGA_PROTECTION_MANAGE_CONTEXT(p_util->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_SAVE);
+#endif
+            if (OPTIGA_LIB_SUCCESS != optiga_cmd_power_hibernate_request(p_util->my_cmd)) {
+                p_util->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+                p_stats->hibernate_failure_count++;
+            }
+            optiga_util_reset_protection_level(p_util);
+            break;
+        }
+        case OPTIGA_CMD_POWER_EVENT_RESTORED: {
+            p_stats->last_resume_latency_us = value;
+            if (value > p_stats->max_resume_latency_us) {
+                p_stats->max_resume_latency_us = value;
+            }
+            if (0 == p_stats->restore_count) {
+                p_stats->average_resume_latency_us = value;
+            } else {
+                p_stats->average_resume_latency_us =
+                    p_stats->average_resume_latency_us
+                    - (p_stats->average_resume_latency_us >> OPTIGA_UTIL_POWER_LATENCY_AVERAGE_SHIFT)
+                    + (value >> OPTIGA_UTIL_POWER_LATENCY_AVERAGE_SHIFT);
+            }
+            p_stats->restore_count++;
+            break;
+        }
+        case OPTIGA_CMD_POWER_EVENT_RESTORE_FAILED: {
+            p_stats->restore_failure_count++;
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+optiga_lib_status_t
+optiga_util_power_manager_start(optiga_util_t *me, const optiga_util_power_config_t *p_config) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_power_manager_t *p_manager = &g_optiga_util_power_manager;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_config)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if ((0 == p_config->idle_timeout_ms)
+            || (OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET < p_config->policy)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if ((OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) || (NULL != p_manager->p_util)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        pal_os_memset(&p_manager->stats, 0x00, sizeof(p_manager->stats));
+        p_manager->config = *p_config;
+        p_manager->p_util = me;
+        p_manager->handler = me->handler;
+        p_manager->caller_context = me->caller_context;
+        me->handler = optiga_util_power_manager_hibernate_handler;
+        me->caller_context = p_manager;
+
+        if (OPTIGA_LIB_SUCCESS
+            != optiga_cmd_power_manager_attach(
+                me->my_cmd,
+                optiga_util_power_manager_event_handler,
+                p_manager
+            )) {
+            me->handler = p_manager->handler;
+            me->caller_context = p_manager->caller_context;
+            p_manager->p_util = NULL;
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_power_manager_stop(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_power_manager_t *p_manager = &g_optiga_util_power_manager;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+        if ((NULL == me) || (me != p_manager->p_util)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        // lint --e{534} suppress "Detaching the power manager always succeeds"
+        optiga_cmd_power_manager_attach(me->my_cmd, NULL, NULL);
+        me->handler = p_manager->handler;
+        me->caller_context = p_manager->caller_context;
+        p_manager->p_util = NULL;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_power_manager_get_stats(const optiga_util_t *me, optiga_util_power_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+
+    do {
+        if ((NULL == me) || (NULL == p_stats) || (me != g_optiga_util_power_manager.p_util)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+        *p_stats = g_optiga_util_power_manager.stats;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+optiga_lib_status_t optiga_util_slot_manager_start(
+    optiga_util_t *me,
+    const optiga_util_slot_manager_config_t *p_config
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    uint8_t index;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_config)
+            || (NULL == p_config->p_slots)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if ((0 == p_config->slot_count)
+            || (OPTIGA_UTIL_SLOT_MANAGER_MAX_SLOTS < p_config->slot_count)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        // The discovery is claimed within the same lock, a concurrent start or synchronization is rejected
+        pal_os_lock_enter_critical_section();
+        if ((OPTIGA_LIB_INSTANCE_BUSY == me->instance_state)
+            || (OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE != p_manager->state)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+        } else {
+            p_manager->state = OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_RECORD;
+            pal_os_memset(p_manager->slots, 0x00, sizeof(p_manager->slots));
+            for (index = 0; index < p_config->slot_count; index++) {
+                p_manager->slots[index].oid = p_config->p_slots[index].oid;
+                p_manager->slots[index].slot_type = p_config->p_slots[index].slot_type;
+            }
+            p_manager->slot_count = p_config->slot_count;
+            p_manager->wear_record_oid = p_config->wear_record_oid;
+            p_manager->is_ready = FALSE;
+            p_manager->is_dirty = FALSE;
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+        pal_os_lock_exit_critical_section();
+        if (OPTIGA_UTIL_SUCCESS != return_value) {
+            break;
+        }
+
+        return_value = optiga_util_slot_manager_begin(
+            p_manager,
+            me,
+            OPTIGA_UTIL_SLOT_MANAGER_STATE_READ_RECORD
+        );
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_slot_manager_stop(void) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    pal_os_lock_enter_critical_section();
+    if (OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE == p_manager->state) {
+        p_manager->is_ready = FALSE;
+        p_manager->slot_count = 0;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_slot_allocate(optiga_util_slot_type_t slot_type, uint16_t owner_id, uint16_t *p_oid) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    optiga_util_slot_info_t *p_slot = NULL;
+    uint8_t index;
+
+    if ((NULL != p_oid) && (0 != owner_id)) {
+        pal_os_lock_enter_critical_section();
+        if (TRUE == p_manager->is_ready) {
+            // Least worn free slot, the first configured one on equal write counts
+            for (index = 0; index < p_manager->slot_count; index++) {
+                if ((slot_type == p_manager->slots[index].slot_type)
+                    && (FALSE == p_manager->slots[index].is_allocated)
+                    && ((NULL == p_slot)
+                        || (p_manager->slots[index].write_count < p_slot->write_count))) {
+                    p_slot = &p_manager->slots[index];
+                }
+            }
+            return_value = OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT;
+            if (NULL != p_slot) {
+                p_slot->is_allocated = TRUE;
+                p_slot->owner_id = owner_id;
+                p_slot->write_count++;
+                p_manager->is_dirty = TRUE;
+                *p_oid = p_slot->oid;
+                return_value = OPTIGA_UTIL_SUCCESS;
+            }
+        }
+        pal_os_lock_exit_critical_section();
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_slot_free(uint16_t oid) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    optiga_util_slot_info_t *p_slot;
+
+    pal_os_lock_enter_critical_section();
+    p_slot = optiga_util_slot_manager_find(p_manager, oid);
+    if ((TRUE == p_manager->is_ready) && (NULL != p_slot) && (TRUE == p_slot->is_allocated)) {
+        p_slot->is_allocated = FALSE;
+        p_slot->is_occupied = FALSE;
+        p_slot->owner_id = 0;
+        p_manager->is_dirty = TRUE;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_slot_record_write(uint16_t oid) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    optiga_util_slot_info_t *p_slot;
+
+    pal_os_lock_enter_critical_section();
+    p_slot = optiga_util_slot_manager_find(p_manager, oid);
+    if ((TRUE == p_manager->is_ready) && (NULL != p_slot)) {
+        p_slot->write_count++;
+        p_manager->is_dirty = TRUE;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_slot_lookup(optiga_util_slot_type_t slot_type, uint16_t owner_id, uint16_t *p_oid) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    const optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    uint8_t index;
+
+    if ((NULL != p_oid) && (0 != owner_id)) {
+        pal_os_lock_enter_critical_section();
+        for (index = 0; (TRUE == p_manager->is_ready) && (index < p_manager->slot_count); index++) {
+            if ((slot_type == p_manager->slots[index].slot_type)
+                && (TRUE == p_manager->slots[index].is_allocated)
+                && (owner_id == p_manager->slots[index].owner_id)) {
+                *p_oid = p_manager->slots[index].oid;
+                return_value = OPTIGA_UTIL_SUCCESS;
+                break;
+            }
+        }
+        pal_os_lock_exit_critical_section();
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_slot_get_info(uint16_t oid, optiga_util_slot_info_t *p_info) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    const optiga_util_slot_info_t *p_slot;
+
+    if (NULL != p_info) {
+        pal_os_lock_enter_critical_section();
+        p_slot = optiga_util_slot_manager_find(p_manager, oid);
+        if ((TRUE == p_manager->is_ready) && (NULL != p_slot)) {
+            *p_info = *p_slot;
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+        pal_os_lock_exit_critical_section();
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_slot_manager_sync(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_slot_manager_t *p_manager = &g_optiga_util_slot_manager;
+    bool_t is_dirty = FALSE;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (FALSE == p_manager->is_ready) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        // The write is claimed within the same lock, a concurrent start or synchronization is rejected.
+        // Changes after the snapshot are persisted by the next synchronization.
+        pal_os_lock_enter_critical_section();
+        if ((OPTIGA_LIB_INSTANCE_BUSY == me->instance_state)
+            || (OPTIGA_UTIL_SLOT_MANAGER_STATE_IDLE != p_manager->state)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+        } else if (TRUE == p_manager->is_dirty) {
+            p_manager->state = OPTIGA_UTIL_SLOT_MANAGER_STATE_WRITE_RECORD;
+            optiga_util_slot_manager_build_record(p_manager);
+            p_manager->is_dirty = FALSE;
+            is_dirty = TRUE;
+            return_value = OPTIGA_UTIL_SUCCESS;
+        } else {
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+        pal_os_lock_exit_critical_section();
+        if (OPTIGA_UTIL_SUCCESS != return_value) {
+            break;
+        }
+
+        if (FALSE == is_dirty) {
+            me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+            return_value = OPTIGA_UTIL_SUCCESS;
+            break;
+        }
+
+        return_value = optiga_util_slot_manager_begin(
+            p_manager,
+            me,
+            OPTIGA_UTIL_SLOT_MANAGER_STATE_WRITE_RECORD
+        );
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            pal_os_lock_enter_critical_section();
+            p_manager->is_dirty = TRUE;
+            pal_os_lock_exit_critical_section();
+        }
+    } while (FALSE);
+
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+optiga_lib_status_t optiga_util_read_cache_enable(optiga_util_t *me, bool_t enable) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_lib_status_t attach_status;
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        if (TRUE == enable) {
+            attach_status = optiga_cmd_write_handler_attach(
+                me->my_cmd,
+                optiga_util_read_cache_write_handler,
+                &g_optiga_util_read_cache
+            );
+            // Writes would not be observed, the cache is not enabled
+            if (OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == attach_status) {
+                return_value = OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT;
+                break;
+            }
+            // Writes were not observed before the handler is attached, the cached data is discarded
+            if (OPTIGA_CMD_SUCCESS == attach_status) {
+                optiga_util_read_cache_flush(OPTIGA_UTIL_READ_CACHE_ALL_OIDS);
+            }
+        }
+        me->read_cache_enabled = enable;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+void optiga_util_read_cache_set_ttl(uint32_t ttl_ms) {
+    pal_os_lock_enter_critical_section();
+    g_optiga_util_read_cache.ttl_ms = ttl_ms;
+    pal_os_lock_exit_critical_section();
+}
+
+optiga_lib_status_t optiga_util_read_cache_set_read_ahead(uint16_t read_ahead_length) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+
+    if (OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE >= read_ahead_length) {
+        pal_os_lock_enter_critical_section();
+        g_optiga_util_read_cache.read_ahead_length = read_ahead_length;
+        pal_os_lock_exit_critical_section();
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    return (return_value);
+}
+
+void optiga_util_read_cache_flush(uint16_t optiga_oid) {
+    optiga_util_read_cache_t *p_cache = &g_optiga_util_read_cache;
+    uint8_t index;
+
+    pal_os_lock_enter_critical_section();
+    for (index = 0; index < OPTIGA_UTIL_READ_CACHE_ENTRIES; index++) {
+        if ((OPTIGA_UTIL_READ_CACHE_ENTRY_FREE != p_cache->entries[index].state)
+            && ((OPTIGA_UTIL_READ_CACHE_ALL_OIDS == optiga_oid)
+                || (optiga_oid == p_cache->entries[index].oid))) {
+            optiga_util_read_cache_discard(&p_cache->entries[index]);
+        }
+    }
+    pal_os_lock_exit_critical_section();
+}
+
+optiga_lib_status_t optiga_util_read_cache_get_stats(optiga_util_read_cache_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+
+    if (NULL != p_stats) {
+        *p_stats = g_optiga_util_read_cache.stats;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
+
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+optiga_lib_status_t
+optiga_util_metadata_store_start(optiga_util_t *me, const uint16_t *p_oids, uint8_t oid_count) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_metadata_store_t *p_store = &g_optiga_util_metadata_store;
+    optiga_lib_status_t attach_status;
+    const uint16_t *p_store_oids = p_oids;
+    uint8_t store_oid_count = oid_count;
+    uint8_t index;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (NULL == p_oids) {
+            p_store_oids = g_optiga_util_metadata_store_default_oids;
+            store_oid_count = (uint8_t)(sizeof(g_optiga_util_metadata_store_default_oids)
+                                        / sizeof(g_optiga_util_metadata_store_default_oids[0]));
+        }
+        if ((0 == store_oid_count) || (OPTIGA_UTIL_METADATA_STORE_MAX_OIDS < store_oid_count)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if (FALSE == optiga_util_metadata_store_claim(me, p_store)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        attach_status = optiga_cmd_write_handler_attach(
+            me->my_cmd,
+            optiga_util_metadata_store_write_handler,
+            p_store
+        );
+        if (OPTIGA_CMD_ERROR_MEMORY_INSUFFICIENT == attach_status) {
+            pal_os_lock_enter_critical_section();
+            p_store->is_busy = FALSE;
+            pal_os_lock_exit_critical_section();
+            return_value = OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT;
+            break;
+        }
+
+        pal_os_lock_enter_critical_section();
+        for (index = 0; index < store_oid_count; index++) {
+            p_store->oid[index] = p_store_oids[index];
+            p_store->state[index] = OPTIGA_UTIL_METADATA_STATE_STALE;
+        }
+        p_store->oid_count = store_oid_count;
+        pal_os_lock_exit_critical_section();
+
+        return_value = optiga_util_metadata_store_begin(p_store, me);
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_metadata_store_refresh(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_metadata_store_t *p_store = &g_optiga_util_metadata_store;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (0 == p_store->oid_count) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        if (FALSE == optiga_util_metadata_store_claim(me, p_store)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        return_value = optiga_util_metadata_store_begin(p_store, me);
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_metadata_store_stop(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_metadata_store_t *p_store = &g_optiga_util_metadata_store;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (TRUE == p_store->is_busy) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        // lint --e{534} suppress "The handler is not attached, if the store was started with another OPTIGA instance"
+        optiga_cmd_write_handler_detach(me->my_cmd, optiga_util_metadata_store_write_handler);
+        pal_os_lock_enter_critical_section();
+        p_store->oid_count = 0;
+        pal_os_lock_exit_critical_section();
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_metadata_get(uint16_t optiga_oid, optiga_util_metadata_t *p_metadata) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    const optiga_util_metadata_store_t *p_store = &g_optiga_util_metadata_store;
+    uint8_t index;
+
+    if (NULL != p_metadata) {
+        pal_os_lock_enter_critical_section();
+        index = optiga_util_metadata_store_find(p_store, optiga_oid);
+        if (index < p_store->oid_count) {
+            if (OPTIGA_UTIL_METADATA_STATE_STALE == p_store->state[index]) {
+                return_value = OPTIGA_UTIL_ERROR;
+            } else if (OPTIGA_UTIL_METADATA_STATE_VALID == p_store->state[index]) {
+                p_metadata->oid = optiga_oid;
+                p_metadata->tag_mask = p_store->tag_mask[index];
+                p_metadata->lcs = p_store->lcs[index];
+                p_metadata->algorithm = p_store->algorithm[index];
+                p_metadata->key_usage = p_store->key_usage[index];
+                p_metadata->data_type = p_store->data_type[index];
+                p_metadata->max_size = p_store->max_size[index];
+                p_metadata->used_size = p_store->used_size[index];
+                p_metadata->change_ac = p_store->ac[index][0];
+                p_metadata->read_ac = p_store->ac[index][1];
+                p_metadata->execute_ac = p_store->ac[index][2];
+                return_value = OPTIGA_UTIL_SUCCESS;
+            } else {
+                // Not available on this OPTIGA
+            }
+        }
+        pal_os_lock_exit_critical_section();
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_metadata_find(
+    const optiga_util_metadata_filter_t *p_filter,
+    uint16_t *p_oids,
+    uint8_t *p_oid_count
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    const optiga_util_metadata_store_t *p_store = &g_optiga_util_metadata_store;
+    uint16_t tag_mask;
+    uint8_t found_count = 0;
+    uint8_t index;
+
+    if ((NULL != p_filter) && (NULL != p_oids) && (NULL != p_oid_count)) {
+        tag_mask = p_filter->tag_mask;
+        return_value = OPTIGA_UTIL_SUCCESS;
+        pal_os_lock_enter_critical_section();
+        for (index = 0; index < p_store->oid_count; index++) {
+            if ((OPTIGA_UTIL_METADATA_STATE_VALID == p_store->state[index])
+                && (tag_mask == (p_store->tag_mask[index] & tag_mask))
+                && ((0U == (tag_mask & OPTIGA_UTIL_METADATA_HAS_LCS))
+                    || (p_filter->lcs == p_store->lcs[index]))
+                && ((0U == (tag_mask & OPTIGA_UTIL_METADATA_HAS_ALGORITHM))
+                    || (p_filter->algorithm == p_store->algorithm[index]))
+                && ((0U == (tag_mask & OPTIGA_UTIL_METADATA_HAS_KEY_USAGE))
+                    || (p_filter->key_usage == (p_store->key_usage[index] & p_filter->key_usage)))
+                && ((0U == (tag_mask & OPTIGA_UTIL_METADATA_HAS_DATA_TYPE))
+                    || (p_filter->data_type == p_store->data_type[index]))) {
+                if (found_count == *p_oid_count) {
+                    return_value = OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT;
+                    break;
+                }
+                p_oids[found_count++] = p_store->oid[index];
+            }
+        }
+        pal_os_lock_exit_critical_section();
+        *p_oid_count = found_count;
+    }
+
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_METADATA_STORE_ENABLED
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+optiga_lib_status_t optiga_util_write_behind_start(const optiga_util_write_behind_config_t *p_config) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+    optiga_util_t *p_window_util = NULL;
+    uint8_t index;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if (NULL == p_config) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if ((NULL == p_config->p_oids) || (0 == p_config->oid_count)
+            || (OPTIGA_UTIL_WRITE_BEHIND_ENTRIES < p_config->oid_count)
+            || (OPTIGA_UTIL_WRITE_BEHIND_BUFFER_SIZE < p_config->flush_length)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+        // The flush after the window is issued with an own instance, as no operation of the application may follow
+        if (0U != p_config->window_ms) {
+            p_window_util =
+                optiga_util_create(0, optiga_util_write_behind_window_handler, p_write_behind);
+            if (NULL == p_window_util) {
+                return_value = OPTIGA_UTIL_ERROR_MEMORY_INSUFFICIENT;
+                break;
+            }
+        }
+
+        pal_os_lock_enter_critical_section();
+        if ((TRUE == p_write_behind->is_busy)
+            || (TRUE == optiga_util_write_behind_has_data(p_write_behind))) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+        } else {
+            for (index = 0; index < p_config->oid_count; index++) {
+                p_write_behind->entries[index].oid = p_config->p_oids[index];
+                p_write_behind->entries[index].state = OPTIGA_UTIL_WRITE_BEHIND_ENTRY_FREE;
+            }
+            p_write_behind->entry_count = p_config->oid_count;
+            p_write_behind->window_ms = p_config->window_ms;
+            p_write_behind->flush_length = p_config->flush_length;
+            pal_os_memset(&p_write_behind->stats, 0x00, sizeof(p_write_behind->stats));
+            // The instance of the previous start is released below
+            optiga_util_write_behind_swap_window_util(p_write_behind, &p_window_util);
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+        pal_os_lock_exit_critical_section();
+        optiga_util_write_behind_release_window_util(p_window_util);
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_write_behind_stop(void) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    optiga_util_write_behind_t *p_write_behind = &g_optiga_util_write_behind;
+
+    optiga_util_t *p_window_util = NULL;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    pal_os_lock_enter_critical_section();
+    if ((FALSE == p_write_behind->is_busy)
+        && (FALSE == optiga_util_write_behind_has_data(p_write_behind))) {
+        p_write_behind->entry_count = 0;
+        optiga_util_write_behind_swap_window_util(p_write_behind, &p_window_util);
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+    optiga_util_write_behind_release_window_util(p_window_util);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_write_behind_flush(optiga_util_t *me, uint16_t optiga_oid) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        if (NULL == optiga_util_write_behind_find(&g_optiga_util_write_behind, optiga_oid)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+        return_value = optiga_util_write_behind_acquire(me);
+        if (OPTIGA_LIB_SUCCESS == return_value) {
+            return_value =
+                optiga_util_write_behind_begin(me, optiga_oid, OPTIGA_UTIL_WRITE_BEHIND_THEN_NONE);
+        }
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_write_behind_barrier(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (0 == g_optiga_util_write_behind.entry_count) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
             break;
         }
+        return_value = optiga_util_write_behind_acquire(me);
+        if (OPTIGA_LIB_SUCCESS == return_value) {
+            return_value = optiga_util_write_behind_begin(
+                me,
+                OPTIGA_UTIL_WRITE_BEHIND_ALL_OIDS,
+                OPTIGA_UTIL_WRITE_BEHIND_THEN_NONE
+            );
+        }
+    } while (FALSE);
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_write_behind_get_stats(optiga_util_write_behind_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+
+    if (NULL != p_stats) {
+        pal_os_lock_enter_critical_section();
+        *p_stats = g_optiga_util_write_behind.stats;
+        pal_os_lock_exit_critical_section();
+        return_value = OPTIGA_UTIL_SUCCESS;
     }
+    return (return_value);
 }
-#endif
+#endif  // OPTIGA_UTIL_WRITE_BEHIND_ENABLED
 
-optiga_util_t *
-optiga_util_create(uint8_t optiga_instance_id, callback_handler_t handler, void *caller_context) {
-    optiga_util_t *me = NULL;
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+optiga_lib_status_t optiga_util_sec_governor_start(
+    optiga_util_t *me,
+    const optiga_util_sec_governor_config_t *p_config
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
+    uint32_t now;
 
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
     do {
 #ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-        if (NULL == handler) {
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_config)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
             break;
         }
 #endif
-        me = (optiga_util_t *)pal_os_calloc(1, sizeof(optiga_util_t));
-        if (NULL == me) {
+        if ((0 == p_config->decay_period_ms) || (0 == p_config->low_priority_limit)
+            || (p_config->low_priority_limit > p_config->throttle_threshold)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
             break;
         }
 
-        me->handler = handler;
-        me->caller_context = caller_context;
-        me->instance_state = OPTIGA_LIB_SUCCESS;
-#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
-        me->protocol_version = OPTIGA_COMMS_PROTOCOL_VERSION_PRE_SHARED_SECRET;
-        me->protection_level = OPTIGA_COMMS_DEFAULT_PROTECTION_LEVEL;
-#endif
-        me->my_cmd = optiga_cmd_create(optiga_instance_id, optiga_util_generic_event_handler, me);
-        if (NULL == me->my_cmd) {
-            pal_os_free(me);
-            me = NULL;
+        if ((OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) || (NULL != p_governor->p_util)) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        now = pal_os_timer_get_time_in_milliseconds();
+        pal_os_lock_enter_critical_section();
+        pal_os_memset(&p_governor->stats, 0x00, sizeof(p_governor->stats));
+        p_governor->config = *p_config;
+        p_governor->base_sec = 0;
+        p_governor->base_time = now;
+        p_governor->refresh_time = now;
+        p_governor->in_progress_count = 0;
+        p_governor->read_event_count = 0;
+        p_governor->is_busy = TRUE;
+        p_governor->p_util = me;
+        pal_os_lock_exit_critical_section();
+
+        p_governor->handler = me->handler;
+        p_governor->caller_context = me->caller_context;
+        me->handler = optiga_util_sec_governor_handler;
+        me->caller_context = p_governor;
+
+        return_value = optiga_util_sec_governor_read(p_governor);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->handler = p_governor->handler;
+            me->caller_context = p_governor->caller_context;
+            pal_os_lock_enter_critical_section();
+            p_governor->p_util = NULL;
+            pal_os_lock_exit_critical_section();
         }
     } while (FALSE);
 
-    return (me);
+    return (return_value);
 }
 
-optiga_lib_status_t optiga_util_destroy(optiga_util_t *me) {
-    optiga_lib_status_t return_value = OPTIGA_LIB_SUCCESS;
+optiga_lib_status_t optiga_util_sec_governor_stop(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
 
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
     do {
-#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-        if (NULL == me) {
+        if ((NULL == me) || (me != p_governor->p_util)) {
             return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
             break;
         }
-#endif
-        return_value = optiga_cmd_destroy(me->my_cmd);
-        pal_os_free(me);
+
+        pal_os_lock_enter_critical_section();
+        if (TRUE == p_governor->is_busy) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+        } else {
+            p_governor->p_util = NULL;
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+        pal_os_lock_exit_critical_section();
+
+        if (OPTIGA_UTIL_SUCCESS == return_value) {
+            me->handler = p_governor->handler;
+            me->caller_context = p_governor->caller_context;
+        }
     } while (FALSE);
+
     return (return_value);
 }
 
-optiga_lib_status_t optiga_util_open_application(optiga_util_t *me, bool_t perform_restore) {
+optiga_lib_status_t optiga_util_sec_governor_refresh(void) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    pal_os_lock_enter_critical_section();
+    if (NULL == p_governor->p_util) {
+        return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    } else if (TRUE == p_governor->is_busy) {
+        return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    } else {
+        p_governor->is_busy = TRUE;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (OPTIGA_UTIL_SUCCESS == return_value) {
+        return_value = optiga_util_sec_governor_read(p_governor);
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_sec_governor_admit(optiga_util_sec_priority_t priority, uint32_t *p_wait_ms) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
+    bool_t is_refresh = FALSE;
+    uint32_t now;
+    uint32_t sec;
+    uint32_t excess;
+
+    if ((NULL == p_wait_ms) || (OPTIGA_UTIL_SEC_PRIORITY_LOW < priority)) {
+        return (OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    }
+
+    now = pal_os_timer_get_time_in_milliseconds();
+    pal_os_lock_enter_critical_section();
+    if (NULL != p_governor->p_util) {
+        optiga_util_sec_governor_decay(p_governor, now);
+        if ((0 != p_governor->config.refresh_period_ms) && (FALSE == p_governor->is_busy)
+            && ((now - p_governor->refresh_time) >= p_governor->config.refresh_period_ms)) {
+            p_governor->is_busy = TRUE;
+            is_refresh = TRUE;
+        }
+
+        // Every request admitted and not released may still raise a security event
+        sec = (uint32_t)p_governor->base_sec + p_governor->in_progress_count;
+        if ((OPTIGA_UTIL_SEC_PRIORITY_LOW == priority)
+            && (sec >= p_governor->config.low_priority_limit)) {
+            excess = (sec - p_governor->config.low_priority_limit) + 1U;
+            if (excess > p_governor->base_sec) {
+                // Held back by requests in progress, which are not decayed
+                *p_wait_ms = p_governor->config.decay_period_ms;
+            } else {
+                *p_wait_ms = (excess * p_governor->config.decay_period_ms)
+                    - (now - p_governor->base_time);
+            }
+            p_governor->stats.deferred_count++;
+            return_value = OPTIGA_UTIL_BUSY;
+        } else {
+            *p_wait_ms = 0;
+            p_governor->in_progress_count++;
+            p_governor->stats.admitted_count++;
+            return_value = OPTIGA_UTIL_SUCCESS;
+        }
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (TRUE == is_refresh) {
+        // lint --e{534} suppress "A failed read is counted in the statistics and retried after the refresh period"
+        optiga_util_sec_governor_read(p_governor);
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_sec_governor_release(optiga_lib_status_t status) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
+    uint32_t now = pal_os_timer_get_time_in_milliseconds();
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_governor->p_util) && (0 != p_governor->in_progress_count)) {
+        p_governor->in_progress_count--;
+        if (OPTIGA_DEVICE_ERROR == (status & OPTIGA_DEVICE_ERROR)) {
+            optiga_util_sec_governor_decay(p_governor, now);
+            if (OPTIGA_UTIL_SEC_GOVERNOR_MAX_SEC > p_governor->base_sec) {
+                p_governor->base_sec++;
+            }
+            if ((TRUE == p_governor->is_busy)
+                && (OPTIGA_UTIL_SEC_GOVERNOR_MAX_SEC > p_governor->read_event_count)) {
+                p_governor->read_event_count++;
+            }
+            p_governor->stats.event_count++;
+            optiga_util_sec_governor_update_stats(p_governor);
+        }
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_sec_governor_get_stats(optiga_util_sec_governor_stats_t *p_stats) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    optiga_util_sec_governor_t *p_governor = &g_optiga_util_sec_governor;
+    uint32_t now = pal_os_timer_get_time_in_milliseconds();
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_stats) && (NULL != p_governor->p_util)) {
+        optiga_util_sec_governor_decay(p_governor, now);
+        *p_stats = p_governor->stats;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+optiga_lib_status_t optiga_util_performance_profile_start(
+    optiga_util_t *me,
+    const optiga_util_performance_config_t *p_config
+) {
     optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_performance_manager_t *p_manager = &g_optiga_util_performance_manager;
+    uint8_t index;
 
     OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
     do {
 #ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-        if ((NULL == me) || (NULL == me->my_cmd)) {
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == p_config)) {
             return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
             break;
         }
 #endif
+        for (index = 0; index < OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT; index++) {
+            if ((OPTIGA_UTIL_PERFORMANCE_MIN_CURRENT_MA > p_config->current_limit_ma[index])
+                || (OPTIGA_UTIL_PERFORMANCE_MAX_CURRENT_MA < p_config->current_limit_ma[index])) {
+                break;
+            }
+        }
+        // The switch to the idle profile must not count as a burst
+        if ((OPTIGA_UTIL_PERFORMANCE_PROFILE_COUNT != index)
+            || ((0 != p_config->burst_queue_depth)
+                && ((2U > p_config->burst_queue_depth) || (0 == p_config->idle_timeout_ms)
+                    || (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM <= p_config->burst_profile)
+                    || (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM <= p_config->idle_profile)))) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
 
-        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+        if ((OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) || (NULL != p_manager->p_util)) {
             return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
             break;
         }
 
-        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
-        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
-        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
-#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
-        if (FALSE == perform_restore) {
-            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_NONE);
-        } else {
-            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_RESTORE);
+        pal_os_lock_enter_critical_section();
+        pal_os_memset(&p_manager->state, 0x00, sizeof(p_manager->state));
+        p_manager->state.profile = OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM;
+        p_manager->config = *p_config;
+        p_manager->benchmark_count = 0;
+        p_manager->last_busy_time = pal_os_timer_get_time_in_milliseconds();
+        p_manager->pending_profile = OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM;
+        p_manager->is_failed = FALSE;
+        p_manager->is_busy = TRUE;
+        p_manager->is_notified = TRUE;
+        p_manager->p_util = me;
+        pal_os_lock_exit_critical_section();
+
+        if (OPTIGA_LIB_SUCCESS
+            != optiga_cmd_load_handler_attach(
+                me->my_cmd,
+                optiga_util_performance_load_handler,
+                p_manager
+            )) {
+            pal_os_lock_enter_critical_section();
+            p_manager->p_util = NULL;
+            p_manager->is_busy = FALSE;
+            pal_os_lock_exit_critical_section();
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
         }
-#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
 
-        return_value = optiga_cmd_open_application(me->my_cmd, perform_restore, NULL);
+        p_manager->handler = me->handler;
+        p_manager->caller_context = me->caller_context;
+        me->handler = optiga_util_performance_handler;
+        me->caller_context = p_manager;
+
+        p_manager->length = sizeof(p_manager->buffer);
+        return_value = optiga_util_read_data(
+            me,
+            OPTIGA_UTIL_PERFORMANCE_OID,
+            0,
+            p_manager->buffer,
+            &p_manager->length
+        );
         if (OPTIGA_LIB_SUCCESS != return_value) {
-            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+            // lint --e{534} suppress "Detaching the load handler always succeeds"
+            optiga_cmd_load_handler_attach(me->my_cmd, NULL, NULL);
+            me->handler = p_manager->handler;
+            me->caller_context = p_manager->caller_context;
+            pal_os_lock_enter_critical_section();
+            p_manager->p_util = NULL;
+            p_manager->is_busy = FALSE;
+            pal_os_lock_exit_critical_section();
         }
-
     } while (FALSE);
-    optiga_util_reset_protection_level(me);
 
     return (return_value);
 }
 
-optiga_lib_status_t optiga_util_close_application(optiga_util_t *me, bool_t perform_hibernate) {
+optiga_lib_status_t optiga_util_performance_profile_stop(optiga_util_t *me) {
     optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
-    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    optiga_util_performance_manager_t *p_manager = &g_optiga_util_performance_manager;
 
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
     do {
-#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
-        if ((NULL == me) || (NULL == me->my_cmd)) {
+        if ((NULL == me) || (me != p_manager->p_util)) {
             return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
             break;
         }
-#endif
 
-        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+        pal_os_lock_enter_critical_section();
+        if (TRUE == p_manager->is_busy) {
             return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
-            break;
-        }
-
-        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
-        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
-        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
-
-#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
-        if (FALSE == perform_hibernate) {
-            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_NONE);
         } else {
-            OPTIGA_PROTECTION_MANAGE_CONTEXT(me->my_cmd, OPTIGA_COMMS_SESSION_CONTEXT_SAVE);
+            p_manager->p_util = NULL;
+            return_value = OPTIGA_UTIL_SUCCESS;
         }
-#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+        pal_os_lock_exit_critical_section();
 
-        return_value = optiga_cmd_close_application(me->my_cmd, perform_hibernate, NULL);
-        if (OPTIGA_LIB_SUCCESS != return_value) {
-            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        if (OPTIGA_UTIL_SUCCESS == return_value) {
+            // lint --e{534} suppress "Detaching the load handler always succeeds"
+            optiga_cmd_load_handler_attach(me->my_cmd, NULL, NULL);
+            me->handler = p_manager->handler;
+            me->caller_context = p_manager->caller_context;
         }
-
     } while (FALSE);
-    optiga_util_reset_protection_level(me);
 
     return (return_value);
 }
 
+optiga_lib_status_t optiga_util_performance_profile_set(optiga_util_performance_profile_t profile) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_util_performance_manager_t *p_manager = &g_optiga_util_performance_manager;
+    bool_t is_active = FALSE;
+
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+    pal_os_lock_enter_critical_section();
+    if ((NULL == p_manager->p_util) || (OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM <= profile)) {
+        return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    } else if (TRUE == p_manager->is_busy) {
+        return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+    } else if (profile == p_manager->state.profile) {
+        is_active = TRUE;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    } else {
+        p_manager->is_busy = TRUE;
+        p_manager->is_notified = TRUE;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    if (TRUE == is_active) {
+        // The profile is active, the handler is invoked before returning
+        p_manager->handler(p_manager->caller_context, OPTIGA_LIB_SUCCESS);
+    } else if (OPTIGA_UTIL_SUCCESS == return_value) {
+        return_value = optiga_util_performance_switch(p_manager, profile);
+    } else {
+        // Not running, invalid profile or busy
+    }
+
+    return (return_value);
+}
+
+optiga_lib_status_t
+optiga_util_performance_profile_get_state(optiga_util_performance_state_t *p_state) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    const optiga_util_performance_manager_t *p_manager = &g_optiga_util_performance_manager;
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_state) && (NULL != p_manager->p_util)) {
+        *p_state = p_manager->state;
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_performance_profile_get_benchmark(
+    optiga_util_performance_benchmark_t *p_benchmark,
+    uint8_t *p_count
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+    const optiga_util_performance_manager_t *p_manager = &g_optiga_util_performance_manager;
+
+    pal_os_lock_enter_critical_section();
+    if ((NULL != p_benchmark) && (NULL != p_count) && (NULL != p_manager->p_util)) {
+        *p_count = MIN(*p_count, p_manager->benchmark_count);
+        pal_os_memcpy(p_benchmark, p_manager->benchmark, (uint32_t)(*p_count) * sizeof(*p_benchmark));
+        return_value = OPTIGA_UTIL_SUCCESS;
+    }
+    pal_os_lock_exit_critical_section();
+
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
 optiga_lib_status_t optiga_util_read_data(
     optiga_util_t *me,
     uint16_t optiga_oid,
@@ -288,6 +3488,9 @@ optiga_lib_status_t optiga_util_read_data(
 ) {
     optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
     optiga_get_data_object_params_t *p_params;
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+    optiga_util_write_behind_entry_t *p_write_behind_entry;
+#endif
     OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
     do {
 #ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
@@ -302,6 +3505,44 @@ optiga_lib_status_t optiga_util_read_data(
             break;
         }
 
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+        p_write_behind_entry = optiga_util_write_behind_get_entry(me, optiga_oid);
+        if ((NULL != p_write_behind_entry)
+            && (OPTIGA_UTIL_WRITE_BEHIND_ENTRY_PENDING == p_write_behind_entry->state)) {
+            // Data is buffered, it is written before the read
+            return_value = optiga_util_write_behind_acquire(me);
+            if (OPTIGA_LIB_SUCCESS == return_value) {
+                g_optiga_util_write_behind.oid = optiga_oid;
+                g_optiga_util_write_behind.offset = offset;
+                g_optiga_util_write_behind.p_read_buffer = buffer;
+                g_optiga_util_write_behind.p_read_length = length;
+                return_value = optiga_util_write_behind_begin(
+                    me,
+                    optiga_oid,
+                    OPTIGA_UTIL_WRITE_BEHIND_THEN_READ
+                );
+            }
+            break;
+        }
+#endif
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+        if ((TRUE == optiga_util_read_cache_is_selected(me, optiga_oid, *length))
+            && (TRUE
+                == optiga_util_read_cache_lookup(
+                    me,
+                    optiga_oid,
+                    offset,
+                    buffer,
+                    length,
+                    optiga_util_read_cache_get_read_ahead_length(optiga_oid, offset, *length)
+                ))) {
+            // Read before, the handler is invoked before returning
+            me->handler(me->caller_context, OPTIGA_LIB_SUCCESS);
+            return_value = OPTIGA_LIB_SUCCESS;
+            break;
+        }
+#endif
+
         me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
         p_params = (optiga_get_data_object_params_t *)&(me->params.optiga_get_data_object_params);
         pal_os_memset(&me->params, 0x00, sizeof(optiga_util_params_t));
@@ -315,6 +3556,14 @@ optiga_lib_status_t optiga_util_read_data(
         p_params->ref_bytes_to_read = length;
         p_params->accumulated_size = 0;
         p_params->last_read_size = 0;
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+        // The data object is read into the reserved entry, the requested window is copied on completion
+        if ((NULL != me->p_read_cache_entry) && (TRUE == me->p_read_cache_entry->is_read_ahead)) {
+            p_params->buffer = me->p_read_cache_entry->data;
+            p_params->bytes_to_read = me->p_read_cache_entry->requested_length;
+            p_params->ref_bytes_to_read = &me->p_read_cache_entry->length;
+        }
+#endif
 
         OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
         OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
@@ -322,6 +3571,9 @@ optiga_lib_status_t optiga_util_read_data(
         return_value = optiga_cmd_get_data_object(me->my_cmd, p_params->data_or_metadata, p_params);
         if (OPTIGA_LIB_SUCCESS != return_value) {
             me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+            optiga_util_read_cache_complete(me, return_value);
+#endif
         }
 
     } while (FALSE);
@@ -480,6 +3732,10 @@ _STATIC_H optiga_lib_status_t optiga_util_protected_update(
             OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
             OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
         }
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+        // Fragments provided by the application terminate a suspended stream
+        p_params->p_stream = NULL;
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
 
         p_params->p_protected_update_buffer = p_buffer;
         p_params->p_protected_update_buffer_length = buffer_length;
@@ -578,6 +3834,98 @@ optiga_lib_status_t optiga_util_protected_update_final(
     return (return_value);
 }
 
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+optiga_lib_status_t optiga_util_protected_update_stream(
+    optiga_util_t *me,
+    uint8_t manifest_version,
+    const uint8_t *manifest,
+    uint16_t manifest_length,
+    const protected_update_data_stream_t *p_stream
+) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_set_object_protected_params_t *p_params;
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd) || (NULL == manifest) || (NULL == p_stream)
+            || (NULL == p_stream->reader) || (NULL == p_stream->p_buffer)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if ((0U == p_stream->length)
+            || (p_stream->buffer_length
+                < MIN(OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE, p_stream->length))) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        p_params =
+            (optiga_set_object_protected_params_t *)&(me->params.optiga_set_object_protected_params
+            );
+        pal_os_memset(&me->params, 0x00, sizeof(optiga_util_params_t));
+
+        OPTIGA_PROTECTION_ENABLE(me->my_cmd, me);
+        OPTIGA_PROTECTION_SET_VERSION(me->my_cmd, me);
+        p_params->manifest_version = manifest_version;
+        p_params->p_protected_update_buffer = manifest;
+        p_params->p_protected_update_buffer_length = manifest_length;
+        p_params->set_obj_protected_tag = OPTIGA_SET_PROTECTED_UPDATE_START;
+        p_params->p_stream = p_stream;
+
+        return_value =
+            optiga_cmd_set_object_protected(me->my_cmd, p_params->manifest_version, p_params);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    optiga_util_reset_protection_level(me);
+    return (return_value);
+}
+
+optiga_lib_status_t optiga_util_protected_update_stream_resume(optiga_util_t *me) {
+    optiga_lib_status_t return_value = OPTIGA_UTIL_ERROR;
+    optiga_set_object_protected_params_t *p_params;
+    OPTIGA_UTIL_LOG_MESSAGE(__FUNCTION__);
+
+    do {
+#ifdef OPTIGA_LIB_DEBUG_NULL_CHECK
+        if ((NULL == me) || (NULL == me->my_cmd)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+#endif
+        if (OPTIGA_LIB_INSTANCE_BUSY == me->instance_state) {
+            return_value = OPTIGA_UTIL_ERROR_INSTANCE_IN_USE;
+            break;
+        }
+        p_params =
+            (optiga_set_object_protected_params_t *)&(me->params.optiga_set_object_protected_params
+            );
+        // Other operations of the instance overwrite the parameters, the command layer rejects them as no stream
+        // is ongoing anymore
+        if ((NULL == p_params->p_stream) || (OPTIGA_LIB_SUCCESS == p_params->stream_read_status)) {
+            return_value = OPTIGA_UTIL_ERROR_INVALID_INPUT;
+            break;
+        }
+
+        me->instance_state = OPTIGA_LIB_INSTANCE_BUSY;
+        return_value =
+            optiga_cmd_set_object_protected(me->my_cmd, p_params->manifest_version, p_params);
+        if (OPTIGA_LIB_SUCCESS != return_value) {
+            me->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        }
+    } while (FALSE);
+    return (return_value);
+}
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 optiga_lib_status_t
 optiga_util_update_count(optiga_util_t *me, uint16_t optiga_counter_oid, uint8_t count) {
     const uint8_t count_value[] = {count};
@@ -0,0 +1,810 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file ifx_i2c_slave_emulator.c
+ *
+ * \brief   This file implements the emulated OPTIGA I2C slave used in the integration tests.
+ *
+ * \details
+ * The emulated slave implements the physical layer registers, the data link layer frames, the transport layer
+ * chaining and the presentation layer of the IFX I2C protocol, OpenApplication and CloseApplication. It is
+ * attached to the test platform abstraction layer, which passes every I2C transfer and GPIO level to it.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "ifx_i2c_slave_emulator.h"
+
+#include <string.h>
+
+#include "optiga_lib_common.h"
+#include "pal_crypt.h"
+#include "pal_ifx_i2c_config.h"
+#include "pal_linux.h"
+#include "pal_os_datastore.h"
+#include "pal_os_timer.h"
+
+/// @cond hidden
+#define EMULATOR_REG_DATA (0x80)
+#define EMULATOR_REG_DATA_REG_LEN (0x81)
+#define EMULATOR_REG_I2C_STATE (0x82)
+#define EMULATOR_REG_MAX_SCL_FREQU (0x84)
+#define EMULATOR_REG_SOFT_RESET (0x88)
+#define EMULATOR_REG_I2C_MODE (0x89)
+
+#define EMULATOR_I2C_STATE_RESPONSE_READY (0x40)
+#define EMULATOR_I2C_STATE_SOFT_RESET (0x08)
+#define EMULATOR_I2C_MODE_FM_PLUS (0x04)
+#define EMULATOR_SM_FM_FREQUENCY (0x0190)
+#define EMULATOR_FM_PLUS_FREQUENCY (0x03E8)
+
+#define EMULATOR_FCTR_CONTROL_FRAME (0x80)
+#define EMULATOR_FCTR_SEQCTR_MASK (0x60)
+#define EMULATOR_FCTR_SEQCTR_RESYNC (0x40)
+#define EMULATOR_FCTR_FRNR_MASK (0x0C)
+#define EMULATOR_FCTR_FRNR_OFFSET (2U)
+#define EMULATOR_FCTR_ACKNR_MASK (0x03)
+#define EMULATOR_MAX_FRAME_NUM (0x03)
+
+#define EMULATOR_CHAINING_NO (0x00)
+#define EMULATOR_CHAINING_FIRST (0x01)
+#define EMULATOR_CHAINING_INTERMEDIATE (0x02)
+#define EMULATOR_CHAINING_LAST (0x04)
+#define EMULATOR_CHAINING_MASK (0x07)
+
+#define EMULATOR_PRL_HELLO (0x00)
+#define EMULATOR_PRL_FINISHED (0x08)
+#define EMULATOR_PRL_RECORD (0x20)
+#define EMULATOR_PRL_FATAL_ALERT (0x40)
+#define EMULATOR_PRL_SAVE_CONTEXT (0x60)
+#define EMULATOR_PRL_CONTEXT_SAVED (0x64)
+#define EMULATOR_PRL_RESTORE_CONTEXT (0x68)
+#define EMULATOR_PRL_CONTEXT_RESTORED (0x6C)
+#define EMULATOR_PRL_PROTOCOL_MASK (0xE0)
+#define EMULATOR_PRL_MANAGE_CONTEXT_MASK (0xFC)
+#define EMULATOR_PRL_MASTER_PROTECTION (0x01)
+#define EMULATOR_PRL_SLAVE_PROTECTION (0x02)
+#define EMULATOR_PRL_HEADER_SIZE (0x05)
+#define EMULATOR_PRL_MAC_SIZE (0x08)
+#define EMULATOR_PRL_MASTER_KEY_OFFSET (0x00)
+#define EMULATOR_PRL_SLAVE_KEY_OFFSET (0x10)
+#define EMULATOR_PRL_MASTER_NONCE_OFFSET (0x20)
+#define EMULATOR_PRL_SLAVE_NONCE_OFFSET (0x24)
+#define EMULATOR_PRL_FINISHED_LENGTH (0x24)
+#define EMULATOR_PRL_LABEL "Platform Binding"
+
+#define EMULATOR_APDU_GET_DATA_OBJECT (0x01)
+#define EMULATOR_APDU_OPEN_APPLICATION (0x70)
+#define EMULATOR_APDU_CLOSE_APPLICATION (0x71)
+#define EMULATOR_APDU_HEADER_SIZE (0x04)
+#define EMULATOR_APDU_FAILURE (0xFF)
+#define EMULATOR_APDU_UID_LENGTH (0x10)
+#define EMULATOR_LAST_ERROR_CODE_OID (0xF1C2)
+#define EMULATOR_ERROR_INVALID_CONTEXT (0x2B)
+#define EMULATOR_ERROR_APPLICATION_CLOSED (0x07)
+/// @endcond
+
+static uint16_t ifx_i2c_slave_emulator_get_uint16(const uint8_t *p_data) {
+    uint16_t value;
+
+    optiga_common_get_uint16(p_data, &value);
+    return (value);
+}
+
+static uint16_t ifx_i2c_slave_emulator_crc(const uint8_t *p_data, uint16_t data_len) {
+    uint16_t index;
+    uint16_t crc = 0;
+    uint16_t h1;
+    uint16_t h2;
+    uint16_t h3;
+    uint16_t h4;
+
+    for (index = 0; index < data_len; index++) {
+        h1 = (crc ^ p_data[index]) & 0xFF;
+        h2 = h1 & 0x0F;
+        h3 = ((uint16_t)(h2 << 4)) ^ h1;
+        h4 = h3 >> 4;
+        crc = ((uint16_t)((((uint16_t)((((uint16_t)(h3 << 1)) ^ h4) << 4)) ^ h2) << 3)) ^ h4
+              ^ (crc >> 8);
+    }
+    return (crc);
+}
+
+static void ifx_i2c_slave_emulator_clear_frames(ifx_i2c_slave_emulator_t *p_emulator) {
+    p_emulator->frame_read_index = 0;
+    p_emulator->frame_count = 0;
+}
+
+static void ifx_i2c_slave_emulator_queue_frame(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t fctr,
+    const uint8_t *p_data,
+    uint16_t data_len
+) {
+    uint8_t index;
+    uint8_t *p_frame;
+    uint16_t crc;
+
+    if (IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES <= p_emulator->frame_count) {
+        return;
+    }
+    index = (p_emulator->frame_read_index + p_emulator->frame_count)
+            % IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES;
+    p_frame = p_emulator->frames[index];
+    p_frame[0] = fctr;
+    optiga_common_set_uint16(&p_frame[1], data_len);
+    if (0 != data_len) {
+        memcpy(&p_frame[3], p_data, data_len);
+    }
+    crc = ifx_i2c_slave_emulator_crc(p_frame, 3 + data_len);
+    optiga_common_set_uint16(&p_frame[3 + data_len], crc);
+    p_emulator->frame_length[index] = (uint16_t)(DL_HEADER_SIZE + data_len);
+    p_emulator->frame_count++;
+}
+
+static void ifx_i2c_slave_emulator_queue_ack(ifx_i2c_slave_emulator_t *p_emulator) {
+    ifx_i2c_slave_emulator_queue_frame(
+        p_emulator,
+        EMULATOR_FCTR_CONTROL_FRAME | p_emulator->rx_seq_nr,
+        NULL,
+        0
+    );
+}
+
+static void ifx_i2c_slave_emulator_queue_fragment(ifx_i2c_slave_emulator_t *p_emulator) {
+    uint8_t fragment[IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE];
+    uint16_t max_packet_length = p_emulator->data_reg_len - (DL_HEADER_SIZE + TL_HEADER_SIZE);
+    uint16_t remaining = p_emulator->response_length - p_emulator->response_offset;
+    uint16_t length = (remaining > max_packet_length) ? max_packet_length : remaining;
+    uint8_t chaining;
+
+    if (0 == remaining) {
+        return;
+    }
+    if (0 == p_emulator->response_offset) {
+        chaining = (remaining > max_packet_length) ? EMULATOR_CHAINING_FIRST : EMULATOR_CHAINING_NO;
+        chaining |= IFX_I2C_PRESENCE_BIT_CHECK;
+    } else {
+        chaining = (remaining > max_packet_length) ? EMULATOR_CHAINING_INTERMEDIATE
+                                                   : EMULATOR_CHAINING_LAST;
+    }
+    fragment[0] = chaining;
+    memcpy(&fragment[TL_HEADER_SIZE], &p_emulator->response[p_emulator->response_offset], length);
+    p_emulator->response_offset += length;
+
+    p_emulator->tx_seq_nr = (p_emulator->tx_seq_nr + 1) & EMULATOR_MAX_FRAME_NUM;
+    ifx_i2c_slave_emulator_queue_frame(
+        p_emulator,
+        (uint8_t)(p_emulator->tx_seq_nr << EMULATOR_FCTR_FRNR_OFFSET) | p_emulator->rx_seq_nr,
+        fragment,
+        TL_HEADER_SIZE + length
+    );
+}
+
+static void ifx_i2c_slave_emulator_reset(ifx_i2c_slave_emulator_t *p_emulator) {
+    p_emulator->tx_seq_nr = EMULATOR_MAX_FRAME_NUM;
+    p_emulator->rx_seq_nr = EMULATOR_MAX_FRAME_NUM;
+    p_emulator->data_reg_len = IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE;
+    p_emulator->max_scl_frequency = EMULATOR_SM_FM_FREQUENCY;
+    p_emulator->packet_length = 0;
+    p_emulator->response_length = 0;
+    p_emulator->response_offset = 0;
+    ifx_i2c_slave_emulator_clear_frames(p_emulator);
+    // The active shielded connection is lost, a hibernated application and the saved connection persist
+    p_emulator->session_established = FALSE;
+    if (IFX_I2C_SLAVE_EMULATOR_APP_OPEN == p_emulator->application_state) {
+        p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_CLOSED;
+    }
+}
+
+static void ifx_i2c_slave_emulator_log_apdu(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t cmd,
+    uint8_t param
+) {
+    if (IFX_I2C_SLAVE_EMULATOR_LOG_SIZE > p_emulator->apdu_count) {
+        p_emulator->apdu_log[p_emulator->apdu_count].cmd = cmd;
+        p_emulator->apdu_log[p_emulator->apdu_count].param = param;
+    }
+    p_emulator->apdu_count++;
+}
+
+static uint16_t ifx_i2c_slave_emulator_failure(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t error_code,
+    uint8_t *p_response
+) {
+    p_emulator->last_error_code = error_code;
+    memset(p_response, 0, EMULATOR_APDU_HEADER_SIZE);
+    p_response[0] = EMULATOR_APDU_FAILURE;
+    return (EMULATOR_APDU_HEADER_SIZE);
+}
+
+static uint16_t ifx_i2c_slave_emulator_process_apdu(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response
+) {
+    uint8_t cmd = p_apdu[0] & 0x7F;
+    uint8_t param = p_apdu[1];
+    uint16_t response_length = EMULATOR_APDU_HEADER_SIZE;
+    uint16_t index;
+
+    ifx_i2c_slave_emulator_log_apdu(p_emulator, cmd, param);
+    memset(p_response, 0, EMULATOR_APDU_HEADER_SIZE);
+
+    if (EMULATOR_APDU_OPEN_APPLICATION == cmd) {
+        if ((0 != param)
+            && ((IFX_I2C_SLAVE_EMULATOR_APP_HIBERNATED != p_emulator->application_state)
+                || (apdu_length
+                    != (EMULATOR_APDU_HEADER_SIZE + EMULATOR_APDU_UID_LENGTH
+                        + sizeof(p_emulator->context_handle)))
+                || (0
+                    != memcmp(
+                        &p_apdu[EMULATOR_APDU_HEADER_SIZE + EMULATOR_APDU_UID_LENGTH],
+                        p_emulator->context_handle,
+                        sizeof(p_emulator->context_handle)
+                    )))) {
+            p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_CLOSED;
+            return (ifx_i2c_slave_emulator_failure(
+                p_emulator,
+                EMULATOR_ERROR_INVALID_CONTEXT,
+                p_response
+            ));
+        }
+        p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_OPEN;
+    } else if ((EMULATOR_APDU_GET_DATA_OBJECT == cmd) && (apdu_length >= 6)
+               && (EMULATOR_LAST_ERROR_CODE_OID == ifx_i2c_slave_emulator_get_uint16(&p_apdu[4]))) {
+        p_response[3] = 1;
+        p_response[4] = p_emulator->last_error_code;
+        p_emulator->last_error_code = 0;
+        response_length++;
+    } else if (IFX_I2C_SLAVE_EMULATOR_APP_OPEN != p_emulator->application_state) {
+        response_length = ifx_i2c_slave_emulator_failure(
+            p_emulator,
+            EMULATOR_ERROR_APPLICATION_CLOSED,
+            p_response
+        );
+    } else if (EMULATOR_APDU_CLOSE_APPLICATION == cmd) {
+        p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_CLOSED;
+        if (0 != param) {
+            // New context handle for every hibernation
+            for (index = 0; index < sizeof(p_emulator->context_handle); index++) {
+                p_emulator->context_handle[index] =
+                    (uint8_t)(p_emulator->apdu_count + (index * 0x11));
+            }
+            optiga_common_set_uint16(&p_response[2], sizeof(p_emulator->context_handle));
+            memcpy(
+                &p_response[EMULATOR_APDU_HEADER_SIZE],
+                p_emulator->context_handle,
+                sizeof(p_emulator->context_handle)
+            );
+            response_length += sizeof(p_emulator->context_handle);
+            p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_HIBERNATED;
+        }
+    } else if (NULL != p_emulator->apdu_handler) {
+        p_emulator->apdu_handler(
+            p_emulator->p_apdu_handler_ctx,
+            p_apdu,
+            apdu_length,
+            p_response,
+            &response_length
+        );
+    } else {
+        // Command processed successfully without response data
+    }
+    return (response_length);
+}
+
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+static void ifx_i2c_slave_emulator_form_associated_data(
+    uint8_t *p_associated_data,
+    uint8_t sctr,
+    uint32_t sequence_number,
+    uint16_t data_len
+) {
+    p_associated_data[0] = sctr;
+    optiga_common_set_uint32(&p_associated_data[1], sequence_number);
+    p_associated_data[5] = PROTOCOL_VERSION_PRE_SHARED_SECRET;
+    optiga_common_set_uint16(&p_associated_data[6], data_len);
+}
+
+static pal_status_t ifx_i2c_slave_emulator_encrypt(
+    const ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t sctr,
+    uint32_t sequence_number,
+    uint8_t *p_data,
+    uint16_t data_len
+) {
+    uint8_t associated_data[8];
+    uint8_t nonce[8];
+
+    ifx_i2c_slave_emulator_form_associated_data(associated_data, sctr, sequence_number, data_len);
+    memcpy(nonce, &p_emulator->session_key[EMULATOR_PRL_SLAVE_NONCE_OFFSET], 4);
+    optiga_common_set_uint32(&nonce[4], sequence_number);
+    return (pal_crypt_encrypt_aes128_ccm(
+        NULL,
+        p_data,
+        data_len,
+        &p_emulator->session_key[EMULATOR_PRL_SLAVE_KEY_OFFSET],
+        nonce,
+        sizeof(nonce),
+        associated_data,
+        sizeof(associated_data),
+        EMULATOR_PRL_MAC_SIZE,
+        p_data
+    ));
+}
+
+static pal_status_t ifx_i2c_slave_emulator_decrypt(
+    const ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t sctr,
+    uint32_t sequence_number,
+    uint8_t *p_data,
+    uint16_t data_len
+) {
+    uint8_t associated_data[8];
+    uint8_t nonce[8];
+
+    ifx_i2c_slave_emulator_form_associated_data(associated_data, sctr, sequence_number, data_len);
+    memcpy(nonce, &p_emulator->session_key[EMULATOR_PRL_MASTER_NONCE_OFFSET], 4);
+    optiga_common_set_uint32(&nonce[4], sequence_number);
+    return (pal_crypt_decrypt_aes128_ccm(
+        NULL,
+        p_data,
+        data_len + EMULATOR_PRL_MAC_SIZE,
+        &p_emulator->session_key[EMULATOR_PRL_MASTER_KEY_OFFSET],
+        nonce,
+        sizeof(nonce),
+        associated_data,
+        sizeof(associated_data),
+        EMULATOR_PRL_MAC_SIZE,
+        p_data
+    ));
+}
+
+static uint16_t ifx_i2c_slave_emulator_hello(ifx_i2c_slave_emulator_t *p_emulator) {
+    uint8_t label[] = EMULATOR_PRL_LABEL;
+    uint8_t secret[OPTIGA_SHARED_SECRET_MAX_LENGTH];
+    uint16_t secret_length = sizeof(secret);
+    uint8_t index;
+
+    p_emulator->session_established = FALSE;
+    for (index = 0; index < sizeof(p_emulator->random); index++) {
+        p_emulator->random[index] = (uint8_t)((p_emulator->handshake_count * 0x1F) + index);
+    }
+    p_emulator->slave_sequence_number = 0x100 * (p_emulator->handshake_count + 1);
+    if ((PAL_STATUS_SUCCESS
+         != pal_os_datastore_read(OPTIGA_PLATFORM_BINDING_SHARED_SECRET_ID, secret, &secret_length))
+        || (PAL_STATUS_SUCCESS
+            != pal_crypt_tls_prf_sha256(
+                NULL,
+                secret,
+                secret_length,
+                label,
+                sizeof(label) - 1,
+                p_emulator->random,
+                sizeof(p_emulator->random),
+                p_emulator->session_key,
+                sizeof(p_emulator->session_key)
+            ))) {
+        p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+        return (1);
+    }
+    p_emulator->response[0] = EMULATOR_PRL_HELLO;
+    p_emulator->response[1] = PROTOCOL_VERSION_PRE_SHARED_SECRET;
+    memcpy(&p_emulator->response[2], p_emulator->random, sizeof(p_emulator->random));
+    optiga_common_set_uint32(
+        &p_emulator->response[2 + sizeof(p_emulator->random)],
+        p_emulator->slave_sequence_number
+    );
+    return (2 + sizeof(p_emulator->random) + 4);
+}
+
+static uint16_t ifx_i2c_slave_emulator_finished(ifx_i2c_slave_emulator_t *p_emulator) {
+    uint8_t *p_payload = &p_emulator->packet[EMULATOR_PRL_HEADER_SIZE];
+    uint8_t *p_response = &p_emulator->response[EMULATOR_PRL_HEADER_SIZE];
+
+    if ((EMULATOR_PRL_HEADER_SIZE + EMULATOR_PRL_FINISHED_LENGTH + EMULATOR_PRL_MAC_SIZE
+         != p_emulator->packet_length)
+        || (p_emulator->slave_sequence_number != optiga_common_get_uint32(&p_emulator->packet[1]))
+        || (PAL_STATUS_SUCCESS
+            != ifx_i2c_slave_emulator_decrypt(
+                p_emulator,
+                EMULATOR_PRL_FINISHED,
+                p_emulator->slave_sequence_number,
+                p_payload,
+                EMULATOR_PRL_FINISHED_LENGTH
+            ))
+        || (0 != memcmp(p_payload, p_emulator->random, sizeof(p_emulator->random)))) {
+        p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+        return (1);
+    }
+    p_emulator->master_sequence_number = 0x200 * (p_emulator->handshake_count + 1);
+    memcpy(p_response, p_emulator->random, sizeof(p_emulator->random));
+    optiga_common_set_uint32(
+        &p_response[sizeof(p_emulator->random)],
+        p_emulator->master_sequence_number
+    );
+    // The slave finished message is encrypted with the keys of the slave
+    (void)ifx_i2c_slave_emulator_encrypt(
+        p_emulator,
+        EMULATOR_PRL_FINISHED,
+        p_emulator->master_sequence_number,
+        p_response,
+        EMULATOR_PRL_FINISHED_LENGTH
+    );
+    p_emulator->response[0] = EMULATOR_PRL_FINISHED;
+    optiga_common_set_uint32(&p_emulator->response[1], p_emulator->master_sequence_number);
+    p_emulator->session_established = TRUE;
+    p_emulator->handshake_count++;
+    return (EMULATOR_PRL_HEADER_SIZE + EMULATOR_PRL_FINISHED_LENGTH + EMULATOR_PRL_MAC_SIZE);
+}
+
+static uint16_t ifx_i2c_slave_emulator_manage_context(ifx_i2c_slave_emulator_t *p_emulator) {
+    uint8_t sctr = p_emulator->packet[0] & EMULATOR_PRL_MANAGE_CONTEXT_MASK;
+    uint16_t response_length = 1;
+
+    p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+    if ((EMULATOR_PRL_SAVE_CONTEXT == sctr) && (TRUE == p_emulator->session_established)) {
+        memcpy(
+            p_emulator->saved_session_key,
+            p_emulator->session_key,
+            sizeof(p_emulator->session_key)
+        );
+        p_emulator->saved_master_sequence_number = p_emulator->master_sequence_number;
+        p_emulator->saved_slave_sequence_number = p_emulator->slave_sequence_number;
+        p_emulator->session_saved = TRUE;
+        p_emulator->session_established = FALSE;
+        p_emulator->response[0] = EMULATOR_PRL_CONTEXT_SAVED;
+    } else if ((EMULATOR_PRL_RESTORE_CONTEXT == sctr) && (5 == p_emulator->packet_length)
+               && (TRUE == p_emulator->session_saved)
+               && (p_emulator->saved_slave_sequence_number
+                   == optiga_common_get_uint32(&p_emulator->packet[1]))) {
+        memcpy(
+            p_emulator->session_key,
+            p_emulator->saved_session_key,
+            sizeof(p_emulator->session_key)
+        );
+        p_emulator->master_sequence_number = p_emulator->saved_master_sequence_number;
+        p_emulator->slave_sequence_number = p_emulator->saved_slave_sequence_number;
+        p_emulator->session_saved = FALSE;
+        p_emulator->session_established = TRUE;
+        p_emulator->response[0] = EMULATOR_PRL_CONTEXT_RESTORED;
+        optiga_common_set_uint32(&p_emulator->response[1], p_emulator->slave_sequence_number);
+        response_length = 5;
+    } else {
+        // Invalid request or no saved connection
+    }
+    return (response_length);
+}
+
+static uint16_t ifx_i2c_slave_emulator_record(ifx_i2c_slave_emulator_t *p_emulator) {
+    uint8_t sctr = p_emulator->packet[0];
+    uint8_t apdu[IFX_I2C_SLAVE_EMULATOR_MAX_PACKET_SIZE];
+    uint8_t *p_apdu = &p_emulator->packet[1];
+    uint16_t apdu_length = p_emulator->packet_length - 1;
+    uint16_t response_length;
+    uint32_t sequence_number;
+
+    if (0 != (sctr & (EMULATOR_PRL_MASTER_PROTECTION | EMULATOR_PRL_SLAVE_PROTECTION))) {
+        if (FALSE == p_emulator->session_established) {
+            p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+            return (1);
+        }
+    }
+    if (0 != (sctr & EMULATOR_PRL_MASTER_PROTECTION)) {
+        sequence_number = optiga_common_get_uint32(&p_emulator->packet[1]);
+        p_apdu = &p_emulator->packet[EMULATOR_PRL_HEADER_SIZE];
+        apdu_length =
+            p_emulator->packet_length - (EMULATOR_PRL_HEADER_SIZE + EMULATOR_PRL_MAC_SIZE);
+        if ((sequence_number <= p_emulator->master_sequence_number)
+            || (PAL_STATUS_SUCCESS
+                != ifx_i2c_slave_emulator_decrypt(
+                    p_emulator,
+                    sctr,
+                    sequence_number,
+                    p_apdu,
+                    apdu_length
+                ))) {
+            p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+            return (1);
+        }
+        p_emulator->master_sequence_number = sequence_number;
+    }
+
+    response_length = ifx_i2c_slave_emulator_process_apdu(p_emulator, p_apdu, apdu_length, apdu);
+    p_emulator->response[0] = sctr;
+    if (0 != (sctr & EMULATOR_PRL_SLAVE_PROTECTION)) {
+        p_emulator->slave_sequence_number++;
+        optiga_common_set_uint32(&p_emulator->response[1], p_emulator->slave_sequence_number);
+        memcpy(&p_emulator->response[EMULATOR_PRL_HEADER_SIZE], apdu, response_length);
+        (void)ifx_i2c_slave_emulator_encrypt(
+            p_emulator,
+            sctr,
+            p_emulator->slave_sequence_number,
+            &p_emulator->response[EMULATOR_PRL_HEADER_SIZE],
+            response_length
+        );
+        return (EMULATOR_PRL_HEADER_SIZE + response_length + EMULATOR_PRL_MAC_SIZE);
+    }
+    memcpy(&p_emulator->response[1], apdu, response_length);
+    return (1 + response_length);
+}
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+
+static void ifx_i2c_slave_emulator_process_packet(ifx_i2c_slave_emulator_t *p_emulator) {
+#ifdef OPTIGA_COMMS_SHIELDED_CONNECTION
+    uint8_t sctr = p_emulator->packet[0];
+
+    if (EMULATOR_PRL_HELLO == sctr) {
+        p_emulator->response_length = ifx_i2c_slave_emulator_hello(p_emulator);
+    } else if (EMULATOR_PRL_FINISHED == sctr) {
+        p_emulator->response_length = ifx_i2c_slave_emulator_finished(p_emulator);
+    } else if (EMULATOR_PRL_RECORD == (sctr & EMULATOR_PRL_PROTOCOL_MASK)) {
+        p_emulator->response_length = ifx_i2c_slave_emulator_record(p_emulator);
+    } else if (EMULATOR_PRL_SAVE_CONTEXT == (sctr & EMULATOR_PRL_PROTOCOL_MASK)) {
+        p_emulator->response_length = ifx_i2c_slave_emulator_manage_context(p_emulator);
+    } else {
+        p_emulator->response[0] = EMULATOR_PRL_FATAL_ALERT;
+        p_emulator->response_length = 1;
+    }
+#else
+    p_emulator->response_length = ifx_i2c_slave_emulator_process_apdu(
+        p_emulator,
+        p_emulator->packet,
+        p_emulator->packet_length,
+        p_emulator->response
+    );
+#endif  // OPTIGA_COMMS_SHIELDED_CONNECTION
+    p_emulator->packet_length = 0;
+    p_emulator->response_offset = 0;
+    ifx_i2c_slave_emulator_queue_fragment(p_emulator);
+}
+
+static void ifx_i2c_slave_emulator_receive_frame(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    const uint8_t *p_frame,
+    uint16_t frame_len
+) {
+    uint8_t fctr = p_frame[0];
+    uint8_t frame_nr = (fctr & EMULATOR_FCTR_FRNR_MASK) >> EMULATOR_FCTR_FRNR_OFFSET;
+    uint16_t data_len;
+    uint8_t chaining;
+
+    if ((DL_HEADER_SIZE > frame_len)
+        || (ifx_i2c_slave_emulator_get_uint16(&p_frame[frame_len - 2])
+            != ifx_i2c_slave_emulator_crc(p_frame, frame_len - 2))) {
+        return;
+    }
+    data_len = ifx_i2c_slave_emulator_get_uint16(&p_frame[1]);
+
+    if (0 != (fctr & EMULATOR_FCTR_CONTROL_FRAME)) {
+        if (EMULATOR_FCTR_SEQCTR_RESYNC == (fctr & EMULATOR_FCTR_SEQCTR_MASK)) {
+            p_emulator->tx_seq_nr = EMULATOR_MAX_FRAME_NUM;
+            p_emulator->rx_seq_nr = EMULATOR_MAX_FRAME_NUM;
+            p_emulator->packet_length = 0;
+            p_emulator->response_length = 0;
+            p_emulator->response_offset = 0;
+            ifx_i2c_slave_emulator_clear_frames(p_emulator);
+        } else if ((0 == (fctr & EMULATOR_FCTR_SEQCTR_MASK))
+                   && ((fctr & EMULATOR_FCTR_ACKNR_MASK) == p_emulator->tx_seq_nr)) {
+            // Fragment acknowledged, send the next one
+            ifx_i2c_slave_emulator_queue_fragment(p_emulator);
+        } else {
+            // Negative acknowledge is not expected by the tests
+        }
+        return;
+    }
+
+    if ((0 == data_len) || (frame_len != (DL_HEADER_SIZE + data_len))) {
+        return;
+    }
+    if (frame_nr == p_emulator->rx_seq_nr) {
+        // Repeated frame, acknowledge again
+        ifx_i2c_slave_emulator_queue_ack(p_emulator);
+        return;
+    }
+    p_emulator->rx_seq_nr = frame_nr;
+    ifx_i2c_slave_emulator_queue_ack(p_emulator);
+
+    chaining = p_frame[3] & EMULATOR_CHAINING_MASK;
+    if ((EMULATOR_CHAINING_NO == chaining) || (EMULATOR_CHAINING_FIRST == chaining)) {
+        p_emulator->packet_length = 0;
+    }
+    if ((p_emulator->packet_length + data_len - TL_HEADER_SIZE) > sizeof(p_emulator->packet)) {
+        p_emulator->packet_length = 0;
+        return;
+    }
+    memcpy(
+        &p_emulator->packet[p_emulator->packet_length],
+        &p_frame[3 + TL_HEADER_SIZE],
+        data_len - TL_HEADER_SIZE
+    );
+    p_emulator->packet_length += (data_len - TL_HEADER_SIZE);
+    if ((EMULATOR_CHAINING_NO == chaining) || (EMULATOR_CHAINING_LAST == chaining)) {
+        ifx_i2c_slave_emulator_process_packet(p_emulator);
+    }
+}
+
+static pal_status_t ifx_i2c_slave_emulator_acknowledge(ifx_i2c_slave_emulator_t *p_emulator) {
+    if (TRUE == p_emulator->unresponsive) {
+        return (PAL_STATUS_FAILURE);
+    }
+    if (0 != p_emulator->nack_count) {
+        p_emulator->nack_count--;
+        return (PAL_STATUS_FAILURE);
+    }
+    return (PAL_STATUS_SUCCESS);
+}
+
+static pal_status_t
+ifx_i2c_slave_emulator_write(void *p_ctx, const uint8_t *p_data, uint16_t length) {
+    ifx_i2c_slave_emulator_t *p_emulator = (ifx_i2c_slave_emulator_t *)p_ctx;
+
+    if ((PAL_STATUS_SUCCESS != ifx_i2c_slave_emulator_acknowledge(p_emulator)) || (0 == length)) {
+        return (PAL_STATUS_FAILURE);
+    }
+    p_emulator->register_address = p_data[0];
+    if (1 == length) {
+        // Register selected for the following read
+        return (PAL_STATUS_SUCCESS);
+    }
+    switch (p_data[0]) {
+        case EMULATOR_REG_DATA: {
+            ifx_i2c_slave_emulator_receive_frame(p_emulator, &p_data[1], length - 1);
+        } break;
+        case EMULATOR_REG_DATA_REG_LEN: {
+            if (3 == length) {
+                p_emulator->data_reg_len = ifx_i2c_slave_emulator_get_uint16(&p_data[1]);
+                if (IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE < p_emulator->data_reg_len) {
+                    p_emulator->data_reg_len = IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE;
+                }
+            }
+        } break;
+        case EMULATOR_REG_SOFT_RESET: {
+            p_emulator->soft_reset_count++;
+            ifx_i2c_slave_emulator_reset(p_emulator);
+        } break;
+        case EMULATOR_REG_I2C_MODE: {
+            p_emulator->max_scl_frequency =
+                ((3 == length) && (EMULATOR_I2C_MODE_FM_PLUS == p_data[2]))
+                    ? EMULATOR_FM_PLUS_FREQUENCY
+                    : EMULATOR_SM_FM_FREQUENCY;
+        } break;
+        default:
+            break;
+    }
+    return (PAL_STATUS_SUCCESS);
+}
+
+static pal_status_t ifx_i2c_slave_emulator_read(void *p_ctx, uint8_t *p_data, uint16_t length) {
+    ifx_i2c_slave_emulator_t *p_emulator = (ifx_i2c_slave_emulator_t *)p_ctx;
+    uint8_t register_value[4] = {0};
+    uint16_t frame_length;
+
+    if (PAL_STATUS_SUCCESS != ifx_i2c_slave_emulator_acknowledge(p_emulator)) {
+        return (PAL_STATUS_FAILURE);
+    }
+    switch (p_emulator->register_address) {
+        case EMULATOR_REG_DATA: {
+            if (0 == p_emulator->frame_count) {
+                return (PAL_STATUS_FAILURE);
+            }
+            frame_length = p_emulator->frame_length[p_emulator->frame_read_index];
+            memcpy(
+                p_data,
+                p_emulator->frames[p_emulator->frame_read_index],
+                (length < frame_length) ? length : frame_length
+            );
+            p_emulator->frame_read_index =
+                (p_emulator->frame_read_index + 1) % IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES;
+            p_emulator->frame_count--;
+            return (PAL_STATUS_SUCCESS);
+        }
+        case EMULATOR_REG_DATA_REG_LEN: {
+            optiga_common_set_uint16(register_value, p_emulator->data_reg_len);
+        } break;
+        case EMULATOR_REG_I2C_STATE: {
+            register_value[0] = EMULATOR_I2C_STATE_SOFT_RESET;
+            if (0 != p_emulator->frame_count) {
+                register_value[0] |= EMULATOR_I2C_STATE_RESPONSE_READY;
+                optiga_common_set_uint16(
+                    &register_value[2],
+                    p_emulator->frame_length[p_emulator->frame_read_index]
+                );
+            }
+        } break;
+        case EMULATOR_REG_MAX_SCL_FREQU: {
+            optiga_common_set_uint16(&register_value[2], p_emulator->max_scl_frequency);
+        } break;
+        default:
+            break;
+    }
+    memcpy(
+        p_data,
+        register_value,
+        (length < sizeof(register_value)) ? length : sizeof(register_value)
+    );
+    return (PAL_STATUS_SUCCESS);
+}
+
+static void
+ifx_i2c_slave_emulator_gpio(void *p_ctx, const pal_gpio_t *p_gpio_context, uint8_t level) {
+    ifx_i2c_slave_emulator_t *p_emulator = (ifx_i2c_slave_emulator_t *)p_ctx;
+
+    if ((&optiga_reset_0 != p_gpio_context) && (&optiga_vdd_0 != p_gpio_context)) {
+        // Other pins are not connected
+        return;
+    }
+    if (LOW != level) {
+        p_emulator->reset_low_time_us =
+            pal_os_timer_get_time_in_microseconds() - p_emulator->reset_low_timestamp_us;
+        return;
+    }
+    p_emulator->reset_low_timestamp_us = pal_os_timer_get_time_in_microseconds();
+    if (&optiga_reset_0 == p_gpio_context) {
+        p_emulator->warm_reset_count++;
+    } else {
+        p_emulator->cold_reset_count++;
+    }
+    ifx_i2c_slave_emulator_reset(p_emulator);
+}
+
+static pal_status_t ifx_i2c_slave_emulator_is_ready(void *p_ctx) {
+    ifx_i2c_slave_emulator_t *p_emulator = (ifx_i2c_slave_emulator_t *)p_ctx;
+
+    p_emulator->ready_check_count++;
+    return ((TRUE == p_emulator->ready_line_stuck) ? PAL_STATUS_FAILURE : PAL_STATUS_SUCCESS);
+}
+
+void ifx_i2c_slave_emulator_attach(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    ifx_i2c_slave_emulator_apdu_handler_t apdu_handler,
+    void *p_ctx
+) {
+    memset(p_emulator, 0, sizeof(*p_emulator));
+    p_emulator->slave.write = ifx_i2c_slave_emulator_write;
+    p_emulator->slave.read = ifx_i2c_slave_emulator_read;
+    p_emulator->slave.gpio = ifx_i2c_slave_emulator_gpio;
+    p_emulator->slave.is_ready = ifx_i2c_slave_emulator_is_ready;
+    p_emulator->slave.p_ctx = p_emulator;
+    p_emulator->apdu_handler = apdu_handler;
+    p_emulator->p_apdu_handler_ctx = p_ctx;
+    p_emulator->application_state = IFX_I2C_SLAVE_EMULATOR_APP_CLOSED;
+    ifx_i2c_slave_emulator_reset(p_emulator);
+
+    pal_i2c_test_attach_slave(&p_emulator->slave);
+}
+
+void ifx_i2c_slave_emulator_detach(void) {
+    pal_i2c_test_attach_slave(NULL);
+}
+
+uint32_t ifx_i2c_slave_emulator_count_apdu(
+    const ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t cmd,
+    uint8_t param
+) {
+    uint32_t count = 0;
+    uint32_t index;
+
+    for (index = 0; (index < p_emulator->apdu_count) && (index < IFX_I2C_SLAVE_EMULATOR_LOG_SIZE);
+         index++) {
+        if ((cmd == p_emulator->apdu_log[index].cmd)
+            && (param == p_emulator->apdu_log[index].param)) {
+            count++;
+        }
+    }
+    return (count);
+}
+
+/**
+ * @}
+ */
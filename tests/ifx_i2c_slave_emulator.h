@@ -0,0 +1,194 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file ifx_i2c_slave_emulator.h
+ *
+ * \brief   This file defines APIs, types and data structures of the emulated OPTIGA I2C slave used in the integration
+ *          tests
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#ifndef IFX_I2C_SLAVE_EMULATOR
+#define IFX_I2C_SLAVE_EMULATOR
+
+#include <stdint.h>
+
+#include "ifx_i2c_config.h"
+#include "pal_i2c_test.h"
+
+/// Maximum frame size supported by the emulated slave
+#define IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE (IFX_I2C_FRAME_SIZE)
+/// Number of frames the emulated slave can queue for the master
+#define IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES (4U)
+/// Maximum length of a transport layer packet
+#define IFX_I2C_SLAVE_EMULATOR_MAX_PACKET_SIZE (0x700U)
+/// Number of APDUs logged by the emulated slave
+#define IFX_I2C_SLAVE_EMULATOR_LOG_SIZE (32U)
+
+/// Application on the emulated slave is closed
+#define IFX_I2C_SLAVE_EMULATOR_APP_CLOSED (0x00)
+/// Application on the emulated slave is open
+#define IFX_I2C_SLAVE_EMULATOR_APP_OPEN (0x01)
+/// Application on the emulated slave is hibernated
+#define IFX_I2C_SLAVE_EMULATOR_APP_HIBERNATED (0x02)
+
+/**
+ * \brief Handler for the APDUs which are not processed by the emulated slave itself.
+ *
+ * \details
+ * OpenApplication, CloseApplication and reading the last error code are processed by the emulated slave.
+ * The handler prepares the response APDU, including the 4 byte response header.
+ */
+typedef void (*ifx_i2c_slave_emulator_apdu_handler_t)(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+);
+
+/** \brief Logged APDU of the emulated slave */
+typedef struct ifx_i2c_slave_emulator_apdu_log {
+    /// Command code without the clear last error bit
+    uint8_t cmd;
+    /// Command parameter
+    uint8_t param;
+} ifx_i2c_slave_emulator_apdu_log_t;
+
+/** \brief Emulated OPTIGA I2C slave */
+typedef struct ifx_i2c_slave_emulator {
+    /// Slave attached to the test platform abstraction layer
+    pal_i2c_test_slave_t slave;
+
+    /// Register selected for the next read
+    uint8_t register_address;
+    /// Negotiated frame size
+    uint16_t data_reg_len;
+    /// Maximum SCL frequency in KHz
+    uint16_t max_scl_frequency;
+
+    /// Sequence number of the last transmitted data frame
+    uint8_t tx_seq_nr;
+    /// Sequence number of the last received data frame
+    uint8_t rx_seq_nr;
+    /// Frames queued for the master
+    uint8_t frames[IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES][IFX_I2C_SLAVE_EMULATOR_FRAME_SIZE];
+    /// Length of the queued frames
+    uint16_t frame_length[IFX_I2C_SLAVE_EMULATOR_MAX_FRAMES];
+    /// Index of the next frame read by the master
+    uint8_t frame_read_index;
+    /// Number of queued frames
+    uint8_t frame_count;
+
+    /// Packet received from the master
+    uint8_t packet[IFX_I2C_SLAVE_EMULATOR_MAX_PACKET_SIZE];
+    /// Length of the packet received from the master
+    uint16_t packet_length;
+    /// Packet to be sent to the master
+    uint8_t response[IFX_I2C_SLAVE_EMULATOR_MAX_PACKET_SIZE];
+    /// Length of the packet to be sent to the master
+    uint16_t response_length;
+    /// Length of the packet already sent to the master
+    uint16_t response_offset;
+
+    /// Session keys of the shielded connection
+    uint8_t session_key[IFX_I2C_SESSION_KEY_BUFFER_SIZE];
+    /// Random of the handshake
+    uint8_t random[0x20];
+    /// Last sequence number received from the master
+    uint32_t master_sequence_number;
+    /// Last sequence number sent to the master
+    uint32_t slave_sequence_number;
+    /// Shielded connection is established
+    uint8_t session_established;
+    /// Saved session keys of the shielded connection
+    uint8_t saved_session_key[IFX_I2C_SESSION_KEY_BUFFER_SIZE];
+    /// Saved sequence number received from the master
+    uint32_t saved_master_sequence_number;
+    /// Saved sequence number sent to the master
+    uint32_t saved_slave_sequence_number;
+    /// Shielded connection is saved
+    uint8_t session_saved;
+
+    /// State of the application
+    uint8_t application_state;
+    /// Context handle of the hibernated application
+    uint8_t context_handle[8];
+    /// Last error code
+    uint8_t last_error_code;
+    /// Handler for other APDUs, NULL responds with success and no data
+    ifx_i2c_slave_emulator_apdu_handler_t apdu_handler;
+    /// Context passed to the APDU handler
+    void *p_apdu_handler_ctx;
+
+    /// Number of the next transfers which are not acknowledged
+    uint32_t nack_count;
+    /// No transfer is acknowledged, while set
+    uint8_t unresponsive;
+
+    /// Number of soft resets
+    uint32_t soft_reset_count;
+    /// Number of resets via the reset pin
+    uint32_t warm_reset_count;
+    /// Number of power cycles via the VDD pin
+    uint32_t cold_reset_count;
+    /// Low time of the last reset pulse or power cycle in microseconds
+    uint32_t reset_low_time_us;
+    /// Time of the last transition to low of the reset or VDD pin in microseconds
+    uint32_t reset_low_timestamp_us;
+    /// Number of checks of the ready line
+    uint32_t ready_check_count;
+    /// Ready line is not signalled, while set
+    uint8_t ready_line_stuck;
+    /// Number of completed handshakes of the shielded connection
+    uint32_t handshake_count;
+    /// Number of processed APDUs
+    uint32_t apdu_count;
+    /// First APDUs processed
+    ifx_i2c_slave_emulator_apdu_log_t apdu_log[IFX_I2C_SLAVE_EMULATOR_LOG_SIZE];
+} ifx_i2c_slave_emulator_t;
+
+/**
+ * \brief Initializes the emulated slave and attaches it to the test platform abstraction layer.
+ *
+ * \param[in] p_emulator          Emulated slave
+ * \param[in] apdu_handler        Handler for other APDUs, NULL responds with success and no data
+ * \param[in] p_ctx               Context passed to the APDU handler
+ */
+void ifx_i2c_slave_emulator_attach(
+    ifx_i2c_slave_emulator_t *p_emulator,
+    ifx_i2c_slave_emulator_apdu_handler_t apdu_handler,
+    void *p_ctx
+);
+
+/**
+ * \brief Detaches the emulated slave from the test platform abstraction layer.
+ */
+void ifx_i2c_slave_emulator_detach(void);
+
+/**
+ * \brief Provides the number of logged APDUs with the given command code.
+ *
+ * \param[in] p_emulator          Emulated slave
+ * \param[in] cmd                 Command code without the clear last error bit
+ * \param[in] param               Command parameter
+ *
+ * \retval    Number of logged APDUs
+ */
+uint32_t ifx_i2c_slave_emulator_count_apdu(
+    const ifx_i2c_slave_emulator_t *p_emulator,
+    uint8_t cmd,
+    uint8_t param
+);
+
+#endif  // IFX_I2C_SLAVE_EMULATOR
+
+/**
+ * @}
+ */
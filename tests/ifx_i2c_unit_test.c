@@ -44,6 +44,9 @@ int main(int argc, char **argv) {
     uint8_t ut_send_frames[I2C_SEND_FRAMES] = {1, 2, 3, 4, 5};
     uint8_t ut_recv_frames[I2C_RECV_FRAMES];
     uint16_t ut_recv_length = 0;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    ifx_i2c_recovery_stats_t ut_recovery_stats;
+#endif
 
     /* ifx_i2c_context needs to be initialized */
     ifx_i2c_context_t *ut_ifx_i2c_ctx = malloc(sizeof(ifx_i2c_context_t));
@@ -106,6 +109,16 @@ int main(int argc, char **argv) {
     ut_lib_status = ifx_i2c_reset(ut_ifx_i2c_ctx, IFX_I2C_WARM_RESET);
     assert(ut_lib_status == IFX_I2C_STACK_SUCCESS);
 
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /* ifx_i2c_get_recovery_stats unit test */
+    memset(&ut_ifx_i2c_ctx->recovery, 0, sizeof(ut_ifx_i2c_ctx->recovery));
+    ut_lib_status = ifx_i2c_get_recovery_stats(ut_ifx_i2c_ctx, &ut_recovery_stats);
+    assert(ut_lib_status == IFX_I2C_STACK_SUCCESS);
+    assert(ut_recovery_stats.recovery_count == 0);
+    ut_lib_status = ifx_i2c_get_recovery_stats(ut_ifx_i2c_ctx, NULL);
+    assert(ut_lib_status == IFX_I2C_STACK_ERROR);
+#endif
+
     /* ifx_i2c_close unit test */
     ut_ifx_i2c_ctx->status = IFX_I2C_STATE_IDLE;
     ut_ifx_i2c_ctx->prl.state = PRL_STATE_IDLE;
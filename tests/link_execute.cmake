@@ -8,6 +8,14 @@ add_executable(optiga_lib_logger_unit_test optiga_lib_logger_unit_test.c)
 add_executable(optiga_cmd_unit_test optiga_cmd_unit_test.c)
 add_executable(optiga_util_integration_test optiga_util_integration_test.c)
 add_executable(optiga_crypt_integration_test optiga_crypt_integration_test.c)
+add_executable(pal_os_memory_pool_unit_test pal_os_memory_pool_unit_test.c)
+add_executable(pal_os_executor_unit_test pal_os_executor_unit_test.c)
+add_executable(optiga_util_power_manager_integration_test optiga_util_power_manager_integration_test.c ifx_i2c_slave_emulator.c)
+add_executable(optiga_comms_fast_recovery_integration_test optiga_comms_fast_recovery_integration_test.c ifx_i2c_slave_emulator.c)
+add_executable(optiga_comms_gpiod_reset_integration_test optiga_comms_gpiod_reset_integration_test.c ifx_i2c_slave_emulator.c)
+add_executable(optiga_crypt_random_pool_integration_test optiga_crypt_random_pool_integration_test.c ifx_i2c_slave_emulator.c)
+add_executable(optiga_crypt_ecdhe_pool_integration_test optiga_crypt_ecdhe_pool_integration_test.c ifx_i2c_slave_emulator.c)
+add_executable(optiga_util_read_cache_integration_test optiga_util_read_cache_integration_test.c ifx_i2c_slave_emulator.c)
 
 # Add target link libraries
 if(BUILD_LIBUSB)
@@ -16,12 +24,28 @@ target_link_libraries(optiga_lib_logger_unit_test optiga_trust_M_lib -lrt -lusb-
 target_link_libraries(optiga_cmd_unit_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
 target_link_libraries(optiga_util_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
 target_link_libraries(optiga_crypt_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(pal_os_memory_pool_unit_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(pal_os_executor_unit_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_util_power_manager_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_comms_fast_recovery_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_comms_gpiod_reset_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_crypt_random_pool_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_crypt_ecdhe_pool_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
+target_link_libraries(optiga_util_read_cache_integration_test optiga_trust_M_lib -lrt -lusb-1.0 -lm)
 else()
 target_link_libraries(optiga_lib_common_unit_test optiga_trust_M_lib -lrt)
 target_link_libraries(optiga_lib_logger_unit_test optiga_trust_M_lib -lrt)
 target_link_libraries(optiga_cmd_unit_test optiga_trust_M_lib -lrt)
 target_link_libraries(optiga_util_integration_test optiga_trust_M_lib -lrt)
 target_link_libraries(optiga_crypt_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(pal_os_memory_pool_unit_test optiga_trust_M_lib -lrt)
+target_link_libraries(pal_os_executor_unit_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_util_power_manager_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_comms_fast_recovery_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_comms_gpiod_reset_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_crypt_random_pool_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_crypt_ecdhe_pool_integration_test optiga_trust_M_lib -lrt)
+target_link_libraries(optiga_util_read_cache_integration_test optiga_trust_M_lib -lrt)
 endif()
 
 # Add Ctest
@@ -31,4 +55,16 @@ add_test(NAME OPTIGA_LIB_COMMON_UNIT_TEST COMMAND optiga_lib_common_unit_test)
 add_test(NAME OPTIGA_LIB_LOGGER_UNIT_TEST COMMAND optiga_lib_logger_unit_test)
 add_test(NAME OPTIGA_CMD_UNIT_TEST COMMAND optiga_cmd_unit_test)
 add_test(NAME OPTIGA_UTIL_INTEGRATION_TEST COMMAND optiga_util_integration_test)
-add_test(NAME OPTIGA_CRYPT_INTEGRATION_TEST COMMAND optiga_crypt_integration_test)
\ No newline at end of file
+add_test(NAME OPTIGA_CRYPT_INTEGRATION_TEST COMMAND optiga_crypt_integration_test)
+add_test(NAME PAL_OS_MEMORY_POOL_UNIT_TEST COMMAND pal_os_memory_pool_unit_test)
+add_test(NAME PAL_OS_EXECUTOR_UNIT_TEST COMMAND pal_os_executor_unit_test)
+add_test(NAME OPTIGA_UTIL_POWER_MANAGER_INTEGRATION_TEST COMMAND optiga_util_power_manager_integration_test)
+add_test(NAME OPTIGA_COMMS_FAST_RECOVERY_INTEGRATION_TEST COMMAND optiga_comms_fast_recovery_integration_test)
+add_test(NAME OPTIGA_COMMS_GPIOD_RESET_INTEGRATION_TEST COMMAND optiga_comms_gpiod_reset_integration_test)
+add_test(NAME OPTIGA_CRYPT_RANDOM_POOL_INTEGRATION_TEST COMMAND optiga_crypt_random_pool_integration_test)
+add_test(NAME OPTIGA_CRYPT_ECDHE_POOL_INTEGRATION_TEST COMMAND optiga_crypt_ecdhe_pool_integration_test)
+add_test(NAME OPTIGA_UTIL_READ_CACHE_INTEGRATION_TEST COMMAND optiga_util_read_cache_integration_test)
+
+# Compile the library with the profile of each operation alone
+add_test(NAME OPTIGA_PROFILE_OPERATIONS_CHECK COMMAND ${CMAKE_COMMAND} -DOPTIGA_PROFILE_CHECK_DIR=${CMAKE_BINARY_DIR}/profile_check -DOPTIGA_PROFILE_CHECK_COMPILER=${CMAKE_C_COMPILER} -P ${PROJECT_SOURCE_DIR}/../extras/profile/optiga_profile.cmake)
+add_test(NAME OPTIGA_PROFILE_OPERATIONS_CHECK_M_V1 COMMAND ${CMAKE_COMMAND} -DOPTIGA_PROFILE_CHECK_DIR=${CMAKE_BINARY_DIR}/profile_check_m_v1 -DOPTIGA_PROFILE_BASE=m_v1 -DOPTIGA_PROFILE_CHECK_COMPILER=${CMAKE_C_COMPILER} -P ${PROJECT_SOURCE_DIR}/../extras/profile/optiga_profile.cmake)
\ No newline at end of file
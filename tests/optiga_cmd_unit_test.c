@@ -470,6 +470,9 @@ void ut_optiga_cmd_calc_hash(
     ut_hash_param->p_hash_oid = NULL;
     ut_hash_param->p_out_digest = NULL;
     ut_hash_param->export_hash_ctx = TRUE;
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+    ut_hash_param->p_hash_stream = NULL;
+#endif
 
     ut_optiga_result =
         optiga_cmd_calc_hash(ut_optiga_cmd, ut_hash_context.hash_algo, ut_hash_param);
@@ -590,6 +593,9 @@ void ut_optiga_encrypt_sym_fct(
 
     /* optiga_cmd_encrypt_sym check : OPTIGA_CRYPT_SYM_START_FINAL*/
     ut_encrypt_sym_param->mode = OPTIGA_SYMMETRIC_CBC;
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    ut_encrypt_sym_param->p_sym_stream = NULL;
+#endif
     ut_encrypt_sym_param->symmetric_key_oid = OPTIGA_KEY_ID_SECRET_BASED;
     ut_encrypt_sym_param->in_data = plain_data_buffer;
     ut_encrypt_sym_param->in_data_length = sizeof(plain_data_buffer);
@@ -786,10 +792,38 @@ int main(int argc, char **argv) {
     ut_sign_param->private_key_oid = OPTIGA_KEY_ID_E0FC;
     ut_sign_param->p_signature = ut_signature;
     ut_sign_param->p_signature_length = &ut_signature_length;
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+    ut_sign_param->batch.item_count = 0;
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
     ut_optiga_result =
         optiga_cmd_calc_sign(ut_optiga_cmd, OPTIGA_RSASSA_PKCS1_V15_SHA256, ut_sign_param);
     assert(ut_optiga_result == OPTIGA_LIB_SUCCESS);
 
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+    /* optiga_cmd_calc_sign check : batch
+    Calculate signatures on a batch of digests by issuing Calc Sign command for each item while holding the lock.
+    */
+    const uint8_t *ut_batch_digests[] = {ut_digest, ut_digest};
+    uint8_t *ut_batch_signatures[] = {ut_signature, ut_signature};
+    uint16_t ut_batch_signature_lengths[] = {sizeof(ut_signature), sizeof(ut_signature)};
+    ut_sign_param->p_digest = ut_batch_digests[0];
+    ut_sign_param->p_signature = ut_batch_signatures[0];
+    ut_sign_param->p_signature_length = &ut_batch_signature_lengths[0];
+    ut_sign_param->batch.p_digests = ut_batch_digests;
+    ut_sign_param->batch.p_signatures = ut_batch_signatures;
+    ut_sign_param->batch.p_signature_lengths = ut_batch_signature_lengths;
+    ut_sign_param->batch.item_handler = NULL;
+    ut_sign_param->batch.p_item_handler_ctx = NULL;
+    ut_sign_param->batch.item_count = 2;
+    ut_sign_param->batch.item_index = 0;
+    ut_optiga_result = optiga_cmd_release_lock(ut_optiga_cmd);
+    assert(ut_optiga_result == OPTIGA_LIB_SUCCESS);
+    ut_optiga_result =
+        optiga_cmd_calc_sign(ut_optiga_cmd, OPTIGA_CRYPT_ECDSA_FIPS_186_3_WITHOUT_HASH, ut_sign_param);
+    assert(ut_optiga_result == OPTIGA_LIB_SUCCESS);
+    ut_sign_param->batch.item_count = 0;
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
     /* optiga_cmd_verify_sign check : ECDSA
     Verifies the signature over the given digest by issuing VerifySign command.
     * - Acquires the OPTIGA lock for #optiga_crypt_ecdsa_verify/#optiga_crypt_rsa_verify.
@@ -981,6 +1015,9 @@ int main(int argc, char **argv) {
     ut_set_object_protected_param->p_protected_update_buffer = (const uint8_t *)ut_manifest;
     ut_set_object_protected_param->p_protected_update_buffer_length = sizeof(ut_manifest);
     ut_set_object_protected_param->set_obj_protected_tag = OPTIGA_SET_PROTECTED_UPDATE_START;
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+    ut_set_object_protected_param->p_stream = NULL;
+#endif
     ut_optiga_result = optiga_cmd_set_object_protected(
         ut_optiga_cmd,
         ut_set_object_protected_param->manifest_version,
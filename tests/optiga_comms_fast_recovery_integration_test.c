@@ -0,0 +1,165 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_comms_fast_recovery_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA comms fast recovery integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_comms_fast_recovery_integration_test.h"
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_DATA_OBJECT_OID (0xE0E0)
+
+static const uint8_t ut_data_object[] = {0x55, 0x66, 0x77, 0x88};
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+
+static void ut_optiga_util_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+/*
+ * Responds to GetDataObject of the test data object
+ */
+static void ut_apdu_handler(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+) {
+    uint16_t oid = 0;
+
+    (void)p_ctx;
+    if (apdu_length >= 6) {
+        optiga_common_get_uint16(&p_apdu[4], &oid);
+    }
+    if ((0x01 == (p_apdu[0] & 0x7F)) && (UT_DATA_OBJECT_OID == oid)) {
+        optiga_common_set_uint16(&p_response[2], sizeof(ut_data_object));
+        memcpy(&p_response[4], ut_data_object, sizeof(ut_data_object));
+        *p_response_length = 4 + sizeof(ut_data_object);
+    }
+}
+
+static void ut_wait_for_completion(void) {
+    uint32_t ut_waited_ms = 0;
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(OPTIGA_LIB_BUSY != ut_optiga_lib_status);
+}
+
+static optiga_lib_status_t ut_open_application(optiga_util_t *p_instance) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(p_instance, FALSE));
+    ut_wait_for_completion();
+    return (ut_optiga_lib_status);
+}
+
+static optiga_lib_status_t ut_read_protected_data(optiga_util_t *p_instance) {
+    uint8_t ut_read_buffer[16];
+    uint16_t ut_read_length = sizeof(ut_read_buffer);
+
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    OPTIGA_UTIL_SET_COMMS_PROTECTION_LEVEL(p_instance, OPTIGA_COMMS_FULL_PROTECTION);
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_read_data(p_instance, UT_DATA_OBJECT_OID, 0, ut_read_buffer, &ut_read_length)
+    );
+    ut_wait_for_completion();
+    if (OPTIGA_LIB_SUCCESS == ut_optiga_lib_status) {
+        assert(sizeof(ut_data_object) == ut_read_length);
+        assert(0 == memcmp(ut_read_buffer, ut_data_object, sizeof(ut_data_object)));
+    }
+    return (ut_optiga_lib_status);
+}
+
+void ut_optiga_comms_fast_recovery_nack_fct() {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    ifx_i2c_recovery_stats_t ut_stats_before;
+    ifx_i2c_recovery_stats_t ut_stats_after;
+    uint32_t ut_warm_reset_count;
+    uint32_t ut_cold_reset_count;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    assert(OPTIGA_LIB_SUCCESS == ut_open_application(ut_optiga_util_instance));
+
+    // Shielded connection is established with the first protected command
+    assert(OPTIGA_LIB_SUCCESS == ut_read_protected_data(ut_optiga_util_instance));
+    assert(1 == ut_emulator.handshake_count);
+
+    // Slave stops acknowledging for longer than the physical layer polls
+    assert(
+        IFX_I2C_STACK_SUCCESS == ifx_i2c_get_recovery_stats(&ifx_i2c_context_0, &ut_stats_before)
+    );
+    ut_warm_reset_count = ut_emulator.warm_reset_count;
+    ut_cold_reset_count = ut_emulator.cold_reset_count;
+    ut_emulator.nack_count = PL_POLLING_MAX_CNT + 1;
+    assert(OPTIGA_COMMS_ERROR_RECOVERED == ut_read_protected_data(ut_optiga_util_instance));
+
+    // Failure is reported once the slave is recovered by soft reset and the session is restored
+    assert(0 == ut_emulator.nack_count);
+    assert(1 == ut_emulator.soft_reset_count);
+    assert(ut_warm_reset_count == ut_emulator.warm_reset_count);
+    assert(ut_cold_reset_count == ut_emulator.cold_reset_count);
+    assert(2 == ut_emulator.handshake_count);
+    assert(
+        IFX_I2C_STACK_SUCCESS == ifx_i2c_get_recovery_stats(&ifx_i2c_context_0, &ut_stats_after)
+    );
+    assert((ut_stats_before.recovery_count + 1) == ut_stats_after.recovery_count);
+    assert(ut_stats_before.recovery_failure_count == ut_stats_after.recovery_failure_count);
+    assert(ut_stats_before.escalation_count == ut_stats_after.escalation_count);
+    assert(
+        (ut_stats_before.error_count[IFX_I2C_ERROR_CLASS_NACK] + 1)
+        == ut_stats_after.error_count[IFX_I2C_ERROR_CLASS_NACK]
+    );
+    assert(IFX_I2C_ERROR_CLASS_NACK == ut_stats_after.last_error_class);
+    assert(IFX_I2C_SOFT_RESET == ut_stats_after.last_recovery_reset_type);
+
+    // Reset closed the application as reported, the restored session protects the next command
+    // without a handshake
+    assert(TRUE == ut_emulator.session_established);
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_CLOSED == ut_emulator.application_state);
+    assert(OPTIGA_LIB_SUCCESS != ut_read_protected_data(ut_optiga_util_instance));
+    assert(2 == ut_emulator.handshake_count);
+
+    // Application is usable again once reopened on OPTIGA_COMMS_ERROR_RECOVERED
+    assert(OPTIGA_LIB_SUCCESS == ut_open_application(ut_optiga_util_instance));
+    assert(OPTIGA_LIB_SUCCESS == ut_read_protected_data(ut_optiga_util_instance));
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    /*
+    Recovery of a failed transceive and restore of the shielded connection covered.
+    */
+    ut_optiga_comms_fast_recovery_nack_fct();
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,117 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_comms_gpiod_reset_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA comms GPIO reset integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_comms_gpiod_reset_integration_test.h"
+
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_DATA_OBJECT_OID (0xE0E0)
+
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+
+static void ut_optiga_util_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+static void ut_wait_for_completion(void) {
+    uint32_t ut_waited_ms = 0;
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(OPTIGA_LIB_BUSY != ut_optiga_lib_status);
+}
+
+static optiga_lib_status_t ut_open_application(optiga_util_t *p_instance) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(p_instance, FALSE));
+    ut_wait_for_completion();
+    return (ut_optiga_lib_status);
+}
+
+void ut_optiga_comms_gpiod_reset_fct() {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    uint32_t ut_ready_check_count;
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    uint8_t ut_read_buffer[16];
+    uint16_t ut_read_length = sizeof(ut_read_buffer);
+#endif
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, NULL, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    // Power cycle is timed by the GPIO backend, negotiation starts on the ready edge
+    assert(OPTIGA_LIB_SUCCESS == ut_open_application(ut_optiga_util_instance));
+    assert(1 == ut_emulator.cold_reset_count);
+    assert(1 == ut_emulator.ready_check_count);
+    assert(RESET_LOW_TIME_MSEC <= ut_emulator.reset_low_time_us);
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_OPEN == ut_emulator.application_state);
+
+    // Ready edge not signalled, the line is checked until the start up time elapsed
+    ut_emulator.ready_line_stuck = TRUE;
+    assert(OPTIGA_LIB_SUCCESS == ut_open_application(ut_optiga_util_instance));
+    assert(2 == ut_emulator.cold_reset_count);
+    assert(2 < ut_emulator.ready_check_count);
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_OPEN == ut_emulator.application_state);
+    ut_emulator.ready_line_stuck = FALSE;
+
+#ifdef OPTIGA_COMMS_FAST_RECOVERY_ENABLED
+    // Soft reset of the recovery also continues on the ready edge
+    ut_ready_check_count = ut_emulator.ready_check_count;
+    ut_emulator.nack_count = PL_POLLING_MAX_CNT + 1;
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_read_data(
+            ut_optiga_util_instance,
+            UT_DATA_OBJECT_OID,
+            0,
+            ut_read_buffer,
+            &ut_read_length
+        )
+    );
+    ut_wait_for_completion();
+    assert(OPTIGA_COMMS_ERROR_RECOVERED == ut_optiga_lib_status);
+    assert(1 == ut_emulator.soft_reset_count);
+    assert(2 == ut_emulator.cold_reset_count);
+    assert((ut_ready_check_count + 1) == ut_emulator.ready_check_count);
+#endif
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_COMMS_GPIOD_RESET_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef OPTIGA_COMMS_GPIOD_RESET_ENABLED
+    /*
+    Timed reset pulse, start on the ready edge and fallback on a missing ready edge covered.
+    */
+    ut_optiga_comms_gpiod_reset_fct();
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
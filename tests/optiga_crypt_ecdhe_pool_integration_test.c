@@ -0,0 +1,355 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_crypt_ecdhe_pool_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA crypt ECDHE pool integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_crypt_ecdhe_pool_integration_test.h"
+
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) && defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED)
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_FAILURE_TIMEOUT_MS (60000U)
+#define UT_IDLE_TIMEOUT_MS (200U)
+#define UT_SETTLE_TIME_MS (50U)
+#define UT_DATA_OBJECT_OID (0xE0E0)
+#define UT_GEN_KEYPAIR_CMD (0x38)
+#define UT_PUBLIC_KEY_TAG (0x02)
+// Consecutive failed generations, after which the pool pauses
+#define UT_MAX_FAILURES (3U)
+
+// BIT STRING encoded NIST P-256 public key
+static const uint8_t ut_public_key[] = {
+    0x03, 0x42, 0x00, 0x04, 0x8b, 0x88, 0x9c, 0x1d, 0xd6, 0x07, 0x58, 0x2e, 0xd6, 0xf8, 0x2c, 0xc2,
+    0xd9, 0xbe, 0xd0, 0xfe, 0x6d, 0xf3, 0x24, 0x5e, 0x94, 0x7d, 0x54, 0xcd, 0x20, 0xdc, 0x58, 0x98,
+    0xcf, 0x51, 0x31, 0x44, 0x22, 0xea, 0x01, 0xd4, 0x0b, 0x23, 0xb2, 0x45, 0x7c, 0x42, 0xdf, 0x3c,
+    0xfb, 0x0d, 0x33, 0x10, 0xb8, 0x49, 0xb7, 0xaa, 0x0a, 0x85, 0xde, 0xe7, 0x6a, 0xf1, 0xac, 0xfc,
+    0xc8, 0x31, 0x96, 0x04};
+static const uint8_t ut_data_object[] = {0x11, 0x22, 0x33, 0x44};
+static const optiga_crypt_ecdhe_pool_config_t ut_pool_config = {
+    OPTIGA_ECC_CURVE_NIST_P_256,
+    (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT,
+    1};
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+
+static void ut_optiga_lib_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+/*
+ * Responds to GenKeyPair with the test public key and to GetDataObject of the test data object
+ */
+static void ut_apdu_handler(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+) {
+    uint16_t oid = 0;
+
+    (void)p_ctx;
+    if (apdu_length >= 6) {
+        optiga_common_get_uint16(&p_apdu[4], &oid);
+    }
+    if (UT_GEN_KEYPAIR_CMD == (p_apdu[0] & 0x7F)) {
+        optiga_common_set_uint16(&p_response[2], 3 + sizeof(ut_public_key));
+        p_response[4] = UT_PUBLIC_KEY_TAG;
+        optiga_common_set_uint16(&p_response[5], sizeof(ut_public_key));
+        memcpy(&p_response[7], ut_public_key, sizeof(ut_public_key));
+        *p_response_length = 7 + sizeof(ut_public_key);
+    } else if ((0x01 == (p_apdu[0] & 0x7F)) && (UT_DATA_OBJECT_OID == oid)) {
+        optiga_common_set_uint16(&p_response[2], sizeof(ut_data_object));
+        memcpy(&p_response[4], ut_data_object, sizeof(ut_data_object));
+        *p_response_length = 4 + sizeof(ut_data_object);
+    }
+}
+
+static void ut_wait_for_completion_l(int line) {
+    uint32_t ut_waited_ms = 0;
+    fprintf(stderr, "DBG wait from %d\n", line);
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    fprintf(stderr, "DBG waited %u\n", ut_waited_ms);
+    { extern void dbg_dump(void); if (OPTIGA_LIB_BUSY == ut_optiga_lib_status) dbg_dump(); }
+    assert(OPTIGA_LIB_BUSY != ut_optiga_lib_status);
+}
+
+#define ut_wait_for_completion() ut_wait_for_completion_l(__LINE__)
+static void ut_wait_for_generated(uint32_t count) {
+    optiga_crypt_ecdhe_pool_stats_t ut_pool_stats = {0};
+    uint32_t ut_waited_ms = 0;
+
+    do {
+        pal_os_timer_delay_in_milliseconds(1);
+        assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_get_stats(&ut_pool_stats));
+    } while ((count != ut_pool_stats.generated_count) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS));
+    assert(count == ut_pool_stats.generated_count);
+}
+
+static uint32_t ut_get_discarded_count(void) {
+    optiga_crypt_ecdhe_pool_stats_t ut_pool_stats = {0};
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_get_stats(&ut_pool_stats));
+    return (ut_pool_stats.discarded_count);
+}
+
+static uint32_t ut_get_failure_count(void) {
+    optiga_crypt_ecdhe_pool_stats_t ut_pool_stats = {0};
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_get_stats(&ut_pool_stats));
+    return (ut_pool_stats.failure_count);
+}
+
+static optiga_lib_status_t
+ut_open_close_application(optiga_util_t *p_instance, bool_t is_open, bool_t is_hibernate) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    if (TRUE == is_open) {
+        assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(p_instance, is_hibernate));
+    } else {
+        assert(OPTIGA_LIB_SUCCESS == optiga_util_close_application(p_instance, is_hibernate));
+    }
+    ut_wait_for_completion();
+    return (ut_optiga_lib_status);
+}
+
+static optiga_lib_status_t ut_read_data(optiga_util_t *p_instance) {
+    uint8_t ut_read_buffer[16];
+    uint16_t ut_read_length = sizeof(ut_read_buffer);
+
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_read_data(p_instance, UT_DATA_OBJECT_OID, 0, ut_read_buffer, &ut_read_length)
+    );
+    ut_wait_for_completion();
+    return (ut_optiga_lib_status);
+}
+
+static void ut_stop_pool(void) {
+    optiga_lib_status_t ut_return_status;
+    uint32_t ut_waited_ms = 0;
+
+    // A generation may be in progress
+    do {
+        ut_return_status = optiga_crypt_ecdhe_pool_stop();
+        if (OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE == ut_return_status) {
+            pal_os_timer_delay_in_milliseconds(1);
+        }
+    } while ((OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE == ut_return_status)
+             && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS));
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+}
+
+void ut_optiga_crypt_ecdhe_pool_invalidate_fct() {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+    optiga_key_id_t ut_private_key = OPTIGA_KEY_ID_SESSION_BASED;
+    uint8_t ut_public_key_buffer[sizeof(ut_public_key) + 4];
+    uint16_t ut_public_key_length = sizeof(ut_public_key_buffer);
+    uint32_t ut_generate_count;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    ut_optiga_crypt_instance = optiga_crypt_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    // Nothing is generated before the application is open
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_start(&ut_pool_config, 1));
+    pal_os_timer_delay_in_milliseconds(UT_SETTLE_TIME_MS);
+    assert(0 == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, UT_GEN_KEYPAIR_CMD, 0x03));
+
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+    ut_wait_for_generated(1);
+
+    // The ready keypair is served before the API returns and the pool is refilled
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_crypt_ecc_generate_keypair(
+            ut_optiga_crypt_instance,
+            OPTIGA_ECC_CURVE_NIST_P_256,
+            (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT,
+            FALSE,
+            &ut_private_key,
+            ut_public_key_buffer,
+            &ut_public_key_length
+        )
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_optiga_lib_status);
+    assert(sizeof(ut_public_key) == ut_public_key_length);
+    assert(0 == memcmp(ut_public_key_buffer, ut_public_key, sizeof(ut_public_key)));
+    ut_wait_for_generated(2);
+
+    // CloseApplication without hibernate discards the ready keypair, nothing is generated while closed
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, FALSE, FALSE));
+    assert(1 == ut_get_discarded_count());
+    ut_generate_count = ifx_i2c_slave_emulator_count_apdu(&ut_emulator, UT_GEN_KEYPAIR_CMD, 0x03);
+    pal_os_timer_delay_in_milliseconds(UT_SETTLE_TIME_MS);
+    assert(
+        ut_generate_count
+        == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, UT_GEN_KEYPAIR_CMD, 0x03)
+    );
+
+    // OpenApplication resets OPTIGA, the keypair generated before is discarded
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+    ut_wait_for_generated(3);
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+    assert(2 == ut_get_discarded_count());
+    ut_wait_for_generated(4);
+
+    // A failed transceive may have recovered OPTIGA by a reset, the ready keypair is discarded
+    ut_emulator.nack_count = PL_POLLING_MAX_CNT + 1;
+    assert(OPTIGA_LIB_SUCCESS != ut_read_data(ut_optiga_util_instance));
+    assert(3 == ut_get_discarded_count());
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+    ut_wait_for_generated(5);
+
+    ut_stop_pool();
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_destroy(ut_optiga_crypt_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+
+void ut_optiga_crypt_ecdhe_pool_failure_fct() {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    uint32_t ut_waited_ms = 0;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+
+    // Every failed transceive releases the sessions, the failures are counted nevertheless
+    ut_emulator.unresponsive = TRUE;
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_start(&ut_pool_config, 1));
+    // The recovery of each failed transceive takes a while
+    while ((UT_MAX_FAILURES > ut_get_failure_count()) && (ut_waited_ms++ < UT_FAILURE_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(UT_MAX_FAILURES == ut_get_failure_count());
+
+    // The pool pauses after the maximum number of consecutive failures and resumes once the application
+    // is opened again, a generation started after the pause would fail as well
+    pal_os_timer_delay_in_milliseconds(UT_SETTLE_TIME_MS);
+    ut_emulator.unresponsive = FALSE;
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+    ut_wait_for_generated(1);
+    assert(UT_MAX_FAILURES == ut_get_failure_count());
+
+    ut_stop_pool();
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+static void ut_wait_for_hibernation(const optiga_util_t *p_power_instance, uint32_t count) {
+    optiga_util_power_stats_t ut_power_stats = {0};
+    uint32_t ut_waited_ms = 0;
+
+    do {
+        pal_os_timer_delay_in_milliseconds(1);
+        assert(OPTIGA_LIB_SUCCESS
+               == optiga_util_power_manager_get_stats(p_power_instance, &ut_power_stats));
+    } while ((count != ut_power_stats.hibernate_count) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS));
+    { optiga_crypt_ecdhe_pool_stats_t ps; optiga_crypt_ecdhe_pool_get_stats(&ps);
+    { extern void dbg_dump(void); if (count != ut_power_stats.hibernate_count) dbg_dump(); }
+    fprintf(stderr, "DBG hib %u fail %u rest %u rf %u | gen %u srv %u miss %u fail %u disc %u app %d\n", ut_power_stats.hibernate_count, ut_power_stats.hibernate_failure_count, ut_power_stats.restore_count, ut_power_stats.restore_failure_count, ps.generated_count, ps.served_count, ps.miss_count, ps.failure_count, ps.discarded_count, (int)ut_emulator.application_state); }
+    assert(count == ut_power_stats.hibernate_count);
+    assert(0 == ut_power_stats.hibernate_failure_count);
+}
+
+void ut_optiga_crypt_ecdhe_pool_hibernate_fct() {
+    optiga_util_t *ut_optiga_util_power_instance = NULL;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_util_power_config_t ut_power_config = {
+        UT_IDLE_TIMEOUT_MS,
+        0,
+        OPTIGA_UTIL_POWER_POLICY_MIN_POWER};
+    uint32_t ut_generate_count;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    ut_optiga_util_power_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_power_instance != NULL);
+    assert(OPTIGA_LIB_SUCCESS == ut_open_close_application(ut_optiga_util_instance, TRUE, FALSE));
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_ecdhe_pool_start(&ut_pool_config, 1));
+    ut_wait_for_generated(1);
+
+    // The session of the ready keypair does not keep OPTIGA from hibernating, it is released before
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_power_manager_start(ut_optiga_util_power_instance, &ut_power_config)
+    );
+    ut_wait_for_hibernation(ut_optiga_util_power_instance, 1);
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_HIBERNATED == ut_emulator.application_state);
+    assert(1 == ut_get_discarded_count());
+
+    // Nothing is generated while hibernated
+    ut_generate_count = ifx_i2c_slave_emulator_count_apdu(&ut_emulator, UT_GEN_KEYPAIR_CMD, 0x03);
+    pal_os_timer_delay_in_milliseconds(UT_SETTLE_TIME_MS);
+    assert(
+        ut_generate_count
+        == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, UT_GEN_KEYPAIR_CMD, 0x03)
+    );
+
+    // The pool is refilled once the application is restored and hibernates again after the idle timeout
+    assert(OPTIGA_LIB_SUCCESS == ut_read_data(ut_optiga_util_instance));
+    ut_wait_for_generated(2);
+    ut_wait_for_hibernation(ut_optiga_util_power_instance, 2);
+    assert(2 == ut_get_discarded_count());
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_power_manager_stop(ut_optiga_util_power_instance));
+    ut_stop_pool();
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_power_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED && OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#if defined(OPTIGA_CRYPT_ECDHE_POOL_ENABLED) && defined(OPTIGA_CRYPT_ECC_GENERATE_KEYPAIR_ENABLED)
+    /*
+    Discarding of the ready keypairs, when OPTIGA loses the sessions, covered.
+    */
+    ut_optiga_crypt_ecdhe_pool_invalidate_fct();
+    /*
+    Pausing of the pool after consecutive failed generations covered.
+    */
+    ut_optiga_crypt_ecdhe_pool_failure_fct();
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    /*
+    Hibernation with ready keypairs and generation only while the application is open covered.
+    */
+    ut_optiga_crypt_ecdhe_pool_hibernate_fct();
+#endif
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
@@ -1008,6 +1008,117 @@ void ut_optiga_crypt_symmetric_encrypt_decrypt_ecb_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+static const uint8_t ut_sym_stream_data[] = {"OPTIGA, Infineon Technologies AG, streamed"};
+static uint8_t ut_sym_stream_output[64];
+static uint16_t ut_sym_stream_offset;
+static uint16_t ut_sym_stream_output_length;
+
+static optiga_lib_status_t ut_sym_stream_read(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    uint16_t remaining_length = (uint16_t)(sizeof(ut_sym_stream_data) - ut_sym_stream_offset);
+
+    (void)callback_ctx;
+    *p_read_length = (remaining_length > buffer_length) ? buffer_length : remaining_length;
+    pal_os_memcpy(p_buffer, &ut_sym_stream_data[ut_sym_stream_offset], *p_read_length);
+    ut_sym_stream_offset += *p_read_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+static optiga_lib_status_t
+ut_sym_stream_write(void *callback_ctx, const uint8_t *p_data, uint16_t data_length) {
+    (void)callback_ctx;
+    if ((ut_sym_stream_output_length + data_length) > sizeof(ut_sym_stream_output)) {
+        return OPTIGA_CRYPT_ERROR_MEMORY_INSUFFICIENT;
+    }
+    pal_os_memcpy(&ut_sym_stream_output[ut_sym_stream_output_length], p_data, data_length);
+    ut_sym_stream_output_length += data_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+void ut_optiga_crypt_symmetric_stream_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    const uint8_t iv[16] = {0};
+    uint8_t stream_buffer[32];
+    symmetric_data_stream_t sym_stream;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    sym_stream.reader = ut_sym_stream_read;
+    sym_stream.writer = ut_sym_stream_write;
+    sym_stream.progress_handler = NULL;
+    sym_stream.p_stream_ctx = NULL;
+    sym_stream.length = sizeof(ut_sym_stream_data);
+    sym_stream.p_buffer = stream_buffer;
+    sym_stream.buffer_length = sizeof(stream_buffer);
+    sym_stream.padding = FALSE;
+
+    /**
+     * Data which is not block aligned is rejected without padding
+     */
+    ut_return_status = optiga_crypt_symmetric_encrypt_stream(
+        ut_optiga_crypt_instance,
+        OPTIGA_SYMMETRIC_ECB,
+        OPTIGA_KEY_ID_SECRET_BASED,
+        NULL,
+        0,
+        &sym_stream
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    /**
+     * Padding is rejected for MAC modes
+     */
+    sym_stream.padding = TRUE;
+    ut_return_status = optiga_crypt_symmetric_encrypt_stream(
+        ut_optiga_crypt_instance,
+        OPTIGA_SYMMETRIC_CMAC,
+        OPTIGA_KEY_ID_SECRET_BASED,
+        NULL,
+        0,
+        &sym_stream
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    /**
+     * Encrypt the padded data in fragments of the stream buffer
+     */
+    ut_sym_stream_offset = 0;
+    ut_sym_stream_output_length = 0;
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_symmetric_encrypt_stream(
+        ut_optiga_crypt_instance,
+        OPTIGA_SYMMETRIC_CBC,
+        OPTIGA_KEY_ID_SECRET_BASED,
+        iv,
+        sizeof(iv),
+        &sym_stream
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
+
 void ut_optiga_crypt_rsa_verify_fct(void) {
     optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
     optiga_crypt_t *ut_optiga_crypt_instance = NULL;
@@ -1518,6 +1629,53 @@ void ut_optiga_crypt_random_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+void ut_optiga_crypt_random_pool_fct(void) {
+    uint8_t random_data_buffer[32];
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+    optiga_crypt_random_pool_config_t random_pool_config = {4, FALSE};
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    ut_return_status = optiga_crypt_random_pool_enable(ut_optiga_crypt_instance, &random_pool_config);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    /**
+     * Generate Random -
+     *       - Specify the Random type as DRNG, the host DRBG is seeded from OPTIGA TRNG
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+
+    ut_return_status = optiga_crypt_random(
+        ut_optiga_crypt_instance,
+        OPTIGA_RNG_TYPE_DRNG,
+        random_data_buffer,
+        sizeof(random_data_buffer)
+    );
+
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    ut_return_status = optiga_crypt_random_pool_disable(ut_optiga_crypt_instance);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
 void ut_optiga_crypt_hmac_fct(void) {
     const uint8_t input_data_buffer_start[] = {
         0x6b,
@@ -1650,6 +1808,60 @@ void ut_optiga_crypt_hmac_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+void ut_optiga_crypt_hmac_stream_fct(void) {
+    uint8_t stream_buffer[32];
+    symmetric_data_stream_t sym_stream;
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    sym_stream.reader = ut_sym_stream_read;
+    sym_stream.writer = ut_sym_stream_write;
+    sym_stream.progress_handler = NULL;
+    sym_stream.p_stream_ctx = NULL;
+    sym_stream.length = sizeof(ut_sym_stream_data);
+    sym_stream.p_buffer = stream_buffer;
+    sym_stream.buffer_length = sizeof(stream_buffer);
+    sym_stream.padding = TRUE;
+
+    /**
+     * Padding is rejected for HMAC
+     */
+    ut_return_status =
+        optiga_crypt_hmac_stream(ut_optiga_crypt_instance, OPTIGA_HMAC_SHA_256, 0xF1D0, &sym_stream);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    /**
+     * Generate HMAC over the data in fragments of the stream buffer
+     */
+    sym_stream.padding = FALSE;
+    ut_sym_stream_offset = 0;
+    ut_sym_stream_output_length = 0;
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status =
+        optiga_crypt_hmac_stream(ut_optiga_crypt_instance, OPTIGA_HMAC_SHA_256, 0xF1D0, &sym_stream);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_SYM_STREAM_ENABLED
+
 void ut_optiga_crypt_hkdf_fct(void) {
     uint8_t decryption_key[16] = {0};
 
@@ -1838,6 +2050,255 @@ void ut_optiga_crypt_hash_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+static const uint8_t ut_hash_stream_data[] = {"OPTIGA, Infineon Technologies AG"};
+static uint16_t ut_hash_stream_offset;
+
+static optiga_lib_status_t ut_hash_stream_read(
+    void *callback_ctx,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    uint16_t remaining_length = (uint16_t)(sizeof(ut_hash_stream_data) - ut_hash_stream_offset);
+
+    (void)callback_ctx;
+    *p_read_length = (remaining_length > buffer_length) ? buffer_length : remaining_length;
+    pal_os_memcpy(p_buffer, &ut_hash_stream_data[ut_hash_stream_offset], *p_read_length);
+    ut_hash_stream_offset += *p_read_length;
+    return OPTIGA_LIB_SUCCESS;
+}
+
+void ut_optiga_crypt_hash_stream_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    uint8_t stream_buffer[16];
+    hash_data_stream_t hash_stream;
+    uint8_t digest[32];
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    hash_stream.reader = ut_hash_stream_read;
+    hash_stream.progress_handler = NULL;
+    hash_stream.p_stream_ctx = NULL;
+    hash_stream.length = sizeof(ut_hash_stream_data);
+    hash_stream.p_buffer = stream_buffer;
+    hash_stream.buffer_length = 0;
+
+    /**
+     * Stream without buffer is rejected
+     */
+    ut_return_status = optiga_crypt_hash_stream(
+        ut_optiga_crypt_instance,
+        OPTIGA_HASH_TYPE_SHA_256,
+        &hash_stream,
+        digest
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    /**
+     * Hash the data in fragments of the stream buffer
+     */
+    ut_hash_stream_offset = 0;
+    hash_stream.buffer_length = sizeof(stream_buffer);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash_stream(
+        ut_optiga_crypt_instance,
+        OPTIGA_HASH_TYPE_SHA_256,
+        &hash_stream,
+        digest
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_HASH_STREAM_ENABLED
+
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+void ut_optiga_crypt_result_cache_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    hash_data_in_optiga_t hash_data_optiga = {0xE0E0, 0x0000, 0x0100};
+    optiga_crypt_result_cache_stats_t result_cache_stats;
+    uint8_t digest[32];
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    ut_return_status = optiga_crypt_result_cache_get_stats(NULL);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    ut_return_status = optiga_crypt_result_cache_enable(ut_optiga_crypt_instance, TRUE);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    /**
+     * Hash the data object, the digest is cached if the hash is successful
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash(
+        ut_optiga_crypt_instance,
+        OPTIGA_HASH_TYPE_SHA_256,
+        OPTIGA_CRYPT_OID_DATA,
+        &hash_data_optiga,
+        digest
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    ut_return_status = optiga_crypt_result_cache_get_stats(&result_cache_stats);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    optiga_crypt_result_cache_clear();
+    ut_return_status = optiga_crypt_result_cache_enable(ut_optiga_crypt_instance, FALSE);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+void ut_optiga_crypt_host_hash_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    uint8_t hash_context_buffer[OPTIGA_HASH_CONTEXT_LENGTH_SHA_384];
+    optiga_hash_context_t hash_context;
+    uint8_t data_to_hash[] = {'a', 'b', 'c'};
+    hash_data_from_host_t hash_data_host = {data_to_hash, sizeof(data_to_hash)};
+    hash_data_in_optiga_t hash_data_optiga = {0xE0E0, 0x00, 0x10};
+    uint8_t digest[48];
+    // SHA256 and SHA384 of "abc"
+    const uint8_t sha256_abc[] = {0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40,
+                                  0xDE, 0x5D, 0xAE, 0x22, 0x23, 0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17,
+                                  0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD};
+    const uint8_t sha384_abc[] = {0xCB, 0x00, 0x75, 0x3F, 0x45, 0xA3, 0x5E, 0x8B, 0xB5, 0xA0,
+                                  0x3D, 0x69, 0x9A, 0xC6, 0x50, 0x07, 0x27, 0x2C, 0x32, 0xAB,
+                                  0x0E, 0xDE, 0xD1, 0x63, 0x1A, 0x8B, 0x60, 0x5A, 0x43, 0xFF,
+                                  0x5B, 0xED, 0x80, 0x86, 0x07, 0x2B, 0xA1, 0xE7, 0xCC, 0x23,
+                                  0x58, 0xBA, 0xEC, 0xA1, 0x34, 0xC8, 0x25, 0xA7};
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+    optiga_crypt_set_hash_engine(ut_optiga_crypt_instance, OPTIGA_CRYPT_HASH_ENGINE_HOST);
+
+    /**
+     * Start, update and finalize on the host, each completed before the API returns
+     */
+    OPTIGA_HASH_CONTEXT_INIT(
+        hash_context,
+        hash_context_buffer,
+        sizeof(hash_context_buffer),
+        (uint8_t)OPTIGA_HASH_TYPE_SHA_256
+    );
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash_start(ut_optiga_crypt_instance, &hash_context);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash_update(
+        ut_optiga_crypt_instance,
+        &hash_context,
+        OPTIGA_CRYPT_HOST_DATA,
+        &hash_data_host
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    /**
+     * Data in OPTIGA cannot be added to a hash context on the host
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash_update(
+        ut_optiga_crypt_instance,
+        &hash_context,
+        OPTIGA_CRYPT_OID_DATA,
+        &hash_data_optiga
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == optiga_lib_status);
+
+    /**
+     * Finalize follows the engine of the hash context, independent of the selected engine
+     */
+    optiga_crypt_set_hash_engine(ut_optiga_crypt_instance, OPTIGA_CRYPT_HASH_ENGINE_OPTIGA);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash_finalize(ut_optiga_crypt_instance, &hash_context, digest);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+    assert(0 == memcmp(digest, sha256_abc, sizeof(sha256_abc)));
+
+    /**
+     * Single SHA384 hash on the host
+     */
+    optiga_crypt_set_hash_engine(ut_optiga_crypt_instance, OPTIGA_CRYPT_HASH_ENGINE_HOST);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash(
+        ut_optiga_crypt_instance,
+        OPTIGA_HASH_TYPE_SHA_384,
+        OPTIGA_CRYPT_HOST_DATA,
+        &hash_data_host,
+        digest
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+    assert(0 == memcmp(digest, sha384_abc, sizeof(sha384_abc)));
+
+    /**
+     * Data in OPTIGA is hashed by OPTIGA
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_hash(
+        ut_optiga_crypt_instance,
+        OPTIGA_HASH_TYPE_SHA_256,
+        OPTIGA_CRYPT_OID_DATA,
+        &hash_data_optiga,
+        digest
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_HOST_HASH_ENABLED
+
 void ut_optiga_crypt_ecdsa_verify_fct(void) {
     optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
     ut_util_encode_ecc_public_key_in_bit_string_format(
@@ -1888,6 +2349,74 @@ void ut_optiga_crypt_ecdsa_verify_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+void ut_optiga_crypt_ecdsa_host_verify_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    uint8_t tampered_digest[sizeof(ecc_digest)];
+    ut_util_encode_ecc_public_key_in_bit_string_format(
+        ecc_public_key_component,
+        sizeof(ecc_public_key_component),
+        ecc_public_key,
+        &ecc_public_key_length
+    );
+
+    public_key_from_host_t public_key_details = {
+        ecc_public_key,
+        ecc_public_key_length,
+        (uint8_t)OPTIGA_ECC_CURVE_NIST_P_256};
+
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+    optiga_crypt_set_verify_policy(ut_optiga_crypt_instance, OPTIGA_CRYPT_VERIFY_POLICY_HOST_ECDSA);
+
+    /**
+     * Verify ECDSA signature on the host, completed before the API returns
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_ecdsa_verify(
+        ut_optiga_crypt_instance,
+        ecc_digest,
+        sizeof(ecc_digest),
+        ecc_signature,
+        sizeof(ecc_signature),
+        OPTIGA_CRYPT_HOST_DATA,
+        &public_key_details
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    /**
+     * Signature over a modified digest is rejected on the host
+     */
+    memcpy(tampered_digest, ecc_digest, sizeof(tampered_digest));
+    tampered_digest[0] ^= 0x01;
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_ecdsa_verify(
+        ut_optiga_crypt_instance,
+        tampered_digest,
+        sizeof(tampered_digest),
+        ecc_signature,
+        sizeof(ecc_signature),
+        OPTIGA_CRYPT_HOST_DATA,
+        &public_key_details
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(OPTIGA_CRYPT_ERROR_VERIFY_FAILED == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+
 void ut_optiga_crypt_ecdsa_sign_fct(void) {
     // To store the signture generated
     uint8_t ecdsa_signature[80];
@@ -1930,6 +2459,69 @@ void ut_optiga_crypt_ecdsa_sign_fct(void) {
     }
 }
 
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+void ut_optiga_crypt_ecdsa_sign_batch_fct(void) {
+    // To store the signatures generated
+    uint8_t ecdsa_signatures[2][80];
+    const uint8_t *ecdsa_digests[] = {ecc_digest, ecc_digest};
+    uint8_t *ecdsa_signature_buffers[] = {ecdsa_signatures[0], ecdsa_signatures[1]};
+    uint16_t ecdsa_signature_lengths[] = {sizeof(ecdsa_signatures[0]), sizeof(ecdsa_signatures[1])};
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     *
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    /**
+     * Empty batch is rejected
+     */
+    ut_return_status = optiga_crypt_ecdsa_sign_batch(
+        ut_optiga_crypt_instance,
+        ecdsa_digests,
+        sizeof(ecc_digest),
+        0,
+        OPTIGA_KEY_ID_E0F0,
+        ecdsa_signature_buffers,
+        ecdsa_signature_lengths,
+        NULL
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    /**
+     * 2. Sign the digests using Private key from Key Store ID E0F0
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_ecdsa_sign_batch(
+        ut_optiga_crypt_instance,
+        ecdsa_digests,
+        sizeof(ecc_digest),
+        2,
+        OPTIGA_KEY_ID_E0F0,
+        ecdsa_signature_buffers,
+        ecdsa_signature_lengths,
+        NULL
+    );
+
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_optiga_crypt_instance->instance_state = OPTIGA_LIB_INSTANCE_FREE;
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+
 void ut_optiga_crypt_ecdh_fct(void) {
     optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
     optiga_key_id_t optiga_key_id;
@@ -2016,6 +2608,227 @@ void ut_optiga_crypt_ecdh_fct(void) {
     }
 }
 
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+void ut_optiga_crypt_key_schedule_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    optiga_key_id_t optiga_key_id = OPTIGA_KEY_ID_SESSION_BASED;
+    uint8_t public_key[100];
+    uint16_t public_key_length = sizeof(public_key);
+    const uint8_t master_secret_label[] = "master secret";
+    const uint8_t key_expansion_label[] = "key expansion";
+    uint8_t randoms[64];
+    uint8_t key_block[40];
+    optiga_key_schedule_step_t steps[2];
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    memset(randoms, 0x5A, sizeof(randoms));
+    memset(steps, 0x00, sizeof(steps));
+    // Master secret, stored in the session OID
+    steps[0].derivation_type = (uint8_t)OPTIGA_TLS12_PRF_SHA_256;
+    steps[0].label = master_secret_label;
+    steps[0].label_length = sizeof(master_secret_label) - 1;
+    steps[0].random_data = randoms;
+    steps[0].random_data_length = sizeof(randoms);
+    steps[0].derived_key_length = 48;
+    // Key block, exported to the host
+    steps[1].derivation_type = (uint8_t)OPTIGA_TLS12_PRF_SHA_256;
+    steps[1].label = key_expansion_label;
+    steps[1].label_length = sizeof(key_expansion_label) - 1;
+    steps[1].random_data = randoms;
+    steps[1].random_data_length = sizeof(randoms);
+    steps[1].derived_key = key_block;
+    steps[1].derived_key_length = sizeof(key_block);
+
+    // A key schedule without key derivation steps is rejected
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        OPTIGA_KEY_ID_E0F1,
+        &peer_public_key_details,
+        steps,
+        0
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+
+    // A step with an unsupported derivation type is rejected
+    steps[1].derivation_type = (uint8_t)OPTIGA_HMAC_SHA_256;
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        OPTIGA_KEY_ID_E0F1,
+        &peer_public_key_details,
+        steps,
+        sizeof(steps) / sizeof(steps[0])
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    steps[1].derivation_type = (uint8_t)OPTIGA_TLS12_PRF_SHA_256;
+
+    // A TLS PRF step without seed is rejected
+    steps[0].random_data_length = 0;
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        OPTIGA_KEY_ID_E0F1,
+        &peer_public_key_details,
+        steps,
+        sizeof(steps) / sizeof(steps[0])
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    steps[0].random_data_length = sizeof(randoms);
+
+    // A derived key exceeding the session OID is rejected
+    steps[0].derived_key_length = 67;
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        OPTIGA_KEY_ID_E0F1,
+        &peer_public_key_details,
+        steps,
+        sizeof(steps) / sizeof(steps[0])
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    steps[0].derived_key_length = 48;
+
+    // Derivation data exceeding the command buffer is rejected
+    steps[1].random_data_length = OPTIGA_MAX_COMMS_BUFFER_SIZE;
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        OPTIGA_KEY_ID_E0F1,
+        &peer_public_key_details,
+        steps,
+        sizeof(steps) / sizeof(steps[0])
+    );
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    steps[1].random_data_length = sizeof(randoms);
+
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_ecc_generate_keypair(
+        ut_optiga_crypt_instance,
+        OPTIGA_ECC_CURVE_NIST_P_256,
+        (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT,
+        FALSE,
+        &optiga_key_id,
+        public_key,
+        &public_key_length
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    /**
+     * ECDH, master secret and key block as a single operation, only the key block is exported
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    OPTIGA_CRYPT_SET_COMMS_PROTECTION_LEVEL(
+        ut_optiga_crypt_instance,
+        OPTIGA_COMMS_COMMAND_PROTECTION
+    );
+    OPTIGA_CRYPT_SET_COMMS_PROTOCOL_VERSION(
+        ut_optiga_crypt_instance,
+        OPTIGA_COMMS_PROTOCOL_VERSION_PRE_SHARED_SECRET
+    );
+    ut_return_status = optiga_crypt_key_schedule(
+        ut_optiga_crypt_instance,
+        optiga_key_id,
+        &peer_public_key_details,
+        steps,
+        sizeof(steps) / sizeof(steps[0])
+    );
+    /* This is a dummy PAL, no chip exists, the session is not acquired by the key pair generation */
+    if (OPTIGA_LIB_SUCCESS == ut_return_status) {
+        while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        };
+    }
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif
+
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+void ut_optiga_crypt_ecdhe_pool_fct(void) {
+    optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
+    optiga_key_id_t optiga_key_id = OPTIGA_KEY_ID_SESSION_BASED;
+    uint8_t public_key[100];
+    uint16_t public_key_length = sizeof(public_key);
+    optiga_crypt_ecdhe_pool_config_t pool_config[] = {
+        {OPTIGA_ECC_CURVE_NIST_P_256, (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT, 1},
+        {OPTIGA_ECC_CURVE_NIST_P_384, (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT, 1}};
+    optiga_crypt_ecdhe_pool_config_t oversized_config = {
+        OPTIGA_ECC_CURVE_NIST_P_256,
+        (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT,
+        OPTIGA_CRYPT_ECDHE_POOL_MAX_KEYPAIRS + 1};
+    optiga_crypt_ecdhe_pool_stats_t pool_stats;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+    /**
+     * Create OPTIGA Crypt Instance
+     */
+    ut_optiga_crypt_instance = optiga_crypt_create(0, optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+
+    /**
+     * The number of keypairs is limited
+     */
+    ut_return_status = optiga_crypt_ecdhe_pool_start(&oversized_config, 1);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    ut_return_status = optiga_crypt_ecdhe_pool_start(pool_config, 0);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    ut_return_status = optiga_crypt_ecdhe_pool_stop();
+    assert(OPTIGA_CRYPT_ERROR == ut_return_status);
+
+    /**
+     * Start pre-generation of a NIST P-256 and a NIST P-384 keypair
+     */
+    ut_return_status = optiga_crypt_ecdhe_pool_start(pool_config, 2);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    ut_return_status = optiga_crypt_ecdhe_pool_start(pool_config, 2);
+    assert(OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE == ut_return_status);
+
+    /**
+     * Generate session based ECC Key pair, served from the pool if a keypair is ready
+     */
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_return_status = optiga_crypt_ecc_generate_keypair(
+        ut_optiga_crypt_instance,
+        OPTIGA_ECC_CURVE_NIST_P_256,
+        (uint8_t)OPTIGA_KEY_USAGE_KEY_AGREEMENT,
+        FALSE,
+        &optiga_key_id,
+        public_key,
+        &public_key_length
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+    };
+    /* This is a dummy PAL, no chip exists */
+    // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+
+    ut_return_status = optiga_crypt_ecdhe_pool_get_stats(NULL);
+    assert(OPTIGA_CRYPT_ERROR_INVALID_INPUT == ut_return_status);
+    ut_return_status = optiga_crypt_ecdhe_pool_get_stats(&pool_stats);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    assert(1 == (pool_stats.served_count + pool_stats.miss_count));
+
+    do {
+        ut_return_status = optiga_crypt_ecdhe_pool_stop();
+    } while (OPTIGA_CRYPT_ERROR_INSTANCE_IN_USE == ut_return_status);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+
+    if (ut_optiga_crypt_instance) {
+        // Destroy the instance after the completion of usecase if not required.
+        ut_return_status = optiga_crypt_destroy(ut_optiga_crypt_instance);
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+    }
+}
+#endif  // OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+
 void ut_optiga_crypt_ecc_generate_keypair_fct(void) {
     optiga_lib_status_t ut_return_status = !OPTIGA_LIB_SUCCESS;
     optiga_key_id_t optiga_key_id;
@@ -2259,6 +3072,9 @@ int main(int argc, char **argv) {
     */
     ut_optiga_crypt_symmetric_encrypt_decrypt_cbc_fct();
     ut_optiga_crypt_symmetric_encrypt_decrypt_ecb_fct();
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    ut_optiga_crypt_symmetric_stream_fct();
+#endif
 
     /*
     optiga_crypt_rsa_verify, optiga_crypt_rsa_sign Unit tests covered.
@@ -2282,24 +3098,53 @@ int main(int argc, char **argv) {
    optiga_crypt_random, optiga_crypt_hmac_start, optiga_crypt_hmac_update, optiga_crypt_hmac_finalize Unit tests covered.
    */
     ut_optiga_crypt_random_fct();
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+    ut_optiga_crypt_random_pool_fct();
+#endif
     ut_optiga_crypt_hmac_fct();
+#ifdef OPTIGA_CRYPT_SYM_STREAM_ENABLED
+    ut_optiga_crypt_hmac_stream_fct();
+#endif
 
     /*
    optiga_crypt_hkdf, optiga_crypt_hash_start, optiga_crypt_hash_update, optiga_crypt_hash_finalize Unit tests covered.
    */
     ut_optiga_crypt_hkdf_fct();
     ut_optiga_crypt_hash_fct();
+#ifdef OPTIGA_CRYPT_HASH_STREAM_ENABLED
+    ut_optiga_crypt_hash_stream_fct();
+#endif
+#ifdef OPTIGA_CRYPT_HOST_HASH_ENABLED
+    ut_optiga_crypt_host_hash_fct();
+#endif
+#ifdef OPTIGA_CRYPT_RESULT_CACHE_ENABLED
+    ut_optiga_crypt_result_cache_fct();
+#endif
 
     /*
    optiga_crypt_ecdsa_verify, optiga_crypt_ecdsa_sign, optiga_crypt_ecdh
    */
     ut_optiga_crypt_ecdsa_verify_fct();
+#ifdef OPTIGA_CRYPT_HOST_VERIFY_ENABLED
+    ut_optiga_crypt_ecdsa_host_verify_fct();
+#endif
     ut_optiga_crypt_ecdsa_sign_fct();
+#ifdef OPTIGA_CRYPT_ECDSA_SIGN_BATCH_ENABLED
+    ut_optiga_crypt_ecdsa_sign_batch_fct();
+#endif
     ut_optiga_crypt_ecdh_fct();
+#if defined(OPTIGA_CRYPT_ECDH_ENABLED) && defined(OPTIGA_CRYPT_KEY_SCHEDULE_ENABLED) \
+    && (defined(OPTIGA_CRYPT_TLS_PRF_SHA256_ENABLED) || defined(OPTIGA_CRYPT_TLS_PRF_SHA384_ENABLED) \
+        || defined(OPTIGA_CRYPT_TLS_PRF_SHA512_ENABLED) || defined(OPTIGA_CRYPT_HKDF_ENABLED))
+    ut_optiga_crypt_key_schedule_fct();
+#endif
 
     /*
    optiga_crypt_clear_auto_state, optiga_crypt_hmac_verify, optiga_crypt_generate_auth_code, optiga_crypt_ecc_generate_keypair Unit tests covered.
    */
     ut_optiga_crypt_ecc_generate_keypair_fct();
+#ifdef OPTIGA_CRYPT_ECDHE_POOL_ENABLED
+    ut_optiga_crypt_ecdhe_pool_fct();
+#endif
     ut_optiga_crypt_clear_auto_state_fct();
 }
\ No newline at end of file
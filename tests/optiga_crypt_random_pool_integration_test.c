@@ -0,0 +1,169 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_crypt_random_pool_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA crypt random pool integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_crypt_random_pool_integration_test.h"
+
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_GET_RANDOM_CMD (0x0C)
+#define UT_KAT_RETURNED_BITS_LENGTH (128U)
+
+/*
+ * NIST CAVP HMAC_DRBG vector, SHA-256, no prediction resistance, no personalization string
+ * and no additional input, COUNT = 0
+ */
+static const uint8_t ut_kat_entropy_input_nonce[] = {
+    // EntropyInput
+    0xca, 0x85, 0x19, 0x11, 0x34, 0x93, 0x84, 0xbf, 0xfe, 0x89, 0xde, 0x1c, 0xbd, 0xc4, 0x6e, 0x68,
+    0x31, 0xe4, 0x4d, 0x34, 0xa4, 0xfb, 0x93, 0x5e, 0xe2, 0x85, 0xdd, 0x14, 0xb7, 0x1a, 0x74, 0x88,
+    // Nonce
+    0x65, 0x9b, 0xa9, 0x6c, 0x60, 0x1d, 0xc6, 0x9f, 0xc9, 0x02, 0x94, 0x08, 0x05, 0xec, 0x0c, 0xa8};
+
+static const uint8_t ut_kat_returned_bits[UT_KAT_RETURNED_BITS_LENGTH] = {
+    0xe5, 0x28, 0xe9, 0xab, 0xf2, 0xde, 0xce, 0x54, 0xd4, 0x7c, 0x7e, 0x75, 0xe5, 0xfe, 0x30, 0x21,
+    0x49, 0xf8, 0x17, 0xea, 0x9f, 0xb4, 0xbe, 0xe6, 0xf4, 0x19, 0x96, 0x97, 0xd0, 0x4d, 0x5b, 0x89,
+    0xd5, 0x4f, 0xbb, 0x97, 0x8a, 0x15, 0xb5, 0xc4, 0x43, 0xc9, 0xec, 0x21, 0x03, 0x6d, 0x24, 0x60,
+    0xb6, 0xf7, 0x3e, 0xba, 0xd0, 0xdc, 0x2a, 0xba, 0x6e, 0x62, 0x4a, 0xbf, 0x07, 0x74, 0x5b, 0xc1,
+    0x07, 0x69, 0x4b, 0xb7, 0x54, 0x7b, 0xb0, 0x99, 0x5f, 0x70, 0xde, 0x25, 0xd6, 0xb2, 0x9e, 0x2d,
+    0x30, 0x11, 0xbb, 0x19, 0xd2, 0x76, 0x76, 0xc0, 0x71, 0x62, 0xc8, 0xb5, 0xcc, 0xde, 0x06, 0x68,
+    0x96, 0x1d, 0xf8, 0x68, 0x03, 0x48, 0x2c, 0xb3, 0x7e, 0xd6, 0xd5, 0xc0, 0xbb, 0x8d, 0x50, 0xcf,
+    0x1f, 0x50, 0xd4, 0x76, 0xaa, 0x04, 0x58, 0xbd, 0xab, 0xa8, 0x06, 0xf4, 0x8b, 0xe9, 0xdc, 0xb8};
+
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+static uint32_t ut_trng_request_count;
+
+static void ut_optiga_lib_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+/*
+ * Responds to GetRandom of type TRNG with the entropy input and nonce of the test vector
+ */
+static void ut_apdu_handler(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+) {
+    uint16_t random_data_length = 0;
+
+    (void)p_ctx;
+    if (apdu_length >= 6) {
+        optiga_common_get_uint16(&p_apdu[4], &random_data_length);
+    }
+    if ((UT_GET_RANDOM_CMD == (p_apdu[0] & 0x7F)) && (OPTIGA_RNG_TYPE_TRNG == p_apdu[1])
+        && (sizeof(ut_kat_entropy_input_nonce) == random_data_length)) {
+        optiga_common_set_uint16(&p_response[2], sizeof(ut_kat_entropy_input_nonce));
+        memcpy(&p_response[4], ut_kat_entropy_input_nonce, sizeof(ut_kat_entropy_input_nonce));
+        *p_response_length = 4 + sizeof(ut_kat_entropy_input_nonce);
+        ut_trng_request_count++;
+    }
+}
+
+static void ut_wait_for_completion(void) {
+    uint32_t ut_waited_ms = 0;
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(OPTIGA_LIB_BUSY != ut_optiga_lib_status);
+}
+
+static optiga_lib_status_t ut_random_drng(optiga_crypt_t *p_instance, uint8_t *p_random_data) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_crypt_random(
+            p_instance,
+            OPTIGA_RNG_TYPE_DRNG,
+            p_random_data,
+            UT_KAT_RETURNED_BITS_LENGTH
+        )
+    );
+    ut_wait_for_completion();
+    return (ut_optiga_lib_status);
+}
+
+void ut_optiga_crypt_random_pool_kat_fct() {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+    optiga_crypt_random_pool_config_t ut_random_pool_config = {4, FALSE};
+    uint8_t ut_random_data[UT_KAT_RETURNED_BITS_LENGTH];
+    uint32_t ut_apdu_count;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(ut_optiga_util_instance, FALSE));
+    ut_wait_for_completion();
+    assert(OPTIGA_LIB_SUCCESS == ut_optiga_lib_status);
+
+    ut_optiga_crypt_instance = optiga_crypt_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_crypt_instance != NULL);
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_crypt_random_pool_enable(ut_optiga_crypt_instance, &ut_random_pool_config)
+    );
+
+    // Instantiate with the TRNG output of OPTIGA and generate, the first returned bits are discarded
+    assert(OPTIGA_LIB_SUCCESS == ut_random_drng(ut_optiga_crypt_instance, ut_random_data));
+    assert(1 == ut_trng_request_count);
+
+    // Second generate is served by the host HMAC without OPTIGA and matches the returned bits
+    ut_apdu_count = ut_emulator.apdu_count;
+    memset(ut_random_data, 0x00, sizeof(ut_random_data));
+    assert(OPTIGA_LIB_SUCCESS == ut_random_drng(ut_optiga_crypt_instance, ut_random_data));
+    assert(ut_apdu_count == ut_emulator.apdu_count);
+    assert(0 == memcmp(ut_random_data, ut_kat_returned_bits, sizeof(ut_kat_returned_bits)));
+
+    // Disabling the pool discards the state, the next request instantiates again to the same output
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_random_pool_disable(ut_optiga_crypt_instance));
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_crypt_random_pool_enable(ut_optiga_crypt_instance, &ut_random_pool_config)
+    );
+    assert(OPTIGA_LIB_SUCCESS == ut_random_drng(ut_optiga_crypt_instance, ut_random_data));
+    assert(OPTIGA_LIB_SUCCESS == ut_random_drng(ut_optiga_crypt_instance, ut_random_data));
+    assert(2 == ut_trng_request_count);
+    assert(0 == memcmp(ut_random_data, ut_kat_returned_bits, sizeof(ut_kat_returned_bits)));
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_destroy(ut_optiga_crypt_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef OPTIGA_CRYPT_RANDOM_POOL_ENABLED
+    /*
+    Known answer test of the host HMAC_DRBG seeded from the emulated OPTIGA TRNG covered.
+    */
+    ut_optiga_crypt_random_pool_kat_fct();
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
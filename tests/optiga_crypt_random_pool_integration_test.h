@@ -0,0 +1,34 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_crypt_random_pool_integration_test.h
+ *
+ * \brief   This file defines APIs, types and data structures used in the OPTIGA crypt random pool integration tests.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#ifndef OPTIGA_CRYPT_RANDOM_POOL_INTEGRATION_TEST
+#define OPTIGA_CRYPT_RANDOM_POOL_INTEGRATION_TEST
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ifx_i2c_slave_emulator.h"
+#include "optiga_crypt.h"
+#include "optiga_lib_common.h"
+#include "optiga_util.h"
+#include "pal_os_timer.h"
+
+#endif  // OPTIGA_CRYPT_RANDOM_POOL_INTEGRATION_TEST
+
+/**
+ * @}
+ */
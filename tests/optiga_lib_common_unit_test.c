@@ -37,4 +37,9 @@ int main(int argc, char **argv) {
     optiga_common_set_uint16(ut_u16_u8_array, ut_u16_var);
     optiga_common_get_uint16(ut_u16_u8_array, &ut_u16_var_calculated);
     assert(ut_u16_var_calculated == ut_u16_var);
+
+    /* optiga_common_is_equal check*/
+    assert(TRUE == optiga_common_is_equal(ut_u32_u8_array, ut_u32_u8_array, sizeof(ut_u32_u8_array)));
+    assert(FALSE == optiga_common_is_equal(ut_u32_u8_array, &ut_u32_u8_array[1], 3));
+    assert(TRUE == optiga_common_is_equal(ut_u32_u8_array, ut_u16_u8_array, 0));
 }
\ No newline at end of file
@@ -15,6 +15,29 @@
 
 #include "optiga_lib_logger_unit_test.h"
 
+#ifdef PAL_LOGGER_RING_ENABLED
+#include <pthread.h>
+
+#define UT_RING_PRODUCER_COUNT (4U)
+#define UT_RING_PRODUCER_RECORDS (PAL_LOGGER_RING_RECORD_COUNT / UT_RING_PRODUCER_COUNT)
+
+/* Writes records with the producer index as layer id and a running event id */
+static void *ut_ring_producer(void *p_arg) {
+    uint8_t ut_producer = (uint8_t)(uintptr_t)p_arg;
+    uint8_t ut_payload[4];
+    uint16_t ut_index;
+
+    for (ut_index = 0; ut_index < UT_RING_PRODUCER_RECORDS; ut_index++) {
+        memset(ut_payload, ut_producer, sizeof(ut_payload));
+        if (PAL_STATUS_SUCCESS
+            != pal_logger_ring_write(ut_producer, (uint8_t)ut_index, ut_payload, sizeof(ut_payload))) {
+            return p_arg;
+        }
+    }
+    return NULL;
+}
+#endif
+
 int main(int argc, char **argv) {
     /* to remove warning for unused parameter */
     (void)(argc);
@@ -23,6 +46,34 @@ int main(int argc, char **argv) {
     char_t *input_string = "Optiga Trust - Unit Tests";
     uint16_t ut_return_success = OPTIGA_LIB_SUCCESS;
     uint16_t ut_return_failure = OPTIGA_DEVICE_ERROR;
+#ifdef PAL_LOGGER_RING_ENABLED
+    pal_logger_ring_record_t ut_record;
+    uint8_t ut_long_data[PAL_LOGGER_RING_MAX_PAYLOAD + 1] = {0};
+    uint32_t ut_overflow_count;
+    uint16_t ut_index;
+    pthread_t ut_producers[UT_RING_PRODUCER_COUNT];
+    uint16_t ut_next_event[UT_RING_PRODUCER_COUNT] = {0};
+    void *ut_producer_result;
+
+    /* pal_logger_ring_write check
+    *  Records are kept in the ring until the application starts the drain thread
+    */
+    optiga_lib_print_string((const char_t *)input_string);
+    if ((PAL_STATUS_SUCCESS != pal_logger_ring_read(&ut_record))
+        || (OPTIGA_LIB_LOGGER_EVENT_STRING != ut_record.event_id)) {
+        return 1;
+    }
+    if (PAL_STATUS_SUCCESS == pal_logger_ring_read(&ut_record)) {
+        return 1;
+    }
+
+    /* pal_logger_ring_start check
+    *  The records of the following prints are formatted by the drain thread
+    */
+    if (PAL_STATUS_SUCCESS != pal_logger_ring_start(optiga_lib_print_record)) {
+        return 1;
+    }
+#endif
 
     /* optiga_lib_print_string check
     *  Nothing to be checked here, just for coverage
@@ -71,4 +122,93 @@ int main(int argc, char **argv) {
         6,
         OPTIGA_LIB_LOGGER_COLOR_BLUE
     );
-}
\ No newline at end of file
+
+#ifdef PAL_LOGGER_RING_ENABLED
+    /* pal_logger_ring_stop check
+    *  Pending records are drained before returning
+    */
+    if (PAL_STATUS_SUCCESS != pal_logger_ring_stop()) {
+        return 1;
+    }
+    if (PAL_STATUS_SUCCESS == pal_logger_ring_read(&ut_record)) {
+        return 1;
+    }
+
+    /* pal_logger_ring_write check
+    *  The payload is truncated and the record keeps the original length
+    */
+    optiga_lib_print_array_hex_format(
+        ut_long_data,
+        sizeof(ut_long_data),
+        OPTIGA_PROTECTED_DATA_COLOR
+    );
+    if ((PAL_STATUS_SUCCESS != pal_logger_ring_read(&ut_record))
+        || (OPTIGA_LIB_LOGGER_EVENT_HEX_DATA_PROTECTED != ut_record.event_id)
+        || (sizeof(ut_long_data) != ut_record.data_length)
+        || (PAL_LOGGER_RING_MAX_PAYLOAD != ut_record.payload_length)) {
+        return 1;
+    }
+    optiga_lib_print_record(&ut_record);
+
+    /* pal_logger_ring_get_overflow_count check
+    *  Records beyond the ring capacity are dropped and counted
+    */
+    ut_overflow_count = pal_logger_ring_get_overflow_count();
+    for (ut_index = 0; ut_index <= PAL_LOGGER_RING_RECORD_COUNT; ut_index++) {
+        optiga_lib_print_status(OPTIGA_CRYPT_SERVICE, OPTIGA_LIB_LOGGER_COLOR_GREEN, ut_index);
+    }
+    if ((ut_overflow_count + 1) != pal_logger_ring_get_overflow_count()) {
+        return 1;
+    }
+
+    /* pal_logger_ring_dump check
+    *  The pending records are written to the dump file
+    */
+    if (PAL_STATUS_SUCCESS != pal_logger_ring_dump("/tmp/optiga_lib_logger_ring.bin")) {
+        return 1;
+    }
+    if (PAL_STATUS_SUCCESS == pal_logger_ring_dump(NULL)) {
+        return 1;
+    }
+
+    /* pal_logger_ring_write check
+    *  Concurrent producers fill the ring without losing or reordering their records
+    */
+    while (PAL_STATUS_SUCCESS == pal_logger_ring_read(&ut_record)) {
+    }
+    ut_overflow_count = pal_logger_ring_get_overflow_count();
+    for (ut_index = 0; ut_index < UT_RING_PRODUCER_COUNT; ut_index++) {
+        if (0
+            != pthread_create(
+                &ut_producers[ut_index],
+                NULL,
+                ut_ring_producer,
+                (void *)(uintptr_t)ut_index
+            )) {
+            return 1;
+        }
+    }
+    for (ut_index = 0; ut_index < UT_RING_PRODUCER_COUNT; ut_index++) {
+        if ((0 != pthread_join(ut_producers[ut_index], &ut_producer_result))
+            || (NULL != ut_producer_result)) {
+            return 1;
+        }
+    }
+    if (ut_overflow_count != pal_logger_ring_get_overflow_count()) {
+        return 1;
+    }
+    for (ut_index = 0; ut_index < PAL_LOGGER_RING_RECORD_COUNT; ut_index++) {
+        if ((PAL_STATUS_SUCCESS != pal_logger_ring_read(&ut_record))
+            || (ut_record.layer_id >= UT_RING_PRODUCER_COUNT)
+            || (ut_next_event[ut_record.layer_id] != ut_record.event_id)
+            || (ut_record.layer_id != ut_record.payload[0])) {
+            return 1;
+        }
+        ut_next_event[ut_record.layer_id]++;
+    }
+    if (PAL_STATUS_SUCCESS == pal_logger_ring_read(&ut_record)) {
+        return 1;
+    }
+#endif
+    return 0;
+}
@@ -19,6 +19,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "optiga_lib_logger.h"
 #include "optiga_lib_return_codes.h"
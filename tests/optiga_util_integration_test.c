@@ -374,6 +374,438 @@ void ut_optiga_util_open_close_fct() {
     assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
 }
 
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+void ut_optiga_util_power_manager_fct() {
+    optiga_util_t *ut_optiga_util_power_instance = NULL;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    optiga_util_power_config_t ut_power_config = {0};
+    optiga_util_power_stats_t ut_power_stats;
+
+    ut_optiga_util_power_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_power_instance != NULL);
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status = optiga_util_power_manager_start(ut_optiga_util_power_instance, NULL);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    // Zero idle timeout is rejected
+    ut_optiga_lib_status =
+        optiga_util_power_manager_start(ut_optiga_util_power_instance, &ut_power_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_power_config.idle_timeout_ms = 5000;
+    ut_power_config.resume_latency_budget_us = 100000;
+    ut_power_config.policy = OPTIGA_UTIL_POWER_POLICY_LATENCY_BUDGET;
+    ut_optiga_lib_status =
+        optiga_util_power_manager_start(ut_optiga_util_power_instance, &ut_power_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // Only one power manager per OPTIGA instance
+    ut_optiga_lib_status =
+        optiga_util_power_manager_start(ut_optiga_util_instance, &ut_power_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INSTANCE_IN_USE);
+
+    ut_optiga_lib_status =
+        optiga_util_power_manager_get_stats(ut_optiga_util_power_instance, &ut_power_stats);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(ut_power_stats.hibernate_count == 0);
+    assert(ut_power_stats.restore_count == 0);
+
+    ut_optiga_lib_status =
+        optiga_util_power_manager_get_stats(ut_optiga_util_instance, &ut_power_stats);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    // Application was never opened, so it is not hibernated
+    assert(
+        optiga_cmd_get_power_state(ut_optiga_util_power_instance->my_cmd)
+        != OPTIGA_CMD_POWER_STATE_HIBERNATED
+    );
+
+    ut_optiga_lib_status = optiga_util_power_manager_stop(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_optiga_lib_status = optiga_util_power_manager_stop(ut_optiga_util_power_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_power_manager_stop(ut_optiga_util_power_instance);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    // The power manager can be restarted with another instance
+    ut_optiga_lib_status =
+        optiga_util_power_manager_start(ut_optiga_util_instance, &ut_power_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // Destroying the instance stops the power manager
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status =
+        optiga_util_power_manager_start(ut_optiga_util_power_instance, &ut_power_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_power_manager_stop(ut_optiga_util_power_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_power_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+void ut_optiga_util_slot_manager_fct() {
+    static const optiga_util_slot_config_t ut_slots[] = {
+        {0xE0F1, OPTIGA_UTIL_SLOT_TYPE_ECC_KEY},
+        {0xE0F2, OPTIGA_UTIL_SLOT_TYPE_ECC_KEY},
+        {0xF1D0, OPTIGA_UTIL_SLOT_TYPE_DATA},
+    };
+    optiga_util_slot_manager_config_t ut_slot_config = {ut_slots, 0, 0xF1DB};
+    optiga_util_slot_info_t ut_slot_info;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    uint16_t ut_oid;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status = optiga_util_slot_manager_start(ut_optiga_util_instance, NULL);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_optiga_lib_status = optiga_util_slot_manager_start(ut_optiga_util_instance, &ut_slot_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    // Slots are served from memory only after the discovery
+    ut_optiga_lib_status = optiga_util_slot_allocate(OPTIGA_UTIL_SLOT_TYPE_ECC_KEY, 1, &ut_oid);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status = optiga_util_slot_get_info(0xE0F1, &ut_slot_info);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status = optiga_util_slot_manager_sync(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_slot_config.slot_count = sizeof(ut_slots) / sizeof(ut_slots[0]);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status = optiga_util_slot_manager_start(ut_optiga_util_instance, &ut_slot_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // The discovery is in progress
+    ut_optiga_lib_status = optiga_util_slot_manager_stop();
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INSTANCE_IN_USE);
+
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the optiga_util_slot_manager_start operation is completed
+    }
+    // assert(optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_slot_free(0xE0F1);
+    assert(ut_optiga_lib_status != OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_slot_manager_stop();
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+void ut_optiga_util_read_cache_fct() {
+    optiga_util_read_cache_stats_t ut_read_cache_stats;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    uint8_t ut_read_buffer[100];
+    uint16_t ut_read_length;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status = optiga_util_read_cache_get_stats(NULL);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_optiga_lib_status = optiga_util_read_cache_enable(ut_optiga_util_instance, TRUE);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    // Enabling again keeps the attached write handler
+    ut_optiga_lib_status = optiga_util_read_cache_enable(ut_optiga_util_instance, TRUE);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    optiga_util_read_cache_set_ttl(1000);
+    ut_optiga_lib_status =
+        optiga_util_read_cache_set_read_ahead(OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE + 1);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status = optiga_util_read_cache_set_read_ahead(OPTIGA_UTIL_READ_CACHE_ENTRY_SIZE);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // Failed reads are not cached
+    ut_read_length = sizeof(ut_read_buffer);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status =
+        optiga_util_read_data(ut_optiga_util_instance, 0xE0E0, 0, ut_read_buffer, &ut_read_length);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the optiga_util_read_data operation is completed
+    }
+
+    ut_optiga_lib_status = optiga_util_read_cache_get_stats(&ut_read_cache_stats);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(ut_read_cache_stats.miss_count == 1);
+    assert(ut_read_cache_stats.hit_count == 0);
+    assert(ut_read_cache_stats.read_ahead_count == 1);
+    // No OPTIGA responds here, hits and invalidations are covered by optiga_util_read_cache_integration_test
+
+    optiga_util_read_cache_flush(OPTIGA_UTIL_READ_CACHE_ALL_OIDS);
+    optiga_util_read_cache_set_ttl(0);
+    ut_optiga_lib_status = optiga_util_read_cache_set_read_ahead(0);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_read_cache_enable(ut_optiga_util_instance, FALSE);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
+
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+void ut_optiga_util_metadata_store_fct() {
+    const uint16_t ut_metadata_oids[] = {0xE0E0, 0xE0F0, 0xE0F1};
+    optiga_util_metadata_filter_t ut_metadata_filter;
+    optiga_util_metadata_t ut_metadata;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    uint16_t ut_found_oids[3];
+    uint8_t ut_found_count;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status = optiga_util_metadata_store_start(NULL, ut_metadata_oids, 3);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status = optiga_util_metadata_get(0xE0F0, NULL);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status =
+        optiga_util_metadata_store_start(ut_optiga_util_instance, ut_metadata_oids, 3);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the optiga_util_metadata_store_start operation is completed
+    }
+
+    // Metadata of objects not read from OPTIGA is not provided
+    ut_optiga_lib_status = optiga_util_metadata_get(0xE0F0, &ut_metadata);
+    assert(ut_optiga_lib_status != OPTIGA_LIB_SUCCESS);
+    ut_metadata_filter.tag_mask = OPTIGA_UTIL_METADATA_HAS_LCS;
+    ut_metadata_filter.lcs = 0x07;
+    ut_found_count = sizeof(ut_found_oids) / sizeof(ut_found_oids[0]);
+    ut_optiga_lib_status =
+        optiga_util_metadata_find(&ut_metadata_filter, ut_found_oids, &ut_found_count);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(ut_found_count == 0);
+
+    ut_optiga_lib_status = optiga_util_metadata_store_stop(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_METADATA_STORE_ENABLED
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+void ut_optiga_util_write_behind_fct() {
+    const uint16_t ut_write_behind_oids[] = {0xF1D0};
+    const uint8_t ut_write_data[] = {0x01, 0x02, 0x03, 0x04};
+    optiga_util_write_behind_config_t ut_write_behind_config = {NULL, 0, 0, 0};
+    optiga_util_write_behind_stats_t ut_write_behind_stats = {0};
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    uint32_t ut_waited_ms = 0;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status = optiga_util_write_behind_start(&ut_write_behind_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status = optiga_util_write_behind_barrier(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_write_behind_config.p_oids = ut_write_behind_oids;
+    ut_write_behind_config.oid_count = 1;
+    ut_write_behind_config.window_ms = 50;
+    ut_optiga_lib_status = optiga_util_write_behind_start(&ut_write_behind_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // Buffered writes complete before returning
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status = optiga_util_write_data(
+        ut_optiga_util_instance,
+        0xF1D0,
+        OPTIGA_UTIL_WRITE_ONLY,
+        0,
+        ut_write_data,
+        sizeof(ut_write_data)
+    );
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_write_behind_stop();
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INSTANCE_IN_USE);
+
+    // The buffered data is flushed after the window, without any further operation
+    while (((ut_write_behind_stats.flush_count + ut_write_behind_stats.flush_failure_count) == 0)
+           && (ut_waited_ms++ < 5000)) {
+        pal_os_timer_delay_in_milliseconds(1);
+        ut_optiga_lib_status = optiga_util_write_behind_get_stats(&ut_write_behind_stats);
+        assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    }
+    assert((ut_write_behind_stats.flush_count + ut_write_behind_stats.flush_failure_count) == 1);
+
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status = optiga_util_write_behind_barrier(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the optiga_util_write_behind_barrier operation is completed
+    }
+
+    ut_optiga_lib_status = optiga_util_write_behind_get_stats(&ut_write_behind_stats);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(ut_write_behind_stats.buffered_count == 1);
+    if (0 == ut_write_behind_stats.flush_failure_count) {
+        // Nothing is left to the barrier
+        assert(ut_write_behind_stats.flush_count == 1);
+        ut_optiga_lib_status = optiga_util_write_behind_stop();
+        assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    } else {
+        // The communication failed, the data is kept for the next flush and the barrier fails as well
+        assert(ut_write_behind_stats.flush_failure_count == 2);
+        assert(optiga_lib_status != OPTIGA_LIB_SUCCESS);
+        ut_optiga_lib_status = optiga_util_write_behind_stop();
+        assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INSTANCE_IN_USE);
+    }
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+void ut_optiga_util_sec_governor_fct() {
+    optiga_util_sec_governor_config_t ut_sec_governor_config = {100, 0, 500, 6, 7};
+    optiga_util_sec_governor_stats_t ut_sec_governor_stats;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+    uint32_t ut_wait_ms;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    ut_optiga_lib_status =
+        optiga_util_sec_governor_start(ut_optiga_util_instance, &ut_sec_governor_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status =
+        optiga_util_sec_governor_admit(OPTIGA_UTIL_SEC_PRIORITY_HIGH, &ut_wait_ms);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_sec_governor_config.low_priority_limit = 2;
+    ut_optiga_lib_status =
+        optiga_util_sec_governor_start(ut_optiga_util_instance, &ut_sec_governor_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    // Each low priority request in progress may raise a security event
+    ut_optiga_lib_status = optiga_util_sec_governor_admit(OPTIGA_UTIL_SEC_PRIORITY_LOW, &ut_wait_ms);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_sec_governor_admit(OPTIGA_UTIL_SEC_PRIORITY_LOW, &ut_wait_ms);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_sec_governor_admit(OPTIGA_UTIL_SEC_PRIORITY_LOW, &ut_wait_ms);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_BUSY);
+    assert(ut_wait_ms != 0);
+    ut_optiga_lib_status = optiga_util_sec_governor_admit(OPTIGA_UTIL_SEC_PRIORITY_HIGH, &ut_wait_ms);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_sec_governor_release(OPTIGA_DEVICE_ERROR);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_sec_governor_release(OPTIGA_LIB_SUCCESS);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_sec_governor_release(OPTIGA_LIB_SUCCESS);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    ut_optiga_lib_status = optiga_util_sec_governor_release(OPTIGA_LIB_SUCCESS);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_optiga_lib_status = optiga_util_sec_governor_get_stats(&ut_sec_governor_stats);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert(ut_sec_governor_stats.admitted_count == 3);
+    assert(ut_sec_governor_stats.deferred_count == 1);
+    assert(ut_sec_governor_stats.event_count == 1);
+
+    do {
+        // Wait until the read of the SEC is completed
+        ut_optiga_lib_status = optiga_util_sec_governor_stop(ut_optiga_util_instance);
+    } while (ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INSTANCE_IN_USE);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+void ut_optiga_util_performance_profile_fct() {
+    optiga_util_performance_config_t ut_performance_config = {
+        {0x06, 0x0A, 0x0F},
+        0x01,
+        OPTIGA_UTIL_PERFORMANCE_PROFILE_MAX_PERFORMANCE,
+        OPTIGA_UTIL_PERFORMANCE_PROFILE_LOW_POWER,
+        1000
+    };
+    optiga_util_performance_state_t ut_performance_state;
+    optiga_util_performance_benchmark_t ut_performance_benchmark[OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES];
+    uint8_t ut_benchmark_count = OPTIGA_UTIL_PERFORMANCE_BENCHMARK_ENTRIES;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_optiga_lib_status;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    // A burst queue depth of 1 would be reached by the switch to the idle profile
+    ut_optiga_lib_status =
+        optiga_util_performance_profile_start(ut_optiga_util_instance, &ut_performance_config);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    ut_optiga_lib_status =
+        optiga_util_performance_profile_set(OPTIGA_UTIL_PERFORMANCE_PROFILE_BALANCED);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+
+    ut_performance_config.burst_queue_depth = 0;
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status =
+        optiga_util_performance_profile_start(ut_optiga_util_instance, &ut_performance_config);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the current limitation is read
+    }
+
+    ut_optiga_lib_status =
+        optiga_util_performance_profile_set(OPTIGA_UTIL_PERFORMANCE_PROFILE_CUSTOM);
+    assert(ut_optiga_lib_status == OPTIGA_UTIL_ERROR_INVALID_INPUT);
+    optiga_lib_status = OPTIGA_LIB_BUSY;
+    ut_optiga_lib_status =
+        optiga_util_performance_profile_set(OPTIGA_UTIL_PERFORMANCE_PROFILE_BALANCED);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        // Wait until the current limitation is written
+    }
+
+    ut_optiga_lib_status = optiga_util_performance_profile_get_state(&ut_performance_state);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+    assert((ut_performance_state.switch_count + ut_performance_state.switch_failure_count) == 1);
+    ut_optiga_lib_status = optiga_util_performance_profile_get_benchmark(
+        ut_performance_benchmark,
+        &ut_benchmark_count
+    );
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_performance_profile_stop(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+
+    ut_optiga_lib_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(ut_optiga_lib_status == OPTIGA_LIB_SUCCESS);
+}
+#endif  // OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+
 void ut_optiga_util_write_data_metadata_fct() {
     optiga_lib_status_t ut_return_status;
     uint16_t offset;
@@ -625,6 +1057,100 @@ void ut_optiga_util_protected_update_fct(void) {
     }
 }
 
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+// Reads the continue and final fragments of a data set as one stream
+static optiga_lib_status_t ut_protected_update_stream_reader(
+    void *callback_ctx,
+    uint32_t offset,
+    uint8_t *p_buffer,
+    uint16_t buffer_length,
+    uint16_t *p_read_length
+) {
+    const optiga_protected_update_manifest_fragment_configuration_t *p_data_config =
+        (const optiga_protected_update_manifest_fragment_configuration_t *)callback_ctx;
+    const uint8_t *p_fragments = p_data_config->final_fragment_data;
+    uint16_t index;
+
+    if (offset < p_data_config->continue_fragment_length) {
+        p_fragments = p_data_config->continue_fragment_data + offset;
+        if (buffer_length > (p_data_config->continue_fragment_length - offset)) {
+            buffer_length = (uint16_t)(p_data_config->continue_fragment_length - offset);
+        }
+    } else {
+        p_fragments += offset - p_data_config->continue_fragment_length;
+    }
+    for (index = 0; index < buffer_length; index++) {
+        p_buffer[index] = p_fragments[index];
+    }
+    *p_read_length = buffer_length;
+    return (OPTIGA_LIB_SUCCESS);
+}
+
+void ut_optiga_util_protected_update_stream_fct(void) {
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_lib_status_t ut_return_status;
+    uint8_t ut_stream_buffer[OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE];
+    protected_update_data_stream_t ut_stream = {
+        ut_protected_update_stream_reader,
+        NULL,
+        NULL,
+        0,
+        ut_stream_buffer,
+        sizeof(ut_stream_buffer)
+    };
+    uint16_t data_config = 0;
+
+    ut_optiga_util_instance = optiga_util_create(0, optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+
+    // No stream is suspended
+    ut_return_status = optiga_util_protected_update_stream_resume(ut_optiga_util_instance);
+    assert(OPTIGA_UTIL_ERROR_INVALID_INPUT == ut_return_status);
+
+    for (data_config = 0; data_config < sizeof(optiga_protected_update_data_set)
+                                            / sizeof(optiga_protected_update_data_configuration_t);
+         data_config++) {
+        ut_stream.p_stream_ctx = (void *)optiga_protected_update_data_set[data_config].data_config;
+        ut_stream.length =
+            optiga_protected_update_data_set[data_config].data_config->final_fragment_length;
+        if (NULL
+            != optiga_protected_update_data_set[data_config].data_config->continue_fragment_data) {
+            ut_stream.length +=
+                optiga_protected_update_data_set[data_config].data_config->continue_fragment_length;
+        }
+
+        optiga_lib_status = OPTIGA_LIB_BUSY;
+        ut_return_status = optiga_util_protected_update_stream(
+            ut_optiga_util_instance,
+            optiga_protected_update_data_set[data_config].data_config->manifest_version,
+            optiga_protected_update_data_set[data_config].data_config->manifest_data,
+            optiga_protected_update_data_set[data_config].data_config->manifest_length,
+            &ut_stream
+        );
+        assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+        while (OPTIGA_LIB_BUSY == optiga_lib_status) {
+        };
+        /* This is a dummy PAL, no chip exists */
+        // assert(OPTIGA_LIB_SUCCESS == optiga_lib_status);
+    }
+
+    // The stream buffer must hold a complete fragment
+    ut_stream.buffer_length = OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE - 1;
+    ut_stream.length = OPTIGA_PROTECTED_UPDATE_FRAGMENT_SIZE;
+    ut_return_status = optiga_util_protected_update_stream(
+        ut_optiga_util_instance,
+        optiga_protected_update_data_set[0].data_config->manifest_version,
+        optiga_protected_update_data_set[0].data_config->manifest_data,
+        optiga_protected_update_data_set[0].data_config->manifest_length,
+        &ut_stream
+    );
+    assert(OPTIGA_UTIL_ERROR_INVALID_INPUT == ut_return_status);
+
+    ut_return_status = optiga_util_destroy(ut_optiga_util_instance);
+    assert(OPTIGA_LIB_SUCCESS == ut_return_status);
+}
+#endif  // OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+
 int main(int argc, char **argv) {
     /* to remove warning for unused parameter */
     (void)(argc);
@@ -636,6 +1162,63 @@ int main(int argc, char **argv) {
     */
     ut_optiga_util_open_close_fct();
 
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    /*
+    optiga_util_power_manager_start, optiga_util_power_manager_stop,
+    optiga_util_power_manager_get_stats Unit tests covered.
+    */
+    ut_optiga_util_power_manager_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_SLOT_MANAGER_ENABLED
+    /*
+    optiga_util_slot_manager_start, optiga_util_slot_manager_stop, optiga_util_slot_allocate,
+    optiga_util_slot_free, optiga_util_slot_get_info, optiga_util_slot_manager_sync Unit tests covered.
+    */
+    ut_optiga_util_slot_manager_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+    /*
+    optiga_util_read_cache_enable, optiga_util_read_cache_set_ttl, optiga_util_read_cache_set_read_ahead,
+    optiga_util_read_cache_flush, optiga_util_read_cache_get_stats Unit tests covered.
+    */
+    ut_optiga_util_read_cache_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_METADATA_STORE_ENABLED
+    /*
+    optiga_util_metadata_store_start, optiga_util_metadata_store_stop, optiga_util_metadata_get,
+    optiga_util_metadata_find Unit tests covered.
+    */
+    ut_optiga_util_metadata_store_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_WRITE_BEHIND_ENABLED
+    /*
+    optiga_util_write_behind_start, optiga_util_write_behind_stop, optiga_util_write_behind_barrier,
+    optiga_util_write_behind_get_stats and the flush after the window Unit tests covered.
+    */
+    ut_optiga_util_write_behind_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_SEC_GOVERNOR_ENABLED
+    /*
+    optiga_util_sec_governor_start, optiga_util_sec_governor_admit, optiga_util_sec_governor_release,
+    optiga_util_sec_governor_get_stats, optiga_util_sec_governor_stop Unit tests covered.
+    */
+    ut_optiga_util_sec_governor_fct();
+#endif
+
+#ifdef OPTIGA_UTIL_PERFORMANCE_PROFILE_ENABLED
+    /*
+    optiga_util_performance_profile_start, optiga_util_performance_profile_set,
+    optiga_util_performance_profile_get_state, optiga_util_performance_profile_get_benchmark,
+    optiga_util_performance_profile_stop Unit tests covered.
+    */
+    ut_optiga_util_performance_profile_fct();
+#endif
+
     /*
     optiga_util_read_data, optiga_util_read_metadata Unit tests covered.
     */
@@ -650,4 +1233,11 @@ int main(int argc, char **argv) {
     optiga_util_protected_update_start, optiga_util_protected_update_continue, optiga_util_protected_update_final Unit tests covered.
     */
     ut_optiga_util_protected_update_fct();
+
+#ifdef OPTIGA_UTIL_PROTECTED_UPDATE_STREAM_ENABLED
+    /*
+    optiga_util_protected_update_stream, optiga_util_protected_update_stream_resume Unit tests covered.
+    */
+    ut_optiga_util_protected_update_stream_fct();
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_util_power_manager_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA util power manager integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_util_power_manager_integration_test.h"
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_IDLE_TIMEOUT_MS (200U)
+#define UT_DATA_OBJECT_OID (0xE0E0)
+
+static const uint8_t ut_data_object[] = {0x11, 0x22, 0x33, 0x44};
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+
+static void ut_optiga_util_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+/*
+ * Responds to GetDataObject of the test data object
+ */
+static void ut_apdu_handler(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+) {
+    uint16_t oid = 0;
+
+    (void)p_ctx;
+    if (apdu_length >= 6) {
+        optiga_common_get_uint16(&p_apdu[4], &oid);
+    }
+    if ((0x01 == (p_apdu[0] & 0x7F)) && (UT_DATA_OBJECT_OID == oid)) {
+        optiga_common_set_uint16(&p_response[2], sizeof(ut_data_object));
+        memcpy(&p_response[4], ut_data_object, sizeof(ut_data_object));
+        *p_response_length = 4 + sizeof(ut_data_object);
+    }
+}
+
+static void ut_wait_for_completion(void) {
+    uint32_t ut_waited_ms = 0;
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(OPTIGA_LIB_BUSY != ut_optiga_lib_status);
+}
+
+static void ut_wait_for_hibernation(const optiga_util_t *p_power_instance, uint32_t count) {
+    optiga_util_power_stats_t ut_power_stats = {0};
+    uint32_t ut_waited_ms = 0;
+
+    do {
+        pal_os_timer_delay_in_milliseconds(1);
+        assert(OPTIGA_LIB_SUCCESS
+               == optiga_util_power_manager_get_stats(p_power_instance, &ut_power_stats));
+    } while ((count != ut_power_stats.hibernate_count) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS));
+    assert(count == ut_power_stats.hibernate_count);
+    assert(0 == ut_power_stats.hibernate_failure_count);
+}
+
+static uint32_t ut_find_apdu(uint8_t cmd, uint8_t param) {
+    uint32_t index;
+
+    for (index = 0; index < ut_emulator.apdu_count; index++) {
+        if ((cmd == ut_emulator.apdu_log[index].cmd)
+            && (param == ut_emulator.apdu_log[index].param)) {
+            break;
+        }
+    }
+    return (index);
+}
+
+void ut_optiga_util_power_manager_hibernate_restore_fct() {
+    optiga_util_t *ut_optiga_util_power_instance = NULL;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_util_power_config_t ut_power_config = {
+        UT_IDLE_TIMEOUT_MS,
+        0,
+        OPTIGA_UTIL_POWER_POLICY_MIN_POWER
+    };
+    optiga_util_power_stats_t ut_power_stats;
+    uint8_t ut_read_buffer[16];
+    uint16_t ut_read_length = sizeof(ut_read_buffer);
+    uint32_t ut_start_time;
+    uint32_t ut_apdu_count;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_util_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    ut_optiga_util_power_instance = optiga_util_create(0, ut_optiga_util_callback, NULL);
+    assert(ut_optiga_util_power_instance != NULL);
+
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(ut_optiga_util_instance, FALSE));
+    ut_wait_for_completion();
+    assert(OPTIGA_LIB_SUCCESS == ut_optiga_lib_status);
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_OPEN == ut_emulator.application_state);
+
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_power_manager_start(ut_optiga_util_power_instance, &ut_power_config)
+    );
+
+    // Not hibernated before the idle timeout
+    ut_start_time = pal_os_timer_get_time_in_milliseconds();
+    pal_os_timer_delay_in_milliseconds(UT_IDLE_TIMEOUT_MS / 4);
+    if ((pal_os_timer_get_time_in_milliseconds() - ut_start_time) < UT_IDLE_TIMEOUT_MS) {
+        assert(0 == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, 0x71, 0x01));
+    }
+
+    // Hibernated with CloseApplication after the idle timeout
+    ut_wait_for_hibernation(ut_optiga_util_power_instance, 1);
+    assert(
+        OPTIGA_CMD_POWER_STATE_HIBERNATED
+        == optiga_cmd_get_power_state(ut_optiga_util_power_instance->my_cmd)
+    );
+    assert(IFX_I2C_SLAVE_EMULATOR_APP_HIBERNATED == ut_emulator.application_state);
+    assert(1 == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, 0x71, 0x01));
+    assert(OPTIGA_LIB_INSTANCE_FREE == ut_optiga_util_power_instance->instance_state);
+
+    // The next command restores the application transparently, before it is sent
+    ut_apdu_count = ut_emulator.apdu_count;
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_read_data(
+            ut_optiga_util_instance,
+            UT_DATA_OBJECT_OID,
+            0,
+            ut_read_buffer,
+            &ut_read_length
+        )
+    );
+    ut_wait_for_completion();
+    assert(OPTIGA_LIB_SUCCESS == ut_optiga_lib_status);
+    assert(sizeof(ut_data_object) == ut_read_length);
+    assert(0 == memcmp(ut_read_buffer, ut_data_object, sizeof(ut_data_object)));
+    assert(ut_apdu_count == ut_find_apdu(0x70, 0x01));
+    assert(0x01 == ut_emulator.apdu_log[ut_apdu_count + 1].cmd);
+
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_power_manager_get_stats(ut_optiga_util_power_instance, &ut_power_stats)
+    );
+    assert(1 == ut_power_stats.restore_count);
+    assert(0 == ut_power_stats.restore_failure_count);
+    assert(ut_power_stats.last_resume_latency_us == ut_power_stats.max_resume_latency_us);
+
+    // Idle again after the restore
+    ut_wait_for_hibernation(ut_optiga_util_power_instance, 2);
+    assert(2 == ifx_i2c_slave_emulator_count_apdu(&ut_emulator, 0x71, 0x01));
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_power_manager_stop(ut_optiga_util_power_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_power_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_UTIL_POWER_MANAGER_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef OPTIGA_UTIL_POWER_MANAGER_ENABLED
+    /*
+    Hibernation after the idle timeout and transparent restore by the next command covered.
+    */
+    ut_optiga_util_power_manager_hibernate_restore_fct();
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
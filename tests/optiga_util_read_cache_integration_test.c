@@ -0,0 +1,210 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file optiga_util_read_cache_integration_test.c
+ *
+ * \brief   This file implements the OPTIGA util read cache integration tests against the emulated OPTIGA.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "optiga_util_read_cache_integration_test.h"
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+#define UT_WAIT_TIMEOUT_MS (5000U)
+#define UT_DATA_OBJECT_OID (0xF1D0)
+#define UT_LCSG_OID (0xE0C0)
+#define UT_GET_DATA_OBJECT_CMD (0x01)
+#define UT_SET_DATA_OBJECT_CMD (0x02)
+#define UT_SET_DATA_OBJECT_HEADER_SIZE (8U)
+
+static volatile optiga_lib_status_t ut_optiga_lib_status;
+static ifx_i2c_slave_emulator_t ut_emulator;
+static uint8_t ut_data_object[4] = {0x11, 0x22, 0x33, 0x44};
+static uint32_t ut_data_object_read_count;
+
+static void ut_optiga_lib_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    ut_optiga_lib_status = return_status;
+}
+
+/*
+ * Responds to GetDataObject of the test data object and stores the data written to it
+ */
+static void ut_apdu_handler(
+    void *p_ctx,
+    const uint8_t *p_apdu,
+    uint16_t apdu_length,
+    uint8_t *p_response,
+    uint16_t *p_response_length
+) {
+    uint16_t oid = 0;
+
+    (void)p_ctx;
+    if (apdu_length >= 6) {
+        optiga_common_get_uint16(&p_apdu[4], &oid);
+    }
+    if ((UT_GET_DATA_OBJECT_CMD == (p_apdu[0] & 0x7F)) && (UT_DATA_OBJECT_OID == oid)) {
+        ut_data_object_read_count++;
+        optiga_common_set_uint16(&p_response[2], sizeof(ut_data_object));
+        memcpy(&p_response[4], ut_data_object, sizeof(ut_data_object));
+        *p_response_length = 4 + sizeof(ut_data_object);
+    } else if ((UT_SET_DATA_OBJECT_CMD == (p_apdu[0] & 0x7F)) && (UT_DATA_OBJECT_OID == oid)
+               && ((UT_SET_DATA_OBJECT_HEADER_SIZE + sizeof(ut_data_object)) == apdu_length)) {
+        memcpy(ut_data_object, &p_apdu[UT_SET_DATA_OBJECT_HEADER_SIZE], sizeof(ut_data_object));
+    }
+}
+
+static void ut_wait_for_completion(void) {
+    uint32_t ut_waited_ms = 0;
+
+    while ((OPTIGA_LIB_BUSY == ut_optiga_lib_status) && (ut_waited_ms++ < UT_WAIT_TIMEOUT_MS)) {
+        pal_os_timer_delay_in_milliseconds(1);
+    }
+    assert(OPTIGA_LIB_SUCCESS == ut_optiga_lib_status);
+}
+
+static void ut_open_close_application(optiga_util_t *p_instance, bool_t is_open) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    if (TRUE == is_open) {
+        assert(OPTIGA_LIB_SUCCESS == optiga_util_open_application(p_instance, FALSE));
+    } else {
+        assert(OPTIGA_LIB_SUCCESS == optiga_util_close_application(p_instance, FALSE));
+    }
+    ut_wait_for_completion();
+}
+
+/*
+ * Reads the test data object, returns the number of reads of the data object sent to OPTIGA
+ */
+static uint32_t ut_read_data(optiga_util_t *p_instance, const uint8_t *p_expected_data) {
+    uint8_t ut_read_buffer[sizeof(ut_data_object)];
+    uint16_t ut_read_length = sizeof(ut_read_buffer);
+    uint32_t ut_read_count = ut_data_object_read_count;
+
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_read_data(p_instance, UT_DATA_OBJECT_OID, 0, ut_read_buffer, &ut_read_length)
+    );
+    ut_wait_for_completion();
+    assert(sizeof(ut_data_object) == ut_read_length);
+    assert(0 == memcmp(ut_read_buffer, p_expected_data, sizeof(ut_data_object)));
+    return (ut_data_object_read_count - ut_read_count);
+}
+
+static void ut_write_data(optiga_util_t *p_instance, uint16_t oid, const uint8_t *p_data) {
+    ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_util_write_data(
+            p_instance,
+            oid,
+            OPTIGA_UTIL_ERASE_AND_WRITE,
+            0,
+            p_data,
+            sizeof(ut_data_object)
+        )
+    );
+    ut_wait_for_completion();
+}
+
+static uint32_t ut_get_invalidation_count(void) {
+    optiga_util_read_cache_stats_t ut_read_cache_stats;
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_read_cache_get_stats(&ut_read_cache_stats));
+    return (ut_read_cache_stats.invalidation_count);
+}
+
+void ut_optiga_util_read_cache_invalidate_fct() {
+    static const uint8_t ut_written_data[] = {0x55, 0x66, 0x77, 0x88};
+    static const uint8_t ut_initial_data[] = {0x11, 0x22, 0x33, 0x44};
+    optiga_util_read_cache_stats_t ut_read_cache_stats;
+    optiga_util_t *ut_optiga_util_instance = NULL;
+    optiga_util_t *ut_optiga_util_writer = NULL;
+
+    ifx_i2c_slave_emulator_attach(&ut_emulator, ut_apdu_handler, NULL);
+
+    ut_optiga_util_instance = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_instance != NULL);
+    ut_optiga_util_writer = optiga_util_create(0, ut_optiga_lib_callback, NULL);
+    assert(ut_optiga_util_writer != NULL);
+    ut_open_close_application(ut_optiga_util_instance, TRUE);
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_read_cache_enable(ut_optiga_util_instance, TRUE));
+
+    // The second read is served from the cache
+    assert(1 == ut_read_data(ut_optiga_util_instance, ut_initial_data));
+    assert(0 == ut_read_data(ut_optiga_util_instance, ut_initial_data));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_read_cache_get_stats(&ut_read_cache_stats));
+    assert(1 == ut_read_cache_stats.hit_count);
+    assert(1 == ut_read_cache_stats.miss_count);
+
+    // A write with another instance discards the entry, the written data is read from OPTIGA
+    ut_write_data(ut_optiga_util_writer, UT_DATA_OBJECT_OID, ut_written_data);
+    assert(1 == ut_get_invalidation_count());
+    assert(1 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+    assert(0 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+
+    // Writing the global lifecycle state discards all entries
+    ut_write_data(ut_optiga_util_writer, UT_LCSG_OID, ut_written_data);
+    assert(2 == ut_get_invalidation_count());
+    assert(1 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+
+    // Closing and opening the application discards all entries
+    ut_open_close_application(ut_optiga_util_writer, FALSE);
+    assert(3 == ut_get_invalidation_count());
+    ut_open_close_application(ut_optiga_util_writer, TRUE);
+    assert(1 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+    ut_open_close_application(ut_optiga_util_writer, TRUE);
+    assert(4 == ut_get_invalidation_count());
+    assert(1 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+
+#ifdef OPTIGA_CRYPT_CLEAR_AUTO_STATE_ENABLED
+    {
+        optiga_crypt_t *ut_optiga_crypt_instance = NULL;
+
+        // Clearing the auto state discards all entries
+        ut_optiga_crypt_instance = optiga_crypt_create(0, ut_optiga_lib_callback, NULL);
+        assert(ut_optiga_crypt_instance != NULL);
+        ut_optiga_lib_status = OPTIGA_LIB_BUSY;
+        assert(
+            OPTIGA_LIB_SUCCESS
+            == optiga_crypt_clear_auto_state(ut_optiga_crypt_instance, UT_DATA_OBJECT_OID)
+        );
+        ut_wait_for_completion();
+        assert(5 == ut_get_invalidation_count());
+        assert(1 == ut_read_data(ut_optiga_util_instance, ut_written_data));
+        assert(OPTIGA_LIB_SUCCESS == optiga_crypt_destroy(ut_optiga_crypt_instance));
+    }
+#endif
+
+    optiga_util_read_cache_flush(OPTIGA_UTIL_READ_CACHE_ALL_OIDS);
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_read_cache_enable(ut_optiga_util_instance, FALSE));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_writer));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    ifx_i2c_slave_emulator_detach();
+}
+#endif  // OPTIGA_UTIL_READ_CACHE_ENABLED
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef OPTIGA_UTIL_READ_CACHE_ENABLED
+    /*
+    Hits and the invalidation by writes and changes of the access state covered.
+    */
+    ut_optiga_util_read_cache_invalidate_fct();
+#endif
+    return 0;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,152 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_executor_unit_test.c
+ *
+ * \brief   This file implements the PAL OS completion executor unit tests.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "pal_os_executor_unit_test.h"
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+static volatile uint32_t ut_completion_count;
+static volatile optiga_lib_status_t ut_completion_status;
+static volatile pthread_t ut_completion_thread;
+static volatile uintptr_t ut_completion_context;
+
+static void ut_pal_os_executor_callback(void *context, optiga_lib_status_t return_status) {
+    /* Numbered completions are invoked in the order they are posted */
+    if (NULL != context) {
+        assert((ut_completion_context + 1U) == (uintptr_t)context);
+        ut_completion_context = (uintptr_t)context;
+    }
+    ut_completion_status = return_status;
+    ut_completion_thread = pthread_self();
+    ut_completion_count++;
+}
+#endif
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef PAL_OS_EXECUTOR_ENABLED
+    pal_os_executor_stats_t ut_stats;
+    struct pollfd ut_poll_fd;
+    int ut_poll_result;
+    uint32_t ut_index;
+    uint8_t ut_random_data[32];
+    optiga_crypt_t *ut_optiga_crypt_instance;
+
+    /* Invalid inputs and executor not running */
+    assert(PAL_STATUS_INVALID_INPUT == pal_os_executor_get_stats(NULL));
+    assert(PAL_STATUS_INVALID_INPUT == pal_os_executor_start(PAL_OS_EXECUTOR_MAX_WORKERS + 1));
+    assert(PAL_STATUS_FAILURE == pal_os_executor_stop());
+    assert(-1 == pal_os_executor_get_fd());
+    assert(
+        PAL_STATUS_FAILURE
+        == pal_os_executor_post(ut_pal_os_executor_callback, NULL, OPTIGA_LIB_SUCCESS)
+    );
+
+    /* Completions are invoked by the caller, signalled through the descriptor */
+    assert(PAL_STATUS_SUCCESS == pal_os_executor_start(0));
+    assert(PAL_STATUS_FAILURE == pal_os_executor_start(0));
+    ut_poll_fd.fd = pal_os_executor_get_fd();
+    ut_poll_fd.events = POLLIN;
+    assert(-1 != ut_poll_fd.fd);
+    assert(0 == poll(&ut_poll_fd, 1, 0));
+    for (ut_index = 0; ut_index < PAL_OS_EXECUTOR_QUEUE_LENGTH; ut_index++) {
+        assert(
+            PAL_STATUS_SUCCESS
+            == pal_os_executor_post(
+                ut_pal_os_executor_callback,
+                (void *)(uintptr_t)(ut_index + 1U),
+                OPTIGA_LIB_SUCCESS
+            )
+        );
+    }
+    assert(0 == ut_completion_count);
+    assert(1 == poll(&ut_poll_fd, 1, 0));
+    /* Queue is full, the queued completions are invoked before the caller invokes its handler */
+    assert(
+        PAL_STATUS_FAILURE
+        == pal_os_executor_post(
+            ut_pal_os_executor_callback,
+            (void *)(uintptr_t)(PAL_OS_EXECUTOR_QUEUE_LENGTH + 1U),
+            OPTIGA_LIB_SUCCESS
+        )
+    );
+    assert(PAL_OS_EXECUTOR_QUEUE_LENGTH == ut_completion_count);
+    assert(PAL_OS_EXECUTOR_QUEUE_LENGTH == ut_completion_context);
+    ut_pal_os_executor_callback(
+        (void *)(uintptr_t)(PAL_OS_EXECUTOR_QUEUE_LENGTH + 1U),
+        OPTIGA_LIB_SUCCESS
+    );
+    assert(0 == pal_os_executor_run());
+    assert(0 == poll(&ut_poll_fd, 1, 0));
+
+    /* Completions posted after the overflow are queued again */
+    ut_completion_count = 0;
+    for (ut_index = 0; ut_index < 2U; ut_index++) {
+        assert(
+            PAL_STATUS_SUCCESS
+            == pal_os_executor_post(ut_pal_os_executor_callback, NULL, OPTIGA_LIB_SUCCESS)
+        );
+    }
+    assert(2 == pal_os_executor_run());
+    assert(2 == ut_completion_count);
+
+    /* Completion of a crypt instance is queued instead of invoked by the timer thread */
+    ut_completion_count = 0;
+    ut_optiga_crypt_instance = optiga_crypt_create(0, ut_pal_os_executor_callback, NULL);
+    assert(NULL != ut_optiga_crypt_instance);
+    assert(
+        OPTIGA_LIB_SUCCESS
+        == optiga_crypt_random(
+            ut_optiga_crypt_instance,
+            OPTIGA_RNG_TYPE_TRNG,
+            ut_random_data,
+            sizeof(ut_random_data)
+        )
+    );
+    /* The timer signal of the test PAL interrupts the poll */
+    do {
+        ut_poll_result = poll(&ut_poll_fd, 1, 5000);
+    } while ((-1 == ut_poll_result) && (EINTR == errno));
+    assert(1 == ut_poll_result);
+    assert(0 == ut_completion_count);
+    assert(1 == pal_os_executor_run());
+    assert(1 == ut_completion_count);
+    assert(pthread_equal(pthread_self(), ut_completion_thread));
+    assert(PAL_STATUS_SUCCESS == pal_os_executor_stop());
+
+    /* Completions are invoked by the workers, the remaining ones by the stop */
+    ut_completion_count = 0;
+    assert(PAL_STATUS_SUCCESS == pal_os_executor_start(2));
+    assert(-1 == pal_os_executor_get_fd());
+    for (ut_index = 0; ut_index < 8; ut_index++) {
+        assert(
+            PAL_STATUS_SUCCESS
+            == pal_os_executor_post(ut_pal_os_executor_callback, NULL, OPTIGA_LIB_SUCCESS)
+        );
+    }
+    assert(PAL_STATUS_SUCCESS == pal_os_executor_stop());
+    assert(8 == ut_completion_count);
+
+    assert(PAL_STATUS_SUCCESS == pal_os_executor_get_stats(&ut_stats));
+    assert((PAL_OS_EXECUTOR_QUEUE_LENGTH + 2 + 1 + 8) == ut_stats.posted_count);
+    assert(ut_stats.posted_count == ut_stats.executed_count);
+    assert(1 == ut_stats.overflow_count);
+    assert(PAL_OS_EXECUTOR_QUEUE_LENGTH == ut_stats.max_queue_depth);
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_destroy(ut_optiga_crypt_instance));
+#endif
+}
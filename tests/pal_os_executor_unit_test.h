@@ -0,0 +1,29 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_executor_unit_test.h
+ *
+ * \brief   This file defines APIs, types and data structures used in the PAL OS completion executor unit tests.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#ifndef PAL_OS_EXECUTOR_UNIT_TEST
+#define PAL_OS_EXECUTOR_UNIT_TEST
+
+#include <assert.h>
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "optiga_crypt.h"
+#include "pal_os_executor.h"
+
+#endif  // PAL_OS_EXECUTOR_UNIT_TEST
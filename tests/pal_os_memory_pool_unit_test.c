@@ -0,0 +1,123 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_memory_pool_unit_test.c
+ *
+ * \brief   This file implements the PAL OS memory pool unit tests.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#include "pal_os_memory_pool_unit_test.h"
+
+// lint --e{818} suppress "argument "context" is not used in the test"
+static void ut_pal_os_memory_pool_callback(void *context, optiga_lib_status_t return_status) {
+    (void)context;
+    (void)return_status;
+}
+
+int main(int argc, char **argv) {
+    /* to remove warning for unused parameter */
+    (void)(argc);
+    (void)(argv);
+
+#ifdef PAL_OS_MEMORY_POOL_ENABLED
+    pal_os_memory_pool_stats_t ut_stats;
+    uint8_t *ut_blocks[PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS + 1];
+    uint8_t *ut_large_block;
+    uint8_t ut_index;
+    uint16_t ut_blocks_in_use;
+    optiga_util_t *ut_optiga_util_instance;
+    optiga_crypt_t *ut_optiga_crypt_instance;
+
+    /* Invalid inputs */
+    assert(PAL_STATUS_INVALID_INPUT == pal_os_memory_pool_get_stats(0, NULL));
+    assert(
+        PAL_STATUS_INVALID_INPUT
+        == pal_os_memory_pool_get_stats(PAL_OS_MEMORY_POOL_CLASS_COUNT, &ut_stats)
+    );
+
+    /* Instance sizes fit into the configured size classes */
+    assert(sizeof(optiga_util_t) <= PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE);
+    assert(sizeof(optiga_crypt_t) <= PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE);
+
+    /* Blocks are zeroed by calloc and released to the pool */
+    for (ut_index = 0; ut_index < PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS; ut_index++) {
+        ut_blocks[ut_index] = (uint8_t *)pal_os_calloc(1, PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE);
+        assert(NULL != ut_blocks[ut_index]);
+        assert(0 == ut_blocks[ut_index][PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE - 1]);
+        ut_blocks[ut_index][PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE - 1] = 0xA5;
+    }
+    assert(
+        PAL_STATUS_SUCCESS
+        == pal_os_memory_pool_get_stats(PAL_OS_MEMORY_POOL_CLASS_SMALL, &ut_stats)
+    );
+    assert(PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS == ut_stats.blocks_in_use);
+    assert(PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS == ut_stats.high_water_mark);
+
+    /* Exhausted class spills into the next larger class */
+    ut_blocks[PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS] =
+        (uint8_t *)pal_os_malloc(PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE);
+    assert(NULL != ut_blocks[PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS]);
+    assert(
+        PAL_STATUS_SUCCESS
+        == pal_os_memory_pool_get_stats(PAL_OS_MEMORY_POOL_CLASS_MEDIUM, &ut_stats)
+    );
+    assert(1 == ut_stats.blocks_in_use);
+
+    for (ut_index = 0; ut_index <= PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS; ut_index++) {
+        pal_os_free(ut_blocks[ut_index]);
+    }
+    assert(
+        PAL_STATUS_SUCCESS
+        == pal_os_memory_pool_get_stats(PAL_OS_MEMORY_POOL_CLASS_SMALL, &ut_stats)
+    );
+    assert(0 == ut_stats.blocks_in_use);
+    assert(PAL_OS_MEMORY_POOL_BLOCKS_PER_CLASS == ut_stats.high_water_mark);
+
+    /* Recycled block is zeroed again */
+    ut_blocks[0] = (uint8_t *)pal_os_calloc(1, PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE);
+    assert(0 == ut_blocks[0][PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE - 1]);
+    pal_os_free(ut_blocks[0]);
+
+    /* Classes are picked by size: one byte above the small class lands in the medium class */
+    ut_blocks[0] = (uint8_t *)pal_os_malloc(PAL_OS_MEMORY_POOL_SMALL_BLOCK_SIZE + 1);
+    assert(
+        PAL_STATUS_SUCCESS
+        == pal_os_memory_pool_get_stats(PAL_OS_MEMORY_POOL_CLASS_MEDIUM, &ut_stats)
+    );
+    assert(1 == ut_stats.blocks_in_use);
+    assert(PAL_OS_MEMORY_POOL_MEDIUM_BLOCK_SIZE == ut_stats.block_size);
+    pal_os_free(ut_blocks[0]);
+
+    /* Requests larger than the largest class are served by the heap */
+    ut_large_block = (uint8_t *)pal_os_malloc(PAL_OS_MEMORY_POOL_LARGE_BLOCK_SIZE + 1);
+    assert(NULL != ut_large_block);
+    assert(FALSE == pal_os_memory_pool_free(ut_large_block));
+    pal_os_free(ut_large_block);
+
+    /* Instances (util, crypt and their command instances) are allocated from the pool */
+    ut_optiga_util_instance = optiga_util_create(0, ut_pal_os_memory_pool_callback, NULL);
+    assert(NULL != ut_optiga_util_instance);
+    ut_optiga_crypt_instance = optiga_crypt_create(0, ut_pal_os_memory_pool_callback, NULL);
+    assert(NULL != ut_optiga_crypt_instance);
+    ut_blocks_in_use = 0;
+    for (ut_index = 0; ut_index < PAL_OS_MEMORY_POOL_CLASS_COUNT; ut_index++) {
+        assert(PAL_STATUS_SUCCESS == pal_os_memory_pool_get_stats(ut_index, &ut_stats));
+        ut_blocks_in_use += ut_stats.blocks_in_use;
+    }
+    assert(4 == ut_blocks_in_use);
+
+    assert(OPTIGA_LIB_SUCCESS == optiga_crypt_destroy(ut_optiga_crypt_instance));
+    assert(OPTIGA_LIB_SUCCESS == optiga_util_destroy(ut_optiga_util_instance));
+    for (ut_index = 0; ut_index < PAL_OS_MEMORY_POOL_CLASS_COUNT; ut_index++) {
+        assert(PAL_STATUS_SUCCESS == pal_os_memory_pool_get_stats(ut_index, &ut_stats));
+        assert(0 == ut_stats.blocks_in_use);
+    }
+#endif
+}
@@ -0,0 +1,27 @@
+/**
+ * SPDX-FileCopyrightText: 2026 Infineon Technologies AG
+ * SPDX-License-Identifier: MIT
+ *
+ * \author Infineon Technologies AG
+ *
+ * \file pal_os_memory_pool_unit_test.h
+ *
+ * \brief   This file defines APIs, types and data structures used in the PAL OS memory pool unit tests.
+ *
+ * \ingroup  grTests
+ *
+ * @{
+ */
+
+#ifndef PAL_OS_MEMORY_POOL_UNIT_TEST
+#define PAL_OS_MEMORY_POOL_UNIT_TEST
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "optiga_crypt.h"
+#include "optiga_util.h"
+#include "pal_os_memory.h"
+
+#endif  // PAL_OS_MEMORY_POOL_UNIT_TEST